@@ -0,0 +1,122 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/raptor2.h.in"
+  "/root/repo/src/raptor_config_cmake.h.in"
+  "/root/repo/tests/binary/CMakeLists.txt"
+  "/root/repo/tests/feeds/CMakeLists.txt"
+  "/root/repo/tests/grddl/CMakeLists.txt"
+  "/root/repo/tests/json/CMakeLists.txt"
+  "/root/repo/tests/ntriples/CMakeLists.txt"
+  "/root/repo/tests/rdfa/CMakeLists.txt"
+  "/root/repo/tests/rdfa11/CMakeLists.txt"
+  "/root/repo/tests/rdfxml/CMakeLists.txt"
+  "/root/repo/tests/trig/CMakeLists.txt"
+  "/root/repo/utils/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckStructHasMember.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBISON.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCURL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCygwin.cmake"
+  "/usr/share/cmake-3.25/Modules/FindFLEX.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibXml2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibXslt.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMsys.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPerl.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "src/raptor_config.h"
+  "src/raptor2.h"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/binary/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/feeds/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/grddl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/json/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/ntriples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rdfa/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rdfa11/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rdfxml/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/trig/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/CMakeFiles/turtle_tables_tgt.dir/DependInfo.cmake"
+  "src/CMakeFiles/turtle_parser_tgt.dir/DependInfo.cmake"
+  "src/CMakeFiles/turtle_flex_tgt.dir/DependInfo.cmake"
+  "src/CMakeFiles/turtle_lexer_tgt.dir/DependInfo.cmake"
+  "src/CMakeFiles/parsedate_tables_tgt.dir/DependInfo.cmake"
+  "src/CMakeFiles/parsedate_tgt.dir/DependInfo.cmake"
+  "src/CMakeFiles/raptor2.dir/DependInfo.cmake"
+  "src/CMakeFiles/turtle_lexer_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/turtle_parser_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/raptor_parse_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/raptor_rfc2396_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/raptor_uri_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/raptor_namespace_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/strcasecmp_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/raptor_www_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/raptor_sequence_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/raptor_stringbuffer_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/raptor_iostream_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/raptor_xml_writer_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/raptor_turtle_writer_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/raptor_avltree_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/raptor_term_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/raptor_permute_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/raptor_snprintf_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/raptor_sort_r_test.dir/DependInfo.cmake"
+  "utils/CMakeFiles/rapper.dir/DependInfo.cmake"
+  "utils/CMakeFiles/rdfdiff.dir/DependInfo.cmake"
+  "utils/CMakeFiles/raptor_bench.dir/DependInfo.cmake"
+  )
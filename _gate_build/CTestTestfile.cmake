@@ -0,0 +1,17 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_gate_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("src")
+subdirs("utils")
+subdirs("tests/binary")
+subdirs("tests/feeds")
+subdirs("tests/grddl")
+subdirs("tests/json")
+subdirs("tests/ntriples")
+subdirs("tests/rdfa")
+subdirs("tests/rdfa11")
+subdirs("tests/rdfxml")
+subdirs("tests/trig")
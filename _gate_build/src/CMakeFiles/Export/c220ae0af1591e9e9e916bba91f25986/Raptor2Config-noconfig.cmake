@@ -0,0 +1,20 @@
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "raptor2" for configuration ""
+set_property(TARGET raptor2 APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(raptor2 PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "C"
+  IMPORTED_LINK_INTERFACE_LIBRARIES_NOCONFIG "/usr/lib/x86_64-linux-gnu/libxml2.so;/usr/lib/x86_64-linux-gnu/libz.so"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libraptor2.a"
+  )
+
+list(APPEND _cmake_import_check_targets raptor2 )
+list(APPEND _cmake_import_check_files_for_raptor2 "${_IMPORT_PREFIX}/lib/libraptor2.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parsedate_tables_tgt"
+  "parsedate.tab.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/parsedate_tables_tgt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
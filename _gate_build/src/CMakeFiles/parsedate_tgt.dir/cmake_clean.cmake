@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parsedate_tgt"
+  "parsedate.c"
+  "parsedate.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/parsedate_tgt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
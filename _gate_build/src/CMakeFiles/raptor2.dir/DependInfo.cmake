@@ -0,0 +1,80 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/librdfa/context.c" "src/CMakeFiles/raptor2.dir/__/librdfa/context.c.o" "gcc" "src/CMakeFiles/raptor2.dir/__/librdfa/context.c.o.d"
+  "/root/repo/librdfa/curie.c" "src/CMakeFiles/raptor2.dir/__/librdfa/curie.c.o" "gcc" "src/CMakeFiles/raptor2.dir/__/librdfa/curie.c.o.d"
+  "/root/repo/librdfa/iri.c" "src/CMakeFiles/raptor2.dir/__/librdfa/iri.c.o" "gcc" "src/CMakeFiles/raptor2.dir/__/librdfa/iri.c.o.d"
+  "/root/repo/librdfa/language.c" "src/CMakeFiles/raptor2.dir/__/librdfa/language.c.o" "gcc" "src/CMakeFiles/raptor2.dir/__/librdfa/language.c.o.d"
+  "/root/repo/librdfa/lists.c" "src/CMakeFiles/raptor2.dir/__/librdfa/lists.c.o" "gcc" "src/CMakeFiles/raptor2.dir/__/librdfa/lists.c.o.d"
+  "/root/repo/librdfa/namespace.c" "src/CMakeFiles/raptor2.dir/__/librdfa/namespace.c.o" "gcc" "src/CMakeFiles/raptor2.dir/__/librdfa/namespace.c.o.d"
+  "/root/repo/librdfa/rdfa.c" "src/CMakeFiles/raptor2.dir/__/librdfa/rdfa.c.o" "gcc" "src/CMakeFiles/raptor2.dir/__/librdfa/rdfa.c.o.d"
+  "/root/repo/librdfa/rdfa_utils.c" "src/CMakeFiles/raptor2.dir/__/librdfa/rdfa_utils.c.o" "gcc" "src/CMakeFiles/raptor2.dir/__/librdfa/rdfa_utils.c.o.d"
+  "/root/repo/librdfa/strtok_r.c" "src/CMakeFiles/raptor2.dir/__/librdfa/strtok_r.c.o" "gcc" "src/CMakeFiles/raptor2.dir/__/librdfa/strtok_r.c.o.d"
+  "/root/repo/librdfa/subject.c" "src/CMakeFiles/raptor2.dir/__/librdfa/subject.c.o" "gcc" "src/CMakeFiles/raptor2.dir/__/librdfa/subject.c.o.d"
+  "/root/repo/librdfa/triple.c" "src/CMakeFiles/raptor2.dir/__/librdfa/triple.c.o" "gcc" "src/CMakeFiles/raptor2.dir/__/librdfa/triple.c.o.d"
+  "/root/repo/src/ntriples_parse.c" "src/CMakeFiles/raptor2.dir/ntriples_parse.c.o" "gcc" "src/CMakeFiles/raptor2.dir/ntriples_parse.c.o.d"
+  "/root/repo/_gate_build/src/parsedate.c" "src/CMakeFiles/raptor2.dir/parsedate.c.o" "gcc" "src/CMakeFiles/raptor2.dir/parsedate.c.o.d"
+  "/root/repo/src/raptor_abbrev.c" "src/CMakeFiles/raptor2.dir/raptor_abbrev.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_abbrev.c.o.d"
+  "/root/repo/src/raptor_avltree.c" "src/CMakeFiles/raptor2.dir/raptor_avltree.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_avltree.c.o.d"
+  "/root/repo/src/raptor_binary.c" "src/CMakeFiles/raptor2.dir/raptor_binary.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_binary.c.o.d"
+  "/root/repo/src/raptor_concepts.c" "src/CMakeFiles/raptor2.dir/raptor_concepts.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_concepts.c.o.d"
+  "/root/repo/src/raptor_convert.c" "src/CMakeFiles/raptor2.dir/raptor_convert.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_convert.c.o.d"
+  "/root/repo/src/raptor_escaped.c" "src/CMakeFiles/raptor2.dir/raptor_escaped.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_escaped.c.o.d"
+  "/root/repo/src/raptor_general.c" "src/CMakeFiles/raptor2.dir/raptor_general.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_general.c.o.d"
+  "/root/repo/src/raptor_guess.c" "src/CMakeFiles/raptor2.dir/raptor_guess.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_guess.c.o.d"
+  "/root/repo/src/raptor_iostream.c" "src/CMakeFiles/raptor2.dir/raptor_iostream.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_iostream.c.o.d"
+  "/root/repo/src/raptor_json_writer.c" "src/CMakeFiles/raptor2.dir/raptor_json_writer.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_json_writer.c.o.d"
+  "/root/repo/src/raptor_librdfa.c" "src/CMakeFiles/raptor2.dir/raptor_librdfa.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_librdfa.c.o.d"
+  "/root/repo/src/raptor_locator.c" "src/CMakeFiles/raptor2.dir/raptor_locator.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_locator.c.o.d"
+  "/root/repo/src/raptor_log.c" "src/CMakeFiles/raptor2.dir/raptor_log.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_log.c.o.d"
+  "/root/repo/src/raptor_memstr.c" "src/CMakeFiles/raptor2.dir/raptor_memstr.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_memstr.c.o.d"
+  "/root/repo/src/raptor_namespace.c" "src/CMakeFiles/raptor2.dir/raptor_namespace.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_namespace.c.o.d"
+  "/root/repo/src/raptor_ntriples.c" "src/CMakeFiles/raptor2.dir/raptor_ntriples.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_ntriples.c.o.d"
+  "/root/repo/src/raptor_option.c" "src/CMakeFiles/raptor2.dir/raptor_option.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_option.c.o.d"
+  "/root/repo/src/raptor_parse.c" "src/CMakeFiles/raptor2.dir/raptor_parse.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_parse.c.o.d"
+  "/root/repo/src/raptor_qname.c" "src/CMakeFiles/raptor2.dir/raptor_qname.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_qname.c.o.d"
+  "/root/repo/src/raptor_rfc2396.c" "src/CMakeFiles/raptor2.dir/raptor_rfc2396.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_rfc2396.c.o.d"
+  "/root/repo/src/raptor_rss.c" "src/CMakeFiles/raptor2.dir/raptor_rss.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_rss.c.o.d"
+  "/root/repo/src/raptor_rss_common.c" "src/CMakeFiles/raptor2.dir/raptor_rss_common.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_rss_common.c.o.d"
+  "/root/repo/src/raptor_sax2.c" "src/CMakeFiles/raptor2.dir/raptor_sax2.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_sax2.c.o.d"
+  "/root/repo/src/raptor_sequence.c" "src/CMakeFiles/raptor2.dir/raptor_sequence.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_sequence.c.o.d"
+  "/root/repo/src/raptor_serialize.c" "src/CMakeFiles/raptor2.dir/raptor_serialize.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_serialize.c.o.d"
+  "/root/repo/src/raptor_serialize_dot.c" "src/CMakeFiles/raptor2.dir/raptor_serialize_dot.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_serialize_dot.c.o.d"
+  "/root/repo/src/raptor_serialize_html.c" "src/CMakeFiles/raptor2.dir/raptor_serialize_html.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_serialize_html.c.o.d"
+  "/root/repo/src/raptor_serialize_json.c" "src/CMakeFiles/raptor2.dir/raptor_serialize_json.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_serialize_json.c.o.d"
+  "/root/repo/src/raptor_serialize_ntriples.c" "src/CMakeFiles/raptor2.dir/raptor_serialize_ntriples.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_serialize_ntriples.c.o.d"
+  "/root/repo/src/raptor_serialize_rdfxml.c" "src/CMakeFiles/raptor2.dir/raptor_serialize_rdfxml.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_serialize_rdfxml.c.o.d"
+  "/root/repo/src/raptor_serialize_rdfxmla.c" "src/CMakeFiles/raptor2.dir/raptor_serialize_rdfxmla.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_serialize_rdfxmla.c.o.d"
+  "/root/repo/src/raptor_serialize_rss.c" "src/CMakeFiles/raptor2.dir/raptor_serialize_rss.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_serialize_rss.c.o.d"
+  "/root/repo/src/raptor_serialize_turtle.c" "src/CMakeFiles/raptor2.dir/raptor_serialize_turtle.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_serialize_turtle.c.o.d"
+  "/root/repo/src/raptor_set.c" "src/CMakeFiles/raptor2.dir/raptor_set.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_set.c.o.d"
+  "/root/repo/src/raptor_statement.c" "src/CMakeFiles/raptor2.dir/raptor_statement.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_statement.c.o.d"
+  "/root/repo/src/raptor_stringbuffer.c" "src/CMakeFiles/raptor2.dir/raptor_stringbuffer.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_stringbuffer.c.o.d"
+  "/root/repo/src/raptor_syntax_description.c" "src/CMakeFiles/raptor2.dir/raptor_syntax_description.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_syntax_description.c.o.d"
+  "/root/repo/src/raptor_term.c" "src/CMakeFiles/raptor2.dir/raptor_term.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_term.c.o.d"
+  "/root/repo/src/raptor_turtle_writer.c" "src/CMakeFiles/raptor2.dir/raptor_turtle_writer.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_turtle_writer.c.o.d"
+  "/root/repo/src/raptor_unicode.c" "src/CMakeFiles/raptor2.dir/raptor_unicode.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_unicode.c.o.d"
+  "/root/repo/src/raptor_uri.c" "src/CMakeFiles/raptor2.dir/raptor_uri.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_uri.c.o.d"
+  "/root/repo/src/raptor_www.c" "src/CMakeFiles/raptor2.dir/raptor_www.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_www.c.o.d"
+  "/root/repo/src/raptor_xml.c" "src/CMakeFiles/raptor2.dir/raptor_xml.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_xml.c.o.d"
+  "/root/repo/src/raptor_xml_writer.c" "src/CMakeFiles/raptor2.dir/raptor_xml_writer.c.o" "gcc" "src/CMakeFiles/raptor2.dir/raptor_xml_writer.c.o.d"
+  "/root/repo/src/snprintf.c" "src/CMakeFiles/raptor2.dir/snprintf.c.o" "gcc" "src/CMakeFiles/raptor2.dir/snprintf.c.o.d"
+  "/root/repo/src/sort_r.c" "src/CMakeFiles/raptor2.dir/sort_r.c.o" "gcc" "src/CMakeFiles/raptor2.dir/sort_r.c.o.d"
+  "/root/repo/src/turtle_common.c" "src/CMakeFiles/raptor2.dir/turtle_common.c.o" "gcc" "src/CMakeFiles/raptor2.dir/turtle_common.c.o.d"
+  "/root/repo/_gate_build/src/turtle_lexer.c" "src/CMakeFiles/raptor2.dir/turtle_lexer.c.o" "gcc" "src/CMakeFiles/raptor2.dir/turtle_lexer.c.o.d"
+  "/root/repo/_gate_build/src/turtle_parser.c" "src/CMakeFiles/raptor2.dir/turtle_parser.c.o" "gcc" "src/CMakeFiles/raptor2.dir/turtle_parser.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,136 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raptor2.dir/__/librdfa/context.c.o"
+  "CMakeFiles/raptor2.dir/__/librdfa/context.c.o.d"
+  "CMakeFiles/raptor2.dir/__/librdfa/curie.c.o"
+  "CMakeFiles/raptor2.dir/__/librdfa/curie.c.o.d"
+  "CMakeFiles/raptor2.dir/__/librdfa/iri.c.o"
+  "CMakeFiles/raptor2.dir/__/librdfa/iri.c.o.d"
+  "CMakeFiles/raptor2.dir/__/librdfa/language.c.o"
+  "CMakeFiles/raptor2.dir/__/librdfa/language.c.o.d"
+  "CMakeFiles/raptor2.dir/__/librdfa/lists.c.o"
+  "CMakeFiles/raptor2.dir/__/librdfa/lists.c.o.d"
+  "CMakeFiles/raptor2.dir/__/librdfa/namespace.c.o"
+  "CMakeFiles/raptor2.dir/__/librdfa/namespace.c.o.d"
+  "CMakeFiles/raptor2.dir/__/librdfa/rdfa.c.o"
+  "CMakeFiles/raptor2.dir/__/librdfa/rdfa.c.o.d"
+  "CMakeFiles/raptor2.dir/__/librdfa/rdfa_utils.c.o"
+  "CMakeFiles/raptor2.dir/__/librdfa/rdfa_utils.c.o.d"
+  "CMakeFiles/raptor2.dir/__/librdfa/strtok_r.c.o"
+  "CMakeFiles/raptor2.dir/__/librdfa/strtok_r.c.o.d"
+  "CMakeFiles/raptor2.dir/__/librdfa/subject.c.o"
+  "CMakeFiles/raptor2.dir/__/librdfa/subject.c.o.d"
+  "CMakeFiles/raptor2.dir/__/librdfa/triple.c.o"
+  "CMakeFiles/raptor2.dir/__/librdfa/triple.c.o.d"
+  "CMakeFiles/raptor2.dir/ntriples_parse.c.o"
+  "CMakeFiles/raptor2.dir/ntriples_parse.c.o.d"
+  "CMakeFiles/raptor2.dir/parsedate.c.o"
+  "CMakeFiles/raptor2.dir/parsedate.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_abbrev.c.o"
+  "CMakeFiles/raptor2.dir/raptor_abbrev.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_avltree.c.o"
+  "CMakeFiles/raptor2.dir/raptor_avltree.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_binary.c.o"
+  "CMakeFiles/raptor2.dir/raptor_binary.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_concepts.c.o"
+  "CMakeFiles/raptor2.dir/raptor_concepts.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_convert.c.o"
+  "CMakeFiles/raptor2.dir/raptor_convert.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_escaped.c.o"
+  "CMakeFiles/raptor2.dir/raptor_escaped.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_general.c.o"
+  "CMakeFiles/raptor2.dir/raptor_general.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_guess.c.o"
+  "CMakeFiles/raptor2.dir/raptor_guess.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_iostream.c.o"
+  "CMakeFiles/raptor2.dir/raptor_iostream.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_json_writer.c.o"
+  "CMakeFiles/raptor2.dir/raptor_json_writer.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_librdfa.c.o"
+  "CMakeFiles/raptor2.dir/raptor_librdfa.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_locator.c.o"
+  "CMakeFiles/raptor2.dir/raptor_locator.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_log.c.o"
+  "CMakeFiles/raptor2.dir/raptor_log.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_memstr.c.o"
+  "CMakeFiles/raptor2.dir/raptor_memstr.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_namespace.c.o"
+  "CMakeFiles/raptor2.dir/raptor_namespace.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_ntriples.c.o"
+  "CMakeFiles/raptor2.dir/raptor_ntriples.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_option.c.o"
+  "CMakeFiles/raptor2.dir/raptor_option.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_parse.c.o"
+  "CMakeFiles/raptor2.dir/raptor_parse.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_qname.c.o"
+  "CMakeFiles/raptor2.dir/raptor_qname.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_rfc2396.c.o"
+  "CMakeFiles/raptor2.dir/raptor_rfc2396.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_rss.c.o"
+  "CMakeFiles/raptor2.dir/raptor_rss.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_rss_common.c.o"
+  "CMakeFiles/raptor2.dir/raptor_rss_common.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_sax2.c.o"
+  "CMakeFiles/raptor2.dir/raptor_sax2.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_sequence.c.o"
+  "CMakeFiles/raptor2.dir/raptor_sequence.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_serialize.c.o"
+  "CMakeFiles/raptor2.dir/raptor_serialize.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_serialize_dot.c.o"
+  "CMakeFiles/raptor2.dir/raptor_serialize_dot.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_serialize_html.c.o"
+  "CMakeFiles/raptor2.dir/raptor_serialize_html.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_serialize_json.c.o"
+  "CMakeFiles/raptor2.dir/raptor_serialize_json.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_serialize_ntriples.c.o"
+  "CMakeFiles/raptor2.dir/raptor_serialize_ntriples.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_serialize_rdfxml.c.o"
+  "CMakeFiles/raptor2.dir/raptor_serialize_rdfxml.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_serialize_rdfxmla.c.o"
+  "CMakeFiles/raptor2.dir/raptor_serialize_rdfxmla.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_serialize_rss.c.o"
+  "CMakeFiles/raptor2.dir/raptor_serialize_rss.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_serialize_turtle.c.o"
+  "CMakeFiles/raptor2.dir/raptor_serialize_turtle.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_set.c.o"
+  "CMakeFiles/raptor2.dir/raptor_set.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_statement.c.o"
+  "CMakeFiles/raptor2.dir/raptor_statement.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_stringbuffer.c.o"
+  "CMakeFiles/raptor2.dir/raptor_stringbuffer.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_syntax_description.c.o"
+  "CMakeFiles/raptor2.dir/raptor_syntax_description.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_term.c.o"
+  "CMakeFiles/raptor2.dir/raptor_term.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_turtle_writer.c.o"
+  "CMakeFiles/raptor2.dir/raptor_turtle_writer.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_unicode.c.o"
+  "CMakeFiles/raptor2.dir/raptor_unicode.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_uri.c.o"
+  "CMakeFiles/raptor2.dir/raptor_uri.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_www.c.o"
+  "CMakeFiles/raptor2.dir/raptor_www.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_xml.c.o"
+  "CMakeFiles/raptor2.dir/raptor_xml.c.o.d"
+  "CMakeFiles/raptor2.dir/raptor_xml_writer.c.o"
+  "CMakeFiles/raptor2.dir/raptor_xml_writer.c.o.d"
+  "CMakeFiles/raptor2.dir/snprintf.c.o"
+  "CMakeFiles/raptor2.dir/snprintf.c.o.d"
+  "CMakeFiles/raptor2.dir/sort_r.c.o"
+  "CMakeFiles/raptor2.dir/sort_r.c.o.d"
+  "CMakeFiles/raptor2.dir/turtle_common.c.o"
+  "CMakeFiles/raptor2.dir/turtle_common.c.o.d"
+  "CMakeFiles/raptor2.dir/turtle_lexer.c.o"
+  "CMakeFiles/raptor2.dir/turtle_lexer.c.o.d"
+  "CMakeFiles/raptor2.dir/turtle_parser.c.o"
+  "CMakeFiles/raptor2.dir/turtle_parser.c.o.d"
+  "libraptor2.a"
+  "libraptor2.pdb"
+  "parsedate.c"
+  "turtle_lexer.c"
+  "turtle_parser.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/raptor2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raptor_avltree_test.dir/raptor_avltree.c.o"
+  "CMakeFiles/raptor_avltree_test.dir/raptor_avltree.c.o.d"
+  "raptor_avltree_test"
+  "raptor_avltree_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/raptor_avltree_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raptor_iostream_test.dir/raptor_iostream.c.o"
+  "CMakeFiles/raptor_iostream_test.dir/raptor_iostream.c.o.d"
+  "raptor_iostream_test"
+  "raptor_iostream_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/raptor_iostream_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
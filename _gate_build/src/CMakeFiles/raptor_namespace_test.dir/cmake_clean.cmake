@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raptor_namespace_test.dir/raptor_namespace.c.o"
+  "CMakeFiles/raptor_namespace_test.dir/raptor_namespace.c.o.d"
+  "raptor_namespace_test"
+  "raptor_namespace_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/raptor_namespace_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raptor_parse_test.dir/raptor_parse.c.o"
+  "CMakeFiles/raptor_parse_test.dir/raptor_parse.c.o.d"
+  "raptor_parse_test"
+  "raptor_parse_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/raptor_parse_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raptor_permute_test.dir/raptor_permute_test.c.o"
+  "CMakeFiles/raptor_permute_test.dir/raptor_permute_test.c.o.d"
+  "raptor_permute_test"
+  "raptor_permute_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/raptor_permute_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
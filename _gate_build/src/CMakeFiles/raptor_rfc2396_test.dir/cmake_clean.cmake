@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raptor_rfc2396_test.dir/raptor_rfc2396.c.o"
+  "CMakeFiles/raptor_rfc2396_test.dir/raptor_rfc2396.c.o.d"
+  "raptor_rfc2396_test"
+  "raptor_rfc2396_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/raptor_rfc2396_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raptor_sequence_test.dir/raptor_sequence.c.o"
+  "CMakeFiles/raptor_sequence_test.dir/raptor_sequence.c.o.d"
+  "raptor_sequence_test"
+  "raptor_sequence_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/raptor_sequence_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raptor_snprintf_test.dir/snprintf.c.o"
+  "CMakeFiles/raptor_snprintf_test.dir/snprintf.c.o.d"
+  "raptor_snprintf_test"
+  "raptor_snprintf_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/raptor_snprintf_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raptor_sort_r_test.dir/sort_r.c.o"
+  "CMakeFiles/raptor_sort_r_test.dir/sort_r.c.o.d"
+  "raptor_sort_r_test"
+  "raptor_sort_r_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/raptor_sort_r_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raptor_stringbuffer_test.dir/raptor_stringbuffer.c.o"
+  "CMakeFiles/raptor_stringbuffer_test.dir/raptor_stringbuffer.c.o.d"
+  "raptor_stringbuffer_test"
+  "raptor_stringbuffer_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/raptor_stringbuffer_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
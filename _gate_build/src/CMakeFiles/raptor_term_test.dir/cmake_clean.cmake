@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raptor_term_test.dir/raptor_term.c.o"
+  "CMakeFiles/raptor_term_test.dir/raptor_term.c.o.d"
+  "raptor_term_test"
+  "raptor_term_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/raptor_term_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raptor_uri_test.dir/raptor_uri.c.o"
+  "CMakeFiles/raptor_uri_test.dir/raptor_uri.c.o.d"
+  "raptor_uri_test"
+  "raptor_uri_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/raptor_uri_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raptor_www_test.dir/raptor_www_test.c.o"
+  "CMakeFiles/raptor_www_test.dir/raptor_www_test.c.o.d"
+  "raptor_www_test"
+  "raptor_www_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/raptor_www_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raptor_xml_writer_test.dir/raptor_xml_writer.c.o"
+  "CMakeFiles/raptor_xml_writer_test.dir/raptor_xml_writer.c.o.d"
+  "raptor_xml_writer_test"
+  "raptor_xml_writer_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/raptor_xml_writer_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
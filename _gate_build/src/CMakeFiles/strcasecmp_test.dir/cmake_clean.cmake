@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/strcasecmp_test.dir/strcasecmp.c.o"
+  "CMakeFiles/strcasecmp_test.dir/strcasecmp.c.o.d"
+  "strcasecmp_test"
+  "strcasecmp_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/strcasecmp_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/turtle_flex_tgt"
+  "turtle_lexer.t"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/turtle_flex_tgt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
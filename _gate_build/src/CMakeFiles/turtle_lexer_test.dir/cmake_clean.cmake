@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/turtle_lexer_test.dir/turtle_lexer.c.o"
+  "CMakeFiles/turtle_lexer_test.dir/turtle_lexer.c.o.d"
+  "turtle_lexer.c"
+  "turtle_lexer_test"
+  "turtle_lexer_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/turtle_lexer_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/turtle_lexer_tgt"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/turtle_lexer_tgt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/turtle_parser_test.dir/turtle_parser.c.o"
+  "CMakeFiles/turtle_parser_test.dir/turtle_parser.c.o.d"
+  "turtle_parser.c"
+  "turtle_parser_test"
+  "turtle_parser_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/turtle_parser_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/turtle_parser_tgt"
+  "turtle_parser.c"
+  "turtle_parser.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/turtle_parser_tgt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/turtle_tables_tgt"
+  "turtle_parser.tab.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/turtle_tables_tgt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,38 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src
+# Build directory: /root/repo/_gate_build/src
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(raptor_parse_test "raptor_parse_test")
+set_tests_properties(raptor_parse_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;284;ADD_TEST;/root/repo/src/CMakeLists.txt;0;")
+add_test(raptor_rfc2396_test "raptor_rfc2396_test")
+set_tests_properties(raptor_rfc2396_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;288;ADD_TEST;/root/repo/src/CMakeLists.txt;0;")
+add_test(raptor_uri_test "raptor_uri_test")
+set_tests_properties(raptor_uri_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;292;ADD_TEST;/root/repo/src/CMakeLists.txt;0;")
+add_test(raptor_namespace_test "raptor_namespace_test")
+set_tests_properties(raptor_namespace_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;296;ADD_TEST;/root/repo/src/CMakeLists.txt;0;")
+add_test(strcasecmp_test "strcasecmp_test")
+set_tests_properties(strcasecmp_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;300;ADD_TEST;/root/repo/src/CMakeLists.txt;0;")
+add_test(raptor_www_test "raptor_www_test")
+set_tests_properties(raptor_www_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;304;ADD_TEST;/root/repo/src/CMakeLists.txt;0;")
+add_test(raptor_sequence_test "raptor_sequence_test")
+set_tests_properties(raptor_sequence_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;308;ADD_TEST;/root/repo/src/CMakeLists.txt;0;")
+add_test(raptor_stringbuffer_test "raptor_stringbuffer_test")
+set_tests_properties(raptor_stringbuffer_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;312;ADD_TEST;/root/repo/src/CMakeLists.txt;0;")
+add_test(raptor_iostream_test "raptor_iostream_test")
+set_tests_properties(raptor_iostream_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;316;ADD_TEST;/root/repo/src/CMakeLists.txt;0;")
+add_test(raptor_xml_writer_test "raptor_xml_writer_test")
+set_tests_properties(raptor_xml_writer_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;320;ADD_TEST;/root/repo/src/CMakeLists.txt;0;")
+add_test(raptor_turtle_writer_test "raptor_turtle_writer_test")
+set_tests_properties(raptor_turtle_writer_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;324;ADD_TEST;/root/repo/src/CMakeLists.txt;0;")
+add_test(raptor_avltree_test "raptor_avltree_test")
+set_tests_properties(raptor_avltree_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;328;ADD_TEST;/root/repo/src/CMakeLists.txt;0;")
+add_test(raptor_term_test "raptor_term_test")
+set_tests_properties(raptor_term_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;332;ADD_TEST;/root/repo/src/CMakeLists.txt;0;")
+add_test(raptor_permute_test "raptor_permute_test")
+set_tests_properties(raptor_permute_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;336;ADD_TEST;/root/repo/src/CMakeLists.txt;0;")
+add_test(raptor_snprintf_test "raptor_snprintf_test")
+set_tests_properties(raptor_snprintf_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;340;ADD_TEST;/root/repo/src/CMakeLists.txt;0;")
+add_test(raptor_sort_r_test "raptor_sort_r_test")
+set_tests_properties(raptor_sort_r_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;344;ADD_TEST;/root/repo/src/CMakeLists.txt;0;")
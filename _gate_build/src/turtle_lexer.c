@@ -0,0 +1,17 @@
+/* stub flex scanner for sandbox gate builds: links but cannot scan */
+#include "turtle_lexer.h"
+#include <stdlib.h>
+int turtle_lexer_lex_init(yyscan_t* scanner) { *scanner = calloc(1, 16); return *scanner ? 0 : 1; }
+int turtle_lexer_lex_destroy(yyscan_t scanner) { free(scanner); return 0; }
+void turtle_lexer_set_debug(int debug, yyscan_t* scanner) { (void)debug; (void)scanner; }
+static void* stub_extra;
+void turtle_lexer_set_extra(void* extra, yyscan_t scanner) { (void)scanner; stub_extra = extra; }
+void* turtle_lexer_get_extra(yyscan_t scanner) { (void)scanner; return stub_extra; }
+YY_BUFFER_STATE turtle_lexer__scan_bytes(const char* bytes, int len, yyscan_t scanner) { (void)bytes; (void)len; (void)scanner; return 0; }
+YY_BUFFER_STATE turtle_lexer__scan_buffer(char* base, size_t size, yyscan_t scanner) { (void)base; (void)size; (void)scanner; return 0; }
+int turtle_lexer_lex(void* lval, yyscan_t scanner) { (void)lval; (void)scanner; return 0; }
+int turtle_lexer_get_column(yyscan_t scanner) { (void)scanner; return 0; }
+void turtle_lexer_set_column(int col, yyscan_t scanner) { (void)col; (void)scanner; }
+#ifdef STANDALONE
+int main(void) { return 0; }
+#endif
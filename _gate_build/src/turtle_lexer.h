@@ -0,0 +1,18 @@
+/* stub flex header for sandbox gate builds (flex unavailable) */
+#ifndef TURTLE_LEXER_H_STUB
+#define TURTLE_LEXER_H_STUB
+#include <stdio.h>
+typedef void* yyscan_t;
+struct yy_buffer_state_stub { int dummy; };
+typedef struct yy_buffer_state_stub *YY_BUFFER_STATE;
+int turtle_lexer_lex_init(yyscan_t* scanner);
+int turtle_lexer_lex_destroy(yyscan_t scanner);
+void turtle_lexer_set_debug(int debug, yyscan_t* scanner);
+void turtle_lexer_set_extra(void* extra, yyscan_t scanner);
+void* turtle_lexer_get_extra(yyscan_t scanner);
+YY_BUFFER_STATE turtle_lexer__scan_bytes(const char* bytes, int len, yyscan_t scanner);
+YY_BUFFER_STATE turtle_lexer__scan_buffer(char* base, size_t size, yyscan_t scanner);
+int turtle_lexer_lex(void* lval, yyscan_t scanner);
+int turtle_lexer_get_column(yyscan_t scanner);
+void turtle_lexer_set_column(int col, yyscan_t scanner);
+#endif
@@ -0,0 +1,114 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_TURTLE_PARSER_TURTLE_PARSER_TAB_H_INCLUDED
+# define YY_TURTLE_PARSER_TURTLE_PARSER_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int turtle_parser_debug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    A = 258,                       /* "a"  */
+    HAT = 259,                     /* "^"  */
+    DOT = 260,                     /* "."  */
+    COMMA = 261,                   /* ","  */
+    SEMICOLON = 262,               /* ";"  */
+    LEFT_SQUARE = 263,             /* "["  */
+    RIGHT_SQUARE = 264,            /* "]"  */
+    LEFT_ROUND = 265,              /* "("  */
+    RIGHT_ROUND = 266,             /* ")"  */
+    LEFT_CURLY = 267,              /* "{"  */
+    RIGHT_CURLY = 268,             /* "}"  */
+    TRUE_TOKEN = 269,              /* "true"  */
+    FALSE_TOKEN = 270,             /* "false"  */
+    PREFIX = 271,                  /* "@prefix"  */
+    BASE = 272,                    /* "@base"  */
+    SPARQL_PREFIX = 273,           /* "PREFIX"  */
+    SPARQL_BASE = 274,             /* "BASE"  */
+    STRING_LITERAL = 275,          /* "string literal"  */
+    URI_LITERAL = 276,             /* "URI literal"  */
+    GRAPH_NAME_LEFT_CURLY = 277,   /* "Graph URI literal {"  */
+    BLANK_LITERAL = 278,           /* "blank node"  */
+    QNAME_LITERAL = 279,           /* "QName"  */
+    IDENTIFIER = 280,              /* "identifier"  */
+    LANGTAG = 281,                 /* "langtag"  */
+    INTEGER_LITERAL = 282,         /* "integer literal"  */
+    FLOATING_LITERAL = 283,        /* "floating point literal"  */
+    DECIMAL_LITERAL = 284,         /* "decimal literal"  */
+    ERROR_TOKEN = 285              /* ERROR_TOKEN  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 145 "/root/repo/src/turtle_parser.y"
+
+  unsigned char *string;
+  raptor_term *identifier;
+  raptor_sequence *sequence;
+  raptor_uri *uri;
+
+#line 101 "turtle_parser.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+
+
+int turtle_parser_parse (raptor_parser* rdf_parser, void* yyscanner);
+
+
+#endif /* !YY_TURTLE_PARSER_TURTLE_PARSER_TAB_H_INCLUDED  */
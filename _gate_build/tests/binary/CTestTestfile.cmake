@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/binary
+# Build directory: /root/repo/_gate_build/tests/binary
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(binary.parse:run "/usr/bin/cmake" "-P" "test-binary.parse.cmake")
+set_tests_properties(binary.parse:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/binary/CMakeLists.txt;8;RAPPER_TEST;/root/repo/tests/binary/CMakeLists.txt;0;")
+add_test(binary.parse:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/binary/test.out" "parse.res")
+set_tests_properties(binary.parse:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/binary/CMakeLists.txt;8;RAPPER_TEST;/root/repo/tests/binary/CMakeLists.txt;0;")
+add_test(binary.roundtrip:run "/usr/bin/cmake" "-P" "test-binary.roundtrip.cmake")
+set_tests_properties(binary.roundtrip:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/binary/CMakeLists.txt;40;ADD_TEST;/root/repo/tests/binary/CMakeLists.txt;0;")
+add_test(binary.roundtrip:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/binary/test.out" "roundtrip.res")
+set_tests_properties(binary.roundtrip:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/binary/CMakeLists.txt;41;ADD_TEST;/root/repo/tests/binary/CMakeLists.txt;0;")
+add_test(binary.bad-magic "/root/repo/_gate_build/utils/rapper" "-q" "-i" "raptor-binary" "-o" "ntriples" "file:/root/repo/tests/binary/bad-magic.brf" "http://librdf.org/raptor/tests/bad-magic.brf")
+set_tests_properties(binary.bad-magic PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/binary/CMakeLists.txt;46;ADD_TEST;/root/repo/tests/binary/CMakeLists.txt;0;")
+add_test(binary.bad-truncated "/root/repo/_gate_build/utils/rapper" "-q" "-i" "raptor-binary" "-o" "ntriples" "file:/root/repo/tests/binary/bad-truncated.brf" "http://librdf.org/raptor/tests/bad-truncated.brf")
+set_tests_properties(binary.bad-truncated PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/binary/CMakeLists.txt;47;ADD_TEST;/root/repo/tests/binary/CMakeLists.txt;0;")
+add_test(binary.bad-dictid "/root/repo/_gate_build/utils/rapper" "-q" "-i" "raptor-binary" "-o" "ntriples" "file:/root/repo/tests/binary/bad-dictid.brf" "http://librdf.org/raptor/tests/bad-dictid.brf")
+set_tests_properties(binary.bad-dictid PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/binary/CMakeLists.txt;48;ADD_TEST;/root/repo/tests/binary/CMakeLists.txt;0;")
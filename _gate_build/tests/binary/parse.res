@@ -0,0 +1,7 @@
+<http://example.org/resource1> <http://example.org/property> <http://example.org/resource2> .
+<http://example.org/resource1> <http://example.org/property> _:anon .
+_:anon <http://example.org/property> <http://example.org/resource2> .
+<http://example.org/resource2> <http://example.org/label> "plain literal" .
+<http://example.org/resource2> <http://example.org/label> "chat"@fr .
+<http://example.org/resource2> <http://example.org/size> "42"^^<http://www.w3.org/2001/XMLSchema#integer> .
+<http://example.org/resource3> <http://example.org/note> "escaped \"quotes\" and \\ backslash" .
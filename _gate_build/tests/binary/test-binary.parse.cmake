@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -i raptor-binary -o ntriples file:/root/repo/tests/binary/test.brf http://librdf.org/raptor/tests/test.nt
+	TIMEOUT 10
+	OUTPUT_FILE parse.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/binary/parse.res.raw
+	parse.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
@@ -0,0 +1,22 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -i ntriples -o raptor-binary file:/root/repo/tests/binary/test.nt http://librdf.org/raptor/tests/test.nt
+	TIMEOUT 10
+	OUTPUT_FILE roundtrip.brf
+	ERROR_QUIET
+)
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -i raptor-binary -o ntriples file:/root/repo/_gate_build/tests/binary/roundtrip.brf http://librdf.org/raptor/tests/test.nt
+	TIMEOUT 10
+	OUTPUT_FILE roundtrip.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/binary/roundtrip.res.raw
+	roundtrip.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
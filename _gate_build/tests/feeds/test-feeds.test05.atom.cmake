@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -i rss-tag-soup -o turtle -f writeBaseURI=0 -O http://www.example.org/blog/ file:/root/repo/tests/feeds/test05.atom
+	TIMEOUT 10
+	OUTPUT_FILE test05.ttl.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/feeds/test05.ttl.raw
+	test05.ttl
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
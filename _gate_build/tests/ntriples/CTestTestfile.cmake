@@ -0,0 +1,38 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/ntriples
+# Build directory: /root/repo/_gate_build/tests/ntriples
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ntriples.test:run "/usr/bin/cmake" "-P" "test-ntriples.test.cmake")
+set_tests_properties(ntriples.test:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/ntriples/CMakeLists.txt;7;RAPPER_TEST;/root/repo/tests/ntriples/CMakeLists.txt;0;")
+add_test(ntriples.test:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/ntriples/test.out" "test.res")
+set_tests_properties(ntriples.test:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/ntriples/CMakeLists.txt;7;RAPPER_TEST;/root/repo/tests/ntriples/CMakeLists.txt;0;")
+add_test(ntriples.bad-00 "/root/repo/_gate_build/utils/rapper" "-q" "-i" "ntriples" "-o" "ntriples" "file:/root/repo/tests/ntriples/bad-00.nt" "http://librdf.org/raptor/tests/bad-00.nt")
+set_tests_properties(ntriples.bad-00 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/ntriples/CMakeLists.txt;13;ADD_TEST;/root/repo/tests/ntriples/CMakeLists.txt;0;")
+add_test(ntriples.bad-01 "/root/repo/_gate_build/utils/rapper" "-q" "-i" "ntriples" "-o" "ntriples" "file:/root/repo/tests/ntriples/bad-01.nt" "http://librdf.org/raptor/tests/bad-01.nt")
+set_tests_properties(ntriples.bad-01 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/ntriples/CMakeLists.txt;14;ADD_TEST;/root/repo/tests/ntriples/CMakeLists.txt;0;")
+add_test(ntriples.bad-02 "/root/repo/_gate_build/utils/rapper" "-q" "-i" "ntriples" "-o" "ntriples" "file:/root/repo/tests/ntriples/bad-02.nt" "http://librdf.org/raptor/tests/bad-02.nt")
+set_tests_properties(ntriples.bad-02 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/ntriples/CMakeLists.txt;15;ADD_TEST;/root/repo/tests/ntriples/CMakeLists.txt;0;")
+add_test(ntriples.bad-03 "/root/repo/_gate_build/utils/rapper" "-q" "-i" "ntriples" "-o" "ntriples" "file:/root/repo/tests/ntriples/bad-03.nt" "http://librdf.org/raptor/tests/bad-03.nt")
+set_tests_properties(ntriples.bad-03 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/ntriples/CMakeLists.txt;16;ADD_TEST;/root/repo/tests/ntriples/CMakeLists.txt;0;")
+add_test(ntriples.bad-04 "/root/repo/_gate_build/utils/rapper" "-q" "-i" "ntriples" "-o" "ntriples" "file:/root/repo/tests/ntriples/bad-04.nt" "http://librdf.org/raptor/tests/bad-04.nt")
+set_tests_properties(ntriples.bad-04 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/ntriples/CMakeLists.txt;17;ADD_TEST;/root/repo/tests/ntriples/CMakeLists.txt;0;")
+add_test(ntriples.bad-05 "/root/repo/_gate_build/utils/rapper" "-q" "-i" "ntriples" "-o" "ntriples" "file:/root/repo/tests/ntriples/bad-05.nt" "http://librdf.org/raptor/tests/bad-05.nt")
+set_tests_properties(ntriples.bad-05 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/ntriples/CMakeLists.txt;18;ADD_TEST;/root/repo/tests/ntriples/CMakeLists.txt;0;")
+add_test(ntriples.bad-06 "/root/repo/_gate_build/utils/rapper" "-q" "-i" "ntriples" "-o" "ntriples" "file:/root/repo/tests/ntriples/bad-06.nt" "http://librdf.org/raptor/tests/bad-06.nt")
+set_tests_properties(ntriples.bad-06 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/ntriples/CMakeLists.txt;19;ADD_TEST;/root/repo/tests/ntriples/CMakeLists.txt;0;")
+add_test(ntriples.bad-07 "/root/repo/_gate_build/utils/rapper" "-q" "-i" "ntriples" "-o" "ntriples" "file:/root/repo/tests/ntriples/bad-07.nt" "http://librdf.org/raptor/tests/bad-07.nt")
+set_tests_properties(ntriples.bad-07 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/ntriples/CMakeLists.txt;20;ADD_TEST;/root/repo/tests/ntriples/CMakeLists.txt;0;")
+add_test(ntriples.testnq-1:run "/usr/bin/cmake" "-P" "test-ntriples.testnq-1.cmake")
+set_tests_properties(ntriples.testnq-1:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/ntriples/CMakeLists.txt;35;RAPPER_TEST;/root/repo/tests/ntriples/CMakeLists.txt;0;")
+add_test(ntriples.testnq-1:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/ntriples/testnq-1.out" "testnq-1.res")
+set_tests_properties(ntriples.testnq-1:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/ntriples/CMakeLists.txt;35;RAPPER_TEST;/root/repo/tests/ntriples/CMakeLists.txt;0;")
+add_test(ntriples.testnq-optional-context:run "/usr/bin/cmake" "-P" "test-ntriples.testnq-optional-context.cmake")
+set_tests_properties(ntriples.testnq-optional-context:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/ntriples/CMakeLists.txt;41;RAPPER_TEST;/root/repo/tests/ntriples/CMakeLists.txt;0;")
+add_test(ntriples.testnq-optional-context:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/ntriples/testnq-optional-context.out" "testnq-optional-context.res")
+set_tests_properties(ntriples.testnq-optional-context:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/ntriples/CMakeLists.txt;41;RAPPER_TEST;/root/repo/tests/ntriples/CMakeLists.txt;0;")
+add_test(ntriples.bug-481:run "/usr/bin/cmake" "-P" "test-ntriples.bug-481.cmake")
+set_tests_properties(ntriples.bug-481:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/ntriples/CMakeLists.txt;47;RAPPER_TEST;/root/repo/tests/ntriples/CMakeLists.txt;0;")
+add_test(ntriples.bug-481:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/ntriples/bug-481.out" "bug-481.res")
+set_tests_properties(ntriples.bug-481:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/ntriples/CMakeLists.txt;47;RAPPER_TEST;/root/repo/tests/ntriples/CMakeLists.txt;0;")
@@ -0,0 +1 @@
+_:httpx3Ax2Fx2Fapix2Ehi5x2Ecomx2Frestx2Fprofilex2Ffoafx2F504083723xxbnode229 <http://xmlns.com/foaf/0.1/nick> "\u0102\uD838\uDF06\u0941\u04EANONGJEE\u04EA\u0941\uD838\uDF06\u0102" <http://api.hi5.com/rest/profile/foaf/504083723> .
@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -i nquads -o nquads file:/root/repo/tests/ntriples/bug-481.nq http://librdf.org/raptor/tests/bug-481.nq
+	TIMEOUT 10
+	OUTPUT_FILE bug-481.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/ntriples/bug-481.res.raw
+	bug-481.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
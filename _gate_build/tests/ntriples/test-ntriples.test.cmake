@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -i ntriples -o ntriples file:/root/repo/tests/ntriples/test.nt http://librdf.org/raptor/tests/test.nt
+	TIMEOUT 10
+	OUTPUT_FILE test.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/ntriples/test.res.raw
+	test.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -i nquads -o nquads file:/root/repo/tests/ntriples/testnq-1.nq http://librdf.org/raptor/tests/testnq-1.nq
+	TIMEOUT 10
+	OUTPUT_FILE testnq-1.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/ntriples/testnq-1.res.raw
+	testnq-1.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -i nquads -o nquads file:/root/repo/tests/ntriples/testnq-optional-context.nq http://librdf.org/raptor/tests/testnq-optional-context.nq
+	TIMEOUT 10
+	OUTPUT_FILE testnq-optional-context.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/ntriples/testnq-optional-context.res.raw
+	testnq-optional-context.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
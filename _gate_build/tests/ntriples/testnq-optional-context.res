@@ -0,0 +1,2 @@
+<http://example.org/a> <http://example.org/b> <http://example.org/c> .
+<http://example.org/d> <http://example.org/e> <http://example.org/f> <http://example.org/g> .
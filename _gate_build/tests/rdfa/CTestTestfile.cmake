@@ -0,0 +1,248 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/rdfa
+# Build directory: /root/repo/_gate_build/tests/rdfa
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rdfa.0001 "/usr/bin/cmake" "-P" "test-rdfa.0001.cmake")
+set_tests_properties(rdfa.0001 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;9;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0006 "/usr/bin/cmake" "-P" "test-rdfa.0006.cmake")
+set_tests_properties(rdfa.0006 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;15;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0007 "/usr/bin/cmake" "-P" "test-rdfa.0007.cmake")
+set_tests_properties(rdfa.0007 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;21;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0008 "/usr/bin/cmake" "-P" "test-rdfa.0008.cmake")
+set_tests_properties(rdfa.0008 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;27;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0009 "/usr/bin/cmake" "-P" "test-rdfa.0009.cmake")
+set_tests_properties(rdfa.0009 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;33;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0010 "/usr/bin/cmake" "-P" "test-rdfa.0010.cmake")
+set_tests_properties(rdfa.0010 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;39;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0012 "/usr/bin/cmake" "-P" "test-rdfa.0012.cmake")
+set_tests_properties(rdfa.0012 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;45;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0013 "/usr/bin/cmake" "-P" "test-rdfa.0013.cmake")
+set_tests_properties(rdfa.0013 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;51;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0014 "/usr/bin/cmake" "-P" "test-rdfa.0014.cmake")
+set_tests_properties(rdfa.0014 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;57;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0015 "/usr/bin/cmake" "-P" "test-rdfa.0015.cmake")
+set_tests_properties(rdfa.0015 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;63;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0017 "/usr/bin/cmake" "-P" "test-rdfa.0017.cmake")
+set_tests_properties(rdfa.0017 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;69;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0018 "/usr/bin/cmake" "-P" "test-rdfa.0018.cmake")
+set_tests_properties(rdfa.0018 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;75;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0019 "/usr/bin/cmake" "-P" "test-rdfa.0019.cmake")
+set_tests_properties(rdfa.0019 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;81;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0020 "/usr/bin/cmake" "-P" "test-rdfa.0020.cmake")
+set_tests_properties(rdfa.0020 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;87;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0021 "/usr/bin/cmake" "-P" "test-rdfa.0021.cmake")
+set_tests_properties(rdfa.0021 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;93;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0023 "/usr/bin/cmake" "-P" "test-rdfa.0023.cmake")
+set_tests_properties(rdfa.0023 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;99;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0025 "/usr/bin/cmake" "-P" "test-rdfa.0025.cmake")
+set_tests_properties(rdfa.0025 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;105;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0026 "/usr/bin/cmake" "-P" "test-rdfa.0026.cmake")
+set_tests_properties(rdfa.0026 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;111;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0027 "/usr/bin/cmake" "-P" "test-rdfa.0027.cmake")
+set_tests_properties(rdfa.0027 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;117;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0029 "/usr/bin/cmake" "-P" "test-rdfa.0029.cmake")
+set_tests_properties(rdfa.0029 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;123;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0030 "/usr/bin/cmake" "-P" "test-rdfa.0030.cmake")
+set_tests_properties(rdfa.0030 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;129;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0031 "/usr/bin/cmake" "-P" "test-rdfa.0031.cmake")
+set_tests_properties(rdfa.0031 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;135;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0032 "/usr/bin/cmake" "-P" "test-rdfa.0032.cmake")
+set_tests_properties(rdfa.0032 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;141;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0033 "/usr/bin/cmake" "-P" "test-rdfa.0033.cmake")
+set_tests_properties(rdfa.0033 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;147;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0034 "/usr/bin/cmake" "-P" "test-rdfa.0034.cmake")
+set_tests_properties(rdfa.0034 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;153;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0035 "/usr/bin/cmake" "-P" "test-rdfa.0035.cmake")
+set_tests_properties(rdfa.0035 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;159;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0036 "/usr/bin/cmake" "-P" "test-rdfa.0036.cmake")
+set_tests_properties(rdfa.0036 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;165;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0037 "/usr/bin/cmake" "-P" "test-rdfa.0037.cmake")
+set_tests_properties(rdfa.0037 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;171;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0038 "/usr/bin/cmake" "-P" "test-rdfa.0038.cmake")
+set_tests_properties(rdfa.0038 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;177;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0039 "/usr/bin/cmake" "-P" "test-rdfa.0039.cmake")
+set_tests_properties(rdfa.0039 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;183;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0040 "/usr/bin/cmake" "-P" "test-rdfa.0040.cmake")
+set_tests_properties(rdfa.0040 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;189;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0041 "/usr/bin/cmake" "-P" "test-rdfa.0041.cmake")
+set_tests_properties(rdfa.0041 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;195;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0042 "/usr/bin/cmake" "-P" "test-rdfa.0042.cmake")
+set_tests_properties(rdfa.0042 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;201;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0046 "/usr/bin/cmake" "-P" "test-rdfa.0046.cmake")
+set_tests_properties(rdfa.0046 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;207;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0047 "/usr/bin/cmake" "-P" "test-rdfa.0047.cmake")
+set_tests_properties(rdfa.0047 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;213;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0048 "/usr/bin/cmake" "-P" "test-rdfa.0048.cmake")
+set_tests_properties(rdfa.0048 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;219;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0049 "/usr/bin/cmake" "-P" "test-rdfa.0049.cmake")
+set_tests_properties(rdfa.0049 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;225;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0050 "/usr/bin/cmake" "-P" "test-rdfa.0050.cmake")
+set_tests_properties(rdfa.0050 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;231;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0051 "/usr/bin/cmake" "-P" "test-rdfa.0051.cmake")
+set_tests_properties(rdfa.0051 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;237;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0052 "/usr/bin/cmake" "-P" "test-rdfa.0052.cmake")
+set_tests_properties(rdfa.0052 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;243;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0053 "/usr/bin/cmake" "-P" "test-rdfa.0053.cmake")
+set_tests_properties(rdfa.0053 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;249;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0054 "/usr/bin/cmake" "-P" "test-rdfa.0054.cmake")
+set_tests_properties(rdfa.0054 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;255;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0055 "/usr/bin/cmake" "-P" "test-rdfa.0055.cmake")
+set_tests_properties(rdfa.0055 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;261;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0056 "/usr/bin/cmake" "-P" "test-rdfa.0056.cmake")
+set_tests_properties(rdfa.0056 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;267;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0057 "/usr/bin/cmake" "-P" "test-rdfa.0057.cmake")
+set_tests_properties(rdfa.0057 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;273;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0058 "/usr/bin/cmake" "-P" "test-rdfa.0058.cmake")
+set_tests_properties(rdfa.0058 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;279;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0059 "/usr/bin/cmake" "-P" "test-rdfa.0059.cmake")
+set_tests_properties(rdfa.0059 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;285;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0060 "/usr/bin/cmake" "-P" "test-rdfa.0060.cmake")
+set_tests_properties(rdfa.0060 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;291;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0061 "/usr/bin/cmake" "-P" "test-rdfa.0061.cmake")
+set_tests_properties(rdfa.0061 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;297;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0062 "/usr/bin/cmake" "-P" "test-rdfa.0062.cmake")
+set_tests_properties(rdfa.0062 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;303;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0063 "/usr/bin/cmake" "-P" "test-rdfa.0063.cmake")
+set_tests_properties(rdfa.0063 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;309;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0064 "/usr/bin/cmake" "-P" "test-rdfa.0064.cmake")
+set_tests_properties(rdfa.0064 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;315;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0065 "/usr/bin/cmake" "-P" "test-rdfa.0065.cmake")
+set_tests_properties(rdfa.0065 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;321;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0066 "/usr/bin/cmake" "-P" "test-rdfa.0066.cmake")
+set_tests_properties(rdfa.0066 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;327;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0067 "/usr/bin/cmake" "-P" "test-rdfa.0067.cmake")
+set_tests_properties(rdfa.0067 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;333;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0068 "/usr/bin/cmake" "-P" "test-rdfa.0068.cmake")
+set_tests_properties(rdfa.0068 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;339;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0069 "/usr/bin/cmake" "-P" "test-rdfa.0069.cmake")
+set_tests_properties(rdfa.0069 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;345;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0070 "/usr/bin/cmake" "-P" "test-rdfa.0070.cmake")
+set_tests_properties(rdfa.0070 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;351;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0071 "/usr/bin/cmake" "-P" "test-rdfa.0071.cmake")
+set_tests_properties(rdfa.0071 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;357;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0072 "/usr/bin/cmake" "-P" "test-rdfa.0072.cmake")
+set_tests_properties(rdfa.0072 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;363;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0073 "/usr/bin/cmake" "-P" "test-rdfa.0073.cmake")
+set_tests_properties(rdfa.0073 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;369;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0074 "/usr/bin/cmake" "-P" "test-rdfa.0074.cmake")
+set_tests_properties(rdfa.0074 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;375;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0075 "/usr/bin/cmake" "-P" "test-rdfa.0075.cmake")
+set_tests_properties(rdfa.0075 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;381;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0076 "/usr/bin/cmake" "-P" "test-rdfa.0076.cmake")
+set_tests_properties(rdfa.0076 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;387;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0077 "/usr/bin/cmake" "-P" "test-rdfa.0077.cmake")
+set_tests_properties(rdfa.0077 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;393;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0078 "/usr/bin/cmake" "-P" "test-rdfa.0078.cmake")
+set_tests_properties(rdfa.0078 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;399;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0079 "/usr/bin/cmake" "-P" "test-rdfa.0079.cmake")
+set_tests_properties(rdfa.0079 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;405;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0080 "/usr/bin/cmake" "-P" "test-rdfa.0080.cmake")
+set_tests_properties(rdfa.0080 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;411;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0081 "/usr/bin/cmake" "-P" "test-rdfa.0081.cmake")
+set_tests_properties(rdfa.0081 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;417;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0082 "/usr/bin/cmake" "-P" "test-rdfa.0082.cmake")
+set_tests_properties(rdfa.0082 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;423;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0083 "/usr/bin/cmake" "-P" "test-rdfa.0083.cmake")
+set_tests_properties(rdfa.0083 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;429;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0084 "/usr/bin/cmake" "-P" "test-rdfa.0084.cmake")
+set_tests_properties(rdfa.0084 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;435;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0085 "/usr/bin/cmake" "-P" "test-rdfa.0085.cmake")
+set_tests_properties(rdfa.0085 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;441;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0087 "/usr/bin/cmake" "-P" "test-rdfa.0087.cmake")
+set_tests_properties(rdfa.0087 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;447;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0088 "/usr/bin/cmake" "-P" "test-rdfa.0088.cmake")
+set_tests_properties(rdfa.0088 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;453;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0089 "/usr/bin/cmake" "-P" "test-rdfa.0089.cmake")
+set_tests_properties(rdfa.0089 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;459;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0090 "/usr/bin/cmake" "-P" "test-rdfa.0090.cmake")
+set_tests_properties(rdfa.0090 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;465;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0091 "/usr/bin/cmake" "-P" "test-rdfa.0091.cmake")
+set_tests_properties(rdfa.0091 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;471;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0093 "/usr/bin/cmake" "-P" "test-rdfa.0093.cmake")
+set_tests_properties(rdfa.0093 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;477;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0099 "/usr/bin/cmake" "-P" "test-rdfa.0099.cmake")
+set_tests_properties(rdfa.0099 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;483;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0104 "/usr/bin/cmake" "-P" "test-rdfa.0104.cmake")
+set_tests_properties(rdfa.0104 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;489;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0106 "/usr/bin/cmake" "-P" "test-rdfa.0106.cmake")
+set_tests_properties(rdfa.0106 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;495;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0107 "/usr/bin/cmake" "-P" "test-rdfa.0107.cmake")
+set_tests_properties(rdfa.0107 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;501;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0108 "/usr/bin/cmake" "-P" "test-rdfa.0108.cmake")
+set_tests_properties(rdfa.0108 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;507;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0109 "/usr/bin/cmake" "-P" "test-rdfa.0109.cmake")
+set_tests_properties(rdfa.0109 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;513;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0110 "/usr/bin/cmake" "-P" "test-rdfa.0110.cmake")
+set_tests_properties(rdfa.0110 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;519;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0111 "/usr/bin/cmake" "-P" "test-rdfa.0111.cmake")
+set_tests_properties(rdfa.0111 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;525;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0112 "/usr/bin/cmake" "-P" "test-rdfa.0112.cmake")
+set_tests_properties(rdfa.0112 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;531;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0113 "/usr/bin/cmake" "-P" "test-rdfa.0113.cmake")
+set_tests_properties(rdfa.0113 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;537;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0114 "/usr/bin/cmake" "-P" "test-rdfa.0114.cmake")
+set_tests_properties(rdfa.0114 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;543;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0115 "/usr/bin/cmake" "-P" "test-rdfa.0115.cmake")
+set_tests_properties(rdfa.0115 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;549;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0117 "/usr/bin/cmake" "-P" "test-rdfa.0117.cmake")
+set_tests_properties(rdfa.0117 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;555;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0118 "/usr/bin/cmake" "-P" "test-rdfa.0118.cmake")
+set_tests_properties(rdfa.0118 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;561;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0119 "/usr/bin/cmake" "-P" "test-rdfa.0119.cmake")
+set_tests_properties(rdfa.0119 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;567;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0120 "/usr/bin/cmake" "-P" "test-rdfa.0120.cmake")
+set_tests_properties(rdfa.0120 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;573;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0121 "/usr/bin/cmake" "-P" "test-rdfa.0121.cmake")
+set_tests_properties(rdfa.0121 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;579;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0122 "/usr/bin/cmake" "-P" "test-rdfa.0122.cmake")
+set_tests_properties(rdfa.0122 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;585;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0126 "/usr/bin/cmake" "-P" "test-rdfa.0126.cmake")
+set_tests_properties(rdfa.0126 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;591;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0131 "/usr/bin/cmake" "-P" "test-rdfa.0131.cmake")
+set_tests_properties(rdfa.0131 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;597;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0134 "/usr/bin/cmake" "-P" "test-rdfa.0134.cmake")
+set_tests_properties(rdfa.0134 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;603;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0140 "/usr/bin/cmake" "-P" "test-rdfa.0140.cmake")
+set_tests_properties(rdfa.0140 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;609;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0147 "/usr/bin/cmake" "-P" "test-rdfa.0147.cmake")
+set_tests_properties(rdfa.0147 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;615;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0172 "/usr/bin/cmake" "-P" "test-rdfa.0172.cmake")
+set_tests_properties(rdfa.0172 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;621;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0173 "/usr/bin/cmake" "-P" "test-rdfa.0173.cmake")
+set_tests_properties(rdfa.0173 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;627;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0174 "/usr/bin/cmake" "-P" "test-rdfa.0174.cmake")
+set_tests_properties(rdfa.0174 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;633;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0181 "/usr/bin/cmake" "-P" "test-rdfa.0181.cmake")
+set_tests_properties(rdfa.0181 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;639;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0197 "/usr/bin/cmake" "-P" "test-rdfa.0197.cmake")
+set_tests_properties(rdfa.0197 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;645;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0201 "/usr/bin/cmake" "-P" "test-rdfa.0201.cmake")
+set_tests_properties(rdfa.0201 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;651;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0202 "/usr/bin/cmake" "-P" "test-rdfa.0202.cmake")
+set_tests_properties(rdfa.0202 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;657;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0203 "/usr/bin/cmake" "-P" "test-rdfa.0203.cmake")
+set_tests_properties(rdfa.0203 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;664;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0207 "/usr/bin/cmake" "-P" "test-rdfa.0207.cmake")
+set_tests_properties(rdfa.0207 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;671;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0209 "/usr/bin/cmake" "-P" "test-rdfa.0209.cmake")
+set_tests_properties(rdfa.0209 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;677;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0210 "/usr/bin/cmake" "-P" "test-rdfa.0210.cmake")
+set_tests_properties(rdfa.0210 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;683;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0211 "/usr/bin/cmake" "-P" "test-rdfa.0211.cmake")
+set_tests_properties(rdfa.0211 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;689;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0212 "/usr/bin/cmake" "-P" "test-rdfa.0212.cmake")
+set_tests_properties(rdfa.0212 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;695;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0215 "/usr/bin/cmake" "-P" "test-rdfa.0215.cmake")
+set_tests_properties(rdfa.0215 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;701;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0258 "/usr/bin/cmake" "-P" "test-rdfa.0258.cmake")
+set_tests_properties(rdfa.0258 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;707;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0262 "/usr/bin/cmake" "-P" "test-rdfa.0262.cmake")
+set_tests_properties(rdfa.0262 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;713;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0291 "/usr/bin/cmake" "-P" "test-rdfa.0291.cmake")
+set_tests_properties(rdfa.0291 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;719;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0294 "/usr/bin/cmake" "-P" "test-rdfa.0294.cmake")
+set_tests_properties(rdfa.0294 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;725;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
+add_test(rdfa.0304 "/usr/bin/cmake" "-P" "test-rdfa.0304.cmake")
+set_tests_properties(rdfa.0304 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa/CMakeLists.txt;732;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa/CMakeLists.txt;0;")
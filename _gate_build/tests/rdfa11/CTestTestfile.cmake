@@ -0,0 +1,406 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/rdfa11
+# Build directory: /root/repo/_gate_build/tests/rdfa11
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rdfa11.0001 "/usr/bin/cmake" "-P" "test-rdfa11.0001.cmake")
+set_tests_properties(rdfa11.0001 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;9;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0006 "/usr/bin/cmake" "-P" "test-rdfa11.0006.cmake")
+set_tests_properties(rdfa11.0006 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;15;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0007 "/usr/bin/cmake" "-P" "test-rdfa11.0007.cmake")
+set_tests_properties(rdfa11.0007 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;21;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0008 "/usr/bin/cmake" "-P" "test-rdfa11.0008.cmake")
+set_tests_properties(rdfa11.0008 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;27;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0009 "/usr/bin/cmake" "-P" "test-rdfa11.0009.cmake")
+set_tests_properties(rdfa11.0009 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;33;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0010 "/usr/bin/cmake" "-P" "test-rdfa11.0010.cmake")
+set_tests_properties(rdfa11.0010 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;39;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0012 "/usr/bin/cmake" "-P" "test-rdfa11.0012.cmake")
+set_tests_properties(rdfa11.0012 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;45;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0013 "/usr/bin/cmake" "-P" "test-rdfa11.0013.cmake")
+set_tests_properties(rdfa11.0013 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;51;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0014 "/usr/bin/cmake" "-P" "test-rdfa11.0014.cmake")
+set_tests_properties(rdfa11.0014 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;57;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0015 "/usr/bin/cmake" "-P" "test-rdfa11.0015.cmake")
+set_tests_properties(rdfa11.0015 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;63;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0017 "/usr/bin/cmake" "-P" "test-rdfa11.0017.cmake")
+set_tests_properties(rdfa11.0017 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;69;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0018 "/usr/bin/cmake" "-P" "test-rdfa11.0018.cmake")
+set_tests_properties(rdfa11.0018 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;75;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0019 "/usr/bin/cmake" "-P" "test-rdfa11.0019.cmake")
+set_tests_properties(rdfa11.0019 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;81;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0020 "/usr/bin/cmake" "-P" "test-rdfa11.0020.cmake")
+set_tests_properties(rdfa11.0020 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;87;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0021 "/usr/bin/cmake" "-P" "test-rdfa11.0021.cmake")
+set_tests_properties(rdfa11.0021 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;93;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0023 "/usr/bin/cmake" "-P" "test-rdfa11.0023.cmake")
+set_tests_properties(rdfa11.0023 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;99;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0025 "/usr/bin/cmake" "-P" "test-rdfa11.0025.cmake")
+set_tests_properties(rdfa11.0025 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;105;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0026 "/usr/bin/cmake" "-P" "test-rdfa11.0026.cmake")
+set_tests_properties(rdfa11.0026 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;111;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0027 "/usr/bin/cmake" "-P" "test-rdfa11.0027.cmake")
+set_tests_properties(rdfa11.0027 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;117;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0029 "/usr/bin/cmake" "-P" "test-rdfa11.0029.cmake")
+set_tests_properties(rdfa11.0029 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;123;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0030 "/usr/bin/cmake" "-P" "test-rdfa11.0030.cmake")
+set_tests_properties(rdfa11.0030 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;129;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0031 "/usr/bin/cmake" "-P" "test-rdfa11.0031.cmake")
+set_tests_properties(rdfa11.0031 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;135;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0032 "/usr/bin/cmake" "-P" "test-rdfa11.0032.cmake")
+set_tests_properties(rdfa11.0032 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;141;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0033 "/usr/bin/cmake" "-P" "test-rdfa11.0033.cmake")
+set_tests_properties(rdfa11.0033 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;147;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0034 "/usr/bin/cmake" "-P" "test-rdfa11.0034.cmake")
+set_tests_properties(rdfa11.0034 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;153;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0035 "/usr/bin/cmake" "-P" "test-rdfa11.0035.cmake")
+set_tests_properties(rdfa11.0035 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;159;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0036 "/usr/bin/cmake" "-P" "test-rdfa11.0036.cmake")
+set_tests_properties(rdfa11.0036 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;165;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0037 "/usr/bin/cmake" "-P" "test-rdfa11.0037.cmake")
+set_tests_properties(rdfa11.0037 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;171;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0038 "/usr/bin/cmake" "-P" "test-rdfa11.0038.cmake")
+set_tests_properties(rdfa11.0038 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;177;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0039 "/usr/bin/cmake" "-P" "test-rdfa11.0039.cmake")
+set_tests_properties(rdfa11.0039 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;183;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0041 "/usr/bin/cmake" "-P" "test-rdfa11.0041.cmake")
+set_tests_properties(rdfa11.0041 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;189;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0048 "/usr/bin/cmake" "-P" "test-rdfa11.0048.cmake")
+set_tests_properties(rdfa11.0048 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;195;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0049 "/usr/bin/cmake" "-P" "test-rdfa11.0049.cmake")
+set_tests_properties(rdfa11.0049 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;201;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0050 "/usr/bin/cmake" "-P" "test-rdfa11.0050.cmake")
+set_tests_properties(rdfa11.0050 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;207;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0051 "/usr/bin/cmake" "-P" "test-rdfa11.0051.cmake")
+set_tests_properties(rdfa11.0051 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;213;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0052 "/usr/bin/cmake" "-P" "test-rdfa11.0052.cmake")
+set_tests_properties(rdfa11.0052 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;219;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0053 "/usr/bin/cmake" "-P" "test-rdfa11.0053.cmake")
+set_tests_properties(rdfa11.0053 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;225;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0054 "/usr/bin/cmake" "-P" "test-rdfa11.0054.cmake")
+set_tests_properties(rdfa11.0054 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;231;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0055 "/usr/bin/cmake" "-P" "test-rdfa11.0055.cmake")
+set_tests_properties(rdfa11.0055 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;237;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0056 "/usr/bin/cmake" "-P" "test-rdfa11.0056.cmake")
+set_tests_properties(rdfa11.0056 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;243;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0057 "/usr/bin/cmake" "-P" "test-rdfa11.0057.cmake")
+set_tests_properties(rdfa11.0057 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;249;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0059 "/usr/bin/cmake" "-P" "test-rdfa11.0059.cmake")
+set_tests_properties(rdfa11.0059 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;255;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0060 "/usr/bin/cmake" "-P" "test-rdfa11.0060.cmake")
+set_tests_properties(rdfa11.0060 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;261;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0061 "/usr/bin/cmake" "-P" "test-rdfa11.0061.cmake")
+set_tests_properties(rdfa11.0061 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;267;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0062 "/usr/bin/cmake" "-P" "test-rdfa11.0062.cmake")
+set_tests_properties(rdfa11.0062 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;273;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0063 "/usr/bin/cmake" "-P" "test-rdfa11.0063.cmake")
+set_tests_properties(rdfa11.0063 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;279;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0064 "/usr/bin/cmake" "-P" "test-rdfa11.0064.cmake")
+set_tests_properties(rdfa11.0064 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;285;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0065 "/usr/bin/cmake" "-P" "test-rdfa11.0065.cmake")
+set_tests_properties(rdfa11.0065 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;291;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0066 "/usr/bin/cmake" "-P" "test-rdfa11.0066.cmake")
+set_tests_properties(rdfa11.0066 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;297;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0067 "/usr/bin/cmake" "-P" "test-rdfa11.0067.cmake")
+set_tests_properties(rdfa11.0067 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;303;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0068 "/usr/bin/cmake" "-P" "test-rdfa11.0068.cmake")
+set_tests_properties(rdfa11.0068 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;309;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0069 "/usr/bin/cmake" "-P" "test-rdfa11.0069.cmake")
+set_tests_properties(rdfa11.0069 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;315;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0070 "/usr/bin/cmake" "-P" "test-rdfa11.0070.cmake")
+set_tests_properties(rdfa11.0070 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;321;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0071 "/usr/bin/cmake" "-P" "test-rdfa11.0071.cmake")
+set_tests_properties(rdfa11.0071 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;327;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0072 "/usr/bin/cmake" "-P" "test-rdfa11.0072.cmake")
+set_tests_properties(rdfa11.0072 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;333;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0073 "/usr/bin/cmake" "-P" "test-rdfa11.0073.cmake")
+set_tests_properties(rdfa11.0073 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;339;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0074 "/usr/bin/cmake" "-P" "test-rdfa11.0074.cmake")
+set_tests_properties(rdfa11.0074 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;345;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0075 "/usr/bin/cmake" "-P" "test-rdfa11.0075.cmake")
+set_tests_properties(rdfa11.0075 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;351;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0076 "/usr/bin/cmake" "-P" "test-rdfa11.0076.cmake")
+set_tests_properties(rdfa11.0076 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;357;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0077 "/usr/bin/cmake" "-P" "test-rdfa11.0077.cmake")
+set_tests_properties(rdfa11.0077 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;363;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0079 "/usr/bin/cmake" "-P" "test-rdfa11.0079.cmake")
+set_tests_properties(rdfa11.0079 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;369;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0080 "/usr/bin/cmake" "-P" "test-rdfa11.0080.cmake")
+set_tests_properties(rdfa11.0080 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;375;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0083 "/usr/bin/cmake" "-P" "test-rdfa11.0083.cmake")
+set_tests_properties(rdfa11.0083 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;381;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0084 "/usr/bin/cmake" "-P" "test-rdfa11.0084.cmake")
+set_tests_properties(rdfa11.0084 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;387;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0085 "/usr/bin/cmake" "-P" "test-rdfa11.0085.cmake")
+set_tests_properties(rdfa11.0085 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;393;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0087 "/usr/bin/cmake" "-P" "test-rdfa11.0087.cmake")
+set_tests_properties(rdfa11.0087 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;399;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0088 "/usr/bin/cmake" "-P" "test-rdfa11.0088.cmake")
+set_tests_properties(rdfa11.0088 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;405;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0089 "/usr/bin/cmake" "-P" "test-rdfa11.0089.cmake")
+set_tests_properties(rdfa11.0089 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;411;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0091 "/usr/bin/cmake" "-P" "test-rdfa11.0091.cmake")
+set_tests_properties(rdfa11.0091 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;417;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0093 "/usr/bin/cmake" "-P" "test-rdfa11.0093.cmake")
+set_tests_properties(rdfa11.0093 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;423;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0099 "/usr/bin/cmake" "-P" "test-rdfa11.0099.cmake")
+set_tests_properties(rdfa11.0099 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;429;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0104 "/usr/bin/cmake" "-P" "test-rdfa11.0104.cmake")
+set_tests_properties(rdfa11.0104 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;435;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0106 "/usr/bin/cmake" "-P" "test-rdfa11.0106.cmake")
+set_tests_properties(rdfa11.0106 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;441;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0107 "/usr/bin/cmake" "-P" "test-rdfa11.0107.cmake")
+set_tests_properties(rdfa11.0107 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;447;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0108 "/usr/bin/cmake" "-P" "test-rdfa11.0108.cmake")
+set_tests_properties(rdfa11.0108 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;453;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0109 "/usr/bin/cmake" "-P" "test-rdfa11.0109.cmake")
+set_tests_properties(rdfa11.0109 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;459;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0110 "/usr/bin/cmake" "-P" "test-rdfa11.0110.cmake")
+set_tests_properties(rdfa11.0110 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;465;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0111 "/usr/bin/cmake" "-P" "test-rdfa11.0111.cmake")
+set_tests_properties(rdfa11.0111 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;471;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0112 "/usr/bin/cmake" "-P" "test-rdfa11.0112.cmake")
+set_tests_properties(rdfa11.0112 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;477;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0113 "/usr/bin/cmake" "-P" "test-rdfa11.0113.cmake")
+set_tests_properties(rdfa11.0113 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;483;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0114 "/usr/bin/cmake" "-P" "test-rdfa11.0114.cmake")
+set_tests_properties(rdfa11.0114 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;489;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0115 "/usr/bin/cmake" "-P" "test-rdfa11.0115.cmake")
+set_tests_properties(rdfa11.0115 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;495;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0117 "/usr/bin/cmake" "-P" "test-rdfa11.0117.cmake")
+set_tests_properties(rdfa11.0117 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;501;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0118 "/usr/bin/cmake" "-P" "test-rdfa11.0118.cmake")
+set_tests_properties(rdfa11.0118 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;507;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0119 "/usr/bin/cmake" "-P" "test-rdfa11.0119.cmake")
+set_tests_properties(rdfa11.0119 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;513;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0120 "/usr/bin/cmake" "-P" "test-rdfa11.0120.cmake")
+set_tests_properties(rdfa11.0120 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;519;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0121 "/usr/bin/cmake" "-P" "test-rdfa11.0121.cmake")
+set_tests_properties(rdfa11.0121 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;525;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0122 "/usr/bin/cmake" "-P" "test-rdfa11.0122.cmake")
+set_tests_properties(rdfa11.0122 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;531;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0126 "/usr/bin/cmake" "-P" "test-rdfa11.0126.cmake")
+set_tests_properties(rdfa11.0126 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;537;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0131 "/usr/bin/cmake" "-P" "test-rdfa11.0131.cmake")
+set_tests_properties(rdfa11.0131 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;543;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0134 "/usr/bin/cmake" "-P" "test-rdfa11.0134.cmake")
+set_tests_properties(rdfa11.0134 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;549;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0140 "/usr/bin/cmake" "-P" "test-rdfa11.0140.cmake")
+set_tests_properties(rdfa11.0140 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;555;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0147 "/usr/bin/cmake" "-P" "test-rdfa11.0147.cmake")
+set_tests_properties(rdfa11.0147 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;561;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0172 "/usr/bin/cmake" "-P" "test-rdfa11.0172.cmake")
+set_tests_properties(rdfa11.0172 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;567;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0173 "/usr/bin/cmake" "-P" "test-rdfa11.0173.cmake")
+set_tests_properties(rdfa11.0173 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;573;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0174 "/usr/bin/cmake" "-P" "test-rdfa11.0174.cmake")
+set_tests_properties(rdfa11.0174 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;579;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0175 "/usr/bin/cmake" "-P" "test-rdfa11.0175.cmake")
+set_tests_properties(rdfa11.0175 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;585;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0176 "/usr/bin/cmake" "-P" "test-rdfa11.0176.cmake")
+set_tests_properties(rdfa11.0176 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;591;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0177 "/usr/bin/cmake" "-P" "test-rdfa11.0177.cmake")
+set_tests_properties(rdfa11.0177 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;598;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0178 "/usr/bin/cmake" "-P" "test-rdfa11.0178.cmake")
+set_tests_properties(rdfa11.0178 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;604;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0179 "/usr/bin/cmake" "-P" "test-rdfa11.0179.cmake")
+set_tests_properties(rdfa11.0179 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;610;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0180 "/usr/bin/cmake" "-P" "test-rdfa11.0180.cmake")
+set_tests_properties(rdfa11.0180 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;616;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0181 "/usr/bin/cmake" "-P" "test-rdfa11.0181.cmake")
+set_tests_properties(rdfa11.0181 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;622;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0182 "/usr/bin/cmake" "-P" "test-rdfa11.0182.cmake")
+set_tests_properties(rdfa11.0182 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;628;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0183 "/usr/bin/cmake" "-P" "test-rdfa11.0183.cmake")
+set_tests_properties(rdfa11.0183 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;634;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0186 "/usr/bin/cmake" "-P" "test-rdfa11.0186.cmake")
+set_tests_properties(rdfa11.0186 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;640;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0187 "/usr/bin/cmake" "-P" "test-rdfa11.0187.cmake")
+set_tests_properties(rdfa11.0187 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;646;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0188 "/usr/bin/cmake" "-P" "test-rdfa11.0188.cmake")
+set_tests_properties(rdfa11.0188 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;652;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0189 "/usr/bin/cmake" "-P" "test-rdfa11.0189.cmake")
+set_tests_properties(rdfa11.0189 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;658;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0190 "/usr/bin/cmake" "-P" "test-rdfa11.0190.cmake")
+set_tests_properties(rdfa11.0190 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;664;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0196 "/usr/bin/cmake" "-P" "test-rdfa11.0196.cmake")
+set_tests_properties(rdfa11.0196 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;671;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0197 "/usr/bin/cmake" "-P" "test-rdfa11.0197.cmake")
+set_tests_properties(rdfa11.0197 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;677;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0198 "/usr/bin/cmake" "-P" "test-rdfa11.0198.cmake")
+set_tests_properties(rdfa11.0198 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;683;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0201 "/usr/bin/cmake" "-P" "test-rdfa11.0201.cmake")
+set_tests_properties(rdfa11.0201 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;690;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0202 "/usr/bin/cmake" "-P" "test-rdfa11.0202.cmake")
+set_tests_properties(rdfa11.0202 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;696;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0203 "/usr/bin/cmake" "-P" "test-rdfa11.0203.cmake")
+set_tests_properties(rdfa11.0203 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;703;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0206 "/usr/bin/cmake" "-P" "test-rdfa11.0206.cmake")
+set_tests_properties(rdfa11.0206 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;710;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0207 "/usr/bin/cmake" "-P" "test-rdfa11.0207.cmake")
+set_tests_properties(rdfa11.0207 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;716;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0213 "/usr/bin/cmake" "-P" "test-rdfa11.0213.cmake")
+set_tests_properties(rdfa11.0213 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;722;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0214 "/usr/bin/cmake" "-P" "test-rdfa11.0214.cmake")
+set_tests_properties(rdfa11.0214 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;728;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0216 "/usr/bin/cmake" "-P" "test-rdfa11.0216.cmake")
+set_tests_properties(rdfa11.0216 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;734;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0217 "/usr/bin/cmake" "-P" "test-rdfa11.0217.cmake")
+set_tests_properties(rdfa11.0217 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;740;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0218 "/usr/bin/cmake" "-P" "test-rdfa11.0218.cmake")
+set_tests_properties(rdfa11.0218 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;746;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0219 "/usr/bin/cmake" "-P" "test-rdfa11.0219.cmake")
+set_tests_properties(rdfa11.0219 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;752;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0220 "/usr/bin/cmake" "-P" "test-rdfa11.0220.cmake")
+set_tests_properties(rdfa11.0220 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;758;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0221 "/usr/bin/cmake" "-P" "test-rdfa11.0221.cmake")
+set_tests_properties(rdfa11.0221 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;764;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0222 "/usr/bin/cmake" "-P" "test-rdfa11.0222.cmake")
+set_tests_properties(rdfa11.0222 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;770;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0223 "/usr/bin/cmake" "-P" "test-rdfa11.0223.cmake")
+set_tests_properties(rdfa11.0223 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;776;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0224 "/usr/bin/cmake" "-P" "test-rdfa11.0224.cmake")
+set_tests_properties(rdfa11.0224 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;782;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0225 "/usr/bin/cmake" "-P" "test-rdfa11.0225.cmake")
+set_tests_properties(rdfa11.0225 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;788;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0226 "/usr/bin/cmake" "-P" "test-rdfa11.0226.cmake")
+set_tests_properties(rdfa11.0226 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;794;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0227 "/usr/bin/cmake" "-P" "test-rdfa11.0227.cmake")
+set_tests_properties(rdfa11.0227 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;800;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0228 "/usr/bin/cmake" "-P" "test-rdfa11.0228.cmake")
+set_tests_properties(rdfa11.0228 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;806;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0229 "/usr/bin/cmake" "-P" "test-rdfa11.0229.cmake")
+set_tests_properties(rdfa11.0229 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;812;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0230 "/usr/bin/cmake" "-P" "test-rdfa11.0230.cmake")
+set_tests_properties(rdfa11.0230 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;818;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0231 "/usr/bin/cmake" "-P" "test-rdfa11.0231.cmake")
+set_tests_properties(rdfa11.0231 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;824;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0232 "/usr/bin/cmake" "-P" "test-rdfa11.0232.cmake")
+set_tests_properties(rdfa11.0232 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;830;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0233 "/usr/bin/cmake" "-P" "test-rdfa11.0233.cmake")
+set_tests_properties(rdfa11.0233 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;836;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0234 "/usr/bin/cmake" "-P" "test-rdfa11.0234.cmake")
+set_tests_properties(rdfa11.0234 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;842;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0235 "/usr/bin/cmake" "-P" "test-rdfa11.0235.cmake")
+set_tests_properties(rdfa11.0235 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;848;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0236 "/usr/bin/cmake" "-P" "test-rdfa11.0236.cmake")
+set_tests_properties(rdfa11.0236 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;854;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0237 "/usr/bin/cmake" "-P" "test-rdfa11.0237.cmake")
+set_tests_properties(rdfa11.0237 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;861;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0238 "/usr/bin/cmake" "-P" "test-rdfa11.0238.cmake")
+set_tests_properties(rdfa11.0238 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;868;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0239 "/usr/bin/cmake" "-P" "test-rdfa11.0239.cmake")
+set_tests_properties(rdfa11.0239 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;875;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0246 "/usr/bin/cmake" "-P" "test-rdfa11.0246.cmake")
+set_tests_properties(rdfa11.0246 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;882;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0247 "/usr/bin/cmake" "-P" "test-rdfa11.0247.cmake")
+set_tests_properties(rdfa11.0247 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;888;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0248 "/usr/bin/cmake" "-P" "test-rdfa11.0248.cmake")
+set_tests_properties(rdfa11.0248 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;894;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0249 "/usr/bin/cmake" "-P" "test-rdfa11.0249.cmake")
+set_tests_properties(rdfa11.0249 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;900;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0250 "/usr/bin/cmake" "-P" "test-rdfa11.0250.cmake")
+set_tests_properties(rdfa11.0250 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;906;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0251 "/usr/bin/cmake" "-P" "test-rdfa11.0251.cmake")
+set_tests_properties(rdfa11.0251 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;912;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0252 "/usr/bin/cmake" "-P" "test-rdfa11.0252.cmake")
+set_tests_properties(rdfa11.0252 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;918;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0253 "/usr/bin/cmake" "-P" "test-rdfa11.0253.cmake")
+set_tests_properties(rdfa11.0253 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;924;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0254 "/usr/bin/cmake" "-P" "test-rdfa11.0254.cmake")
+set_tests_properties(rdfa11.0254 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;930;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0255 "/usr/bin/cmake" "-P" "test-rdfa11.0255.cmake")
+set_tests_properties(rdfa11.0255 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;936;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0256 "/usr/bin/cmake" "-P" "test-rdfa11.0256.cmake")
+set_tests_properties(rdfa11.0256 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;942;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0257 "/usr/bin/cmake" "-P" "test-rdfa11.0257.cmake")
+set_tests_properties(rdfa11.0257 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;949;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0258 "/usr/bin/cmake" "-P" "test-rdfa11.0258.cmake")
+set_tests_properties(rdfa11.0258 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;955;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0259 "/usr/bin/cmake" "-P" "test-rdfa11.0259.cmake")
+set_tests_properties(rdfa11.0259 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;961;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0260 "/usr/bin/cmake" "-P" "test-rdfa11.0260.cmake")
+set_tests_properties(rdfa11.0260 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;967;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0261 "/usr/bin/cmake" "-P" "test-rdfa11.0261.cmake")
+set_tests_properties(rdfa11.0261 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;973;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0262 "/usr/bin/cmake" "-P" "test-rdfa11.0262.cmake")
+set_tests_properties(rdfa11.0262 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;979;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0263 "/usr/bin/cmake" "-P" "test-rdfa11.0263.cmake")
+set_tests_properties(rdfa11.0263 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;985;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0264 "/usr/bin/cmake" "-P" "test-rdfa11.0264.cmake")
+set_tests_properties(rdfa11.0264 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;991;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0265 "/usr/bin/cmake" "-P" "test-rdfa11.0265.cmake")
+set_tests_properties(rdfa11.0265 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;997;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0266 "/usr/bin/cmake" "-P" "test-rdfa11.0266.cmake")
+set_tests_properties(rdfa11.0266 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1003;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0267 "/usr/bin/cmake" "-P" "test-rdfa11.0267.cmake")
+set_tests_properties(rdfa11.0267 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1009;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0268 "/usr/bin/cmake" "-P" "test-rdfa11.0268.cmake")
+set_tests_properties(rdfa11.0268 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1015;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0269 "/usr/bin/cmake" "-P" "test-rdfa11.0269.cmake")
+set_tests_properties(rdfa11.0269 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1021;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0271 "/usr/bin/cmake" "-P" "test-rdfa11.0271.cmake")
+set_tests_properties(rdfa11.0271 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1033;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0272 "/usr/bin/cmake" "-P" "test-rdfa11.0272.cmake")
+set_tests_properties(rdfa11.0272 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1039;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0273 "/usr/bin/cmake" "-P" "test-rdfa11.0273.cmake")
+set_tests_properties(rdfa11.0273 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1046;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0274 "/usr/bin/cmake" "-P" "test-rdfa11.0274.cmake")
+set_tests_properties(rdfa11.0274 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1053;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0275 "/usr/bin/cmake" "-P" "test-rdfa11.0275.cmake")
+set_tests_properties(rdfa11.0275 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1060;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0276 "/usr/bin/cmake" "-P" "test-rdfa11.0276.cmake")
+set_tests_properties(rdfa11.0276 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1067;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0277 "/usr/bin/cmake" "-P" "test-rdfa11.0277.cmake")
+set_tests_properties(rdfa11.0277 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1074;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0278 "/usr/bin/cmake" "-P" "test-rdfa11.0278.cmake")
+set_tests_properties(rdfa11.0278 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1081;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0279 "/usr/bin/cmake" "-P" "test-rdfa11.0279.cmake")
+set_tests_properties(rdfa11.0279 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1088;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0280 "/usr/bin/cmake" "-P" "test-rdfa11.0280.cmake")
+set_tests_properties(rdfa11.0280 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1095;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0281 "/usr/bin/cmake" "-P" "test-rdfa11.0281.cmake")
+set_tests_properties(rdfa11.0281 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1102;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0282 "/usr/bin/cmake" "-P" "test-rdfa11.0282.cmake")
+set_tests_properties(rdfa11.0282 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1109;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0283 "/usr/bin/cmake" "-P" "test-rdfa11.0283.cmake")
+set_tests_properties(rdfa11.0283 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1116;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0284 "/usr/bin/cmake" "-P" "test-rdfa11.0284.cmake")
+set_tests_properties(rdfa11.0284 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1122;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0285 "/usr/bin/cmake" "-P" "test-rdfa11.0285.cmake")
+set_tests_properties(rdfa11.0285 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1128;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0286 "/usr/bin/cmake" "-P" "test-rdfa11.0286.cmake")
+set_tests_properties(rdfa11.0286 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1135;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0287 "/usr/bin/cmake" "-P" "test-rdfa11.0287.cmake")
+set_tests_properties(rdfa11.0287 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1142;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0289 "/usr/bin/cmake" "-P" "test-rdfa11.0289.cmake")
+set_tests_properties(rdfa11.0289 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1149;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0290 "/usr/bin/cmake" "-P" "test-rdfa11.0290.cmake")
+set_tests_properties(rdfa11.0290 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1155;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0291 "/usr/bin/cmake" "-P" "test-rdfa11.0291.cmake")
+set_tests_properties(rdfa11.0291 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1161;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0292 "/usr/bin/cmake" "-P" "test-rdfa11.0292.cmake")
+set_tests_properties(rdfa11.0292 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1167;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0293 "/usr/bin/cmake" "-P" "test-rdfa11.0293.cmake")
+set_tests_properties(rdfa11.0293 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1173;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0295 "/usr/bin/cmake" "-P" "test-rdfa11.0295.cmake")
+set_tests_properties(rdfa11.0295 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1179;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0296 "/usr/bin/cmake" "-P" "test-rdfa11.0296.cmake")
+set_tests_properties(rdfa11.0296 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1186;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0297 "/usr/bin/cmake" "-P" "test-rdfa11.0297.cmake")
+set_tests_properties(rdfa11.0297 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1192;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0298 "/usr/bin/cmake" "-P" "test-rdfa11.0298.cmake")
+set_tests_properties(rdfa11.0298 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1198;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0299 "/usr/bin/cmake" "-P" "test-rdfa11.0299.cmake")
+set_tests_properties(rdfa11.0299 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1204;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0300 "/usr/bin/cmake" "-P" "test-rdfa11.0300.cmake")
+set_tests_properties(rdfa11.0300 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1210;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0301 "/usr/bin/cmake" "-P" "test-rdfa11.0301.cmake")
+set_tests_properties(rdfa11.0301 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1216;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0302 "/usr/bin/cmake" "-P" "test-rdfa11.0302.cmake")
+set_tests_properties(rdfa11.0302 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1222;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0303 "/usr/bin/cmake" "-P" "test-rdfa11.0303.cmake")
+set_tests_properties(rdfa11.0303 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1228;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
+add_test(rdfa11.0304 "/usr/bin/cmake" "-P" "test-rdfa11.0304.cmake")
+set_tests_properties(rdfa11.0304 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;454;ADD_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;1234;RAPPER_RDFDIFF_TEST;/root/repo/tests/rdfa11/CMakeLists.txt;0;")
@@ -0,0 +1,346 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/rdfxml
+# Build directory: /root/repo/_gate_build/tests/rdfxml
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rdfxml.ex-00:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-00.cmake")
+set_tests_properties(rdfxml.ex-00:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;7;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-00:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-00.out" "ex-00.res")
+set_tests_properties(rdfxml.ex-00:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;7;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-01:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-01.cmake")
+set_tests_properties(rdfxml.ex-01:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;13;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-01:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-01.out" "ex-01.res")
+set_tests_properties(rdfxml.ex-01:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;13;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-02:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-02.cmake")
+set_tests_properties(rdfxml.ex-02:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;19;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-02:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-02.out" "ex-02.res")
+set_tests_properties(rdfxml.ex-02:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;19;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-04:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-04.cmake")
+set_tests_properties(rdfxml.ex-04:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;25;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-04:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-04.out" "ex-04.res")
+set_tests_properties(rdfxml.ex-04:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;25;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-05:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-05.cmake")
+set_tests_properties(rdfxml.ex-05:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;31;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-05:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-05.out" "ex-05.res")
+set_tests_properties(rdfxml.ex-05:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;31;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-06:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-06.cmake")
+set_tests_properties(rdfxml.ex-06:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;37;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-06:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-06.out" "ex-06.res")
+set_tests_properties(rdfxml.ex-06:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;37;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-07:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-07.cmake")
+set_tests_properties(rdfxml.ex-07:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;43;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-07:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-07.out" "ex-07.res")
+set_tests_properties(rdfxml.ex-07:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;43;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-08:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-08.cmake")
+set_tests_properties(rdfxml.ex-08:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;49;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-08:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-08.out" "ex-08.res")
+set_tests_properties(rdfxml.ex-08:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;49;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-09:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-09.cmake")
+set_tests_properties(rdfxml.ex-09:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;55;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-09:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-09.out" "ex-09.res")
+set_tests_properties(rdfxml.ex-09:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;55;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-10:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-10.cmake")
+set_tests_properties(rdfxml.ex-10:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;61;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-10:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-10.out" "ex-10.res")
+set_tests_properties(rdfxml.ex-10:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;61;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-11:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-11.cmake")
+set_tests_properties(rdfxml.ex-11:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;67;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-11:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-11.out" "ex-11.res")
+set_tests_properties(rdfxml.ex-11:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;67;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-12:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-12.cmake")
+set_tests_properties(rdfxml.ex-12:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;73;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-12:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-12.out" "ex-12.res")
+set_tests_properties(rdfxml.ex-12:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;73;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-13:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-13.cmake")
+set_tests_properties(rdfxml.ex-13:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;79;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-13:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-13.out" "ex-13.res")
+set_tests_properties(rdfxml.ex-13:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;79;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-14:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-14.cmake")
+set_tests_properties(rdfxml.ex-14:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;85;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-14:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-14.out" "ex-14.res")
+set_tests_properties(rdfxml.ex-14:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;85;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-15:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-15.cmake")
+set_tests_properties(rdfxml.ex-15:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;91;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-15:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-15.out" "ex-15.res")
+set_tests_properties(rdfxml.ex-15:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;91;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-16:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-16.cmake")
+set_tests_properties(rdfxml.ex-16:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;97;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-16:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-16.out" "ex-16.res")
+set_tests_properties(rdfxml.ex-16:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;97;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-17:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-17.cmake")
+set_tests_properties(rdfxml.ex-17:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;103;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-17:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-17.out" "ex-17.res")
+set_tests_properties(rdfxml.ex-17:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;103;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-18:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-18.cmake")
+set_tests_properties(rdfxml.ex-18:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;109;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-18:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-18.out" "ex-18.res")
+set_tests_properties(rdfxml.ex-18:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;109;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-20:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-20.cmake")
+set_tests_properties(rdfxml.ex-20:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;115;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-20:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-20.out" "ex-20.res")
+set_tests_properties(rdfxml.ex-20:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;115;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-21:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-21.cmake")
+set_tests_properties(rdfxml.ex-21:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;121;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-21:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-21.out" "ex-21.res")
+set_tests_properties(rdfxml.ex-21:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;121;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-22:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-22.cmake")
+set_tests_properties(rdfxml.ex-22:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;127;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-22:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-22.out" "ex-22.res")
+set_tests_properties(rdfxml.ex-22:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;127;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-23:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-23.cmake")
+set_tests_properties(rdfxml.ex-23:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;133;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-23:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-23.out" "ex-23.res")
+set_tests_properties(rdfxml.ex-23:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;133;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-24:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-24.cmake")
+set_tests_properties(rdfxml.ex-24:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;139;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-24:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-24.out" "ex-24.res")
+set_tests_properties(rdfxml.ex-24:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;139;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-25:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-25.cmake")
+set_tests_properties(rdfxml.ex-25:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;145;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-25:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-25.out" "ex-25.res")
+set_tests_properties(rdfxml.ex-25:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;145;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-26:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-26.cmake")
+set_tests_properties(rdfxml.ex-26:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;151;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-26:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-26.out" "ex-26.res")
+set_tests_properties(rdfxml.ex-26:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;151;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-27:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-27.cmake")
+set_tests_properties(rdfxml.ex-27:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;157;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-27:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-27.out" "ex-27.res")
+set_tests_properties(rdfxml.ex-27:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;157;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-28:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-28.cmake")
+set_tests_properties(rdfxml.ex-28:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;163;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-28:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-28.out" "ex-28.res")
+set_tests_properties(rdfxml.ex-28:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;163;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-29:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-29.cmake")
+set_tests_properties(rdfxml.ex-29:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;169;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-29:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-29.out" "ex-29.res")
+set_tests_properties(rdfxml.ex-29:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;169;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-30:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-30.cmake")
+set_tests_properties(rdfxml.ex-30:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;175;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-30:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-30.out" "ex-30.res")
+set_tests_properties(rdfxml.ex-30:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;175;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-31:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-31.cmake")
+set_tests_properties(rdfxml.ex-31:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;181;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-31:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-31.out" "ex-31.res")
+set_tests_properties(rdfxml.ex-31:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;181;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-32:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-32.cmake")
+set_tests_properties(rdfxml.ex-32:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;187;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-32:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-32.out" "ex-32.res")
+set_tests_properties(rdfxml.ex-32:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;187;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-33:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-33.cmake")
+set_tests_properties(rdfxml.ex-33:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;193;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-33:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-33.out" "ex-33.res")
+set_tests_properties(rdfxml.ex-33:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;193;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-34:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-34.cmake")
+set_tests_properties(rdfxml.ex-34:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;199;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-34:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-34.out" "ex-34.res")
+set_tests_properties(rdfxml.ex-34:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;199;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-35:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-35.cmake")
+set_tests_properties(rdfxml.ex-35:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;205;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-35:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-35.out" "ex-35.res")
+set_tests_properties(rdfxml.ex-35:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;205;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-36:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-36.cmake")
+set_tests_properties(rdfxml.ex-36:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;211;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-36:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-36.out" "ex-36.res")
+set_tests_properties(rdfxml.ex-36:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;211;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-37:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-37.cmake")
+set_tests_properties(rdfxml.ex-37:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;217;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-37:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-37.out" "ex-37.res")
+set_tests_properties(rdfxml.ex-37:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;217;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-38:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-38.cmake")
+set_tests_properties(rdfxml.ex-38:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;223;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-38:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-38.out" "ex-38.res")
+set_tests_properties(rdfxml.ex-38:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;223;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-39:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-39.cmake")
+set_tests_properties(rdfxml.ex-39:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;229;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-39:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-39.out" "ex-39.res")
+set_tests_properties(rdfxml.ex-39:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;229;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-40:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-40.cmake")
+set_tests_properties(rdfxml.ex-40:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;235;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-40:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-40.out" "ex-40.res")
+set_tests_properties(rdfxml.ex-40:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;235;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-41:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-41.cmake")
+set_tests_properties(rdfxml.ex-41:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;241;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-41:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-41.out" "ex-41.res")
+set_tests_properties(rdfxml.ex-41:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;241;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-46:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-46.cmake")
+set_tests_properties(rdfxml.ex-46:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;247;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-46:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-46.out" "ex-46.res")
+set_tests_properties(rdfxml.ex-46:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;247;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-47:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-47.cmake")
+set_tests_properties(rdfxml.ex-47:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;253;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-47:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-47.out" "ex-47.res")
+set_tests_properties(rdfxml.ex-47:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;253;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-48:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-48.cmake")
+set_tests_properties(rdfxml.ex-48:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;259;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-48:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-48.out" "ex-48.res")
+set_tests_properties(rdfxml.ex-48:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;259;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-49:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-49.cmake")
+set_tests_properties(rdfxml.ex-49:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;265;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-49:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-49.out" "ex-49.res")
+set_tests_properties(rdfxml.ex-49:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;265;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-51:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-51.cmake")
+set_tests_properties(rdfxml.ex-51:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;271;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-51:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-51.out" "ex-51.res")
+set_tests_properties(rdfxml.ex-51:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;271;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-53:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-53.cmake")
+set_tests_properties(rdfxml.ex-53:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;277;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-53:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-53.out" "ex-53.res")
+set_tests_properties(rdfxml.ex-53:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;277;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-54:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-54.cmake")
+set_tests_properties(rdfxml.ex-54:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;283;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-54:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-54.out" "ex-54.res")
+set_tests_properties(rdfxml.ex-54:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;283;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-56:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-56.cmake")
+set_tests_properties(rdfxml.ex-56:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;289;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-56:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-56.out" "ex-56.res")
+set_tests_properties(rdfxml.ex-56:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;289;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-57:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-57.cmake")
+set_tests_properties(rdfxml.ex-57:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;295;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-57:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-57.out" "ex-57.res")
+set_tests_properties(rdfxml.ex-57:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;295;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-58:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-58.cmake")
+set_tests_properties(rdfxml.ex-58:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;301;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-58:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-58.out" "ex-58.res")
+set_tests_properties(rdfxml.ex-58:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;301;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-61:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-61.cmake")
+set_tests_properties(rdfxml.ex-61:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;307;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-61:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-61.out" "ex-61.res")
+set_tests_properties(rdfxml.ex-61:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;307;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.22-rdf-syntax-ns:run "/usr/bin/cmake" "-P" "test-rdfxml.22-rdf-syntax-ns.cmake")
+set_tests_properties(rdfxml.22-rdf-syntax-ns:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;313;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.22-rdf-syntax-ns:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/22-rdf-syntax-ns.out" "22-rdf-syntax-ns.res")
+set_tests_properties(rdfxml.22-rdf-syntax-ns:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;313;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.rdfs-namespace:run "/usr/bin/cmake" "-P" "test-rdfxml.rdfs-namespace.cmake")
+set_tests_properties(rdfxml.rdfs-namespace:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;319;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.rdfs-namespace:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/rdfs-namespace.out" "rdfs-namespace.res")
+set_tests_properties(rdfxml.rdfs-namespace:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;319;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.rdf-schema:run "/usr/bin/cmake" "-P" "test-rdfxml.rdf-schema.cmake")
+set_tests_properties(rdfxml.rdf-schema:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;325;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.rdf-schema:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/rdf-schema.out" "rdf-schema.res")
+set_tests_properties(rdfxml.rdf-schema:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;325;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.owl-schema:run "/usr/bin/cmake" "-P" "test-rdfxml.owl-schema.cmake")
+set_tests_properties(rdfxml.owl-schema:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;331;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.owl-schema:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/owl-schema.out" "owl-schema.res")
+set_tests_properties(rdfxml.owl-schema:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;331;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.daml-oil:run "/usr/bin/cmake" "-P" "test-rdfxml.daml-oil.cmake")
+set_tests_properties(rdfxml.daml-oil:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;337;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.daml-oil:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/daml-oil.out" "daml-oil.res")
+set_tests_properties(rdfxml.daml-oil:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;337;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.wine:run "/usr/bin/cmake" "-P" "test-rdfxml.wine.cmake")
+set_tests_properties(rdfxml.wine:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;343;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.wine:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/wine.out" "wine.res")
+set_tests_properties(rdfxml.wine:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;343;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-55:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-55.cmake")
+set_tests_properties(rdfxml.ex-55:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;349;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-55:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-55.out" "ex-55.res")
+set_tests_properties(rdfxml.ex-55:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;349;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-19:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-19.cmake")
+set_tests_properties(rdfxml.ex-19:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;355;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-19:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-19.out" "ex-19.res")
+set_tests_properties(rdfxml.ex-19:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;355;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-52:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-52.cmake")
+set_tests_properties(rdfxml.ex-52:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;361;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-52:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-52.out" "ex-52.res")
+set_tests_properties(rdfxml.ex-52:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;361;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-00 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-00.rdf" "http://librdf.org/raptor/tests/bad-00.rdf")
+set_tests_properties(rdfxml.bad-00 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;367;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-01 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-01.rdf" "http://librdf.org/raptor/tests/bad-01.rdf")
+set_tests_properties(rdfxml.bad-01 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;368;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-02 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-02.rdf" "http://librdf.org/raptor/tests/bad-02.rdf")
+set_tests_properties(rdfxml.bad-02 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;369;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-03 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-03.rdf" "http://librdf.org/raptor/tests/bad-03.rdf")
+set_tests_properties(rdfxml.bad-03 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;370;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-04 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-04.rdf" "http://librdf.org/raptor/tests/bad-04.rdf")
+set_tests_properties(rdfxml.bad-04 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;371;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-05 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-05.rdf" "http://librdf.org/raptor/tests/bad-05.rdf")
+set_tests_properties(rdfxml.bad-05 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;372;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-06 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-06.rdf" "http://librdf.org/raptor/tests/bad-06.rdf")
+set_tests_properties(rdfxml.bad-06 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;373;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-07 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-07.rdf" "http://librdf.org/raptor/tests/bad-07.rdf")
+set_tests_properties(rdfxml.bad-07 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;374;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-08 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-08.rdf" "http://librdf.org/raptor/tests/bad-08.rdf")
+set_tests_properties(rdfxml.bad-08 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;375;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-09 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-09.rdf" "http://librdf.org/raptor/tests/bad-09.rdf")
+set_tests_properties(rdfxml.bad-09 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;376;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-10 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-10.rdf" "http://librdf.org/raptor/tests/bad-10.rdf")
+set_tests_properties(rdfxml.bad-10 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;377;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-11 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-11.rdf" "http://librdf.org/raptor/tests/bad-11.rdf")
+set_tests_properties(rdfxml.bad-11 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;378;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-12 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-12.rdf" "http://librdf.org/raptor/tests/bad-12.rdf")
+set_tests_properties(rdfxml.bad-12 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;379;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-13 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-13.rdf" "http://librdf.org/raptor/tests/bad-13.rdf")
+set_tests_properties(rdfxml.bad-13 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;380;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-14 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-14.rdf" "http://librdf.org/raptor/tests/bad-14.rdf")
+set_tests_properties(rdfxml.bad-14 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;381;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-18 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-18.rdf" "http://librdf.org/raptor/tests/bad-18.rdf")
+set_tests_properties(rdfxml.bad-18 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;382;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-19 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-19.rdf" "http://librdf.org/raptor/tests/bad-19.rdf")
+set_tests_properties(rdfxml.bad-19 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;383;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-20 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-20.rdf" "http://librdf.org/raptor/tests/bad-20.rdf")
+set_tests_properties(rdfxml.bad-20 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;384;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-21 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-21.rdf" "http://librdf.org/raptor/tests/bad-21.rdf")
+set_tests_properties(rdfxml.bad-21 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;385;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-22 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-22.rdf" "http://librdf.org/raptor/tests/bad-22.rdf")
+set_tests_properties(rdfxml.bad-22 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;386;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-23 "/root/repo/_gate_build/utils/rapper" "-q" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-23.rdf" "http://librdf.org/raptor/tests/bad-23.rdf")
+set_tests_properties(rdfxml.bad-23 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;387;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-15 "/root/repo/_gate_build/utils/rapper" "-q" "-m" "strict" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-15.rdf" "http://librdf.org/raptor/tests/bad-15.rdf")
+set_tests_properties(rdfxml.bad-15 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;415;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-16 "/root/repo/_gate_build/utils/rapper" "-q" "-m" "strict" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-16.rdf" "http://librdf.org/raptor/tests/bad-16.rdf")
+set_tests_properties(rdfxml.bad-16 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;416;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.bad-17 "/root/repo/_gate_build/utils/rapper" "-q" "-m" "strict" "-o" "ntriples" "file:/root/repo/tests/rdfxml/bad-17.rdf" "http://librdf.org/raptor/tests/bad-17.rdf")
+set_tests_properties(rdfxml.bad-17 PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/tests/rdfxml/CMakeLists.txt;417;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.warn-00:run "/usr/bin/cmake" "-P" "test-rdfxml.warn-00.cmake")
+set_tests_properties(rdfxml.warn-00:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;427;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.warn-00:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/warn-00.out" "warn-00.res")
+set_tests_properties(rdfxml.warn-00:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;427;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.warn-02:run "/usr/bin/cmake" "-P" "test-rdfxml.warn-02.cmake")
+set_tests_properties(rdfxml.warn-02:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;433;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.warn-02:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/warn-02.out" "warn-02.res")
+set_tests_properties(rdfxml.warn-02:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;433;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.warn-04:run "/usr/bin/cmake" "-P" "test-rdfxml.warn-04.cmake")
+set_tests_properties(rdfxml.warn-04:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;439;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.warn-04:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/warn-04.out" "warn-04.res")
+set_tests_properties(rdfxml.warn-04:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;439;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.warn-05:run "/usr/bin/cmake" "-P" "test-rdfxml.warn-05.cmake")
+set_tests_properties(rdfxml.warn-05:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;445;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.warn-05:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/warn-05.out" "warn-05.res")
+set_tests_properties(rdfxml.warn-05:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;445;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.warn-06:run "/usr/bin/cmake" "-P" "test-rdfxml.warn-06.cmake")
+set_tests_properties(rdfxml.warn-06:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;451;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.warn-06:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/warn-06.out" "warn-06.res")
+set_tests_properties(rdfxml.warn-06:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;451;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.warn-07:run "/usr/bin/cmake" "-P" "test-rdfxml.warn-07.cmake")
+set_tests_properties(rdfxml.warn-07:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;457;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.warn-07:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/warn-07.out" "warn-07.res")
+set_tests_properties(rdfxml.warn-07:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;457;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-03:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-03.cmake")
+set_tests_properties(rdfxml.ex-03:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;463;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-03:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-03.out" "ex-03.res")
+set_tests_properties(rdfxml.ex-03:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;463;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-42:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-42.cmake")
+set_tests_properties(rdfxml.ex-42:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;469;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-42:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-42.out" "ex-42.res")
+set_tests_properties(rdfxml.ex-42:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;469;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-43:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-43.cmake")
+set_tests_properties(rdfxml.ex-43:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;475;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-43:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-43.out" "ex-43.res")
+set_tests_properties(rdfxml.ex-43:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;475;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-44:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-44.cmake")
+set_tests_properties(rdfxml.ex-44:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;481;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-44:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-44.out" "ex-44.res")
+set_tests_properties(rdfxml.ex-44:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;481;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-45:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-45.cmake")
+set_tests_properties(rdfxml.ex-45:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;487;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-45:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-45.out" "ex-45.res")
+set_tests_properties(rdfxml.ex-45:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;487;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-59:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-59.cmake")
+set_tests_properties(rdfxml.ex-59:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;493;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-59:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-59.rdf" "ex-59-rdfxml.rdf")
+set_tests_properties(rdfxml.ex-59:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;493;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-60:run "/usr/bin/cmake" "-P" "test-rdfxml.ex-60.cmake")
+set_tests_properties(rdfxml.ex-60:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;499;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
+add_test(rdfxml.ex-60:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/rdfxml/ex-60.rdf" "ex-60-rdfxml.rdf")
+set_tests_properties(rdfxml.ex-60:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;499;RAPPER_TEST;/root/repo/tests/rdfxml/CMakeLists.txt;0;")
@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -o ntriples /root/repo/tests/rdfxml/22-rdf-syntax-ns.rdf http://www.w3.org/1999/02/22-rdf-syntax-ns
+	TIMEOUT 10
+	OUTPUT_FILE 22-rdf-syntax-ns.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/rdfxml/22-rdf-syntax-ns.res.raw
+	22-rdf-syntax-ns.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
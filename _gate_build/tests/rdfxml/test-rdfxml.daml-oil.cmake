@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -o ntriples /root/repo/tests/rdfxml/daml-oil.rdf http://www.daml.org/2001/03/daml+oil
+	TIMEOUT 10
+	OUTPUT_FILE daml-oil.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/rdfxml/daml-oil.res.raw
+	daml-oil.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -o ntriples /root/repo/tests/rdfxml/ex-40.rdf http://librdf.org/raptor/tests/ex-40.rdf
+	TIMEOUT 10
+	OUTPUT_FILE ex-40.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/rdfxml/ex-40.res.raw
+	ex-40.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -o ntriples /root/repo/tests/rdfxml/ex-49.rdf http://librdf.org/raptor/tests/ex-49.rdf
+	TIMEOUT 10
+	OUTPUT_FILE ex-49.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/rdfxml/ex-49.res.raw
+	ex-49.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
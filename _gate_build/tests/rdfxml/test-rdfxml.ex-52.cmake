@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -f scanForRDF -o ntriples file:/root/repo/tests/rdfxml/ex-52.svg http://librdf.org/raptor/tests/ex-52.rdf
+	TIMEOUT 10
+	OUTPUT_FILE ex-52.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/rdfxml/ex-52.res.raw
+	ex-52.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
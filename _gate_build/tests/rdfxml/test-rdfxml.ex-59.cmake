@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -i ntriples -o rdfxml /root/repo/tests/rdfxml/ex-59.nt -
+	TIMEOUT 10
+	OUTPUT_FILE ex-59-rdfxml.rdf.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/rdfxml/ex-59-rdfxml.rdf.raw
+	ex-59-rdfxml.rdf
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
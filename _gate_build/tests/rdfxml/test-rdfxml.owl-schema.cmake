@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -o ntriples /root/repo/tests/rdfxml/owl-schema.rdf http://www.w3.org/2002/07/owl
+	TIMEOUT 10
+	OUTPUT_FILE owl-schema.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/rdfxml/owl-schema.res.raw
+	owl-schema.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -o ntriples /root/repo/tests/rdfxml/rdf-schema.rdf http://www.w3.org/2000/01/rdf-schema
+	TIMEOUT 10
+	OUTPUT_FILE rdf-schema.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/rdfxml/rdf-schema.res.raw
+	rdf-schema.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
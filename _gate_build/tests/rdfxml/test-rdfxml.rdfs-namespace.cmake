@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -o ntriples /root/repo/tests/rdfxml/rdfs-namespace.rdf http://www.w3.org/2000/01/rdf-schema
+	TIMEOUT 10
+	OUTPUT_FILE rdfs-namespace.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/rdfxml/rdfs-namespace.res.raw
+	rdfs-namespace.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
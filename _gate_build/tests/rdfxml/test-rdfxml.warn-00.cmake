@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -o ntriples file:/root/repo/tests/rdfxml/warn-00.rdf http://librdf.org/raptor/tests/warn-00.rdf
+	TIMEOUT 10
+	OUTPUT_FILE warn-00.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/rdfxml/warn-00.res.raw
+	warn-00.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
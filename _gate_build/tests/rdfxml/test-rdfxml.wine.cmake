@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -o ntriples /root/repo/tests/rdfxml/wine.rdf http://www.w3.org/TR/owl-guide/wine.rdf
+	TIMEOUT 10
+	OUTPUT_FILE wine.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/rdfxml/wine.res.raw
+	wine.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
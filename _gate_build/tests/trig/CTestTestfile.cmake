@@ -0,0 +1,26 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/trig
+# Build directory: /root/repo/_gate_build/tests/trig
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(trig.example1:run "/usr/bin/cmake" "-P" "test-trig.example1.cmake")
+set_tests_properties(trig.example1:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/trig/CMakeLists.txt;7;RAPPER_TEST;/root/repo/tests/trig/CMakeLists.txt;0;")
+add_test(trig.example1:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/trig/example1.out" "example1.res")
+set_tests_properties(trig.example1:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/trig/CMakeLists.txt;7;RAPPER_TEST;/root/repo/tests/trig/CMakeLists.txt;0;")
+add_test(trig.example2:run "/usr/bin/cmake" "-P" "test-trig.example2.cmake")
+set_tests_properties(trig.example2:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/trig/CMakeLists.txt;13;RAPPER_TEST;/root/repo/tests/trig/CMakeLists.txt;0;")
+add_test(trig.example2:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/trig/example2.out" "example2.res")
+set_tests_properties(trig.example2:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/trig/CMakeLists.txt;13;RAPPER_TEST;/root/repo/tests/trig/CMakeLists.txt;0;")
+add_test(trig.example3:run "/usr/bin/cmake" "-P" "test-trig.example3.cmake")
+set_tests_properties(trig.example3:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/trig/CMakeLists.txt;19;RAPPER_TEST;/root/repo/tests/trig/CMakeLists.txt;0;")
+add_test(trig.example3:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/trig/example3.out" "example3.res")
+set_tests_properties(trig.example3:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/trig/CMakeLists.txt;19;RAPPER_TEST;/root/repo/tests/trig/CMakeLists.txt;0;")
+add_test(trig.bug370:run "/usr/bin/cmake" "-P" "test-trig.bug370.cmake")
+set_tests_properties(trig.bug370:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/trig/CMakeLists.txt;25;RAPPER_TEST;/root/repo/tests/trig/CMakeLists.txt;0;")
+add_test(trig.bug370:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/trig/bug370.out" "bug370.res")
+set_tests_properties(trig.bug370:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/trig/CMakeLists.txt;25;RAPPER_TEST;/root/repo/tests/trig/CMakeLists.txt;0;")
+add_test(trig.bug451:run "/usr/bin/cmake" "-P" "test-trig.bug451.cmake")
+set_tests_properties(trig.bug451:run PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;397;ADD_TEST;/root/repo/tests/trig/CMakeLists.txt;31;RAPPER_TEST;/root/repo/tests/trig/CMakeLists.txt;0;")
+add_test(trig.bug451:cmp "/usr/bin/cmake" "-E" "compare_files" "/root/repo/tests/trig/bug451.out" "bug451.res")
+set_tests_properties(trig.bug451:cmp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;398;ADD_TEST;/root/repo/tests/trig/CMakeLists.txt;31;RAPPER_TEST;/root/repo/tests/trig/CMakeLists.txt;0;")
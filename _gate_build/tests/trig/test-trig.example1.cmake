@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -i trig -o nquads /root/repo/tests/trig/example1.trig http://example.librdf.org/example1.trig
+	TIMEOUT 10
+	OUTPUT_FILE example1.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/trig/example1.res.raw
+	example1.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -i trig -o nquads /root/repo/tests/trig/example2.trig http://example.librdf.org/example2.trig
+	TIMEOUT 10
+	OUTPUT_FILE example2.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/trig/example2.res.raw
+	example2.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
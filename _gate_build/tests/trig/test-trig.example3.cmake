@@ -0,0 +1,16 @@
+
+EXECUTE_PROCESS(
+	COMMAND /root/repo/_gate_build/utils/rapper -q -i trig -o nquads /root/repo/tests/trig/example3.trig http://example.librdf.org/example3.trig
+	TIMEOUT 10
+	OUTPUT_FILE example3.res.raw
+	ERROR_QUIET
+)
+
+# http://public.kitware.com/Bug/view.php?id=13007
+
+CONFIGURE_FILE(
+	/root/repo/_gate_build/tests/trig/example3.res.raw
+	example3.res
+	@ONLY
+	NEWLINE_STYLE UNIX
+)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rapper.dir/rapper.c.o"
+  "CMakeFiles/rapper.dir/rapper.c.o.d"
+  "rapper"
+  "rapper.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rapper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raptor_bench.dir/raptor_bench.c.o"
+  "CMakeFiles/raptor_bench.dir/raptor_bench.c.o.d"
+  "raptor_bench"
+  "raptor_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/raptor_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rdfdiff.dir/rdfdiff.c.o"
+  "CMakeFiles/rdfdiff.dir/rdfdiff.c.o.d"
+  "rdfdiff"
+  "rdfdiff.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rdfdiff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -396,9 +396,10 @@ rdfacontext* rdfa_create_new_element_context(rdfalist* context_stack)
       rdfa_copy_mapping((void**)parent_context->uri_mappings,
          (copy_mapping_value_fp)rdfa_replace_string);
 #endif
-   rval->term_mappings =
-      rdfa_copy_mapping((void**)parent_context->term_mappings,
-         (copy_mapping_value_fp)rdfa_replace_string);
+   /* term mappings are only ever modified when the initial context is
+    * set up on the root, so share the parent's by reference instead of
+    * deep-copying dozens of strings for every element entered */
+   rval->term_mappings = rdfa_share_mapping(parent_context->term_mappings);
    rval->list_mappings =
       rdfa_copy_mapping((void**)parent_context->local_list_mappings,
          (copy_mapping_value_fp)rdfa_replace_list);
@@ -162,11 +162,9 @@ void rdfa_complete_list_triples(rdfacontext* context)
                 *   http://www.w3.org/1999/02/22-rdf-syntax-ns#first
                 * object
                 *   full IRI or literal */
-               triple->subject =
-                  rdfa_replace_string(triple->subject, bnode);
-               triple->predicate =
-                  rdfa_replace_string(triple->predicate,
-                     "http://www.w3.org/1999/02/22-rdf-syntax-ns#first");
+               rdfa_triple_set_subject(triple, bnode);
+               rdfa_triple_set_predicate(triple,
+                  "http://www.w3.org/1999/02/22-rdf-syntax-ns#first");
                context->default_graph_triple_callback(
                   triple, context->callback_data);
 
@@ -218,10 +216,8 @@ void rdfa_complete_list_triples(rdfacontext* context)
             if(tmp) {
               tmp[0] = '\0';
               triple = (rdftriple*)list->items[0]->data;
-              triple->subject =
-                rdfa_replace_string(triple->subject, subject);
-              triple->predicate =
-                rdfa_replace_string(triple->predicate, predicate);
+              rdfa_triple_set_subject(triple, subject);
+              rdfa_triple_set_predicate(triple, predicate);
               context->default_graph_triple_callback(
                 triple, context->callback_data);
             }
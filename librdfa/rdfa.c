@@ -55,6 +55,17 @@
 #define READ_BUFFER_SIZE 4096
 #define RDFA_DOCTYPE_STRING_LENGTH 103
 
+/* overlap kept when scanning newly appended preread data, so that
+ * markers split across chunk boundaries are still found. Must be at
+ * least as long as the longest marker searched for below. */
+#define RDFA_SNIFF_OVERLAP 32
+
+/* sticky document sniffing state, held in rdfacontext.wb_sniff_flags */
+#define RDFA_SNIFF_XHTML_RDFA_1_0 (1 << 0)
+#define RDFA_SNIFF_XHTML_RDFA_1_1 (1 << 1)
+#define RDFA_SNIFF_HTML           (1 << 2)
+#define RDFA_SNIFF_HEAD_END       (1 << 3)
+
 /**
  * Read the head of the XHTML document and determines the base IRI for
  * the document.
@@ -71,24 +82,20 @@ static size_t rdfa_init_base(
    char* temp_buffer, size_t bytes_read)
 {
    char* head_end = NULL;
+   char* scan_start = NULL;
    size_t offset = context->wb_position;
-   size_t needed_size = 0;
-
-   if((offset + bytes_read) > *working_buffer_size)
-   {
-      needed_size = (offset + bytes_read) - *working_buffer_size;
-   }
-
-   /* search for the end of <head>, stop if <head> was found */
 
    /* extend the working buffer size */
-   if(needed_size > 0)
+   if((offset + bytes_read) > *working_buffer_size)
    {
-      size_t temp_buffer_size = sizeof(char) * READ_BUFFER_SIZE;
-      if((size_t)needed_size > temp_buffer_size)
-         temp_buffer_size += needed_size;
-
-      *working_buffer_size += temp_buffer_size;
+      /* grow geometrically so that accumulating a large preread region
+       * costs amortized-linear copies instead of one realloc per chunk */
+      size_t new_buffer_size =
+         *working_buffer_size ? (*working_buffer_size * 2) : READ_BUFFER_SIZE;
+      if(new_buffer_size < (offset + bytes_read))
+         new_buffer_size = offset + bytes_read + READ_BUFFER_SIZE;
+
+      *working_buffer_size = new_buffer_size;
       /* +1 for NUL at end, to allow strstr() etc. to work */
       *working_buffer = (char*)realloc(*working_buffer, *working_buffer_size + 1);
    }
@@ -98,18 +105,36 @@ static size_t rdfa_init_base(
    /* ensure the buffer is a NUL-terminated string */
    *(*working_buffer + offset + bytes_read) = '\0';
 
-   /* Sniff the beginning of the document for any document information */
-   if(strstr(*working_buffer, "-//W3C//DTD XHTML+RDFa 1.0//EN") != NULL)
+   /* Sniff the beginning of the document for any document information.
+    * Only the newly appended data is scanned, plus a small overlap for
+    * markers straddling a chunk boundary; markers found earlier are
+    * remembered in wb_sniff_flags so feeding a large document in many
+    * small chunks does not rescan the whole buffer every time. */
+   scan_start = *working_buffer;
+   if(context->wb_sniff_offset > RDFA_SNIFF_OVERLAP)
+      scan_start += context->wb_sniff_offset - RDFA_SNIFF_OVERLAP;
+
+   if(!(context->wb_sniff_flags & RDFA_SNIFF_XHTML_RDFA_1_0) &&
+      strstr(scan_start, "-//W3C//DTD XHTML+RDFa 1.0//EN") != NULL)
+      context->wb_sniff_flags |= RDFA_SNIFF_XHTML_RDFA_1_0;
+   if(!(context->wb_sniff_flags & RDFA_SNIFF_XHTML_RDFA_1_1) &&
+      strstr(scan_start, "-//W3C//DTD XHTML+RDFa 1.1//EN") != NULL)
+      context->wb_sniff_flags |= RDFA_SNIFF_XHTML_RDFA_1_1;
+   if(!(context->wb_sniff_flags & RDFA_SNIFF_HTML) &&
+      strstr(scan_start, "<html") != NULL)
+      context->wb_sniff_flags |= RDFA_SNIFF_HTML;
+
+   if(context->wb_sniff_flags & RDFA_SNIFF_XHTML_RDFA_1_0)
    {
       context->host_language = HOST_LANGUAGE_XHTML1;
       context->rdfa_version = RDFA_VERSION_1_0;
    }
-   else if(strstr(*working_buffer, "-//W3C//DTD XHTML+RDFa 1.1//EN") != NULL)
+   else if(context->wb_sniff_flags & RDFA_SNIFF_XHTML_RDFA_1_1)
    {
       context->host_language = HOST_LANGUAGE_XHTML1;
       context->rdfa_version = RDFA_VERSION_1_1;
    }
-   else if(strstr(*working_buffer, "<html") != NULL)
+   else if(context->wb_sniff_flags & RDFA_SNIFF_HTML)
    {
       context->host_language = HOST_LANGUAGE_HTML;
       context->rdfa_version = RDFA_VERSION_1_1;
@@ -128,26 +153,42 @@ static size_t rdfa_init_base(
      context->rdfa_version = RDFA_VERSION_1_1;
 #endif
 
-   /* search for the end of </head> in */
-   head_end = strstr(*working_buffer, "</head>");
-   if(head_end == NULL)
-      head_end = strstr(*working_buffer, "</HEAD>");
+   /* remember where <base was first seen; the href value may only be
+    * completed by a later chunk, so the offset is kept in the context
+    * (stored off-by-one so that zero means "not seen yet") */
+   if(context->wb_base_offset == 0)
+   {
+      char* base_start = strstr(scan_start, "<base ");
+      if(base_start == NULL)
+         base_start = strstr(scan_start, "<BASE ");
+      if(base_start != NULL)
+         context->wb_base_offset = (size_t)(base_start - *working_buffer) + 1;
+   }
+
+   /* search for the end of </head> in the newly appended data */
+   if(!(context->wb_sniff_flags & RDFA_SNIFF_HEAD_END))
+   {
+      head_end = strstr(scan_start, "</head>");
+      if(head_end == NULL)
+         head_end = strstr(scan_start, "</HEAD>");
+      if(head_end != NULL)
+         context->wb_sniff_flags |= RDFA_SNIFF_HEAD_END;
+   }
 
    context->wb_position += bytes_read;
+   if(context->wb_position > context->wb_high_water)
+      context->wb_high_water = context->wb_position;
+   context->wb_sniff_offset = context->wb_position;
 
-   if(head_end == NULL)
+   if(!(context->wb_sniff_flags & RDFA_SNIFF_HEAD_END))
       return bytes_read;
 
-   /* if </head> was found, search for <base and extract the base URI */
-   if(head_end != NULL)
+   /* if </head> was found, extract the base URI from any <base seen */
+   if(context->wb_base_offset != 0)
    {
-      char* base_start = strstr(*working_buffer, "<base ");
-      char* href_start = NULL;
-      if(base_start == NULL)
-         base_start = strstr(*working_buffer, "<BASE ");
-      if(base_start != NULL)
-        href_start = strstr(base_start, "href=");
-      
+      char* base_start = *working_buffer + (context->wb_base_offset - 1);
+      char* href_start = strstr(base_start, "href=");
+
       if(href_start != NULL)
       {
          char sep = href_start[5];
@@ -1510,6 +1551,11 @@ char* rdfa_get_buffer(rdfacontext* context, size_t* blen)
    return context->working_buffer;
 }
 
+size_t rdfa_get_buffer_high_water(rdfacontext* context)
+{
+   return context->wb_high_water;
+}
+
 int rdfa_parse_buffer(rdfacontext* context, size_t bytes)
 {
    int rval;
@@ -152,6 +152,13 @@ typedef struct rdftriple
    rdfresource_t object_type;
    char* datatype;
    char* language;
+   /* Private: bitmask tracking which string members were replaced after
+    * creation and thus own separate heap allocations. Strings copied at
+    * creation time live in the triple's own allocation block and must
+    * not be freed individually. Managed by rdfa_create_triple(),
+    * rdfa_triple_set_subject(), rdfa_triple_set_predicate() and
+    * rdfa_free_triple(). */
+   unsigned char string_flags;
 } rdftriple;
 
 /**
@@ -249,6 +256,10 @@ typedef struct rdfacontext
    size_t wb_allocated;
    char* working_buffer;
    size_t wb_position;
+   size_t wb_high_water;
+   size_t wb_sniff_offset;
+   size_t wb_base_offset;
+   int wb_sniff_flags;
 #ifdef LIBRDFA_IN_RAPTOR
    raptor_world *world;
    raptor_locator *locator;
@@ -335,6 +346,18 @@ DLLEXPORT int rdfa_parse_chunk(
  */
 DLLEXPORT char* rdfa_get_buffer(rdfacontext* context, size_t* blen);
 
+/**
+ * Gets the largest number of bytes that were held in the context's
+ * working buffer at any point during the parse so far. Useful for
+ * monitoring how much input a document forced the parser to buffer
+ * while it searched for the base IRI.
+ *
+ * @param context the base rdfa context.
+ *
+ * @return the working buffer high-water mark, in bytes.
+ */
+DLLEXPORT size_t rdfa_get_buffer_high_water(rdfacontext* context);
+
 /**
  * Informs the parser to attempt to parse more of the given context's input
  * buffer. To fill the input buffer with data, call rdfa_get_buffer().
@@ -309,15 +309,76 @@ void rdfa_add_item(rdfalist* list, void* data, liflag_t flags)
    ++list->num_items;
 }
 
+/* number of slots in a mapping's hidden hash index; must be a power
+ * of two and comfortably larger than MAX_URI_MAPPINGS so the open
+ * addressing probe chains stay short */
+#define RDFA_MAPPING_INDEX_SIZE 256
+
+/* hidden bookkeeping stored immediately before a mapping's first
+ * element: a reference count so mappings can be shared between
+ * evaluation contexts, and a hash index over the keys so lookups
+ * avoid a linear strcmp scan of the whole table */
+typedef struct
+{
+   size_t ref_count;
+   /* number of key/value pairs appended to the mapping */
+   size_t num_pairs;
+   /* each slot holds 1 + the pair number of a key, 0 when empty */
+   unsigned short index[RDFA_MAPPING_INDEX_SIZE];
+} rdfa_mapping_header;
+
+#define RDFA_MAPPING_HEADER(mapping) (((rdfa_mapping_header*)(void*)(mapping)) - 1)
+
+static size_t rdfa_mapping_hash_key(const char* key)
+{
+   size_t hash = 5381;
+
+   while(*key != '\0')
+   {
+      hash = ((hash << 5) + hash) + (unsigned char)*key++;
+   }
+
+   return hash;
+}
+
+static void rdfa_mapping_index_insert(
+   void** mapping, const char* key, size_t pair)
+{
+   rdfa_mapping_header* header = RDFA_MAPPING_HEADER(mapping);
+   size_t i = rdfa_mapping_hash_key(key) & (RDFA_MAPPING_INDEX_SIZE - 1);
+
+   while(header->index[i] != 0)
+   {
+      i = (i + 1) & (RDFA_MAPPING_INDEX_SIZE - 1);
+   }
+
+   header->index[i] = (unsigned short)(pair + 1);
+}
+
 void** rdfa_create_mapping(size_t elements)
 {
    size_t mapping_size = sizeof(void*) * MAX_URI_MAPPINGS * 2;
-   void** mapping = (void**)malloc(mapping_size);
+   rdfa_mapping_header* header =
+      (rdfa_mapping_header*)malloc(sizeof(rdfa_mapping_header) + mapping_size);
+   void** mapping = NULL;
 
    /* only initialize the mapping if it is not null. */
+   if(header != NULL)
+   {
+      memset(header, 0, sizeof(rdfa_mapping_header) + mapping_size);
+      header->ref_count = 1;
+      mapping = (void**)(header + 1);
+   }
+
+   return mapping;
+}
+
+void** rdfa_share_mapping(void** mapping)
+{
+   /* share by reference, bumping the hidden reference count */
    if(mapping != NULL)
    {
-      memset(mapping, 0, mapping_size);
+      RDFA_MAPPING_HEADER(mapping)->ref_count++;
    }
 
    return mapping;
@@ -371,15 +432,22 @@ void rdfa_append_to_list_mapping(
 void** rdfa_copy_mapping(
    void** mapping, copy_mapping_value_fp copy_mapping_value)
 {
-   void** rval = (void**)calloc(MAX_URI_MAPPINGS * 2, sizeof(void*));
+   void** rval = rdfa_create_mapping(MAX_URI_MAPPINGS);
    void** mptr = mapping;
    void** rptr = rval;
+   size_t pairs = 0;
+
+   if(rval == NULL)
+   {
+      return NULL;
+   }
 
    /* copy each element of the old mapping to the new mapping. */
    while(*mptr != NULL)
    {
       /* copy the key */
       *rptr = rdfa_replace_string((char*)*rptr, (const char*)*mptr);
+      rdfa_mapping_index_insert(rval, (const char*)*mptr, pairs);
       rptr++;
       mptr++;
 
@@ -387,64 +455,69 @@ void** rdfa_copy_mapping(
       *rptr = copy_mapping_value(*rptr, *mptr);
       rptr++;
       mptr++;
+      pairs++;
    }
 
+   RDFA_MAPPING_HEADER(rval)->num_pairs = pairs;
+
    return rval;
 }
 
 void rdfa_update_mapping(void** mapping, const char* key, const void* value,
    update_mapping_value_fp update_mapping_value)
 {
-   int found = 0;
-   void** mptr = mapping;
+   rdfa_mapping_header* header = RDFA_MAPPING_HEADER(mapping);
+   size_t i = rdfa_mapping_hash_key(key) & (RDFA_MAPPING_INDEX_SIZE - 1);
+   void** mptr;
 
-   /* search the current mapping to see if the key exists in the mapping */
-   while(!found && (*mptr != NULL))
+   /* probe the hash index to see if the key exists in the mapping */
+   while(header->index[i] != 0)
    {
+      mptr = mapping + (size_t)(header->index[i] - 1) * 2;
       if(strcmp((char*)*mptr, key) == 0)
       {
          mptr++;
          *mptr = update_mapping_value(*mptr, value);
-         found = 1;
-      }
-      else
-      {
-         mptr++;
+         return;
       }
-      mptr++;
+      i = (i + 1) & (RDFA_MAPPING_INDEX_SIZE - 1);
    }
 
-   /* if we made it through the entire URI mapping and the key was not
-    * found, create a new key-value pair. */
-   if(!found)
+   /* the key was not found and the mapping is full; drop the update
+    * rather than writing past the end of the table */
+   if(header->num_pairs >= MAX_URI_MAPPINGS)
    {
-     *mptr = rdfa_replace_string((char*)*mptr, key);
-      mptr++;
-      *mptr = update_mapping_value(*mptr, value);
+      return;
    }
+
+   /* the key was not found, create a new key-value pair */
+   mptr = mapping + header->num_pairs * 2;
+   *mptr = rdfa_replace_string((char*)*mptr, key);
+   mptr++;
+   *mptr = update_mapping_value(*mptr, value);
+   header->index[i] = (unsigned short)(header->num_pairs + 1);
+   header->num_pairs++;
 }
 
 const void* rdfa_get_mapping(void** mapping, const char* key)
 {
-   const void* rval = NULL;
-   char** mptr = (char**)mapping;
+   rdfa_mapping_header* header = RDFA_MAPPING_HEADER(mapping);
+   size_t i = rdfa_mapping_hash_key(key) & (RDFA_MAPPING_INDEX_SIZE - 1);
 
-   /* search the current mapping to see if the key exists in the mapping. */
-   while(*mptr != NULL)
+   /* probe the hash index for the key; a slot whose key no longer
+    * matches (such as one overwritten with RDFA_MAPPING_DELETED_KEY)
+    * just extends the probe chain */
+   while(header->index[i] != 0)
    {
-      if(strcmp(*mptr, key) == 0)
-      {
-         mptr++;
-         rval = *mptr;
-      }
-      else
+      void** mptr = mapping + (size_t)(header->index[i] - 1) * 2;
+      if(strcmp((char*)*mptr, key) == 0)
       {
-         mptr++;
+         return mptr[1];
       }
-      mptr++;
+      i = (i + 1) & (RDFA_MAPPING_INDEX_SIZE - 1);
    }
 
-   return rval;
+   return NULL;
 }
 
 const void* rdfa_get_list_mapping(
@@ -513,6 +586,14 @@ void rdfa_free_mapping(void** mapping, free_mapping_value_fp free_value)
 
    if(mapping != NULL)
    {
+      /* a shared mapping is only torn down with the last reference */
+      rdfa_mapping_header* header = RDFA_MAPPING_HEADER(mapping);
+      header->ref_count--;
+      if(header->ref_count > 0)
+      {
+         return;
+      }
+
       /* free all of the memory in the mapping */
       while(*mptr != NULL)
       {
@@ -522,7 +603,7 @@ void rdfa_free_mapping(void** mapping, free_mapping_value_fp free_value)
          mptr++;
       }
 
-      free(mapping);
+      free(header);
    }
 }
 
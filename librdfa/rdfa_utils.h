@@ -113,6 +113,17 @@ typedef void (*free_mapping_value_fp)(void*);
  */
 void** rdfa_create_mapping(size_t elements);
 
+/**
+ * Shares a mapping by reference, incrementing its hidden reference
+ * count.  The mapping is only destroyed when rdfa_free_mapping() has
+ * been called once for every reference.
+ *
+ * @param mapping the mapping to share.
+ *
+ * @return the same mapping pointer.
+ */
+void** rdfa_share_mapping(void** mapping);
+
 /**
  * Adds a list to a mapping given a key to create. The result will be a
  * zero-item list associated with the given key in the mapping.
@@ -371,6 +382,28 @@ rdftriple* rdfa_create_triple(const char* subject, const char* predicate,
    const char* object, rdfresource_t object_type, const char* datatype,
    const char* language);
 
+/**
+ * Replaces the subject of a triple after creation, releasing any
+ * previously replaced subject. Use this instead of assigning the
+ * member directly; the original subject lives inside the triple's
+ * allocation block and must not be passed to free().
+ *
+ * @param triple the triple to modify.
+ * @param subject the new subject for the triple.
+ */
+void rdfa_triple_set_subject(rdftriple* triple, const char* subject);
+
+/**
+ * Replaces the predicate of a triple after creation, releasing any
+ * previously replaced predicate. Use this instead of assigning the
+ * member directly; the original predicate lives inside the triple's
+ * allocation block and must not be passed to free().
+ *
+ * @param triple the triple to modify.
+ * @param predicate the new predicate for the triple.
+ */
+void rdfa_triple_set_predicate(rdftriple* triple, const char* predicate);
+
 /**
  * Prints a triple in a human-readable fashion.
  *
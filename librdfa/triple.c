@@ -32,19 +32,23 @@
 #include "rdfa_utils.h"
 #include "rdfa.h"
 
+/* string_flags bits: set when the corresponding member was replaced
+ * after creation and owns a separate heap allocation. */
+#define RDFA_TRIPLE_HEAP_SUBJECT   0x01
+#define RDFA_TRIPLE_HEAP_PREDICATE 0x02
+
 rdftriple* rdfa_create_triple(const char* subject, const char* predicate,
    const char* object, rdfresource_t object_type, const char* datatype,
    const char* language)
 {
-   rdftriple* rval = (rdftriple*)malloc(sizeof(rdftriple));
-
-   /* clear the memory */
-   rval->subject = NULL;
-   rval->predicate = NULL;
-   rval->object = NULL;
-   rval->object_type = object_type;
-   rval->datatype = NULL;
-   rval->language = NULL;
+   rdftriple* rval;
+   size_t subject_size = 0;
+   size_t predicate_size = 0;
+   size_t object_size = 0;
+   size_t datatype_size = 0;
+   size_t language_size = 0;
+   int complete = (subject != NULL) && (predicate != NULL) &&
+      (object != NULL);
 
 #if 0
    printf("SUBJECT  : %s\n", subject);
@@ -56,28 +60,83 @@ rdftriple* rdfa_create_triple(const char* subject, const char* predicate,
 
    /* a triple needs a subject, predicate and object at minimum to be
     * considered a triple. */
-   if((subject != NULL) && (predicate != NULL) && (object != NULL))
+   if(complete)
+   {
+      subject_size = strlen(subject) + 1;
+      predicate_size = strlen(predicate) + 1;
+      object_size = strlen(object) + 1;
+      if(datatype != NULL)
+      {
+         datatype_size = strlen(datatype) + 1;
+      }
+      if(language != NULL)
+      {
+         language_size = strlen(language) + 1;
+      }
+   }
+
+   /* the string payloads are copied into the tail of the triple's own
+    * allocation block, so the whole triple costs a single malloc. */
+   rval = (rdftriple*)malloc(sizeof(rdftriple) + subject_size +
+      predicate_size + object_size + datatype_size + language_size);
+
+   /* clear the memory */
+   rval->subject = NULL;
+   rval->predicate = NULL;
+   rval->object = NULL;
+   rval->object_type = object_type;
+   rval->datatype = NULL;
+   rval->language = NULL;
+   rval->string_flags = 0;
+
+   if(complete)
    {
-      rval->subject = rdfa_replace_string(rval->subject, subject);
-      rval->predicate = rdfa_replace_string(rval->predicate, predicate);
-      rval->object = rdfa_replace_string(rval->object, object);
+      char* dest = (char*)(rval + 1);
+
+      rval->subject = (char*)memcpy(dest, subject, subject_size);
+      dest += subject_size;
+      rval->predicate = (char*)memcpy(dest, predicate, predicate_size);
+      dest += predicate_size;
+      rval->object = (char*)memcpy(dest, object, object_size);
+      dest += object_size;
 
       /* if the datatype is present, set it */
       if(datatype != NULL)
       {
-         rval->datatype = rdfa_replace_string(rval->datatype, datatype);
+         rval->datatype = (char*)memcpy(dest, datatype, datatype_size);
+         dest += datatype_size;
       }
 
       /* if the language was specified, set it */
       if(language != NULL)
       {
-         rval->language = rdfa_replace_string(rval->language, language);
+         rval->language = (char*)memcpy(dest, language, language_size);
       }
    }
 
    return rval;
 }
 
+void rdfa_triple_set_subject(rdftriple* triple, const char* subject)
+{
+   if(triple->string_flags & RDFA_TRIPLE_HEAP_SUBJECT)
+   {
+      free(triple->subject);
+   }
+   triple->subject = rdfa_strdup(subject);
+   triple->string_flags |= RDFA_TRIPLE_HEAP_SUBJECT;
+}
+
+void rdfa_triple_set_predicate(rdftriple* triple, const char* predicate)
+{
+   if(triple->string_flags & RDFA_TRIPLE_HEAP_PREDICATE)
+   {
+      free(triple->predicate);
+   }
+   triple->predicate = rdfa_strdup(predicate);
+   triple->string_flags |= RDFA_TRIPLE_HEAP_PREDICATE;
+}
+
 void rdfa_print_triple(rdftriple* triple)
 {
    if(triple->object_type == RDF_TYPE_NAMESPACE_PREFIX)
@@ -165,11 +224,16 @@ void rdfa_print_triple(rdftriple* triple)
 
 void rdfa_free_triple(rdftriple* triple)
 {
-   free(triple->subject);
-   free(triple->predicate);
-   free(triple->object);
-   free(triple->datatype);
-   free(triple->language);
+   /* only replaced members own separate allocations; everything set at
+    * creation time lives inside the triple's block. */
+   if(triple->string_flags & RDFA_TRIPLE_HEAP_SUBJECT)
+   {
+      free(triple->subject);
+   }
+   if(triple->string_flags & RDFA_TRIPLE_HEAP_PREDICATE)
+   {
+      free(triple->predicate);
+   }
    free(triple);
 }
 
@@ -152,7 +152,7 @@ raptor_ntriples_generate_statement(raptor_parser* parser,
     goto cleanup;
 
   /* Generate the statement */
-  (*parser->statement_handler)(parser->user_data, statement);
+  raptor_parser_emit_statement_inline(parser, statement);
 
   cleanup:
   raptor_free_statement(statement);
@@ -172,6 +172,10 @@ raptor_ntriples_parse_line(raptor_parser* rdf_parser,
   unsigned char *p;
   raptor_term* terms[MAX_NTRIPLES_TERMS+1] = {NULL, NULL, NULL, NULL, NULL};
   int rc = 0;
+  /* NULL in cheap-locator mode: term scanning then skips all
+   * per-character location bookkeeping */
+  raptor_locator* locator =
+    rdf_parser->option_snapshot.cheap_locator ? NULL : &rdf_parser->locator;
   
   /* ASSERTION:
    * p always points to first char we are considering
@@ -190,8 +194,10 @@ raptor_ntriples_parse_line(raptor_parser* rdf_parser,
 
   while(len > 0 && isspace((int)*p)) {
     p++;
-    rdf_parser->locator.column++;
-    rdf_parser->locator.byte++;
+    if(locator) {
+      locator->column++;
+      locator->byte++;
+    }
     len--;
   }
 
@@ -257,8 +263,8 @@ raptor_ntriples_parse_line(raptor_parser* rdf_parser,
     }
 
 
-    term_len = raptor_ntriples_parse_term(rdf_parser->world, &rdf_parser->locator,
-                                          p, &len, &terms[i], 0);
+    term_len = raptor_ntriples_parse_term(rdf_parser->world, rdf_parser,
+                                          locator, p, &len, &terms[i], 0);
     if(!term_len) {
       rc = 1;
       goto cleanup;
@@ -282,8 +288,10 @@ raptor_ntriples_parse_line(raptor_parser* rdf_parser,
     while(len > 0 && isspace((int)*p)) {
       p++;
       len--;
-      rdf_parser->locator.column++;
-      rdf_parser->locator.byte++;
+      if(locator) {
+        locator->column++;
+        locator->byte++;
+      }
     }
 
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
@@ -306,15 +314,19 @@ raptor_ntriples_parse_line(raptor_parser* rdf_parser,
     if(*p == '.') {
       p++;
       len--;
-      rdf_parser->locator.column++;
-      rdf_parser->locator.byte++;
+      if(locator) {
+        locator->column++;
+        locator->byte++;
+      }
 
       /* Skip whitespace after '.' */
       while(len > 0 && isspace((int)*p)) {
         p++;
         len--;
-        rdf_parser->locator.column++;
-        rdf_parser->locator.byte++;
+        if(locator) {
+          locator->column++;
+          locator->byte++;
+        }
       }
 
       /* Only a comment is allowed here */
@@ -448,6 +460,13 @@ raptor_ntriples_parse_chunk(raptor_parser* rdf_parser,
       int bq = 0;
       while(ptr < end_ptr) {
         if(!bq) {
+          /* skip the run of bytes that cannot change the quote, URI,
+           * escape or line-end state - vectorized when possible */
+          ptr += raptor_ntriples_scan_line_special(ptr,
+                   RAPTOR_GOOD_CAST(size_t, end_ptr - ptr));
+          if(ptr == end_ptr)
+            break;
+
           if(*ptr == '\\') {
             bq = 1;
             ptr++;
@@ -487,7 +506,8 @@ raptor_ntriples_parse_chunk(raptor_parser* rdf_parser,
     }
     
     len = ptr - line_start;
-    rdf_parser->locator.column = 0;
+    /* in cheap-locator mode the column is never tracked */
+    rdf_parser->locator.column = rdf_parser->option_snapshot.cheap_locator ? -1 : 0;
 
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
     RAPTOR_DEBUG2("line (%ld) : >>>", len);
@@ -497,9 +517,21 @@ raptor_ntriples_parse_chunk(raptor_parser* rdf_parser,
     *ptr = '\0';
     if(raptor_ntriples_parse_line(rdf_parser, line_start, len, max_terms))
       return 1;
-    
+
+    /* an error under fail-fast stops the scan mid-buffer; otherwise
+     * keep going - the application's log handler may have set failed
+     * (e.g. via raptor_parser_parse_abort()) for an error this parser
+     * recovers from by skipping the bad line */
+    if(rdf_parser->option_snapshot.fail_fast && rdf_parser->failed)
+      return 1;
+
     rdf_parser->locator.line++;
 
+    /* in cheap-locator mode the byte offset advances once per line
+     * instead of per character inside term scanning */
+    if(rdf_parser->option_snapshot.cheap_locator)
+      rdf_parser->locator.byte += RAPTOR_GOOD_CAST(int, len);
+
     /* go past newline */
     if(ptr < end_ptr) {
       ptr++;
@@ -578,6 +610,9 @@ raptor_ntriples_parse_start(raptor_parser* rdf_parser)
 
   ntriples_parser->last_char = '\0';
 
+  if(rdf_parser->option_snapshot.cheap_locator)
+    locator->column = -1;
+
   return 0;
 }
 
@@ -615,18 +650,31 @@ raptor_ntriples_parse_recognise_syntax(raptor_parser_factory* factory,
      * and that all URLs are absolute, and there are a lot of http:
      * URLs
      */
-#define  HAS_AT_PREFIX (raptor_memstr((const char*)buffer, len, "@prefix ") != NULL)
+    static const char* const markers[6] = {
+      "@prefix ",
+      "\n<http://",
+      "\r<http://",
+      "> <http://",
+      "> <",
+      "> \""
+    };
+#define  HAS_AT_PREFIX (founds[0])
 
 #define  HAS_NTRIPLES_START_1_LEN 8
 #define  HAS_NTRIPLES_START_1 (!memcmp((const char*)buffer, "<http://", HAS_NTRIPLES_START_1_LEN))
 #define  HAS_NTRIPLES_START_2_LEN 2
 #define  HAS_NTRIPLES_START_2 (!memcmp((const char*)buffer, "_:", HAS_NTRIPLES_START_2_LEN))
 
-#define  HAS_NTRIPLES_1 (raptor_memstr((const char*)buffer, len, "\n<http://") != NULL)
-#define  HAS_NTRIPLES_2 (raptor_memstr((const char*)buffer, len, "\r<http://") != NULL)
-#define  HAS_NTRIPLES_3 (raptor_memstr((const char*)buffer, len, "> <http://") != NULL)
-#define  HAS_NTRIPLES_4 (raptor_memstr((const char*)buffer, len, "> <") != NULL)
-#define  HAS_NTRIPLES_5 (raptor_memstr((const char*)buffer, len, "> \"") != NULL)
+#define  HAS_NTRIPLES_1 (founds[1])
+#define  HAS_NTRIPLES_2 (founds[2])
+#define  HAS_NTRIPLES_3 (founds[3])
+#define  HAS_NTRIPLES_4 (founds[4])
+#define  HAS_NTRIPLES_5 (founds[5])
+    int founds[6];
+
+    /* search for all the markers in one pass over the content */
+    raptor_memstr_multi((const char*)buffer, len, markers, 6, founds);
+
     if(HAS_AT_PREFIX)
       /* Turtle */
       return 0;
@@ -797,3 +845,489 @@ raptor_init_parser_nquads(raptor_world* world)
                                                &raptor_nquads_parser_register_factory);
 }
 #endif
+
+
+/*
+ * Parallel N-Triples / N-Quads parsing engine.
+ *
+ * The syntaxes are line-delimited so the input can be split at newline
+ * boundaries into large blocks, each scanned by an independent worker
+ * with its own #raptor_world and #raptor_parser.  Statements are
+ * delivered to the statement handler of the originating parser,
+ * serialized by a mutex; delivery order across blocks is NOT the
+ * document order (within a block it is).
+ */
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+
+/* shared destination for all workers */
+typedef struct {
+  raptor_parser* dest_parser;
+  pthread_mutex_t lock;
+} raptor_ntriples_parallel_sink;
+
+/* per-worker state */
+typedef struct {
+  raptor_ntriples_parallel_sink* sink;
+  const char* syntax_name;
+  const unsigned char* base_uri_string;
+  const unsigned char* data;
+  size_t length;
+  pthread_t thread;
+  /* non-0 only when @thread was actually created and must be joined */
+  int thread_created;
+  int rc;
+} raptor_ntriples_parallel_block;
+
+
+static void
+raptor_ntriples_parallel_statement_handler(void* user_data,
+                                           raptor_statement* statement)
+{
+  raptor_ntriples_parallel_sink* sink = (raptor_ntriples_parallel_sink*)user_data;
+  raptor_parser* dest_parser = sink->dest_parser;
+
+  pthread_mutex_lock(&sink->lock);
+  if(dest_parser->statement_handler)
+    raptor_parser_emit_statement(dest_parser, statement);
+  pthread_mutex_unlock(&sink->lock);
+}
+
+
+static void*
+raptor_ntriples_parallel_worker(void* arg)
+{
+  raptor_ntriples_parallel_block* block = (raptor_ntriples_parallel_block*)arg;
+  raptor_world* world = NULL;
+  raptor_parser* parser = NULL;
+  raptor_uri* base_uri = NULL;
+  int rc = 1;
+
+  world = raptor_new_world();
+  if(!world || raptor_world_open(world))
+    goto tidy;
+
+  parser = raptor_new_parser(world, block->syntax_name);
+  if(!parser)
+    goto tidy;
+
+  raptor_parser_set_statement_handler(parser, block->sink,
+                                      raptor_ntriples_parallel_statement_handler);
+  /* statements are counted when the destination parser delivers them,
+   * not when they pass through this forwarding sink */
+  parser->internal_sink = 1;
+
+  base_uri = raptor_new_uri(world, block->base_uri_string);
+  if(!base_uri)
+    goto tidy;
+
+  if(raptor_parser_parse_start(parser, base_uri))
+    goto tidy;
+
+  rc = raptor_parser_parse_chunk(parser, block->data, block->length, 1);
+
+  tidy:
+  if(base_uri)
+    raptor_free_uri(base_uri);
+  if(parser)
+    raptor_free_parser(parser);
+  if(world)
+    raptor_free_world(world);
+
+  block->rc = rc;
+  return NULL;
+}
+#endif /* HAVE_PTHREAD_H */
+
+
+/**
+ * raptor_parser_parse_file_parallel:
+ * @rdf_parser: parser - must be for the "ntriples" or "nquads" syntax
+ * @uri: URI of RDF content or NULL to read from standard input
+ * @base_uri: the base URI to use (or NULL if the same)
+ * @worker_count: number of worker threads to use
+ *
+ * Parse line-delimited RDF content at a file URI on multiple threads.
+ *
+ * Splits the content at newline boundaries into @worker_count blocks
+ * and scans each on its own thread with a private parser instance.
+ * Statements are delivered to the statement handler set on
+ * @rdf_parser; calls are serialized so the handler need not be
+ * thread-safe, but the order in which statements from different
+ * blocks arrive is unspecified.  The #raptor_statement objects passed
+ * to the handler belong to per-worker worlds and, as usual, are only
+ * valid for the duration of the callback.
+ *
+ * Falls back to raptor_parser_parse_file() when @worker_count is less
+ * than 2, the platform has no thread support, @uri is NULL or the
+ * parser is not an N-Triples family parser.
+ *
+ * Return value: non 0 on failure
+ **/
+int
+raptor_parser_parse_file_parallel(raptor_parser* rdf_parser, raptor_uri *uri,
+                                  raptor_uri *base_uri, int worker_count)
+{
+#ifdef HAVE_PTHREAD_H
+  const char* syntax_name;
+  const char *filename = NULL;
+  FILE *fh = NULL;
+  unsigned char *data = NULL;
+  size_t size;
+  long file_size;
+  raptor_ntriples_parallel_sink sink;
+  raptor_ntriples_parallel_block* blocks = NULL;
+  int started = 0;
+  size_t block_target;
+  size_t offset = 0;
+  int i;
+  int rc = 0;
+
+  if(!uri || worker_count < 2)
+    return raptor_parser_parse_file(rdf_parser, uri, base_uri);
+
+  syntax_name = rdf_parser->factory->desc.names[0];
+  if(strcmp(syntax_name, "ntriples") && strcmp(syntax_name, "nquads"))
+    return raptor_parser_parse_file(rdf_parser, uri, base_uri);
+
+  if(!base_uri)
+    base_uri = uri;
+
+  filename = raptor_uri_uri_string_to_filename(raptor_uri_as_string(uri));
+  if(!filename)
+    return 1;
+
+  fh = fopen(filename, "rb");
+  if(!fh) {
+    raptor_parser_error(rdf_parser, "file '%s' open failed - %s",
+                        filename, strerror(errno));
+    rc = 1;
+    goto tidy;
+  }
+
+  if(fseek(fh, 0, SEEK_END) || (file_size = ftell(fh)) < 0 ||
+     fseek(fh, 0, SEEK_SET)) {
+    raptor_parser_error(rdf_parser, "file '%s' seek failed - %s",
+                        filename, strerror(errno));
+    rc = 1;
+    goto tidy;
+  }
+  size = (size_t)file_size;
+
+  data = RAPTOR_MALLOC(unsigned char*, size + 1);
+  if(!data) {
+    rc = 1;
+    goto tidy;
+  }
+  if(size && fread(data, 1, size, fh) != size) {
+    raptor_parser_error(rdf_parser, "file '%s' read failed - %s",
+                        filename, strerror(errno));
+    rc = 1;
+    goto tidy;
+  }
+  data[size] = '\0';
+  fclose(fh);
+  fh = NULL;
+
+  blocks = RAPTOR_CALLOC(raptor_ntriples_parallel_block*, worker_count,
+                         sizeof(*blocks));
+  if(!blocks) {
+    rc = 1;
+    goto tidy;
+  }
+
+  sink.dest_parser = rdf_parser;
+  pthread_mutex_init(&sink.lock, NULL);
+
+  /* split into blocks ending just after a newline */
+  block_target = size / worker_count;
+  for(i = 0; i < worker_count && offset < size; i++) {
+    size_t end = offset + block_target;
+    const unsigned char* nl;
+
+    if(end >= size || i == worker_count - 1)
+      end = size;
+    else {
+      nl = (const unsigned char*)memchr(data + end, '\n', size - end);
+      end = nl ? (size_t)(nl - data) + 1 : size;
+    }
+
+    blocks[i].sink = &sink;
+    blocks[i].syntax_name = syntax_name;
+    blocks[i].base_uri_string = raptor_uri_as_string(base_uri);
+    blocks[i].data = data + offset;
+    blocks[i].length = end - offset;
+    blocks[i].rc = -1;
+    offset = end;
+  }
+
+  for(i = 0; i < worker_count && blocks[i].data; i++) {
+    if(pthread_create(&blocks[i].thread, NULL,
+                      raptor_ntriples_parallel_worker, &blocks[i])) {
+      /* on thread creation failure, parse the block inline; there is
+       * no thread to join for it */
+      raptor_ntriples_parallel_worker(&blocks[i]);
+    } else
+      blocks[i].thread_created = 1;
+    started++;
+  }
+
+  for(i = 0; i < started; i++) {
+    if(blocks[i].thread_created)
+      pthread_join(blocks[i].thread, NULL);
+    if(blocks[i].rc)
+      rc = 1;
+  }
+
+  pthread_mutex_destroy(&sink.lock);
+
+  tidy:
+  if(blocks)
+    RAPTOR_FREE(raptor_ntriples_parallel_block*, blocks);
+  if(data)
+    RAPTOR_FREE(unsigned char*, data);
+  if(fh)
+    fclose(fh);
+  if(filename)
+    RAPTOR_FREE(char*, filename);
+
+  return rc;
+#else
+  return raptor_parser_parse_file(rdf_parser, uri, base_uri);
+#endif
+}
+
+
+#define RAPTOR_NTRIPLES_SPLIT_BUFFER_SIZE 65536
+
+/*
+ * raptor_ntriples_previous_line_start:
+ * @fh: open file handle
+ * @target: byte offset to look backwards from
+ * @buffer: read buffer of RAPTOR_NTRIPLES_SPLIT_BUFFER_SIZE bytes
+ *
+ * INTERNAL - find the start of the line containing @target
+ *
+ * Scans backwards for the nearest newline before @target.  A raw
+ * newline is a line boundary in well-formed N-Triples / N-Quads since
+ * the syntaxes require newlines inside literals to be escaped.
+ *
+ * Return value: offset of the first byte after that newline, or 0
+ * when no earlier newline exists
+ */
+static size_t
+raptor_ntriples_previous_line_start(FILE* fh, size_t target,
+                                    unsigned char* buffer)
+{
+  size_t end = target;
+
+  while(end > 0) {
+    size_t chunk = RAPTOR_NTRIPLES_SPLIT_BUFFER_SIZE;
+    size_t i;
+
+    if(chunk > end)
+      chunk = end;
+
+    if(fseek(fh, RAPTOR_BAD_CAST(long, end - chunk), SEEK_SET))
+      return 0;
+    if(fread(buffer, 1, chunk, fh) != chunk)
+      return 0;
+
+    for(i = chunk; i > 0; i--) {
+      if(buffer[i - 1] == '\n' || buffer[i - 1] == '\r')
+        return end - chunk + i;
+    }
+
+    end -= chunk;
+  }
+
+  return 0;
+}
+
+
+/*
+ * raptor_ntriples_next_split_offset:
+ * @fh: open file handle
+ * @start: byte offset to scan forward from
+ * @size: total file size
+ * @buffer: read buffer of RAPTOR_NTRIPLES_SPLIT_BUFFER_SIZE bytes
+ *
+ * INTERNAL - find the next safe line boundary at or after @start
+ *
+ * @start usually lands mid-line, possibly inside a quoted literal, so
+ * the quote state there is unknown.  The scan therefore backs up to
+ * the previous raw newline - a true line start in well-formed content
+ * - and runs the same quote / URI / backslash state machine as the
+ * chunk scanner forward from that clean state, so a newline escaped
+ * inside a quoted literal on the current line is not taken as a line
+ * end.
+ *
+ * Return value: offset of the first byte after the newline, or
+ * (size_t)-1 if no newline was found before end of file
+ */
+static size_t
+raptor_ntriples_next_split_offset(FILE* fh, size_t start, size_t size,
+                                  unsigned char* buffer)
+{
+  int quote = '\0';
+  int in_uri = 0;
+  int bq = 0;
+  size_t pos;
+
+  pos = raptor_ntriples_previous_line_start(fh, start, buffer);
+
+  if(fseek(fh, RAPTOR_BAD_CAST(long, pos), SEEK_SET))
+    return (size_t)-1;
+
+  while(pos < size) {
+    size_t n = fread(buffer, 1, RAPTOR_NTRIPLES_SPLIT_BUFFER_SIZE, fh);
+    size_t i;
+
+    if(!n)
+      break;
+
+    for(i = 0; i < n; i++, pos++) {
+      unsigned char c = buffer[i];
+
+      if(bq) {
+        bq = 0;
+        continue;
+      }
+      if(c == '\\') {
+        bq = 1;
+        continue;
+      }
+
+      if(c == '<')
+        in_uri = 1;
+      else if(in_uri && c == '>')
+        in_uri = 0;
+
+      if(!quote) {
+        if((!in_uri && c == '\'') || c == '"') {
+          quote = c;
+          continue;
+        }
+        if((c == '\n' || c == '\r') && pos >= start)
+          /* a following \n of a \r\n pair is an empty line to the
+           * chunk scanner and is harmless */
+          return pos + 1;
+      } else if(c == quote)
+        quote = 0;
+    }
+  }
+
+  return (size_t)-1;
+}
+
+
+/**
+ * raptor_parser_get_split_offsets:
+ * @rdf_parser: parser - must be for the "ntriples" or "nquads" syntax
+ * @uri: file URI of the content
+ * @shard_count: number of shards wanted (positive)
+ * @offsets: array of at least @shard_count entries to fill with shard start byte offsets
+ *
+ * Find safe byte offsets for splitting a line-delimited RDF file.
+ *
+ * Divides the file into up to @shard_count shards of roughly equal
+ * size whose boundaries fall just after a newline outside any quoted
+ * literal, so each shard starts at the beginning of a line and can be
+ * parsed independently.  @offsets[0] is always 0; a shard covers the
+ * bytes from its offset up to the next offset (or end of file).
+ *
+ * Pass a shard's starting offset to
+ * raptor_parser_parse_start_at_offset() so that errors from a parser
+ * reading mid-file report absolute byte positions.
+ *
+ * Blank node labels are scoped to the document, so shards parsed in
+ * separate parsers see independently numbered blank nodes; splitting
+ * is only label-safe for content where that does not matter or where
+ * labels are resolved downstream.
+ *
+ * Return value: number of shards found (at least 1, at most
+ * @shard_count - fewer when the file is small), or less than 0 on
+ * failure
+ **/
+int
+raptor_parser_get_split_offsets(raptor_parser* rdf_parser, raptor_uri* uri,
+                                int shard_count, size_t* offsets)
+{
+  const char* syntax_name;
+  const char* filename = NULL;
+  FILE* fh = NULL;
+  unsigned char* buffer = NULL;
+  long file_size;
+  size_t size;
+  size_t shard_target;
+  int count = 0;
+  int i;
+  int rc = -1;
+
+  if(!rdf_parser || !uri || shard_count < 1 || !offsets)
+    return -1;
+
+  syntax_name = rdf_parser->factory->desc.names[0];
+  if(strcmp(syntax_name, "ntriples") && strcmp(syntax_name, "nquads")) {
+    raptor_parser_error(rdf_parser,
+                        "Split offsets are only available for the ntriples and nquads syntaxes.");
+    return -1;
+  }
+
+  filename = raptor_uri_uri_string_to_filename(raptor_uri_as_string(uri));
+  if(!filename)
+    return -1;
+
+  fh = fopen(filename, "rb");
+  if(!fh) {
+    raptor_parser_error(rdf_parser, "file '%s' open failed - %s",
+                        filename, strerror(errno));
+    goto tidy;
+  }
+
+  if(fseek(fh, 0, SEEK_END) || (file_size = ftell(fh)) < 0) {
+    raptor_parser_error(rdf_parser, "file '%s' seek failed - %s",
+                        filename, strerror(errno));
+    goto tidy;
+  }
+  size = (size_t)file_size;
+
+  buffer = RAPTOR_MALLOC(unsigned char*, RAPTOR_NTRIPLES_SPLIT_BUFFER_SIZE);
+  if(!buffer)
+    goto tidy;
+
+  offsets[count++] = 0;
+
+  shard_target = size / RAPTOR_GOOD_CAST(size_t, shard_count);
+  for(i = 1; i < shard_count; i++) {
+    size_t target = shard_target * RAPTOR_GOOD_CAST(size_t, i);
+    size_t split;
+
+    /* a shard boundary may overshoot later targets; keep shards
+     * non-empty rather than equally many */
+    if(target <= offsets[count - 1])
+      continue;
+
+    split = raptor_ntriples_next_split_offset(fh, target, size, buffer);
+    if(split == (size_t)-1 || split >= size)
+      break;
+
+    if(split <= offsets[count - 1])
+      continue;
+
+    offsets[count++] = split;
+  }
+
+  rc = count;
+
+  tidy:
+  if(buffer)
+    RAPTOR_FREE(unsigned char*, buffer);
+  if(fh)
+    fclose(fh);
+  if(filename)
+    RAPTOR_FREE(char*, filename);
+
+  return rc;
+}
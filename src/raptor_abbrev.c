@@ -223,6 +223,16 @@ raptor_compare_abbrev_po(raptor_abbrev_node** nodes1,
 }
 
 
+/* raptor_compare_abbrev_po() adapted to sequence sorting, where the
+ * args are the addresses of the stored item pointers */
+static int
+raptor_compare_abbrev_po_arg(const void* a, const void* b, void* user_data)
+{
+  return raptor_compare_abbrev_po(*(raptor_abbrev_node***)a,
+                                  *(raptor_abbrev_node***)b);
+}
+
+
 #ifdef RAPTOR_DEBUG
 static void
 raptor_print_abbrev_po(raptor_abbrev_node** nodes, FILE* handle)
@@ -283,10 +293,14 @@ raptor_new_abbrev_subject(raptor_abbrev_node* node)
                                        (raptor_data_print_handler)raptor_print_abbrev_po);
 #endif
 
+    subject->pending_properties =
+      raptor_new_sequence((raptor_data_free_handler)raptor_free_abbrev_po, NULL);
+
     subject->list_items =
       raptor_new_sequence((raptor_data_free_handler)raptor_free_abbrev_node, NULL);
 
-    if(!subject->properties || !subject->list_items) {
+    if(!subject->properties || !subject->pending_properties ||
+       !subject->list_items) {
       raptor_free_abbrev_subject(subject);
       subject = NULL;
     }
@@ -310,7 +324,10 @@ raptor_free_abbrev_subject(raptor_abbrev_subject* subject)
   
   if(subject->properties)
     raptor_free_avltree(subject->properties);
-  
+
+  if(subject->pending_properties)
+    raptor_free_sequence(subject->pending_properties);
+
   if(subject->list_items)
     raptor_free_sequence(subject->list_items);
   
@@ -345,17 +362,20 @@ raptor_abbrev_subject_invalidate(raptor_abbrev_subject *subject)
  *
  * The subject node takes ownership of the predicate/object nodes.
  * On error, predicate/object are freed immediately.
- * 
- * Return value: <0 on failure, >0 if pair is a duplicate and it was not added
+ *
+ * The pair is appended to the pending properties; duplicate triples
+ * (s->[p o]) are discarded later when the pending properties are
+ * sorted by raptor_abbrev_subject_commit_properties().
+ *
+ * Return value: <0 on failure
  **/
 int
 raptor_abbrev_subject_add_property(raptor_abbrev_subject* subject,
                                    raptor_abbrev_node* predicate,
-                                   raptor_abbrev_node* object) 
+                                   raptor_abbrev_node* object)
 {
-  int err;
   raptor_abbrev_node** nodes;
-  
+
   nodes = raptor_new_abbrev_po(predicate, object);
   if(!nodes)
     return -1;
@@ -363,31 +383,105 @@ raptor_abbrev_subject_add_property(raptor_abbrev_subject* subject,
   predicate->ref_count++;
   object->ref_count++;
 
-  if(raptor_avltree_search(subject->properties, nodes)) {
-    /* Already present - do not add a duplicate triple (s->[p o]) */
-    raptor_free_abbrev_po(nodes);
+  /* on failure the push frees nodes via the sequence free handler */
+  if(raptor_sequence_push(subject->pending_properties, nodes))
+    return -1;
+
+  return 0;
+}
+
+
+/**
+ * raptor_abbrev_subject_commit_properties:
+ * @subject: subject node
+ *
+ * INTERNAL - Sort the pending properties of a subject into its tree.
+ *
+ * Sorts the pairs collected by raptor_abbrev_subject_add_property()
+ * in a single raptor_sequence_sort_r_parallel() pass, drops the
+ * duplicates (now adjacent) and bulk loads the result with
+ * raptor_new_avltree_from_sequence().  This replaces a tree search
+ * and insert per statement with one sort at emit time.
+ *
+ * Does nothing when no properties are pending, so it is safe to call
+ * from every reader of the properties tree.
+ *
+ * Return value: non-0 on failure
+ **/
+int
+raptor_abbrev_subject_commit_properties(raptor_abbrev_subject* subject)
+{
+  raptor_sequence* pending = subject->pending_properties;
+  raptor_sequence* unique = NULL;
+  raptor_avltree* tree;
+  raptor_abbrev_node** prev;
+  raptor_abbrev_node** nodes;
+  int size;
+  int i;
+
+  if(!pending)
+    return 0;
+
+  size = raptor_sequence_size(pending);
+  if(!size)
+    return 0;
+
+  if(raptor_avltree_size(subject->properties)) {
+    /* rare: statements for this subject arrived after an earlier
+     * commit - merge them into the existing tree */
+    while((nodes = (raptor_abbrev_node**)raptor_sequence_pop(pending))) {
+      if(raptor_avltree_search(subject->properties, nodes))
+        raptor_free_abbrev_po(nodes);
+      else if(raptor_avltree_add(subject->properties, nodes))
+        return 1;
+    }
+    return 0;
+  }
+
+  raptor_sequence_sort_r_parallel(pending, raptor_compare_abbrev_po_arg, NULL);
+
+  unique = raptor_new_sequence((raptor_data_free_handler)raptor_free_abbrev_po,
+                               NULL);
+  if(!unique)
     return 1;
+
+  prev = NULL;
+  for(i = 0; i < size; i++) {
+    nodes = (raptor_abbrev_node**)raptor_sequence_delete_at(pending, i);
+    if(prev && !raptor_compare_abbrev_po(prev, nodes)) {
+      /* duplicate triple (s->[p o]) - do not keep it */
+      raptor_free_abbrev_po(nodes);
+      continue;
+    }
+    /* on failure the push frees nodes via the sequence free handler */
+    if(raptor_sequence_push(unique, nodes)) {
+      raptor_free_sequence(unique);
+      return 1;
+    }
+    prev = nodes;
   }
-  
-#if 0
-  fprintf(stderr, "Adding P,O ");
-  raptor_print_abbrev_po(stderr, nodes);
 
-  raptor_avltree_dump(subject->properties, stderr);
+  tree =
+    raptor_new_avltree_from_sequence((raptor_data_compare_handler)raptor_compare_abbrev_po,
+                                     (raptor_data_free_handler)raptor_free_abbrev_po,
+                                     0, unique);
+  raptor_free_sequence(unique);
+  if(!tree)
+    return 1;
+#ifdef RAPTOR_DEBUG
+  raptor_avltree_set_print_handler(tree,
+                                   (raptor_data_print_handler)raptor_print_abbrev_po);
 #endif
-  err = raptor_avltree_add(subject->properties, nodes);
-  if(err)
-    return -1;
-#if 0
-  fprintf(stderr, "Result ");
-  raptor_avltree_print(subject->properties, stderr);
-  
-  raptor_avltree_dump(subject->properties, stderr);
 
-  raptor_avltree_check(subject->properties);
+  raptor_free_avltree(subject->properties);
+  subject->properties = tree;
 
-  fprintf(stderr, "\n\n");
-#endif
+  /* the emptied pending sequence still holds NULL slots; replace it */
+  raptor_free_sequence(pending);
+  subject->pending_properties =
+    raptor_new_sequence((raptor_data_free_handler)raptor_free_abbrev_po, NULL);
+  if(!subject->pending_properties)
+    return 1;
 
   return 0;
 }
@@ -534,6 +628,385 @@ raptor_print_subject(raptor_abbrev_subject* subject)
 #endif
 
 
+/*
+ * raptor_abbrev_spill implementation
+ *
+ * Disk-backed store for the abbreviating serializers - see
+ * RAPTOR_OPTION_SERIALIZE_SPILL_SIZE.  Statements are kept as
+ * N-Triples/N-Quads lines; whenever the in-memory buffer reaches the
+ * configured run size it is sorted and written to an anonymous
+ * temporary file.  At replay time the sorted runs are merged and the
+ * statements parsed back in line order, which groups all statements
+ * for a subject together (a line is prefixed by its subject term, so
+ * lexicographic order clusters equal subjects).
+ *
+ **/
+
+struct raptor_abbrev_spill_s {
+  raptor_world* world;
+  int run_size;              /* lines buffered before a run is written */
+  raptor_sequence* lines;    /* char* lines awaiting the next run */
+  raptor_sequence* runs;     /* FILE* sorted run temporary files */
+  int wrote_graphs;          /* non-0 if any line has a graph term */
+  int failed;                /* non-0 after a temporary file error */
+};
+
+
+static void
+raptor_abbrev_spill_free_line(void* line)
+{
+  RAPTOR_FREE(char*, line);
+}
+
+
+static void
+raptor_abbrev_spill_close_run(void* fh)
+{
+  fclose((FILE*)fh);
+}
+
+
+/* strcmp adapted to sequence sorting, where the args are the
+ * addresses of the stored line pointers */
+static int
+raptor_abbrev_spill_compare_lines(const void* a, const void* b,
+                                  void* user_data)
+{
+  return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+
+/**
+ * raptor_new_abbrev_spill:
+ * @world: raptor world
+ * @run_size: statements to buffer in memory before spilling a run
+ *
+ * INTERNAL - Constructor for raptor_abbrev_spill
+ *
+ * Return value: new spill store or NULL on failure
+ **/
+raptor_abbrev_spill*
+raptor_new_abbrev_spill(raptor_world* world, int run_size)
+{
+  raptor_abbrev_spill* spill;
+
+  spill = RAPTOR_CALLOC(raptor_abbrev_spill*, 1, sizeof(*spill));
+  if(!spill)
+    return NULL;
+
+  spill->world = world;
+  spill->run_size = (run_size > 0) ? run_size : 1;
+
+  spill->lines = raptor_new_sequence(raptor_abbrev_spill_free_line, NULL);
+  spill->runs = raptor_new_sequence(raptor_abbrev_spill_close_run, NULL);
+  if(!spill->lines || !spill->runs) {
+    raptor_free_abbrev_spill(spill);
+    return NULL;
+  }
+
+  return spill;
+}
+
+
+/**
+ * raptor_free_abbrev_spill:
+ * @spill: spill store
+ *
+ * INTERNAL - Destructor for raptor_abbrev_spill
+ *
+ * Closing the run files deletes them (they are made with tmpfile()).
+ **/
+void
+raptor_free_abbrev_spill(raptor_abbrev_spill* spill)
+{
+  RAPTOR_ASSERT_OBJECT_POINTER_RETURN(spill, raptor_abbrev_spill);
+
+  if(spill->lines)
+    raptor_free_sequence(spill->lines);
+  if(spill->runs)
+    raptor_free_sequence(spill->runs);
+
+  RAPTOR_FREE(raptor_abbrev_spill, spill);
+}
+
+
+/* Sort the buffered lines and write them out as one run file */
+static int
+raptor_abbrev_spill_write_run(raptor_abbrev_spill* spill)
+{
+  FILE* fh;
+  int size;
+  int i;
+
+  size = raptor_sequence_size(spill->lines);
+  if(!size)
+    return 0;
+
+  raptor_sequence_sort_r_parallel(spill->lines,
+                                  raptor_abbrev_spill_compare_lines, NULL);
+
+  fh = tmpfile();
+  if(!fh) {
+    raptor_log_error(spill->world, RAPTOR_LOG_LEVEL_ERROR, NULL,
+                     "Failed to create temporary file for statement spill");
+    spill->failed = 1;
+    return 1;
+  }
+
+  for(i = 0; i < size; i++) {
+    char* line = (char*)raptor_sequence_get_at(spill->lines, i);
+    size_t line_len = strlen(line);
+
+    if(fwrite(line, 1, line_len, fh) != line_len) {
+      raptor_log_error(spill->world, RAPTOR_LOG_LEVEL_ERROR, NULL,
+                       "Failed to write temporary file for statement spill");
+      fclose(fh);
+      spill->failed = 1;
+      return 1;
+    }
+  }
+
+  if(raptor_sequence_push(spill->runs, fh)) {
+    spill->failed = 1;
+    return 1;
+  }
+
+  /* the written lines are no longer needed; replace the sequence */
+  raptor_free_sequence(spill->lines);
+  spill->lines = raptor_new_sequence(raptor_abbrev_spill_free_line, NULL);
+  if(!spill->lines) {
+    spill->failed = 1;
+    return 1;
+  }
+
+  return 0;
+}
+
+
+/**
+ * raptor_abbrev_spill_add:
+ * @spill: spill store
+ * @statement: statement to store
+ *
+ * INTERNAL - Append a statement to the spill store
+ *
+ * Return value: non-0 on failure
+ **/
+int
+raptor_abbrev_spill_add(raptor_abbrev_spill* spill,
+                        raptor_statement* statement)
+{
+  unsigned char* term_strings[4] = { NULL, NULL, NULL, NULL };
+  size_t term_lens[4] = { 0, 0, 0, 0 };
+  int term_count;
+  size_t line_len;
+  char* line;
+  char* p;
+  int i;
+  int rc = 1;
+
+  if(spill->failed)
+    return 1;
+
+  term_strings[0] = raptor_term_to_counted_string(statement->subject,
+                                                  &term_lens[0]);
+  term_strings[1] = raptor_term_to_counted_string(statement->predicate,
+                                                  &term_lens[1]);
+  term_strings[2] = raptor_term_to_counted_string(statement->object,
+                                                  &term_lens[2]);
+  term_count = 3;
+  if(statement->graph) {
+    term_strings[3] = raptor_term_to_counted_string(statement->graph,
+                                                    &term_lens[3]);
+    term_count = 4;
+    spill->wrote_graphs = 1;
+  }
+
+  /* line is "S P O .\n" or "S P O G .\n" */
+  line_len = 0;
+  for(i = 0; i < term_count; i++) {
+    if(!term_strings[i])
+      goto tidy;
+    line_len += term_lens[i] + 1; /* term and a space */
+  }
+  line_len += 2; /* ".\n" */
+
+  line = RAPTOR_MALLOC(char*, line_len + 1);
+  if(!line)
+    goto tidy;
+
+  p = line;
+  for(i = 0; i < term_count; i++) {
+    memcpy(p, term_strings[i], term_lens[i]);
+    p += term_lens[i];
+    *p++ = ' ';
+  }
+  *p++ = '.';
+  *p++ = '\n';
+  *p = '\0';
+
+  /* on failure the push frees line via the sequence free handler */
+  if(raptor_sequence_push(spill->lines, line))
+    goto tidy;
+
+  rc = 0;
+  if(raptor_sequence_size(spill->lines) >= spill->run_size)
+    rc = raptor_abbrev_spill_write_run(spill);
+
+  tidy:
+  for(i = 0; i < 4; i++) {
+    if(term_strings[i])
+      raptor_free_memory(term_strings[i]);
+  }
+
+  return rc;
+}
+
+
+/* Read one line of any length from a run file; NULL at EOF/failure */
+static char*
+raptor_abbrev_spill_read_line(FILE* fh)
+{
+  size_t capacity = 256;
+  size_t len = 0;
+  char* line;
+
+  line = RAPTOR_MALLOC(char*, capacity);
+  if(!line)
+    return NULL;
+
+  while(fgets(line + len, RAPTOR_GOOD_CAST(int, capacity - len), fh)) {
+    len += strlen(line + len);
+    if(len && line[len - 1] == '\n')
+      return line;
+
+    if(feof(fh))
+      return line;
+
+    /* line continues - grow the buffer */
+    {
+      char* new_line = RAPTOR_REALLOC(char*, line, capacity << 1);
+      if(!new_line) {
+        RAPTOR_FREE(char*, line);
+        return NULL;
+      }
+      line = new_line;
+      capacity <<= 1;
+    }
+  }
+
+  if(len)
+    return line;
+
+  RAPTOR_FREE(char*, line);
+  return NULL;
+}
+
+
+/**
+ * raptor_abbrev_spill_replay:
+ * @spill: spill store
+ * @handler: statement handler to deliver the stored statements to
+ * @user_data: opaque data for @handler
+ *
+ * INTERNAL - Merge the sorted runs and deliver the statements in line order
+ *
+ * All statements with the same subject arrive consecutively; exact
+ * duplicate statements are dropped during the merge.  The statements
+ * are reconstructed with the N-Quads (or N-Triples when no statement
+ * had a graph term) parser, so blank node labels survive the round
+ * trip unchanged.
+ *
+ * Return value: non-0 on failure
+ **/
+int
+raptor_abbrev_spill_replay(raptor_abbrev_spill* spill,
+                           raptor_statement_handler handler,
+                           void* user_data)
+{
+  raptor_parser* parser = NULL;
+  char** heads = NULL;
+  char* prev_line = NULL;
+  int run_count;
+  int i;
+  int rc = 1;
+
+  if(spill->failed)
+    return 1;
+
+  /* everything buffered so far becomes the final run; when nothing
+   * was ever spilled this is also the only run */
+  if(raptor_abbrev_spill_write_run(spill))
+    return 1;
+
+  parser = raptor_new_parser(spill->world,
+                             spill->wrote_graphs ? "nquads" : "ntriples");
+  if(!parser) {
+    raptor_log_error(spill->world, RAPTOR_LOG_LEVEL_ERROR, NULL,
+                     "Statement spill replay requires the N-Triples / N-Quads parser");
+    return 1;
+  }
+  raptor_parser_set_statement_handler(parser, user_data, handler);
+  if(raptor_parser_parse_start(parser, NULL))
+    goto tidy;
+
+  run_count = raptor_sequence_size(spill->runs);
+
+  heads = RAPTOR_CALLOC(char**, run_count + 1, sizeof(char*));
+  if(!heads)
+    goto tidy;
+
+  for(i = 0; i < run_count; i++) {
+    FILE* fh = (FILE*)raptor_sequence_get_at(spill->runs, i);
+    rewind(fh);
+    heads[i] = raptor_abbrev_spill_read_line(fh);
+  }
+
+  while(1) {
+    int min_i = -1;
+
+    for(i = 0; i < run_count; i++) {
+      if(heads[i] && (min_i < 0 || strcmp(heads[i], heads[min_i]) < 0))
+        min_i = i;
+    }
+    if(min_i < 0)
+      break;
+
+    /* adjacent equal lines are exact duplicate statements */
+    if(!prev_line || strcmp(prev_line, heads[min_i])) {
+      if(raptor_parser_parse_chunk(parser,
+                                   (const unsigned char*)heads[min_i],
+                                   strlen(heads[min_i]), 0))
+        goto tidy;
+    }
+
+    if(prev_line)
+      RAPTOR_FREE(char*, prev_line);
+    prev_line = heads[min_i];
+    heads[min_i] =
+      raptor_abbrev_spill_read_line((FILE*)raptor_sequence_get_at(spill->runs,
+                                                                  min_i));
+  }
+
+  rc = raptor_parser_parse_chunk(parser, NULL, 0, 1);
+
+  tidy:
+  if(prev_line)
+    RAPTOR_FREE(char*, prev_line);
+  if(heads) {
+    for(i = 0; i < raptor_sequence_size(spill->runs); i++) {
+      if(heads[i])
+        RAPTOR_FREE(char*, heads[i]);
+    }
+    RAPTOR_FREE(char**, heads);
+  }
+  if(parser)
+    raptor_free_parser(parser);
+
+  return rc;
+}
+
+
 /* helper functions */
 
 /**
@@ -62,12 +62,20 @@
 
 /* raptor_avltree.c */
 typedef struct raptor_avltree_node_s raptor_avltree_node;
+typedef struct raptor_avltree_slab_s raptor_avltree_slab;
 
 /* AVL-tree */
 struct raptor_avltree_s {
   /* root node of tree */
   raptor_avltree_node* root;
 
+  /* slabs that nodes are carved from; node memory is only returned to
+   * the system when the tree is freed */
+  raptor_avltree_slab* slabs;
+
+  /* chain of deleted nodes awaiting reuse, linked through ->right */
+  raptor_avltree_node* free_nodes;
+
   /* node comparison function (optional) */
   raptor_data_compare_handler compare_handler;
 
@@ -107,6 +115,20 @@ struct raptor_avltree_node_s {
 };
 
 
+/* number of nodes allocated per slab */
+#define RAPTOR_AVLTREE_SLAB_SIZE 256
+
+/* slab of AVL-tree nodes */
+struct raptor_avltree_slab_s {
+  raptor_avltree_slab* next;
+
+  /* number of nodes handed out from @nodes */
+  unsigned int used;
+
+  raptor_avltree_node nodes[RAPTOR_AVLTREE_SLAB_SIZE];
+};
+
+
 #ifndef TRUE
 #define	TRUE		1
 #define	FALSE		0
@@ -114,6 +136,8 @@ struct raptor_avltree_node_s {
 
 
 /* local prototypes */
+static raptor_avltree_node* raptor_avltree_node_alloc(raptor_avltree* tree);
+static void raptor_avltree_node_free(raptor_avltree* tree, raptor_avltree_node* node);
 static int raptor_avltree_sprout(raptor_avltree* tree, raptor_avltree_node* parent, raptor_avltree_node** node_pp, void* p_data, int *rebalancing_p);
 static void* raptor_avltree_delete_internal(raptor_avltree* tree, raptor_avltree_node** node_pp, void* p_data, int *rebalancing_p);
 static void* raptor_avltree_delete_internal2(raptor_avltree* tree, raptor_avltree_node** ppr_r, int *rebalancing_p, raptor_avltree_node** ppr_q);
@@ -149,6 +173,8 @@ raptor_new_avltree(raptor_data_compare_handler compare_handler,
     return NULL;
 
   tree->root = NULL;
+  tree->slabs = NULL;
+  tree->free_nodes = NULL;
   tree->compare_handler = compare_handler;
   tree->free_handler = free_handler;
   tree->print_handler = NULL;
@@ -173,10 +199,169 @@ raptor_free_avltree(raptor_avltree* tree)
   
   raptor_free_avltree_internal(tree, tree->root);
 
+  while(tree->slabs) {
+    raptor_avltree_slab* next = tree->slabs->next;
+    RAPTOR_FREE(raptor_avltree_slab, tree->slabs);
+    tree->slabs = next;
+  }
+
   RAPTOR_FREE(raptor_avltree, tree);
 }
 
 
+/*
+ * raptor_avltree_node_alloc:
+ * @tree: AVL tree
+ *
+ * INTERNAL - Get a node from the tree's slabs, reusing a deleted one
+ * if available.
+ *
+ * Keeping nodes in large contiguous slabs improves the cache locality
+ * of tree walks compared to one malloc per node.
+ *
+ * Return value: node or NULL on failure
+ */
+static raptor_avltree_node*
+raptor_avltree_node_alloc(raptor_avltree* tree)
+{
+  raptor_avltree_node* node;
+
+  if(tree->free_nodes) {
+    node = tree->free_nodes;
+    tree->free_nodes = node->right;
+    return node;
+  }
+
+  if(!tree->slabs || tree->slabs->used == RAPTOR_AVLTREE_SLAB_SIZE) {
+    raptor_avltree_slab* slab;
+
+    slab = RAPTOR_MALLOC(raptor_avltree_slab*, sizeof(*slab));
+    if(!slab)
+      return NULL;
+    slab->next = tree->slabs;
+    slab->used = 0;
+    tree->slabs = slab;
+  }
+
+  return &tree->slabs->nodes[tree->slabs->used++];
+}
+
+
+/*
+ * raptor_avltree_node_free:
+ * @tree: AVL tree
+ * @node: node no longer in the tree
+ *
+ * INTERNAL - Return a node to the tree's reuse chain.
+ */
+static void
+raptor_avltree_node_free(raptor_avltree* tree, raptor_avltree_node* node)
+{
+  node->right = tree->free_nodes;
+  tree->free_nodes = node;
+}
+
+
+/*
+ * raptor_avltree_build_from_sequence:
+ * @tree: AVL tree
+ * @seq: sorted sequence that items are taken from
+ * @low: lowest sequence index of this subtree
+ * @high: highest sequence index of this subtree
+ * @parent: parent node (or NULL for the root)
+ * @height_p: returns the height of the built subtree, or -1 on failure
+ *
+ * INTERNAL - Recursively build a balanced subtree from @seq[@low..@high].
+ *
+ * Return value: subtree root or NULL for an empty range or on failure
+ */
+static raptor_avltree_node*
+raptor_avltree_build_from_sequence(raptor_avltree* tree, raptor_sequence* seq,
+                                   int low, int high,
+                                   raptor_avltree_node* parent, int* height_p)
+{
+  int mid;
+  raptor_avltree_node* node;
+  int left_height;
+  int right_height;
+
+  if(low > high) {
+    *height_p = 0;
+    return NULL;
+  }
+
+  mid = low + (high - low) / 2;
+
+  node = raptor_avltree_node_alloc(tree);
+  if(!node) {
+    *height_p = -1;
+    return NULL;
+  }
+
+  node->parent = parent;
+  node->data = raptor_sequence_delete_at(seq, mid);
+
+  node->left = raptor_avltree_build_from_sequence(tree, seq, low, mid - 1,
+                                                  node, &left_height);
+  node->right = raptor_avltree_build_from_sequence(tree, seq, mid + 1, high,
+                                                   node, &right_height);
+  if(left_height < 0 || right_height < 0) {
+    *height_p = -1;
+    return NULL;
+  }
+
+  node->balance = RAPTOR_GOOD_CAST(signed char, right_height - left_height);
+  *height_p = 1 + ((left_height > right_height) ? left_height : right_height);
+
+  return node;
+}
+
+
+/**
+ * raptor_new_avltree_from_sequence:
+ * @compare_handler: item comparison handler for ordering
+ * @free_handler: item free handler (or NULL)
+ * @flags: AVLTree flags - bitmask of #raptor_avltree_bitflags flags.
+ * @seq: sequence of items sorted ascending by @compare_handler
+ *
+ * AVL Tree Constructor - bulk load from a pre-sorted sequence
+ *
+ * Builds a balanced tree from the @seq items in O(n), avoiding the
+ * per-item rebalancing of repeated raptor_avltree_add() calls.  The
+ * items are taken out of @seq (their slots are set to NULL) and become
+ * owned by the new tree.
+ *
+ * Return value: new AVL Tree or NULL on failure
+ */
+raptor_avltree*
+raptor_new_avltree_from_sequence(raptor_data_compare_handler compare_handler,
+                                 raptor_data_free_handler free_handler,
+                                 unsigned int flags,
+                                 raptor_sequence* seq)
+{
+  raptor_avltree* tree;
+  int size;
+  int height = 0;
+
+  tree = raptor_new_avltree(compare_handler, free_handler, flags);
+  if(!tree)
+    return NULL;
+
+  size = seq ? raptor_sequence_size(seq) : 0;
+  if(size > 0) {
+    tree->root = raptor_avltree_build_from_sequence(tree, seq, 0, size - 1,
+                                                    NULL, &height);
+    if(height < 0) {
+      raptor_free_avltree(tree);
+      return NULL;
+    }
+    tree->size = RAPTOR_GOOD_CAST(unsigned int, size);
+  }
+
+  return tree;
+}
+
+
 static void
 raptor_free_avltree_internal(raptor_avltree* tree, raptor_avltree_node* node)
 {
@@ -188,7 +373,7 @@ raptor_free_avltree_internal(raptor_avltree* tree, raptor_avltree_node* node)
     if(tree->free_handler)
       tree->free_handler(node->data);
     tree->size--;
-    RAPTOR_FREE(raptor_avltree_node, node);
+    /* node memory itself stays in the slabs */
   }
 }
 
@@ -200,7 +385,10 @@ raptor_avltree_search_internal(raptor_avltree* tree, raptor_avltree_node* node,
                                const void* p_data)
 {
   if(node) {
-    int cmp= tree->compare_handler(p_data, node->data);
+    int cmp;
+
+    RAPTOR_STATS_INC(avltree_comparisons);
+    cmp = tree->compare_handler(p_data, node->data);
 
     if(cmp > 0)
       return raptor_avltree_search_internal(tree, node->right, p_data);
@@ -684,7 +872,7 @@ raptor_avltree_sprout(raptor_avltree* tree, raptor_avltree_node* parent,
   /* If grounded, add the node here, set the rebalance flag and return */
   if(!*node_pp) {
     RAPTOR_AVLTREE_DEBUG1("grounded. adding new node, setting rebalancing flag true\n");
-    *node_pp = RAPTOR_MALLOC(raptor_avltree_node*, sizeof(**node_pp));
+    *node_pp = raptor_avltree_node_alloc(tree);
     if(!*node_pp) {
       if(tree->free_handler)
         tree->free_handler(p_data);
@@ -719,6 +907,7 @@ raptor_avltree_sprout(raptor_avltree* tree, raptor_avltree_node* parent,
   raptor_avltree_check_node(tree, *node_pp, 0, 0);
 #endif
   /* compare the data */
+  RAPTOR_STATS_INC(avltree_comparisons);
   cmp = tree->compare_handler(p_data, (*node_pp)->data);
   if(cmp < 0)
     /* if LESS, prepare to move to the left. */
@@ -762,6 +951,7 @@ raptor_avltree_delete_internal(raptor_avltree* tree,
     return rdata;
   }
 
+  RAPTOR_STATS_INC(avltree_comparisons);
   cmp = tree->compare_handler((*node_pp)->data, p_data);
 
   if(cmp > 0) {
@@ -806,7 +996,7 @@ raptor_avltree_delete_internal(raptor_avltree* tree,
         raptor_avltree_balance_left(tree, node_pp, rebalancing_p);
     }
 
-    RAPTOR_FREE(raptor_avltree_node, pr_q);
+    raptor_avltree_node_free(tree, pr_q);
   }
 
   return rdata;
@@ -1420,6 +1610,96 @@ raptor_avltree_iterator_next(raptor_avltree_iterator* iterator)
 }
 
 
+/*
+ * raptor_avltree_node_lower_bound:
+ * @tree: AVL Tree object
+ * @node: subtree root to search under
+ * @p_data: key item
+ * @direction: <0 to find the end of the prefix, otherwise the start of the suffix
+ *
+ * INTERNAL - Find the boundary node for a key
+ *
+ * For a forwards direction this is the leftmost node whose item does
+ * not sort before @p_data; for a backwards direction the rightmost
+ * node whose item does not sort after it.  Unlike
+ * raptor_avltree_search_internal() the key need not match any item.
+ *
+ * Return value: boundary node or NULL if no item is on that side of the key
+ */
+static raptor_avltree_node*
+raptor_avltree_node_lower_bound(raptor_avltree* tree,
+                                raptor_avltree_node* node,
+                                const void* p_data,
+                                int direction)
+{
+  raptor_avltree_node* found = NULL;
+
+  while(node) {
+    int cmp = tree->compare_handler(p_data, node->data);
+
+    if(direction < 0) {
+      if(cmp >= 0) {
+        found = node;
+        node = node->right;
+      } else
+        node = node->left;
+    } else {
+      if(cmp <= 0) {
+        found = node;
+        node = node->left;
+      } else
+        node = node->right;
+    }
+  }
+
+  return found;
+}
+
+
+/**
+ * raptor_avltree_iterator_seek:
+ * @iterator: AVL Tree iterator object
+ * @key: key item to seek to
+ *
+ * Reposition an iterator at the first item on or after a key
+ *
+ * Moves @iterator to the first item that does not sort before @key
+ * (or, for a backwards iterator, the last item that does not sort
+ * after it); iteration then continues from there over the rest of the
+ * tree.  @key need not match any stored item and is only used during
+ * this call - it remains owned by the caller.  Any range given to
+ * raptor_new_avltree_iterator() no longer applies.
+ *
+ * The iterator is re-rooted at the current top of the tree, so this
+ * also makes a cursor resumable across tree modification: a partial
+ * traversal can emit some items, delete them from the tree and seek
+ * to the next key to carry on, at the cost of one O(log N) descent
+ * instead of restarting and skipping over the remains of the prefix.
+ *
+ * Return value: non-0 if there is no such item (iteration is finished)
+ **/
+int
+raptor_avltree_iterator_seek(raptor_avltree_iterator* iterator,
+                             const void* key)
+{
+  raptor_avltree* tree = iterator->tree;
+
+  if(iterator->range) {
+    if(iterator->range_free_handler)
+      iterator->range_free_handler(iterator->range);
+    iterator->range = NULL;
+    iterator->range_free_handler = NULL;
+  }
+
+  iterator->root = tree->root;
+  iterator->current = raptor_avltree_node_lower_bound(tree, tree->root, key,
+                                                      iterator->direction);
+  iterator->is_finished = (iterator->current == NULL);
+
+  return iterator->is_finished;
+}
+
+
 /**
  * raptor_avltree_iterator_get:
  * @iterator: AVL Tree iterator object
@@ -1728,6 +2008,40 @@ main(int argc, char *argv[])
   raptor_free_avltree_iterator(iter);
 
 
+#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
+  fprintf(stderr, "%s: Seeking iterator to mid-tree key\n", program);
+#endif
+#define SEEK_RESULT_OFFSET 4
+  /* "dz" matches no item and sorts between "def" and "jib" */
+  iter = raptor_new_avltree_iterator(tree, NULL, NULL, 1);
+  if(raptor_avltree_iterator_seek(iter, (const void*)"dz")) {
+    fprintf(stderr, "%s: Seek to 'dz' unexpectedly ended iteration\n", program);
+    exit(1);
+  }
+  for(i = SEEK_RESULT_OFFSET; 1; i++) {
+    const char* data = (const char*)raptor_avltree_iterator_get(iter);
+    const char* result = results[i];
+    if((!data && data != result) || (data && strcmp(data, result))) {
+      fprintf(stderr, "%3d: Seeked iterator expected '%s' but found '%s'\n",
+              i, result, data);
+      exit(1);
+    }
+    if(raptor_avltree_iterator_next(iter))
+      break;
+    if(i > RESULT_COUNT) {
+      fprintf(stderr, "Seeked iterator did not end on result %i as expected\n",
+              i);
+      exit(1);
+    }
+  }
+  if(!raptor_avltree_iterator_seek(iter, (const void*)"zzz")) {
+    fprintf(stderr, "%s: Seek past the last item did not end iteration\n",
+            program);
+    exit(1);
+  }
+  raptor_free_avltree_iterator(iter);
+
+
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
   fprintf(stderr, "%s: Checking tree\n", program);
 #endif
@@ -1762,6 +2076,104 @@ main(int argc, char *argv[])
 #endif
   raptor_free_avltree(tree);
 
+
+  /* test bulk load from a sorted sequence */
+
+  if(1) {
+    raptor_sequence* seq;
+
+    seq = raptor_new_sequence(NULL, NULL);
+    if(!seq) {
+      fprintf(stderr, "%s: Failed to create sequence\n", program);
+      exit(1);
+    }
+    for(i = 0; results[i]; i++)
+      raptor_sequence_push(seq, (void*)results[i]);
+
+    tree = raptor_new_avltree_from_sequence(compare_strings,
+                                            NULL, /* static pointers */
+                                            0, seq);
+    if(!tree) {
+      fprintf(stderr, "%s: Failed to bulk load tree\n", program);
+      exit(1);
+    }
+    raptor_free_sequence(seq);
+
+    if(raptor_avltree_size(tree) != RESULT_COUNT) {
+      fprintf(stderr, "%s: Bulk loaded tree size is %d, expected %d\n",
+              program, raptor_avltree_size(tree), RESULT_COUNT);
+      exit(1);
+    }
+
+    vs.count = 0;
+    vs.results = results;
+    vs.failed = 0;
+    raptor_avltree_visit(tree, check_string, &vs);
+    if(vs.failed) {
+      fprintf(stderr, "%s: Checking bulk loaded tree failed\n", program);
+      exit(1);
+    }
+
+    raptor_free_avltree(tree);
+  }
+
+
+  /* test an emit-and-delete traversal resumed with seek */
+
+  if(1) {
+    tree = raptor_new_avltree(compare_strings,
+                              NULL, /* static pointers */
+                              0);
+    if(!tree) {
+      fprintf(stderr, "%s: Failed to create tree\n", program);
+      exit(1);
+    }
+    for(i = 0; results[i]; i++) {
+      if(raptor_avltree_add(tree, (void*)results[i])) {
+        fprintf(stderr, "%s: Adding tree item '%s' failed\n", program,
+                results[i]);
+        exit(1);
+      }
+    }
+
+    iter = raptor_new_avltree_iterator(tree, NULL, NULL, 1);
+    for(i = 0; 1; i++) {
+      const char* data = (const char*)raptor_avltree_iterator_get(iter);
+      const char* next_data = NULL;
+
+      if(!data)
+        break;
+      if(strcmp(data, results[i])) {
+        fprintf(stderr,
+                "%3d: Deleting iterator expected '%s' but found '%s'\n",
+                i, results[i], data);
+        exit(1);
+      }
+
+      /* peek at the successor, delete the current item, then resume
+       * at the successor - the delete may have rebalanced the tree
+       * under the cursor */
+      if(!raptor_avltree_iterator_next(iter))
+        next_data = (const char*)raptor_avltree_iterator_get(iter);
+
+      raptor_avltree_delete(tree, (void*)data);
+
+      if(!next_data)
+        break;
+      raptor_avltree_iterator_seek(iter, next_data);
+    }
+    raptor_free_avltree_iterator(iter);
+
+    if(raptor_avltree_size(tree)) {
+      fprintf(stderr,
+              "%s: Emit-and-delete traversal left %d items in the tree\n",
+              program, raptor_avltree_size(tree));
+      exit(1);
+    }
+
+    raptor_free_avltree(tree);
+  }
+
   raptor_free_world(world);
 
   /* keep gcc -Wall happy */
@@ -0,0 +1,956 @@
+/* -*- Mode: c; c-basic-offset: 2 -*-
+ *
+ * raptor_binary.c - Raptor binary statement interchange parser and serializer
+ *
+ * Copyright (C) 2026, David Beckett http://www.dajobe.org/
+ *
+ * This package is Free Software and part of Redland http://librdf.org/
+ *
+ * It is licensed under the following three licenses as alternatives:
+ *   1. GNU Lesser General Public License (LGPL) V2.1 or any newer version
+ *   2. GNU General Public License (GPL) V2 or any newer version
+ *   3. Apache License, V2.0 or any newer version
+ *
+ * You may not use this file except in compliance with at least one of
+ * the above three licenses.
+ *
+ * See LICENSE.html or LICENSE.txt at the top of this package for the
+ * complete terms and further detail along with the license texts for
+ * the licenses in COPYING.LIB, COPYING and LICENSE-2.0.txt respectively.
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <raptor_config.h>
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
+/* Raptor includes */
+#include "raptor2.h"
+#include "raptor_internal.h"
+
+#if defined(RAPTOR_PARSER_BINARY) || defined(RAPTOR_SERIALIZER_BINARY)
+
+/*
+ * The "raptor-binary" format is a compact statement interchange
+ * encoding for handing statements between pipeline stages without
+ * re-lexing and re-escaping a text syntax.  All integers are
+ * little-endian fixed width so a reader can decode a mapped file
+ * sequentially without any byte-level scanning:
+ *
+ *   header:  "RAPB" format-version(u8)
+ *   blocks:  'B' block-length(u32)
+ *              dict-count(u32) dict-entries
+ *              statement-count(u32) statements
+ *   trailer: 'E'
+ *
+ * Dictionary entries define per-block term ids 1..dict-count in
+ * order of appearance:
+ *
+ *   URI:     'U' length(u32) bytes
+ *   blank:   'N' length(u32) bytes (the label, no "_:" prefix)
+ *   literal: 'L' length(u32) bytes datatype-id(u32)
+ *                language-length(u8) language-bytes
+ *
+ * A literal's datatype-id is 0 for none, otherwise the id of an
+ * earlier URI entry in the same block.  Each statement is four u32
+ * term ids - subject, predicate, object, graph - where graph id 0
+ * means the default graph.  Ids do not carry across blocks, so a
+ * block can be decoded (or skipped via block-length) in isolation.
+ */
+
+#define RAPTOR_BINARY_MAGIC "RAPB"
+#define RAPTOR_BINARY_MAGIC_LEN 4
+#define RAPTOR_BINARY_VERSION 1
+/* magic + version */
+#define RAPTOR_BINARY_HEADER_LEN 5
+
+#define RAPTOR_BINARY_TAG_BLOCK 'B'
+#define RAPTOR_BINARY_TAG_END 'E'
+
+#define RAPTOR_BINARY_TERM_URI 'U'
+#define RAPTOR_BINARY_TERM_BLANK 'N'
+#define RAPTOR_BINARY_TERM_LITERAL 'L'
+
+/* statements per block before the serializer flushes it */
+#define RAPTOR_BINARY_BLOCK_STATEMENTS 16384
+
+
+static void
+raptor_binary_encode_u32(unsigned char *buffer, unsigned int value)
+{
+  buffer[0] = RAPTOR_GOOD_CAST(unsigned char, value & 0xFF);
+  buffer[1] = RAPTOR_GOOD_CAST(unsigned char, (value >> 8) & 0xFF);
+  buffer[2] = RAPTOR_GOOD_CAST(unsigned char, (value >> 16) & 0xFF);
+  buffer[3] = RAPTOR_GOOD_CAST(unsigned char, (value >> 24) & 0xFF);
+}
+
+
+static unsigned int
+raptor_binary_decode_u32(const unsigned char *buffer)
+{
+  return (unsigned int)buffer[0] |
+         ((unsigned int)buffer[1] << 8) |
+         ((unsigned int)buffer[2] << 16) |
+         ((unsigned int)buffer[3] << 24);
+}
+
+#endif
+
+
+#ifdef RAPTOR_SERIALIZER_BINARY
+
+/*
+ * Raptor binary serializer object
+ */
+typedef struct {
+  /* map of term to per-block id - a tree of raptor_binary_dict_entry */
+  raptor_avltree* term_ids;
+
+  /* encoded dictionary entries of the current block */
+  raptor_stringbuffer* dict_sb;
+  /* encoded statement records of the current block */
+  raptor_stringbuffer* stmt_sb;
+
+  /* entries in dict_sb; the next entry gets id dict_count + 1 */
+  unsigned int dict_count;
+  /* records in stmt_sb */
+  unsigned int stmt_count;
+} raptor_binary_serializer_context;
+
+
+/* entry of the term_ids tree; holds a reference to the term */
+typedef struct {
+  raptor_term* term;
+  unsigned int id;
+} raptor_binary_dict_entry;
+
+
+static int
+raptor_binary_dict_entry_compare(const void *a, const void *b)
+{
+  return raptor_term_compare(((const raptor_binary_dict_entry*)a)->term,
+                             ((const raptor_binary_dict_entry*)b)->term);
+}
+
+
+static void
+raptor_binary_dict_entry_free(void *data)
+{
+  raptor_binary_dict_entry* entry = (raptor_binary_dict_entry*)data;
+
+  raptor_free_term(entry->term);
+  RAPTOR_FREE(raptor_binary_dict_entry, entry);
+}
+
+
+/*
+ * raptor_binary_serializer_block_init:
+ * @context: serializer context
+ *
+ * INTERNAL - Create the empty structures for a new block.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_binary_serializer_block_init(raptor_binary_serializer_context* context)
+{
+  context->term_ids = raptor_new_avltree(raptor_binary_dict_entry_compare,
+                                         raptor_binary_dict_entry_free, 0);
+  context->dict_sb = raptor_new_stringbuffer();
+  context->stmt_sb = raptor_new_stringbuffer();
+  context->dict_count = 0;
+  context->stmt_count = 0;
+
+  return !context->term_ids || !context->dict_sb || !context->stmt_sb;
+}
+
+
+static void
+raptor_binary_serializer_block_terminate(raptor_binary_serializer_context* context)
+{
+  if(context->term_ids) {
+    raptor_free_avltree(context->term_ids);
+    context->term_ids = NULL;
+  }
+  if(context->dict_sb) {
+    raptor_free_stringbuffer(context->dict_sb);
+    context->dict_sb = NULL;
+  }
+  if(context->stmt_sb) {
+    raptor_free_stringbuffer(context->stmt_sb);
+    context->stmt_sb = NULL;
+  }
+}
+
+
+static int
+raptor_binary_stringbuffer_append_u32(raptor_stringbuffer* sb,
+                                      unsigned int value)
+{
+  unsigned char buffer[4];
+
+  raptor_binary_encode_u32(buffer, value);
+  return raptor_stringbuffer_append_counted_string(sb, buffer, 4, 1);
+}
+
+
+/* forward declaration - literal entries encode their datatype id */
+static unsigned int raptor_binary_serializer_get_term_id(raptor_serializer* serializer, raptor_term* term, int *errorp);
+
+
+/*
+ * raptor_binary_serializer_append_dict_entry:
+ * @serializer: serializer object
+ * @term: term to encode
+ *
+ * INTERNAL - Append the dictionary record for @term to the block.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_binary_serializer_append_dict_entry(raptor_serializer* serializer,
+                                           raptor_term* term)
+{
+  raptor_binary_serializer_context* context;
+  raptor_stringbuffer* sb;
+  unsigned char* string;
+  size_t length;
+  unsigned int datatype_id = 0;
+
+  context = (raptor_binary_serializer_context*)serializer->context;
+  sb = context->dict_sb;
+
+  switch(term->type) {
+    case RAPTOR_TERM_TYPE_URI:
+      string = raptor_uri_as_counted_string(term->value.uri, &length);
+      if(raptor_stringbuffer_append_counted_string(sb,
+           (const unsigned char*)"U", 1, 1) ||
+         raptor_binary_stringbuffer_append_u32(sb,
+           RAPTOR_BAD_CAST(unsigned int, length)) ||
+         raptor_stringbuffer_append_counted_string(sb, string, length, 1))
+        return 1;
+      break;
+
+    case RAPTOR_TERM_TYPE_BLANK:
+      if(raptor_stringbuffer_append_counted_string(sb,
+           (const unsigned char*)"N", 1, 1) ||
+         raptor_binary_stringbuffer_append_u32(sb,
+           term->value.blank.string_len) ||
+         raptor_stringbuffer_append_counted_string(sb,
+           term->value.blank.string, term->value.blank.string_len, 1))
+        return 1;
+      break;
+
+    case RAPTOR_TERM_TYPE_LITERAL:
+      if(term->value.literal.datatype) {
+        raptor_term* datatype_term;
+        int error = 0;
+
+        /* the datatype URI becomes its own entry, defined before the
+         * literal that references it */
+        datatype_term = raptor_new_term_from_uri(serializer->world,
+                                                 term->value.literal.datatype);
+        if(!datatype_term)
+          return 1;
+        datatype_id = raptor_binary_serializer_get_term_id(serializer,
+                                                           datatype_term,
+                                                           &error);
+        raptor_free_term(datatype_term);
+        if(error)
+          return 1;
+      }
+
+      if(raptor_stringbuffer_append_counted_string(sb,
+           (const unsigned char*)"L", 1, 1) ||
+         raptor_binary_stringbuffer_append_u32(sb,
+           term->value.literal.string_len) ||
+         raptor_stringbuffer_append_counted_string(sb,
+           term->value.literal.string, term->value.literal.string_len, 1) ||
+         raptor_binary_stringbuffer_append_u32(sb, datatype_id))
+        return 1;
+
+      if(raptor_stringbuffer_append_counted_string(sb,
+           &term->value.literal.language_len, 1, 1))
+        return 1;
+      if(term->value.literal.language_len &&
+         raptor_stringbuffer_append_counted_string(sb,
+           term->value.literal.language, term->value.literal.language_len, 1))
+        return 1;
+      break;
+
+    case RAPTOR_TERM_TYPE_UNKNOWN:
+    default:
+      return 1;
+  }
+
+  return 0;
+}
+
+
+/*
+ * raptor_binary_serializer_get_term_id:
+ * @serializer: serializer object
+ * @term: term
+ * @errorp: error flag to set on failure
+ *
+ * INTERNAL - Get the current block id for @term, defining it if new.
+ *
+ * Return value: term id (1-based)
+ */
+static unsigned int
+raptor_binary_serializer_get_term_id(raptor_serializer* serializer,
+                                     raptor_term* term, int *errorp)
+{
+  raptor_binary_serializer_context* context;
+  raptor_binary_dict_entry key;
+  raptor_binary_dict_entry* entry;
+
+  context = (raptor_binary_serializer_context*)serializer->context;
+
+  key.term = term;
+  entry = (raptor_binary_dict_entry*)raptor_avltree_search(context->term_ids,
+                                                           &key);
+  if(entry)
+    return entry->id;
+
+  if(raptor_binary_serializer_append_dict_entry(serializer, term))
+    goto error;
+
+  entry = RAPTOR_MALLOC(raptor_binary_dict_entry*, sizeof(*entry));
+  if(!entry)
+    goto error;
+
+  entry->term = raptor_term_copy(term);
+  entry->id = ++context->dict_count;
+
+  /* raptor_avltree_add() frees entry via the free handler on failure */
+  if(raptor_avltree_add(context->term_ids, entry))
+    goto error;
+
+  return entry->id;
+
+  error:
+  *errorp = 1;
+  return 0;
+}
+
+
+/*
+ * raptor_binary_serialize_flush_block:
+ * @serializer: serializer object
+ *
+ * INTERNAL - Write the accumulated block to the iostream and reset.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_binary_serialize_flush_block(raptor_serializer* serializer)
+{
+  raptor_binary_serializer_context* context;
+  unsigned char buffer[4];
+  size_t dict_length;
+  size_t stmt_length;
+  raptor_iostream* iostr = serializer->iostream;
+
+  context = (raptor_binary_serializer_context*)serializer->context;
+
+  if(!context->stmt_count && !context->dict_count)
+    return 0;
+
+  dict_length = raptor_stringbuffer_length(context->dict_sb);
+  stmt_length = raptor_stringbuffer_length(context->stmt_sb);
+
+  raptor_iostream_write_byte(RAPTOR_BINARY_TAG_BLOCK, iostr);
+  /* block length counts both u32 counters and the encoded records */
+  raptor_binary_encode_u32(buffer,
+                           RAPTOR_BAD_CAST(unsigned int,
+                                           8 + dict_length + stmt_length));
+  raptor_iostream_write_bytes(buffer, 1, 4, iostr);
+
+  raptor_binary_encode_u32(buffer, context->dict_count);
+  raptor_iostream_write_bytes(buffer, 1, 4, iostr);
+  if(dict_length)
+    raptor_iostream_write_bytes(raptor_stringbuffer_as_string(context->dict_sb),
+                                1, dict_length, iostr);
+
+  raptor_binary_encode_u32(buffer, context->stmt_count);
+  raptor_iostream_write_bytes(buffer, 1, 4, iostr);
+  if(stmt_length)
+    raptor_iostream_write_bytes(raptor_stringbuffer_as_string(context->stmt_sb),
+                                1, stmt_length, iostr);
+
+  raptor_binary_serializer_block_terminate(context);
+  return raptor_binary_serializer_block_init(context);
+}
+
+
+/* create a new serializer */
+static int
+raptor_binary_serialize_init(raptor_serializer* serializer, const char *name)
+{
+  raptor_binary_serializer_context* context;
+
+  context = (raptor_binary_serializer_context*)serializer->context;
+  return raptor_binary_serializer_block_init(context);
+}
+
+
+/* destroy a serializer */
+static void
+raptor_binary_serialize_terminate(raptor_serializer* serializer)
+{
+  raptor_binary_serializer_context* context;
+
+  context = (raptor_binary_serializer_context*)serializer->context;
+  raptor_binary_serializer_block_terminate(context);
+}
+
+
+/* add a namespace */
+static int
+raptor_binary_serialize_declare_namespace(raptor_serializer* serializer,
+                                          raptor_uri *uri,
+                                          const unsigned char *prefix)
+{
+  /* NOP - the format has no namespaces */
+  return 0;
+}
+
+
+/* start a serialize */
+static int
+raptor_binary_serialize_start(raptor_serializer* serializer)
+{
+  raptor_iostream_write_bytes(RAPTOR_BINARY_MAGIC, 1,
+                              RAPTOR_BINARY_MAGIC_LEN, serializer->iostream);
+  raptor_iostream_write_byte(RAPTOR_BINARY_VERSION, serializer->iostream);
+  return 0;
+}
+
+
+/* serialize a statement */
+static int
+raptor_binary_serialize_statement(raptor_serializer* serializer,
+                                  raptor_statement *statement)
+{
+  raptor_binary_serializer_context* context;
+  unsigned char buffer[16];
+  unsigned int graph_id = 0;
+  int error = 0;
+
+  context = (raptor_binary_serializer_context*)serializer->context;
+
+  raptor_binary_encode_u32(&buffer[0],
+    raptor_binary_serializer_get_term_id(serializer, statement->subject,
+                                         &error));
+  raptor_binary_encode_u32(&buffer[4],
+    raptor_binary_serializer_get_term_id(serializer, statement->predicate,
+                                         &error));
+  raptor_binary_encode_u32(&buffer[8],
+    raptor_binary_serializer_get_term_id(serializer, statement->object,
+                                         &error));
+
+  if(statement->graph)
+    graph_id = raptor_binary_serializer_get_term_id(serializer,
+                                                    statement->graph, &error);
+  raptor_binary_encode_u32(&buffer[12], graph_id);
+
+  if(error)
+    return 1;
+
+  if(raptor_stringbuffer_append_counted_string(context->stmt_sb,
+                                               buffer, sizeof(buffer), 1))
+    return 1;
+  context->stmt_count++;
+
+  if(context->stmt_count >= RAPTOR_BINARY_BLOCK_STATEMENTS)
+    return raptor_binary_serialize_flush_block(serializer);
+
+  return 0;
+}
+
+
+/* end a serialize */
+static int
+raptor_binary_serialize_end(raptor_serializer* serializer)
+{
+  if(raptor_binary_serialize_flush_block(serializer))
+    return 1;
+
+  raptor_iostream_write_byte(RAPTOR_BINARY_TAG_END, serializer->iostream);
+  return 0;
+}
+
+
+/* finish the serializer factory */
+static void
+raptor_binary_serialize_finish_factory(raptor_serializer_factory* factory)
+{
+  /* NOP */
+}
+
+
+static const char* const binary_names[2] = { "raptor-binary", NULL };
+
+#define BINARY_TYPES_COUNT 1
+static const raptor_type_q binary_types[BINARY_TYPES_COUNT + 1] = {
+  { "application/x-raptor-binary", 27, 10},
+  { NULL, 0, 0}
+};
+
+static int
+raptor_binary_serializer_register_factory(raptor_serializer_factory *factory)
+{
+  factory->desc.names = binary_names;
+  factory->desc.mime_types = binary_types;
+
+  factory->desc.label = "Raptor binary statement interchange";
+  factory->desc.uri_strings = NULL;
+
+  factory->context_length     = sizeof(raptor_binary_serializer_context);
+
+  factory->init                = raptor_binary_serialize_init;
+  factory->terminate           = raptor_binary_serialize_terminate;
+  factory->declare_namespace   = raptor_binary_serialize_declare_namespace;
+  factory->serialize_start     = raptor_binary_serialize_start;
+  factory->serialize_statement = raptor_binary_serialize_statement;
+  factory->serialize_end       = raptor_binary_serialize_end;
+  factory->finish_factory      = raptor_binary_serialize_finish_factory;
+
+  return 0;
+}
+
+
+int
+raptor_init_serializer_binary(raptor_world* world)
+{
+  return !raptor_serializer_register_factory(world,
+                                             &raptor_binary_serializer_register_factory);
+}
+
+#endif
+
+
+#ifdef RAPTOR_PARSER_BINARY
+
+/*
+ * Raptor binary parser object
+ */
+struct raptor_binary_parser_context_s {
+  /* bytes accumulated but not yet decoded */
+  unsigned char *buffer;
+  /* allocated size of buffer */
+  size_t buffer_size;
+  /* valid bytes in buffer */
+  size_t buffer_length;
+
+  /* file header has been checked */
+  int seen_header;
+  /* end-of-stream trailer has been seen */
+  int seen_trailer;
+};
+
+typedef struct raptor_binary_parser_context_s raptor_binary_parser_context;
+
+
+static int
+raptor_binary_parse_init(raptor_parser* rdf_parser, const char *name)
+{
+  return 0;
+}
+
+
+static void
+raptor_binary_parse_terminate(raptor_parser* rdf_parser)
+{
+  raptor_binary_parser_context *binary_parser;
+
+  binary_parser = (raptor_binary_parser_context*)rdf_parser->context;
+  if(binary_parser->buffer) {
+    RAPTOR_FREE(cdata, binary_parser->buffer);
+    binary_parser->buffer = NULL;
+    binary_parser->buffer_size = 0;
+    binary_parser->buffer_length = 0;
+  }
+}
+
+
+static int
+raptor_binary_parse_start(raptor_parser* rdf_parser)
+{
+  raptor_locator *locator = &rdf_parser->locator;
+  raptor_binary_parser_context *binary_parser;
+
+  binary_parser = (raptor_binary_parser_context*)rdf_parser->context;
+
+  /* a binary format has no lines or columns */
+  locator->line = -1;
+  locator->column = -1;
+  locator->byte = 0;
+
+  binary_parser->buffer_length = 0;
+  binary_parser->seen_header = 0;
+  binary_parser->seen_trailer = 0;
+
+  return 0;
+}
+
+
+/*
+ * raptor_binary_parse_block:
+ * @rdf_parser: parser object
+ * @p: start of block content (after tag and length)
+ * @block_length: length of block content
+ *
+ * INTERNAL - Decode one complete block and emit its statements.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_binary_parse_block(raptor_parser* rdf_parser,
+                          const unsigned char *p, size_t block_length)
+{
+  const unsigned char *end = p + block_length;
+  raptor_term** dict = NULL;
+  unsigned int dict_count;
+  unsigned int stmt_count;
+  unsigned int i;
+  int rc = 1;
+
+  if(block_length < 8) {
+    raptor_parser_error(rdf_parser, "Binary block too short");
+    return 1;
+  }
+
+  dict_count = raptor_binary_decode_u32(p);
+  p += 4;
+
+  /* every dictionary entry occupies at least 5 bytes (kind + u32
+   * length), so a count the block cannot possibly hold is rejected
+   * before it sizes an allocation - an untrusted 0xFFFFFFFF here
+   * would otherwise wrap dict_count + 1 below to a zero-size dict
+   * that the cleanup loop walks far out of bounds */
+  if((size_t)dict_count > (block_length - 4) / 5) {
+    raptor_parser_error(rdf_parser,
+                        "Binary block dictionary count %u too large for block",
+                        dict_count);
+    return 1;
+  }
+
+  /* ids are 1-based; entry 0 stays NULL */
+  dict = RAPTOR_CALLOC(raptor_term**, dict_count + 1, sizeof(raptor_term*));
+  if(!dict)
+    return 1;
+
+  for(i = 1; i <= dict_count; i++) {
+    unsigned char kind;
+    unsigned int length;
+
+    if(p + 5 > end)
+      goto truncated;
+    kind = *p++;
+    length = raptor_binary_decode_u32(p);
+    p += 4;
+    if(p + length > end)
+      goto truncated;
+
+    switch(kind) {
+      case RAPTOR_BINARY_TERM_URI:
+        dict[i] = raptor_new_term_from_counted_uri_string(rdf_parser->world,
+                                                          p, length);
+        p += length;
+        break;
+
+      case RAPTOR_BINARY_TERM_BLANK:
+        dict[i] = raptor_new_term_from_counted_blank(rdf_parser->world,
+                                                     p, length);
+        p += length;
+        break;
+
+      case RAPTOR_BINARY_TERM_LITERAL: {
+        const unsigned char *value = p;
+        unsigned int datatype_id;
+        unsigned char language_len;
+        raptor_uri* datatype_uri = NULL;
+
+        p += length;
+        if(p + 5 > end)
+          goto truncated;
+        datatype_id = raptor_binary_decode_u32(p);
+        p += 4;
+        language_len = *p++;
+        if(p + language_len > end)
+          goto truncated;
+
+        if(datatype_id) {
+          if(datatype_id >= i || !dict[datatype_id] ||
+             dict[datatype_id]->type != RAPTOR_TERM_TYPE_URI) {
+            raptor_parser_error(rdf_parser,
+                                "Binary literal datatype id %u is not an earlier URI entry",
+                                datatype_id);
+            goto cleanup;
+          }
+          datatype_uri = dict[datatype_id]->value.uri;
+        }
+
+        dict[i] = raptor_new_term_from_counted_literal(rdf_parser->world,
+                                                       value, length,
+                                                       datatype_uri,
+                                                       language_len ? p : NULL,
+                                                       language_len);
+        p += language_len;
+        break;
+      }
+
+      default:
+        raptor_parser_error(rdf_parser,
+                            "Unknown binary term kind 0x%02X", kind);
+        goto cleanup;
+    }
+
+    if(!dict[i])
+      goto cleanup;
+  }
+
+  if(p + 4 > end)
+    goto truncated;
+  stmt_count = raptor_binary_decode_u32(p);
+  p += 4;
+
+  /* compare by division: stmt_count * 16 can wrap a 32-bit size_t
+   * and slip an oversized count past an equality check */
+  if(RAPTOR_GOOD_CAST(size_t, end - p) / 16 != (size_t)stmt_count ||
+     RAPTOR_GOOD_CAST(size_t, end - p) % 16) {
+    raptor_parser_error(rdf_parser, "Binary block statement area size mismatch");
+    goto cleanup;
+  }
+
+  for(i = 0; i < stmt_count; i++) {
+    raptor_statement *statement = &rdf_parser->statement;
+    unsigned int subject_id = raptor_binary_decode_u32(p);
+    unsigned int predicate_id = raptor_binary_decode_u32(p + 4);
+    unsigned int object_id = raptor_binary_decode_u32(p + 8);
+    unsigned int graph_id = raptor_binary_decode_u32(p + 12);
+
+    p += 16;
+
+    if(!subject_id || subject_id > dict_count ||
+       !predicate_id || predicate_id > dict_count ||
+       !object_id || object_id > dict_count ||
+       graph_id > dict_count) {
+      raptor_parser_error(rdf_parser, "Binary statement term id out of range");
+      goto cleanup;
+    }
+
+    if(!rdf_parser->emitted_default_graph) {
+      raptor_parser_start_graph(rdf_parser, NULL, 0);
+      rdf_parser->emitted_default_graph++;
+    }
+
+    statement->subject = raptor_term_copy(dict[subject_id]);
+    statement->predicate = raptor_term_copy(dict[predicate_id]);
+    statement->object = raptor_term_copy(dict[object_id]);
+    statement->graph = graph_id ? raptor_term_copy(dict[graph_id]) : NULL;
+
+    if(rdf_parser->statement_handler)
+      raptor_parser_emit_statement(rdf_parser, statement);
+
+    raptor_free_statement(statement);
+  }
+
+  rc = 0;
+  goto cleanup;
+
+  truncated:
+  raptor_parser_error(rdf_parser, "Binary block truncated");
+
+  cleanup:
+  for(i = 1; i <= dict_count; i++) {
+    if(dict[i])
+      raptor_free_term(dict[i]);
+  }
+  RAPTOR_FREE(raptor_term**, dict);
+
+  return rc;
+}
+
+
+static int
+raptor_binary_parse_chunk(raptor_parser* rdf_parser,
+                          const unsigned char *s, size_t len,
+                          int is_end)
+{
+  raptor_binary_parser_context *binary_parser;
+  unsigned char *p;
+  size_t remaining;
+
+  binary_parser = (raptor_binary_parser_context*)rdf_parser->context;
+
+  if(rdf_parser->failed)
+    return 1;
+
+  /* append the new bytes to any kept partial record */
+  if(len) {
+    if(binary_parser->buffer_length + len > binary_parser->buffer_size) {
+      unsigned char *buffer;
+      size_t new_size = binary_parser->buffer_length + len;
+
+      buffer = RAPTOR_MALLOC(unsigned char*, new_size);
+      if(!buffer)
+        return 1;
+      if(binary_parser->buffer_length)
+        memcpy(buffer, binary_parser->buffer, binary_parser->buffer_length);
+      if(binary_parser->buffer)
+        RAPTOR_FREE(cdata, binary_parser->buffer);
+      binary_parser->buffer = buffer;
+      binary_parser->buffer_size = new_size;
+    }
+    memcpy(binary_parser->buffer + binary_parser->buffer_length, s, len);
+    binary_parser->buffer_length += len;
+  }
+
+  p = binary_parser->buffer;
+  remaining = binary_parser->buffer_length;
+
+  if(!binary_parser->seen_header) {
+    if(remaining < RAPTOR_BINARY_HEADER_LEN)
+      goto keep;
+
+    if(memcmp(p, RAPTOR_BINARY_MAGIC, RAPTOR_BINARY_MAGIC_LEN)) {
+      raptor_parser_error(rdf_parser, "Not a raptor binary stream");
+      return 1;
+    }
+    if(p[RAPTOR_BINARY_MAGIC_LEN] != RAPTOR_BINARY_VERSION) {
+      raptor_parser_error(rdf_parser,
+                          "Unknown raptor binary format version %d",
+                          (int)p[RAPTOR_BINARY_MAGIC_LEN]);
+      return 1;
+    }
+    p += RAPTOR_BINARY_HEADER_LEN;
+    remaining -= RAPTOR_BINARY_HEADER_LEN;
+    binary_parser->seen_header = 1;
+  }
+
+  while(remaining > 0 && !binary_parser->seen_trailer) {
+    unsigned char tag = *p;
+    unsigned int block_length;
+
+    if(tag == RAPTOR_BINARY_TAG_END) {
+      p++;
+      remaining--;
+      binary_parser->seen_trailer = 1;
+      break;
+    }
+
+    if(tag != RAPTOR_BINARY_TAG_BLOCK) {
+      raptor_parser_error(rdf_parser,
+                          "Unknown binary record tag 0x%02X", tag);
+      return 1;
+    }
+
+    if(remaining < 5)
+      break;
+    block_length = raptor_binary_decode_u32(p + 1);
+    if(remaining < (size_t)5 + block_length)
+      break;
+
+    if(raptor_binary_parse_block(rdf_parser, p + 5, block_length))
+      return 1;
+
+    p += 5 + block_length;
+    remaining -= 5 + block_length;
+  }
+
+  if(binary_parser->seen_trailer && remaining) {
+    raptor_parser_error(rdf_parser, "Data after binary stream trailer");
+    return 1;
+  }
+
+  keep:
+  /* keep an incomplete record for the next chunk */
+  if(remaining && p != binary_parser->buffer)
+    memmove(binary_parser->buffer, p, remaining);
+  rdf_parser->locator.byte += RAPTOR_BAD_CAST(long,
+    binary_parser->buffer_length - remaining);
+  binary_parser->buffer_length = remaining;
+
+  if(is_end) {
+    if(remaining || !binary_parser->seen_trailer) {
+      raptor_parser_error(rdf_parser, "Unexpected end of binary stream");
+      return 1;
+    }
+
+    if(rdf_parser->emitted_default_graph) {
+      raptor_parser_end_graph(rdf_parser, NULL, 0);
+      rdf_parser->emitted_default_graph--;
+    }
+  }
+
+  return 0;
+}
+
+
+static int
+raptor_binary_parse_recognise_syntax(raptor_parser_factory* factory,
+                                     const unsigned char *buffer, size_t len,
+                                     const unsigned char *identifier,
+                                     const unsigned char *suffix,
+                                     const char *mime_type)
+{
+  if(buffer && len >= RAPTOR_BINARY_MAGIC_LEN &&
+     !memcmp(buffer, RAPTOR_BINARY_MAGIC, RAPTOR_BINARY_MAGIC_LEN))
+    return 9;
+
+  return 0;
+}
+
+
+static const char* const binary_parser_names[2] = { "raptor-binary", NULL };
+
+#define BINARY_PARSER_TYPES_COUNT 1
+static const raptor_type_q binary_parser_types[BINARY_PARSER_TYPES_COUNT + 1] = {
+  { "application/x-raptor-binary", 27, 10},
+  { NULL, 0, 0}
+};
+
+static int
+raptor_binary_parser_register_factory(raptor_parser_factory *factory)
+{
+  int rc = 0;
+
+  factory->desc.names = binary_parser_names;
+
+  factory->desc.mime_types = binary_parser_types;
+
+  factory->desc.label = "Raptor binary statement interchange";
+  factory->desc.uri_strings = NULL;
+
+  factory->desc.flags = 0;
+
+  factory->context_length     = sizeof(raptor_binary_parser_context);
+
+  factory->init      = raptor_binary_parse_init;
+  factory->terminate = raptor_binary_parse_terminate;
+  factory->start     = raptor_binary_parse_start;
+  factory->chunk     = raptor_binary_parse_chunk;
+  factory->recognise_syntax = raptor_binary_parse_recognise_syntax;
+
+  return rc;
+}
+
+
+int
+raptor_init_parser_binary(raptor_world* world)
+{
+  return !raptor_world_register_parser_factory(world,
+                                               &raptor_binary_parser_register_factory);
+}
+
+#endif
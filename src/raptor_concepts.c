@@ -120,6 +120,38 @@ const raptor_rdf_ns_term_info raptor_rdf_ns_terms_info[RDF_NS_LAST + 2] = {
 };
 
 
+/* xsd:* local names indexed by #raptor_xsd_datatype;
+ * entry RAPTOR_XSD_DATATYPE_NONE is NULL */
+static const char* const raptor_xsd_datatype_names[RAPTOR_XSD_DATATYPE_LAST + 1] = {
+  NULL,
+  "anyURI",
+  "base64Binary",
+  "boolean",
+  "byte",
+  "date",
+  "dateTime",
+  "decimal",
+  "double",
+  "duration",
+  "float",
+  "hexBinary",
+  "int",
+  "integer",
+  "long",
+  "negativeInteger",
+  "nonNegativeInteger",
+  "nonPositiveInteger",
+  "positiveInteger",
+  "short",
+  "string",
+  "time",
+  "unsignedByte",
+  "unsignedInt",
+  "unsignedLong",
+  "unsignedShort"
+};
+
+
 
 int
 raptor_concepts_init(raptor_world* world)
@@ -149,21 +181,19 @@ raptor_concepts_init(raptor_world* world)
   if(!world->xsd_namespace_uri)
     return 1;
 
-  world->xsd_boolean_uri = raptor_new_uri_from_uri_local_name(world, world->xsd_namespace_uri, (const unsigned char*)"boolean");
-  if(!world->xsd_boolean_uri)
-    return 1;
+  for(i = RAPTOR_XSD_DATATYPE_NONE + 1; i <= RAPTOR_XSD_DATATYPE_LAST; i++) {
+    unsigned char* name = (unsigned char*)raptor_xsd_datatype_names[i];
 
-  world->xsd_decimal_uri = raptor_new_uri_from_uri_local_name(world, world->xsd_namespace_uri, (const unsigned char*)"decimal");
-  if(!world->xsd_decimal_uri)
-    return 1;
-
-  world->xsd_double_uri = raptor_new_uri_from_uri_local_name(world, world->xsd_namespace_uri, (const unsigned char*)"double");
-  if(!world->xsd_double_uri)
-    return 1;
+    world->xsd_datatype_uris[i] =
+      raptor_new_uri_from_uri_local_name(world, world->xsd_namespace_uri, name);
+    if(!world->xsd_datatype_uris[i])
+      return 1;
 
-  world->xsd_integer_uri = raptor_new_uri_from_uri_local_name(world, world->xsd_namespace_uri, (const unsigned char*)"integer");
-  if(!world->xsd_integer_uri)
-    return 1;
+    world->xsd_datatype_terms[i] =
+      raptor_new_term_from_uri(world, world->xsd_datatype_uris[i]);
+    if(!world->xsd_datatype_terms[i])
+      return 1;
+  }
 
   return 0;
 }
@@ -185,15 +215,69 @@ raptor_concepts_finish(raptor_world* world)
       raptor_free_term(world->terms[i]);
   }
 
-  if(world->xsd_boolean_uri)
-    raptor_free_uri(world->xsd_boolean_uri);
-  if(world->xsd_decimal_uri)
-    raptor_free_uri(world->xsd_decimal_uri);
-  if(world->xsd_double_uri)
-    raptor_free_uri(world->xsd_double_uri);
-  if(world->xsd_integer_uri)
-    raptor_free_uri(world->xsd_integer_uri);
+  for(i = RAPTOR_XSD_DATATYPE_NONE + 1; i <= RAPTOR_XSD_DATATYPE_LAST; i++) {
+    if(world->xsd_datatype_terms[i]) {
+      raptor_free_term(world->xsd_datatype_terms[i]);
+      world->xsd_datatype_terms[i] = NULL;
+    }
+    if(world->xsd_datatype_uris[i]) {
+      raptor_free_uri(world->xsd_datatype_uris[i]);
+      world->xsd_datatype_uris[i] = NULL;
+    }
+  }
 
   if(world->xsd_namespace_uri)
     raptor_free_uri(world->xsd_namespace_uri);
 }
+
+
+/**
+ * raptor_world_get_xsd_datatype_uri:
+ * @world: raptor_world object
+ * @datatype: XSD datatype
+ *
+ * Get the pre-built URI of a common XSD datatype.
+ *
+ * The returned URI is shared and owned by @world; use
+ * raptor_uri_copy() to keep a reference to it.
+ *
+ * Return value: shared #raptor_uri or NULL if @datatype is not a known datatype
+ */
+raptor_uri*
+raptor_world_get_xsd_datatype_uri(raptor_world* world,
+                                  raptor_xsd_datatype datatype)
+{
+  RAPTOR_ASSERT_OBJECT_POINTER_RETURN_VALUE(world, raptor_world, NULL);
+
+  if(datatype <= RAPTOR_XSD_DATATYPE_NONE ||
+     datatype > RAPTOR_XSD_DATATYPE_LAST)
+    return NULL;
+
+  return world->xsd_datatype_uris[datatype];
+}
+
+
+/**
+ * raptor_world_get_xsd_datatype_term:
+ * @world: raptor_world object
+ * @datatype: XSD datatype
+ *
+ * Get the pre-built URI term of a common XSD datatype.
+ *
+ * The returned term is shared and owned by @world; use
+ * raptor_term_copy() to keep a reference to it.
+ *
+ * Return value: shared #raptor_term or NULL if @datatype is not a known datatype
+ */
+raptor_term*
+raptor_world_get_xsd_datatype_term(raptor_world* world,
+                                   raptor_xsd_datatype datatype)
+{
+  RAPTOR_ASSERT_OBJECT_POINTER_RETURN_VALUE(world, raptor_world, NULL);
+
+  if(datatype <= RAPTOR_XSD_DATATYPE_NONE ||
+     datatype > RAPTOR_XSD_DATATYPE_LAST)
+    return NULL;
+
+  return world->xsd_datatype_terms[datatype];
+}
@@ -0,0 +1,492 @@
+/* -*- Mode: c; c-basic-offset: 2 -*-
+ *
+ * raptor_convert.c - Pipelined parse to serialize format conversion
+ *
+ * Copyright (C) 2010, David Beckett http://www.dajobe.org/
+ *
+ * This package is Free Software and part of Redland http://librdf.org/
+ *
+ * It is licensed under the following three licenses as alternatives:
+ *   1. GNU Lesser General Public License (LGPL) V2.1 or any newer version
+ *   2. GNU General Public License (GPL) V2 or any newer version
+ *   3. Apache License, V2.0 or any newer version
+ *
+ * You may not use this file except in compliance with at least one of
+ * the above three licenses.
+ *
+ * See LICENSE.html or LICENSE.txt at the top of this package for the
+ * complete terms and further detail along with the license texts for
+ * the licenses in COPYING.LIB, COPYING and LICENSE-2.0.txt respectively.
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <raptor_config.h>
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
+/* Raptor includes */
+#include "raptor2.h"
+#include "raptor_internal.h"
+
+
+/*
+ * Format conversion used to be wired up by the caller: the parser's
+ * statement handler called raptor_serializer_serialize_statement()
+ * directly (see utils/rapper.c) so parsing and serializing ran
+ * interleaved on one thread.  raptor_convert() instead runs the
+ * serializer on its own thread fed through a small bounded ring of
+ * statement batches, so the two stages overlap.
+ *
+ * The pipeline needs a thread-safe world: statements are copied on
+ * the parser thread and freed on the serializer thread, which is only
+ * safe when the term and URI reference counts and the statement pool
+ * are guarded by the world mutex (RAPTOR_WORLD_FLAG_THREAD_SAFE).
+ * When that flag is unset, or raptor was built without pthreads, the
+ * conversion falls back to the classic single-threaded wiring with
+ * identical results.
+ */
+
+#ifdef HAVE_PTHREAD_H
+
+/* Statements accumulated per ring slot before handing to the consumer */
+#define RAPTOR_CONVERT_BATCH_SIZE 256
+
+/* Ring capacity in events; bounds memory when the serializer lags */
+#define RAPTOR_CONVERT_RING_SIZE 8
+
+
+/*
+ * A pipeline event is a batch of statements, a namespace declaration
+ * or both NULL fields (end of stream).  Namespace declarations flush
+ * the batch under construction first so the consumer applies them to
+ * the serializer in document order.
+ */
+typedef struct {
+  /* batch of raptor_statement* owned by the event, or NULL */
+  raptor_sequence* statements;
+
+  /* copied namespace prefix (may be NULL for the default namespace) */
+  unsigned char* ns_prefix;
+
+  /* copied namespace URI, or NULL when this is not a namespace event */
+  raptor_uri* ns_uri;
+} raptor_convert_event;
+
+
+typedef struct {
+  raptor_world* world;
+  raptor_parser* parser;
+  raptor_serializer* serializer;
+
+  /* bounded ring of event pointers; producer blocks when full,
+   * consumer blocks when empty */
+  raptor_convert_event* ring[RAPTOR_CONVERT_RING_SIZE];
+  int ring_head;
+  int ring_tail;
+  int ring_count;
+
+  pthread_mutex_t mutex;
+  pthread_cond_t not_empty;
+  pthread_cond_t not_full;
+
+  /* batch under construction on the parser thread */
+  raptor_sequence* batch;
+
+  /* non-0 when either stage failed; producer aborts the parse */
+  int failed;
+
+  pthread_t thread;
+} raptor_convert_pipeline;
+
+
+/*
+ * raptor_free_convert_event:
+ * @event: pipeline event
+ *
+ * INTERNAL - Destroy a pipeline event and its content.
+ */
+static void
+raptor_free_convert_event(raptor_convert_event* event)
+{
+  if(!event)
+    return;
+
+  if(event->statements)
+    raptor_free_sequence(event->statements);
+  if(event->ns_prefix)
+    RAPTOR_FREE(char*, event->ns_prefix);
+  if(event->ns_uri)
+    raptor_free_uri(event->ns_uri);
+
+  RAPTOR_FREE(raptor_convert_event*, event);
+}
+
+
+/*
+ * raptor_convert_pipeline_push:
+ * @pipeline: conversion pipeline
+ * @event: event to enqueue (ownership transferred), or NULL for end of stream
+ *
+ * INTERNAL - Enqueue an event, blocking while the ring is full.
+ *
+ * Return value: non-0 on failure (the consumer already failed)
+ */
+static int
+raptor_convert_pipeline_push(raptor_convert_pipeline* pipeline,
+                             raptor_convert_event* event)
+{
+  int rc = 0;
+
+  pthread_mutex_lock(&pipeline->mutex);
+
+  /* a failed consumer keeps draining until end of stream so this
+   * cannot block forever */
+  while(pipeline->ring_count == RAPTOR_CONVERT_RING_SIZE)
+    pthread_cond_wait(&pipeline->not_full, &pipeline->mutex);
+
+  if(pipeline->failed && event) {
+    /* consumer gave up - discard the event but still deliver the end
+     * of stream marker so the consumer thread terminates */
+    raptor_free_convert_event(event);
+    rc = 1;
+  } else {
+    pipeline->ring[pipeline->ring_tail] = event;
+    pipeline->ring_tail = (pipeline->ring_tail + 1) % RAPTOR_CONVERT_RING_SIZE;
+    pipeline->ring_count++;
+    pthread_cond_signal(&pipeline->not_empty);
+  }
+
+  pthread_mutex_unlock(&pipeline->mutex);
+
+  return rc;
+}
+
+
+/*
+ * raptor_convert_pipeline_flush_batch:
+ * @pipeline: conversion pipeline
+ *
+ * INTERNAL - Enqueue the batch under construction, if any.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_convert_pipeline_flush_batch(raptor_convert_pipeline* pipeline)
+{
+  raptor_convert_event* event;
+
+  if(!pipeline->batch || !raptor_sequence_size(pipeline->batch))
+    return 0;
+
+  event = RAPTOR_CALLOC(raptor_convert_event*, 1, sizeof(*event));
+  if(!event)
+    return 1;
+
+  event->statements = pipeline->batch;
+  pipeline->batch = NULL;
+
+  return raptor_convert_pipeline_push(pipeline, event);
+}
+
+
+/*
+ * raptor_convert_statement_handler:
+ * @user_data: conversion pipeline
+ * @statement: statement from the parser
+ *
+ * INTERNAL - Parser statement handler; copies the statement into the
+ * batch under construction and enqueues full batches.
+ */
+static void
+raptor_convert_statement_handler(void* user_data, raptor_statement* statement)
+{
+  raptor_convert_pipeline* pipeline = (raptor_convert_pipeline*)user_data;
+  raptor_statement* s;
+
+  if(pipeline->failed) {
+    raptor_parser_parse_abort(pipeline->parser);
+    return;
+  }
+
+  if(!pipeline->batch) {
+    pipeline->batch = raptor_new_sequence((raptor_data_free_handler)raptor_free_statement,
+                                          NULL);
+    if(!pipeline->batch)
+      goto failed;
+  }
+
+  s = raptor_statement_copy(statement);
+  if(!s)
+    goto failed;
+
+  if(raptor_sequence_push(pipeline->batch, s))
+    goto failed;
+
+  if(raptor_sequence_size(pipeline->batch) >= RAPTOR_CONVERT_BATCH_SIZE) {
+    if(raptor_convert_pipeline_flush_batch(pipeline))
+      goto failed;
+  }
+
+  return;
+
+  failed:
+  pipeline->failed = 1;
+  raptor_parser_parse_abort(pipeline->parser);
+}
+
+
+/*
+ * raptor_convert_namespace_handler:
+ * @user_data: conversion pipeline
+ * @nspace: namespace declared by the parser
+ *
+ * INTERNAL - Parser namespace handler; flushes the current batch and
+ * enqueues the declaration so the consumer applies it in order.
+ */
+static void
+raptor_convert_namespace_handler(void* user_data, raptor_namespace* nspace)
+{
+  raptor_convert_pipeline* pipeline = (raptor_convert_pipeline*)user_data;
+  raptor_convert_event* event;
+  const unsigned char* prefix;
+
+  if(pipeline->failed)
+    return;
+
+  if(raptor_convert_pipeline_flush_batch(pipeline))
+    goto failed;
+
+  event = RAPTOR_CALLOC(raptor_convert_event*, 1, sizeof(*event));
+  if(!event)
+    goto failed;
+
+  event->ns_uri = raptor_uri_copy(raptor_namespace_get_uri(nspace));
+  if(!event->ns_uri) {
+    raptor_free_convert_event(event);
+    goto failed;
+  }
+
+  prefix = raptor_namespace_get_prefix(nspace);
+  if(prefix) {
+    size_t len = strlen((const char*)prefix);
+    event->ns_prefix = RAPTOR_MALLOC(unsigned char*, len + 1);
+    if(!event->ns_prefix) {
+      raptor_free_convert_event(event);
+      goto failed;
+    }
+    memcpy(event->ns_prefix, prefix, len + 1);
+  }
+
+  if(raptor_convert_pipeline_push(pipeline, event))
+    goto failed;
+
+  return;
+
+  failed:
+  pipeline->failed = 1;
+}
+
+
+/*
+ * raptor_convert_pipeline_run:
+ * @arg: conversion pipeline
+ *
+ * INTERNAL - Consumer thread; serializes batches until end of stream.
+ */
+static void*
+raptor_convert_pipeline_run(void* arg)
+{
+  raptor_convert_pipeline* pipeline = (raptor_convert_pipeline*)arg;
+
+  while(1) {
+    raptor_convert_event* event;
+
+    pthread_mutex_lock(&pipeline->mutex);
+    while(!pipeline->ring_count)
+      pthread_cond_wait(&pipeline->not_empty, &pipeline->mutex);
+
+    event = pipeline->ring[pipeline->ring_head];
+    pipeline->ring_head = (pipeline->ring_head + 1) % RAPTOR_CONVERT_RING_SIZE;
+    pipeline->ring_count--;
+    pthread_cond_signal(&pipeline->not_full);
+    pthread_mutex_unlock(&pipeline->mutex);
+
+    if(!event)
+      /* end of stream */
+      break;
+
+    if(!pipeline->failed) {
+      if(event->ns_uri) {
+        if(raptor_serializer_set_namespace(pipeline->serializer,
+                                           event->ns_uri,
+                                           event->ns_prefix))
+          pipeline->failed = 1;
+      }
+
+      if(event->statements) {
+        int i;
+        int size = raptor_sequence_size(event->statements);
+        for(i = 0; i < size; i++) {
+          raptor_statement* s;
+          s = (raptor_statement*)raptor_sequence_get_at(event->statements, i);
+          if(raptor_serializer_serialize_statement(pipeline->serializer, s)) {
+            pipeline->failed = 1;
+            break;
+          }
+        }
+      }
+    }
+
+    raptor_free_convert_event(event);
+  }
+
+  return NULL;
+}
+
+#endif /* HAVE_PTHREAD_H */
+
+
+/*
+ * raptor_convert_direct:
+ * @user_data: serializer
+ * @statement: statement from the parser
+ *
+ * INTERNAL - Single-threaded statement handler for the fallback path.
+ */
+static void
+raptor_convert_direct(void* user_data, raptor_statement* statement)
+{
+  raptor_serializer_serialize_statement((raptor_serializer*)user_data,
+                                        statement);
+}
+
+
+/*
+ * raptor_convert_direct_namespace:
+ * @user_data: serializer
+ * @nspace: namespace declared by the parser
+ *
+ * INTERNAL - Single-threaded namespace handler for the fallback path.
+ */
+static void
+raptor_convert_direct_namespace(void* user_data, raptor_namespace* nspace)
+{
+  raptor_serializer_set_namespace_from_namespace((raptor_serializer*)user_data,
+                                                 nspace);
+}
+
+
+/**
+ * raptor_convert:
+ * @world: raptor world
+ * @parser: parser for the input syntax
+ * @serializer: serializer for the output syntax
+ * @iostr: iostream to parse from
+ * @base_uri: base URI for parsing and serializing (or NULL)
+ * @out_iostr: iostream to serialize to
+ *
+ * Convert between syntaxes by streaming @iostr through @parser into
+ * @serializer writing to @out_iostr.
+ *
+ * This replaces the usual wiring of a statement handler that calls
+ * raptor_serializer_serialize_statement() directly.  When @world was
+ * created thread-safe (RAPTOR_WORLD_FLAG_THREAD_SAFE) and raptor was
+ * built with pthreads, the serializer runs on its own thread fed
+ * through a bounded queue of statement batches so parsing and
+ * serializing overlap; otherwise the two stages run interleaved on
+ * the calling thread.  Either way the output is the same.
+ *
+ * The parser's statement and namespace handlers are replaced for the
+ * duration of the call.  The parser and serializer must not be in use
+ * when this is called; the serializer must not have been started.
+ *
+ * Return value: non-0 on failure
+ **/
+int
+raptor_convert(raptor_world* world,
+               raptor_parser* parser, raptor_serializer* serializer,
+               raptor_iostream* iostr, raptor_uri* base_uri,
+               raptor_iostream* out_iostr)
+{
+  int rc = 0;
+
+  RAPTOR_ASSERT_OBJECT_POINTER_RETURN_VALUE(world, raptor_world, 1);
+  RAPTOR_ASSERT_OBJECT_POINTER_RETURN_VALUE(parser, raptor_parser, 1);
+  RAPTOR_ASSERT_OBJECT_POINTER_RETURN_VALUE(serializer, raptor_serializer, 1);
+  RAPTOR_ASSERT_OBJECT_POINTER_RETURN_VALUE(iostr, raptor_iostream, 1);
+  RAPTOR_ASSERT_OBJECT_POINTER_RETURN_VALUE(out_iostr, raptor_iostream, 1);
+
+  raptor_world_open(world);
+
+  if(raptor_serializer_start_to_iostream(serializer, base_uri, out_iostr))
+    return 1;
+
+#ifdef HAVE_PTHREAD_H
+  if(world->thread_safe) {
+    raptor_convert_pipeline pipeline;
+
+    memset(&pipeline, '\0', sizeof(pipeline));
+    pipeline.world = world;
+    pipeline.parser = parser;
+    pipeline.serializer = serializer;
+    pthread_mutex_init(&pipeline.mutex, NULL);
+    pthread_cond_init(&pipeline.not_empty, NULL);
+    pthread_cond_init(&pipeline.not_full, NULL);
+
+    if(!pthread_create(&pipeline.thread, NULL,
+                       raptor_convert_pipeline_run, &pipeline)) {
+      raptor_parser_set_statement_handler(parser, &pipeline,
+                                          raptor_convert_statement_handler);
+      raptor_parser_set_namespace_handler(parser, &pipeline,
+                                          raptor_convert_namespace_handler);
+
+      rc = raptor_parser_parse_iostream(parser, iostr, base_uri);
+
+      if(!pipeline.failed)
+        raptor_convert_pipeline_flush_batch(&pipeline);
+
+      /* end of stream marker; always delivered so the thread exits */
+      raptor_convert_pipeline_push(&pipeline, NULL);
+      pthread_join(pipeline.thread, NULL);
+
+      if(pipeline.batch)
+        raptor_free_sequence(pipeline.batch);
+
+      if(pipeline.failed)
+        rc = 1;
+
+      pthread_mutex_destroy(&pipeline.mutex);
+      pthread_cond_destroy(&pipeline.not_empty);
+      pthread_cond_destroy(&pipeline.not_full);
+
+      if(!rc)
+        rc = raptor_serializer_serialize_end(serializer);
+
+      return rc;
+    }
+
+    pthread_mutex_destroy(&pipeline.mutex);
+    pthread_cond_destroy(&pipeline.not_empty);
+    pthread_cond_destroy(&pipeline.not_full);
+    /* thread creation failed - fall through to the direct wiring */
+  }
+#endif
+
+  raptor_parser_set_statement_handler(parser, serializer,
+                                      raptor_convert_direct);
+  raptor_parser_set_namespace_handler(parser, serializer,
+                                      raptor_convert_direct_namespace);
+
+  rc = raptor_parser_parse_iostream(parser, iostr, base_uri);
+
+  if(!rc)
+    rc = raptor_serializer_serialize_end(serializer);
+
+  return rc;
+}
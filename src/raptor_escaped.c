@@ -34,6 +34,51 @@
 #include "raptor_internal.h"
 
 
+/*
+ * raptor_escaped_write_fill_clean_table:
+ * @table: 256-entry table to fill
+ * @delim: terminating delimiter character or \0
+ * @flags: bit flags - see #raptor_escaped_write_bitflags
+ *
+ * INTERNAL - Mark the bytes @raptor_string_escaped_write() passes
+ * through verbatim for the given profile.
+ *
+ * A byte is clean exactly when the per-character loop below would
+ * reach its plain raptor_iostream_write_byte() case; runs of clean
+ * bytes can then be emitted with a single counted write.  Bytes at
+ * 0x7F and above are never marked clean so multi-byte sequences keep
+ * going through the validating UTF-8 decoder.
+ */
+void
+raptor_escaped_write_fill_clean_table(unsigned char *table,
+                                      const char delim,
+                                      unsigned int flags)
+{
+  int c;
+
+  memset(table, '\0', 256);
+
+  for(c = 1; c < 0x7f; c++) {
+    int clean;
+
+    if((delim && c == delim) || c == '\\')
+      clean = 0;
+    else if(flags & RAPTOR_ESCAPED_WRITE_BITFLAG_SPARQL_URI_ESCAPES)
+      clean = (c > 0x20 &&
+               c != '<' && c != '>' && c != '"' &&
+               c != '{' && c != '}' && c != '|' && c != '^' && c != '`');
+    else if(flags & RAPTOR_ESCAPED_WRITE_BITFLAG_BS_ESCAPES_TNRU)
+      clean = (c >= 0x20);
+    else if(flags & RAPTOR_ESCAPED_WRITE_BITFLAG_BS_ESCAPES_BF)
+      clean = (c != 0x08 && c != 0x0b);
+    else
+      clean = 1;
+
+    table[c] = RAPTOR_GOOD_CAST(unsigned char, clean);
+  }
+}
+
+
 /**
  * raptor_string_escaped_write:
  * @string: UTF-8 string to write
@@ -55,6 +100,42 @@ raptor_string_escaped_write(const unsigned char *string,
                             const char delim,
                             unsigned int flags,
                             raptor_iostream *iostr)
+{
+  unsigned char clean[256];
+
+  if(!string)
+    return 1;
+
+  raptor_escaped_write_fill_clean_table(clean, delim, flags);
+
+  return raptor_string_escaped_write_clean_table(string, len, delim, flags,
+                                                 clean, iostr);
+}
+
+
+/*
+ * raptor_string_escaped_write_clean_table:
+ * @string: UTF-8 string to write
+ * @len: length of UTF-8 string
+ * @delim: Terminating delimiter character for string (such as " or >) or \0 for no escaping.
+ * @flags: bit flags - see #raptor_escaped_write_bitflags
+ * @clean: 256-entry clean byte table filled by
+ * raptor_escaped_write_fill_clean_table() for the same @delim and @flags
+ * @iostr: #raptor_iostream to write to
+ *
+ * INTERNAL - raptor_string_escaped_write() with a caller-provided
+ * clean byte table, for writers that emit many strings with the same
+ * escaping profile and can fill the table once up front.
+ *
+ * Return value: non-0 on failure such as bad UTF-8 encoding.
+ */
+int
+raptor_string_escaped_write_clean_table(const unsigned char *string,
+                                        size_t len,
+                                        const char delim,
+                                        unsigned int flags,
+                                        const unsigned char *clean,
+                                        raptor_iostream *iostr)
 {
   unsigned char c;
   int unichar_len;
@@ -62,8 +143,22 @@ raptor_string_escaped_write(const unsigned char *string,
 
   if(!string)
     return 1;
-  
+
   for(; (c=*string); string++, len--) {
+    if(clean[c]) {
+      /* bulk-write the whole run of characters needing no escaping */
+      size_t span = 1;
+
+      while(span < len && clean[string[span]])
+        span++;
+      raptor_iostream_counted_string_write(string, span, iostr);
+
+      /* -1 since the loop above advances by one */
+      string += span - 1;
+      len -= span - 1;
+      continue;
+    }
+
     if((delim && c == delim && (delim == '\'' || delim == '"')) ||
        c == '\\') {
       raptor_iostream_write_byte('\\', iostr);
@@ -205,14 +300,66 @@ raptor_string_python_write(const unsigned char *string,
 
 
 
+/*
+ * raptor_literal_term_escaped_write:
+ * @term: literal term to write
+ * @flags: bit flags - see #raptor_escaped_write_bitflags
+ * @iostr: raptor iostream
+ *
+ * INTERNAL - write the escaped rendering of a literal term
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_literal_term_escaped_write(const raptor_term *term,
+                                  unsigned int flags,
+                                  raptor_iostream* iostr)
+{
+  const char* quotes="\"\"\"\"";
+
+  if(flags == RAPTOR_ESCAPED_WRITE_TURTLE_LONG_LITERAL)
+    raptor_iostream_counted_string_write(quotes, 3, iostr);
+  else
+    raptor_iostream_write_byte('"', iostr);
+  raptor_string_escaped_write(term->value.literal.string,
+                              term->value.literal.string_len,
+                              '"',
+                              flags,
+                              iostr);
+  if(flags == RAPTOR_ESCAPED_WRITE_TURTLE_LONG_LITERAL)
+    raptor_iostream_counted_string_write(quotes, 3, iostr);
+  else
+    raptor_iostream_write_byte('"', iostr);
+
+  if(term->value.literal.language) {
+    raptor_iostream_write_byte('@', iostr);
+    raptor_iostream_counted_string_write(term->value.literal.language,
+                                         term->value.literal.language_len,
+                                         iostr);
+  }
+  if(term->value.literal.datatype) {
+    if(flags == RAPTOR_ESCAPED_WRITE_NTRIPLES_LITERAL)
+      flags = RAPTOR_ESCAPED_WRITE_NTRIPLES_URI;
+    else if(flags == RAPTOR_ESCAPED_WRITE_TURTLE_LITERAL)
+      flags = RAPTOR_ESCAPED_WRITE_TURTLE_URI;
+
+    raptor_iostream_counted_string_write("^^", 2, iostr);
+    raptor_uri_escaped_write(term->value.literal.datatype, NULL,
+                             flags, iostr);
+  }
+
+  return 0;
+}
+
+
 /**
  * raptor_term_escaped_write:
  * @term: term to write
  * @flags: bit flags - see #raptor_escaped_write_bitflags
  * @iostr: raptor iostream
- * 
+ *
  * Write a #raptor_term formatted with escapes to a #raptor_iostream
- * 
+ *
  * Return value: non-0 on failure
  **/
 int
@@ -220,46 +367,67 @@ raptor_term_escaped_write(const raptor_term *term,
                           unsigned int flags,
                           raptor_iostream* iostr)
 {
-  const char* quotes="\"\"\"\"";
-
   if(!term)
     return 1;
 
   switch(term->type) {
     case RAPTOR_TERM_TYPE_LITERAL:
-      if(flags == RAPTOR_ESCAPED_WRITE_TURTLE_LONG_LITERAL) 
-        raptor_iostream_counted_string_write(quotes, 3, iostr);
-      else
-        raptor_iostream_write_byte('"', iostr);
-      raptor_string_escaped_write(term->value.literal.string,
-                                  term->value.literal.string_len,
-                                  '"',
-                                  flags,
-                                  iostr);
-      if(flags == RAPTOR_ESCAPED_WRITE_TURTLE_LONG_LITERAL) 
-        raptor_iostream_counted_string_write(quotes, 3, iostr);
-      else
-        raptor_iostream_write_byte('"', iostr);
-
-      if(term->value.literal.language) {
-        raptor_iostream_write_byte('@', iostr);
-        raptor_iostream_counted_string_write(term->value.literal.language,
-                                             term->value.literal.language_len,
-                                             iostr);
-      }
-      if(term->value.literal.datatype) {
-        if(flags == RAPTOR_ESCAPED_WRITE_NTRIPLES_LITERAL)
-          flags = RAPTOR_ESCAPED_WRITE_NTRIPLES_URI;
-        else if(flags == RAPTOR_ESCAPED_WRITE_TURTLE_LITERAL)
-          flags = RAPTOR_ESCAPED_WRITE_TURTLE_URI;
-
-        raptor_iostream_counted_string_write("^^", 2, iostr);
-        raptor_uri_escaped_write(term->value.literal.datatype, NULL,
-                                 flags, iostr);
+      /* Interned literal terms that get written more than once keep
+       * their escaped rendering on the term and replay it as a single
+       * write.  The first write goes direct and just marks the term
+       * (escaped_image_len doubles as the seen-once marker); the
+       * rendering is built on the second write, so terms that are
+       * serialized only once never pay for the allocation.  The image
+       * is built for the flags of the write that triggered it; other
+       * flags take the direct path.
+       */
+      if(term->usage > 0 && term->world && term->world->term_interning) {
+        if(term->escaped_image) {
+          if(term->escaped_image_flags == flags) {
+            raptor_iostream_write_bytes(term->escaped_image, 1,
+                                        term->escaped_image_len, iostr);
+            break;
+          }
+        } else if(term->escaped_image_len) {
+          raptor_term* t = (raptor_term*)term;
+          void* image = NULL;
+          size_t image_len = 0;
+          raptor_iostream* image_iostr;
+
+          image_iostr = raptor_new_iostream_to_string(term->world,
+                                                      &image, &image_len,
+                                                      NULL);
+          if(image_iostr) {
+            raptor_literal_term_escaped_write(term, flags, image_iostr);
+            raptor_free_iostream(image_iostr);
+          }
+
+          if(image) {
+            RAPTOR_WORLD_LOCK(t->world);
+            if(!t->escaped_image) {
+              t->escaped_image = (unsigned char*)image;
+              t->escaped_image_len = image_len;
+              t->escaped_image_flags = flags;
+              image = NULL;
+            }
+            RAPTOR_WORLD_UNLOCK(t->world);
+
+            if(image)
+              raptor_free_memory(image);
+          }
+
+          if(term->escaped_image && term->escaped_image_flags == flags) {
+            raptor_iostream_write_bytes(term->escaped_image, 1,
+                                        term->escaped_image_len, iostr);
+            break;
+          }
+        } else {
+          ((raptor_term*)term)->escaped_image_len = 1;
+        }
       }
 
-      break;
-      
+      return raptor_literal_term_escaped_write(term, flags, iostr);
+
     case RAPTOR_TERM_TYPE_BLANK:
       raptor_iostream_counted_string_write("_:", 2, iostr);
 
@@ -179,10 +179,28 @@ raptor_world_open(raptor_world* world)
 
   world->opened = 1;
 
+#ifdef HAVE_PTHREAD_H
+  if(world->thread_safe) {
+    pthread_mutexattr_t attr;
+
+    /* recursive: locked sections nest - see RAPTOR_WORLD_LOCK */
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    rc = pthread_mutex_init(&world->mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+    if(rc)
+      return rc;
+  }
+#endif
+
   rc = raptor_uri_init(world);
   if(rc)
     return rc;
 
+  rc = raptor_term_init(world);
+  if(rc)
+    return rc;
+
   rc = raptor_concepts_init(world);
   if(rc)
     return rc;
@@ -244,12 +262,240 @@ raptor_free_world(raptor_world* world)
 
   raptor_concepts_finish(world);
 
+  raptor_statement_finish(world);
+
+  raptor_term_finish(world);
+
   raptor_uri_finish(world);
 
+  if(world->nfc_cache)
+    RAPTOR_FREE(raptor_nfc_cache_slot*, world->nfc_cache);
+
+  {
+    int i;
+
+    for(i = 0; i < RAPTOR_WORLD_SCRATCH_BUFFERS; i++) {
+      if(world->scratch_buffers[i])
+        RAPTOR_FREE(char*, world->scratch_buffers[i]);
+    }
+  }
+
+#ifdef HAVE_PTHREAD_H
+  if(world->thread_safe && world->opened)
+    pthread_mutex_destroy(&world->mutex);
+#endif
+
   RAPTOR_FREE(raptor_world, world);
 }
 
 
+/* smallest scratch buffer handed out; avoids recycling tiny blocks
+ * that the next borrower cannot use */
+#define RAPTOR_WORLD_SCRATCH_MIN_SIZE 256
+
+/*
+ * raptor_world_borrow_scratch:
+ * @world: raptor world
+ * @size: minimum usable size in bytes
+ *
+ * INTERNAL - Borrow a transient buffer of at least @size bytes.
+ *
+ * Helpers that build a short-lived string per statement or subject
+ * borrow from this small pool instead of paying a malloc/free pair
+ * per call.  The buffer must be given back with
+ * raptor_world_return_scratch() (never raptor_free_memory()) and must
+ * not be held across a borrow by the same caller chain.
+ *
+ * Return value: buffer or NULL on failure
+ */
+unsigned char*
+raptor_world_borrow_scratch(raptor_world* world, size_t size)
+{
+  unsigned char* base = NULL;
+  int i;
+
+  RAPTOR_WORLD_LOCK(world);
+  for(i = 0; i < RAPTOR_WORLD_SCRATCH_BUFFERS; i++) {
+    if(world->scratch_buffers[i] &&
+       *(size_t*)world->scratch_buffers[i] >= size) {
+      base = world->scratch_buffers[i];
+      world->scratch_buffers[i] = NULL;
+      break;
+    }
+  }
+  RAPTOR_WORLD_UNLOCK(world);
+
+  if(!base) {
+    if(size < RAPTOR_WORLD_SCRATCH_MIN_SIZE)
+      size = RAPTOR_WORLD_SCRATCH_MIN_SIZE;
+
+    base = RAPTOR_MALLOC(unsigned char*, sizeof(size_t) + size);
+    if(!base)
+      return NULL;
+    *(size_t*)base = size;
+  }
+
+  return base + sizeof(size_t);
+}
+
+
+/*
+ * raptor_world_return_scratch:
+ * @world: raptor world
+ * @buffer: buffer from raptor_world_borrow_scratch() (or NULL)
+ *
+ * INTERNAL - Return a borrowed scratch buffer to the pool.
+ */
+void
+raptor_world_return_scratch(raptor_world* world, unsigned char* buffer)
+{
+  unsigned char* base;
+  int i;
+
+  if(!buffer)
+    return;
+
+  base = buffer - sizeof(size_t);
+
+  RAPTOR_WORLD_LOCK(world);
+  for(i = 0; i < RAPTOR_WORLD_SCRATCH_BUFFERS; i++) {
+    if(!world->scratch_buffers[i]) {
+      world->scratch_buffers[i] = base;
+      base = NULL;
+      break;
+    }
+  }
+  RAPTOR_WORLD_UNLOCK(world);
+
+  if(base)
+    RAPTOR_FREE(char*, base);
+}
+
+
+/* compare handler for syntax name index entries - order by name */
+static int
+raptor_syntax_name_index_entry_compare(const void* a, const void* b)
+{
+  return strcmp(((const raptor_syntax_name_index_entry*)a)->name,
+                ((const raptor_syntax_name_index_entry*)b)->name);
+}
+
+
+/* free handler for syntax name index entries - the name and factory
+ * are owned by the factory registry */
+static void
+raptor_free_syntax_name_index_entry(void* data)
+{
+  RAPTOR_FREE(raptor_syntax_name_index_entry*, data);
+}
+
+
+/*
+ * raptor_world_index_syntax_name:
+ * @tree_p: pointer to index tree, created on first use
+ * @name: syntax name (shared; must outlive the index)
+ * @factory: factory serving @name
+ *
+ * INTERNAL - Add a name to factory mapping to a registry name index.
+ *
+ * A name already indexed keeps its first factory, matching the
+ * first-registered-wins behavior of the linear registry scan.
+ *
+ * Return value: non-0 on failure
+ */
+int
+raptor_world_index_syntax_name(raptor_avltree** tree_p,
+                               const char* name, void* factory)
+{
+  raptor_syntax_name_index_entry* entry;
+
+  if(!*tree_p) {
+    *tree_p = raptor_new_avltree(raptor_syntax_name_index_entry_compare,
+                                 raptor_free_syntax_name_index_entry, 0);
+    if(!*tree_p)
+      return 1;
+  }
+
+  entry = RAPTOR_MALLOC(raptor_syntax_name_index_entry*, sizeof(*entry));
+  if(!entry)
+    return 1;
+
+  entry->name = name;
+  entry->factory = factory;
+
+  /* a duplicate (>0) is freed by the tree and is not an error */
+  return raptor_avltree_add(*tree_p, entry) < 0;
+}
+
+
+/*
+ * raptor_world_lookup_syntax_name:
+ * @tree: index tree (or NULL if never built)
+ * @name: syntax name
+ *
+ * INTERNAL - Look up a factory by syntax name in a registry name index.
+ *
+ * Return value: factory or NULL if not indexed
+ */
+void*
+raptor_world_lookup_syntax_name(raptor_avltree* tree, const char* name)
+{
+  raptor_syntax_name_index_entry key;
+  raptor_syntax_name_index_entry* entry;
+
+  if(!tree)
+    return NULL;
+
+  key.name = name;
+  entry = (raptor_syntax_name_index_entry*)raptor_avltree_search(tree, &key);
+
+  return entry ? entry->factory : NULL;
+}
+
+
+#ifndef RAPTOR_DISABLE_STATISTICS
+/* storage for the library-wide counters declared in raptor_internal.h */
+raptor_statistics raptor_statistics_counters;
+#endif
+
+
+/**
+ * raptor_world_get_statistics:
+ * @world: raptor_world object
+ * @statistics: statistics structure to fill in
+ *
+ * Get the library operation counters.
+ *
+ * Fills in @statistics with a snapshot of the counters described in
+ * #raptor_statistics.  The counters are cumulative for the whole
+ * process, not just @world, and are maintained with cheap
+ * unsynchronised increments so concurrent readers see approximate
+ * values.
+ *
+ * If the library was built with RAPTOR_DISABLE_STATISTICS defined the
+ * accounting is compiled out; @statistics is zeroed and non-0 is
+ * returned.
+ *
+ * Return value: non-0 on failure or if statistics are compiled out
+ */
+int
+raptor_world_get_statistics(raptor_world* world, raptor_statistics* statistics)
+{
+  RAPTOR_ASSERT_OBJECT_POINTER_RETURN_VALUE(world, raptor_world, 1);
+
+  if(!statistics)
+    return 1;
+
+#ifndef RAPTOR_DISABLE_STATISTICS
+  *statistics = raptor_statistics_counters;
+  return 0;
+#else
+  memset(statistics, '\0', sizeof(*statistics));
+  return 1;
+#endif
+}
+
+
 /**
  * raptor_world_set_generate_bnodeid_handler:
  * @world: #raptor_world world object
@@ -279,22 +525,16 @@ raptor_world_set_generate_bnodeid_handler(raptor_world* world,
 }
 
 
+/* format the ID prefix and an already-reserved counter value into a
+ * new buffer - no locking */
 static unsigned char*
-raptor_world_default_generate_bnodeid_handler(void *user_data,
-                                              unsigned char *user_bnodeid) 
+raptor_world_format_bnodeid(raptor_world* world, int id)
 {
-  raptor_world *world = (raptor_world*)user_data;
-  int id;
   unsigned char *buffer;
   const char* prefix;
   unsigned int prefix_length;
   size_t id_length;
 
-  if(user_bnodeid)
-    return user_bnodeid;
-
-  id = ++world->default_generate_bnodeid_handler_base;
-
   id_length = raptor_format_integer(NULL, 0, id, /* base */ 10, -1, '\0');
 
   if(world->default_generate_bnodeid_handler_prefix) {
@@ -317,6 +557,343 @@ raptor_world_default_generate_bnodeid_handler(void *user_data,
 }
 
 
+static unsigned char*
+raptor_world_default_generate_bnodeid_handler(void *user_data,
+                                              unsigned char *user_bnodeid)
+{
+  raptor_world *world = (raptor_world*)user_data;
+  int id;
+
+  if(user_bnodeid)
+    return user_bnodeid;
+
+  RAPTOR_WORLD_LOCK(world);
+  id = ++world->default_generate_bnodeid_handler_base;
+  RAPTOR_WORLD_UNLOCK(world);
+
+  return raptor_world_format_bnodeid(world, id);
+}
+
+
+/* blank node IDs reserved per parser in one go - one world lock per
+ * this many generated IDs */
+#define RAPTOR_BNODEID_RESERVE 64
+
+/*
+ * raptor_world_reserve_bnodeids:
+ * @world: raptor_world object
+ * @count: number of IDs to reserve
+ *
+ * INTERNAL - Reserve a contiguous range of blank node IDs.
+ *
+ * Advances the default ID counter by @count under one lock so a
+ * parser can hand out the range without touching shared state.
+ *
+ * Return value: first ID of the reserved range
+ */
+int
+raptor_world_reserve_bnodeids(raptor_world* world, int count)
+{
+  int first;
+
+  RAPTOR_WORLD_LOCK(world);
+  first = world->default_generate_bnodeid_handler_base + 1;
+  world->default_generate_bnodeid_handler_base += count;
+  RAPTOR_WORLD_UNLOCK(world);
+
+  return first;
+}
+
+
+/*
+ * raptor_parser_internal_generate_id:
+ * @rdf_parser: parser
+ * @user_bnodeid: user blank node ID string to use (or NULL)
+ *
+ * INTERNAL - Generate an ID for a parser, reserving IDs in bulk.
+ *
+ * Like raptor_world_internal_generate_id() but the default generator
+ * takes IDs from a per-parser range of RAPTOR_BNODEID_RESERVE IDs
+ * reserved in one locked operation, so concurrent parsers sharing a
+ * world do not contend on the counter for every blank node.
+ *
+ * Return value: newly allocated generated ID or NULL on failure
+ */
+unsigned char*
+raptor_parser_internal_generate_id(raptor_parser* rdf_parser,
+                                   unsigned char *user_bnodeid)
+{
+  raptor_world* world = rdf_parser->world;
+  int id;
+
+  /* custom generators and user-supplied IDs take the normal path */
+  if(user_bnodeid || world->generate_bnodeid_handler)
+    return raptor_world_internal_generate_id(world, user_bnodeid);
+
+  if(rdf_parser->bnodeid_next >= rdf_parser->bnodeid_end ||
+     rdf_parser->bnodeid_generation != world->default_generate_bnodeid_handler_generation) {
+    rdf_parser->bnodeid_next = raptor_world_reserve_bnodeids(world,
+                                                             RAPTOR_BNODEID_RESERVE);
+    rdf_parser->bnodeid_end = rdf_parser->bnodeid_next + RAPTOR_BNODEID_RESERVE;
+    rdf_parser->bnodeid_generation = world->default_generate_bnodeid_handler_generation;
+  }
+
+  id = rdf_parser->bnodeid_next++;
+
+  return raptor_world_format_bnodeid(world, id);
+}
+
+
+/*
+ * Blank node label map.
+ *
+ * Triple store dumps reference the same _:label many times; building
+ * a fresh term (two allocations and a string copy) per occurrence is
+ * wasted work.  This open addressing table maps each document label
+ * to one shared term and hands out counted references to it, so a
+ * repeat occurrence costs a hash probe and a reference increment.
+ * Labels at most RAPTOR_BNODE_MAP_INLINE_LEN bytes - nearly all of
+ * them in practice - are stored inline in the entry.
+ */
+
+/* labels up to this many bytes are stored inside the entry */
+#define RAPTOR_BNODE_MAP_INLINE_LEN 23
+
+/* initial capacity; a power of two, grown at 3/4 load */
+#define RAPTOR_BNODE_MAP_INITIAL_CAPACITY 64
+
+typedef struct {
+  /* owned term reference; NULL marks an empty slot */
+  raptor_term* term;
+  unsigned int hash;
+  unsigned int label_len;
+  union {
+    unsigned char inline_label[RAPTOR_BNODE_MAP_INLINE_LEN + 1];
+    unsigned char* heap_label;
+  } u;
+} raptor_bnode_map_entry;
+
+struct raptor_bnode_map_s {
+  raptor_bnode_map_entry* entries;
+  size_t capacity; /* power of two */
+  size_t size;
+};
+typedef struct raptor_bnode_map_s raptor_bnode_map;
+
+
+static const unsigned char*
+raptor_bnode_map_entry_label(raptor_bnode_map_entry* entry)
+{
+  if(entry->label_len <= RAPTOR_BNODE_MAP_INLINE_LEN)
+    return entry->u.inline_label;
+  return entry->u.heap_label;
+}
+
+
+static unsigned int
+raptor_bnode_map_hash(const unsigned char* label, size_t label_len)
+{
+  unsigned int hash = 5381;
+
+  while(label_len--)
+    hash = ((hash << 5) + hash) + *label++; /* hash * 33 + c */
+
+  return hash;
+}
+
+
+/* grow the table to @new_capacity, reinserting the live entries.
+ * Return value: non 0 on failure (the map is left usable)
+ */
+static int
+raptor_bnode_map_rehash(raptor_bnode_map* map, size_t new_capacity)
+{
+  raptor_bnode_map_entry* new_entries;
+  size_t i;
+
+  new_entries = RAPTOR_CALLOC(raptor_bnode_map_entry*, new_capacity,
+                              sizeof(*new_entries));
+  if(!new_entries)
+    return 1;
+
+  for(i = 0; i < map->capacity; i++) {
+    raptor_bnode_map_entry* entry = &map->entries[i];
+    size_t j;
+
+    if(!entry->term)
+      continue;
+
+    j = entry->hash & (new_capacity - 1);
+    while(new_entries[j].term)
+      j = (j + 1) & (new_capacity - 1);
+    new_entries[j] = *entry;
+  }
+
+  RAPTOR_FREE(raptor_bnode_map_entry*, map->entries);
+  map->entries = new_entries;
+  map->capacity = new_capacity;
+  return 0;
+}
+
+
+/**
+ * raptor_parser_get_blank_term:
+ * @rdf_parser: parser
+ * @label: document blank node label (need not be NUL terminated)
+ * @label_len: length of @label
+ *
+ * INTERNAL - Resolve a document blank node label to a term.
+ *
+ * The first occurrence of a label builds the term - running a custom
+ * generate ID handler exactly once for that label - and later
+ * occurrences return new references to the same term.  The map is
+ * emptied at parse start since labels are scoped to one document.
+ *
+ * Return value: new term reference or NULL on failure
+ */
+raptor_term*
+raptor_parser_get_blank_term(raptor_parser* rdf_parser,
+                             const unsigned char* label, size_t label_len)
+{
+  raptor_world* world = rdf_parser->world;
+  raptor_bnode_map* map = rdf_parser->bnode_map;
+  raptor_bnode_map_entry* entry;
+  raptor_term* term;
+  unsigned int hash;
+  size_t i;
+
+  if(!map) {
+    map = RAPTOR_CALLOC(raptor_bnode_map*, 1, sizeof(*map));
+    if(map) {
+      map->entries = RAPTOR_CALLOC(raptor_bnode_map_entry*,
+                                   RAPTOR_BNODE_MAP_INITIAL_CAPACITY,
+                                   sizeof(*map->entries));
+      if(!map->entries) {
+        RAPTOR_FREE(raptor_bnode_map*, map);
+        map = NULL;
+      } else
+        map->capacity = RAPTOR_BNODE_MAP_INITIAL_CAPACITY;
+    }
+    rdf_parser->bnode_map = map;
+  }
+
+  hash = raptor_bnode_map_hash(label, label_len);
+
+  if(map) {
+    i = hash & (map->capacity - 1);
+    while((entry = &map->entries[i])->term) {
+      if(entry->hash == hash && entry->label_len == label_len &&
+         !memcmp(raptor_bnode_map_entry_label(entry), label, label_len))
+        return raptor_term_copy(entry->term);
+      i = (i + 1) & (map->capacity - 1);
+    }
+  }
+
+  /* first occurrence: build the term */
+  if(world->generate_bnodeid_handler) {
+    unsigned char* label_copy;
+    unsigned char* id;
+
+    /* the handler takes ownership of its argument */
+    label_copy = RAPTOR_MALLOC(unsigned char*, label_len + 1);
+    if(!label_copy)
+      return NULL;
+    memcpy(label_copy, label, label_len);
+    label_copy[label_len] = '\0';
+
+    id = raptor_world_internal_generate_id(world, label_copy);
+    if(!id)
+      return NULL;
+    term = raptor_new_term_from_blank(world, id);
+    RAPTOR_FREE(char*, id);
+  } else
+    term = raptor_new_term_from_counted_blank(world, label, label_len);
+
+  if(!term || !map)
+    return term;
+
+  if(4 * (map->size + 1) > 3 * map->capacity) {
+    if(raptor_bnode_map_rehash(map, map->capacity << 1))
+      /* keep the term uncached rather than fail the parse */
+      return term;
+
+    i = hash & (map->capacity - 1);
+    while(map->entries[i].term)
+      i = (i + 1) & (map->capacity - 1);
+  }
+
+  entry = &map->entries[i];
+  if(label_len <= RAPTOR_BNODE_MAP_INLINE_LEN) {
+    memcpy(entry->u.inline_label, label, label_len);
+    entry->u.inline_label[label_len] = '\0';
+  } else {
+    entry->u.heap_label = RAPTOR_MALLOC(unsigned char*, label_len + 1);
+    if(!entry->u.heap_label)
+      return term;
+    memcpy(entry->u.heap_label, label, label_len);
+    entry->u.heap_label[label_len] = '\0';
+  }
+  entry->hash = hash;
+  entry->label_len = RAPTOR_BAD_CAST(unsigned int, label_len);
+  entry->term = raptor_term_copy(term);
+  map->size++;
+
+  return term;
+}
+
+
+/*
+ * raptor_parser_clear_bnode_map:
+ * @rdf_parser: parser
+ *
+ * INTERNAL - Empty the blank node label map, keeping its allocation.
+ */
+void
+raptor_parser_clear_bnode_map(raptor_parser* rdf_parser)
+{
+  raptor_bnode_map* map = rdf_parser->bnode_map;
+  size_t i;
+
+  if(!map)
+    return;
+
+  for(i = 0; i < map->capacity; i++) {
+    raptor_bnode_map_entry* entry = &map->entries[i];
+
+    if(!entry->term)
+      continue;
+
+    raptor_free_term(entry->term);
+    if(entry->label_len > RAPTOR_BNODE_MAP_INLINE_LEN)
+      RAPTOR_FREE(unsigned char*, entry->u.heap_label);
+  }
+
+  memset(map->entries, '\0', map->capacity * sizeof(*map->entries));
+  map->size = 0;
+}
+
+
+/*
+ * raptor_parser_free_bnode_map:
+ * @rdf_parser: parser
+ *
+ * INTERNAL - Destroy the blank node label map.
+ */
+void
+raptor_parser_free_bnode_map(raptor_parser* rdf_parser)
+{
+  raptor_bnode_map* map = rdf_parser->bnode_map;
+
+  if(!map)
+    return;
+
+  raptor_parser_clear_bnode_map(rdf_parser);
+  RAPTOR_FREE(raptor_bnode_map_entry*, map->entries);
+  RAPTOR_FREE(raptor_bnode_map*, map);
+  rdf_parser->bnode_map = NULL;
+}
+
+
 /**
  * raptor_world_generate_bnodeid:
  * @world: raptor_world object
@@ -391,6 +968,8 @@ raptor_world_set_generate_bnodeid_parameters(raptor_world* world,
   world->default_generate_bnodeid_handler_prefix = prefix_copy;
   world->default_generate_bnodeid_handler_prefix_length = length;
   world->default_generate_bnodeid_handler_base = base;
+  /* invalidate any ID ranges parsers reserved under the old base */
+  world->default_generate_bnodeid_handler_generation++;
 }
 
 
@@ -473,9 +1052,22 @@ raptor_world_set_flag(raptor_world *world, raptor_world_flag flag, int value)
       world->uri_interning = value;
       break;
 
+    case RAPTOR_WORLD_FLAG_TERM_INTERNING:
+      world->term_interning = value;
+      break;
+
     case RAPTOR_WORLD_FLAG_WWW_SKIP_INIT_FINISH:
       world->www_skip_www_init_finish = value;
       break;
+
+    case RAPTOR_WORLD_FLAG_THREAD_SAFE:
+#ifdef HAVE_PTHREAD_H
+      world->thread_safe = value;
+#else
+      if(value)
+        rc = -2;
+#endif
+      break;
   }
 
   return rc;
@@ -507,6 +1099,35 @@ raptor_world_set_log_handler(raptor_world *world, void *user_data,
 }
 
 
+/**
+ * raptor_world_set_minimum_log_level:
+ * @world: world object
+ * @level: minimum log message level to deliver
+ *
+ * Set the minimum level of log messages that are delivered.
+ *
+ * Messages below @level are dropped before their text is formatted,
+ * so a handler that would discard warnings anyway never pays the
+ * formatting cost.  The default #RAPTOR_LOG_LEVEL_NONE delivers
+ * everything; #RAPTOR_LOG_LEVEL_ERROR is typical for production runs
+ * over known-dirty inputs.
+ *
+ * Return value: non-0 on failure
+ **/
+int
+raptor_world_set_minimum_log_level(raptor_world *world, raptor_log_level level)
+{
+  RAPTOR_ASSERT_OBJECT_POINTER_RETURN_VALUE(world, raptor_world, -1);
+
+  if(level > RAPTOR_LOG_LEVEL_LAST)
+    return 1;
+
+  world->minimum_log_level = level;
+
+  return 0;
+}
+
+
 /**
  * raptor_basename:
  * @name: path
@@ -598,6 +1219,132 @@ raptor_world_internal_set_ignore_errors(raptor_world* world, int flag)
 }
 
 
+/* Runtime allocator hooks set by raptor_memory_set_allocator().
+ * NULL entries fall through to the C library allocator.
+ */
+static struct {
+  raptor_data_context_malloc_handler malloc_handler;
+  raptor_data_context_calloc_handler calloc_handler;
+  raptor_data_context_realloc_handler realloc_handler;
+  raptor_data_context_free_handler free_handler;
+  void* user_data;
+} raptor_memory_hooks = { NULL, NULL, NULL, NULL, NULL };
+
+
+/*
+ * raptor_memory_malloc:
+ * @size: size of memory to allocate
+ *
+ * INTERNAL - malloc() through the allocator hooks.
+ *
+ * Return value: the address of the allocated memory or NULL on failure
+ */
+void*
+raptor_memory_malloc(size_t size)
+{
+  if(raptor_memory_hooks.malloc_handler)
+    return raptor_memory_hooks.malloc_handler(raptor_memory_hooks.user_data,
+                                              size);
+  return malloc(size);
+}
+
+
+/*
+ * raptor_memory_calloc:
+ * @nmemb: number of members
+ * @size: size of member
+ *
+ * INTERNAL - calloc() through the allocator hooks.
+ *
+ * Return value: the address of the allocated memory or NULL on failure
+ */
+void*
+raptor_memory_calloc(size_t nmemb, size_t size)
+{
+  if(raptor_memory_hooks.calloc_handler)
+    return raptor_memory_hooks.calloc_handler(raptor_memory_hooks.user_data,
+                                              nmemb, size);
+  return calloc(nmemb, size);
+}
+
+
+/*
+ * raptor_memory_realloc:
+ * @ptr: memory to resize or NULL
+ * @size: new size
+ *
+ * INTERNAL - realloc() through the allocator hooks.
+ *
+ * Return value: the address of the resized memory or NULL on failure
+ */
+void*
+raptor_memory_realloc(void *ptr, size_t size)
+{
+  if(raptor_memory_hooks.realloc_handler)
+    return raptor_memory_hooks.realloc_handler(raptor_memory_hooks.user_data,
+                                               ptr, size);
+  return realloc(ptr, size);
+}
+
+
+/*
+ * raptor_memory_free:
+ * @ptr: memory pointer
+ *
+ * INTERNAL - free() through the allocator hooks.
+ */
+void
+raptor_memory_free(void *ptr)
+{
+  if(raptor_memory_hooks.free_handler) {
+    raptor_memory_hooks.free_handler(raptor_memory_hooks.user_data, ptr);
+    return;
+  }
+  free(ptr);
+}
+
+
+/**
+ * raptor_memory_set_allocator:
+ * @malloc_handler: malloc handler (or NULL for the C library one)
+ * @calloc_handler: calloc handler (or NULL for the C library one)
+ * @realloc_handler: realloc handler (or NULL for the C library one)
+ * @free_handler: free handler (or NULL for the C library one)
+ * @user_data: context pointer passed to every handler call
+ *
+ * Set the allocator used for all memory allocated inside raptor.
+ *
+ * Lets an application redirect raptor's internal allocation churn to
+ * its own allocator - for example a jemalloc arena or an accounting
+ * wrapper - instead of the C library one.  Memory must be freed by
+ * the allocator that made it, so call this before raptor_new_world()
+ * and do not change the allocator again while any raptor-allocated
+ * memory is live.  The hooks are process-wide, not per-world:
+ * raptor's internal allocation sites have no world handle.
+ *
+ * The handlers may be called from several threads at once when
+ * multi-threaded features like raptor_parser_parse_file_parallel()
+ * are in use and so must be thread-safe.
+ *
+ * Return value: non-0 on failure
+ **/
+int
+raptor_memory_set_allocator(raptor_data_context_malloc_handler malloc_handler,
+                            raptor_data_context_calloc_handler calloc_handler,
+                            raptor_data_context_realloc_handler realloc_handler,
+                            raptor_data_context_free_handler free_handler,
+                            void *user_data)
+{
+  raptor_memory_hooks.malloc_handler = malloc_handler;
+  raptor_memory_hooks.calloc_handler = calloc_handler;
+  raptor_memory_hooks.realloc_handler = realloc_handler;
+  raptor_memory_hooks.free_handler = free_handler;
+  raptor_memory_hooks.user_data = user_data;
+
+  return 0;
+}
+
+
 /**
  * raptor_free_memory:
  * @ptr: memory pointer
@@ -685,7 +1432,7 @@ raptor_sign_malloc(size_t size)
   
   size += sizeof(int);
   
-  p = (int*)malloc(size);
+  p = (int*)raptor_memory_malloc(size);
   *p++ = RAPTOR_SIGN_KEY;
   return p;
 }
@@ -698,7 +1445,7 @@ raptor_sign_calloc(size_t nmemb, size_t size)
   /* turn into bytes */
   size = nmemb*size + sizeof(int);
   
-  p = (int*)calloc(1, size);
+  p = (int*)raptor_memory_calloc(1, size);
   *p++ = RAPTOR_SIGN_KEY;
   return p;
 }
@@ -719,7 +1466,7 @@ raptor_sign_realloc(void *ptr, size_t size)
 
   size += sizeof(int);
   
-  p = (int*)realloc(p, size);
+  p = (int*)raptor_memory_realloc(p, size);
   *p++= RAPTOR_SIGN_KEY;
   return p;
 }
@@ -738,7 +1485,7 @@ raptor_sign_free(void *ptr)
   if(*p != RAPTOR_SIGN_KEY)
     RAPTOR_FATAL3("memory signature %08X != %08X", *p, RAPTOR_SIGN_KEY);
 
-  free(p);
+  raptor_memory_free(p);
 }
 #endif
 
@@ -91,7 +91,51 @@ typedef struct
   /* base URI in effect when the above was found */
   raptor_uri* base_uri;
 } grddl_xml_context;
-  
+
+
+/* A document body retrieved ahead of time by a concurrent fetch
+ * group, waiting to be consumed by raptor_grddl_run_recursive()
+ */
+typedef struct
+{
+  /* URI the fetch was made for - the lookup key */
+  raptor_uri* uri;
+  /* URI after any redirects, if different */
+  raptor_uri* final_uri;
+  /* Content-Type header value, if any */
+  char* content_type;
+  /* document bytes */
+  char* buffer;
+  size_t buffer_len;
+  /* non-0 if the retrieval failed */
+  int failed;
+} raptor_grddl_prefetched_doc;
+
+
+/* World-level cache of GRDDL XSLT stylesheets.  A handful of
+ * well-known transforms cover nearly all documents, so keep both the
+ * raw fetched bytes and the compiled stylesheet keyed by URI; on a
+ * hit, the per-document cost is just applying the transform.
+ */
+typedef struct
+{
+  /* stylesheet URI - the cache key */
+  raptor_uri* uri;
+  /* raw stylesheet bytes as fetched */
+  char* buffer;
+  size_t buffer_len;
+  /* compiled stylesheet, owned by this entry */
+  xsltStylesheetPtr sheet;
+  /* when the entry was stored, for TTL expiry */
+  time_t stored;
+} raptor_grddl_stylesheet_cache_entry;
+
+/* seconds a cached stylesheet remains valid */
+#define RAPTOR_GRDDL_CACHE_TTL 3600
+
+/* maximum number of cached stylesheets; the oldest is evicted */
+#define RAPTOR_GRDDL_CACHE_SIZE 16
+
 
 /*
  * XSLT parser object
@@ -134,6 +178,10 @@ struct raptor_grddl_parser_context_s {
   /* List of namespace / <head profile> URIs */
   raptor_sequence* profile_uris;
 
+  /* Documents fetched concurrently ahead of the recursive GRDDL
+   * walk, keyed by URI; NULL until a prefetch happens */
+  raptor_sequence* prefetched_docs;
+
   /* List of visited URIs */
   raptor_sequence* visited_uris;
 
@@ -247,6 +295,49 @@ grddl_free_xml_context(void *context, void* userdata)
 }
 
 
+static void
+raptor_grddl_free_prefetched_doc(void* data)
+{
+  raptor_grddl_prefetched_doc* doc = (raptor_grddl_prefetched_doc*)data;
+
+  if(!doc)
+    return;
+
+  if(doc->uri)
+    raptor_free_uri(doc->uri);
+  if(doc->final_uri)
+    raptor_free_uri(doc->final_uri);
+  if(doc->content_type)
+    RAPTOR_FREE(char*, doc->content_type);
+  if(doc->buffer)
+    RAPTOR_FREE(char*, doc->buffer);
+  RAPTOR_FREE(raptor_grddl_prefetched_doc, doc);
+}
+
+
+/* Remove and return the prefetched document for @uri, if any */
+static raptor_grddl_prefetched_doc*
+raptor_grddl_take_prefetched_doc(raptor_grddl_parser_context* grddl_parser,
+                                 raptor_uri* uri)
+{
+  int i;
+  int size;
+
+  if(!grddl_parser->prefetched_docs)
+    return NULL;
+
+  size = raptor_sequence_size(grddl_parser->prefetched_docs);
+  for(i = 0; i < size; i++) {
+    raptor_grddl_prefetched_doc* doc;
+    doc = (raptor_grddl_prefetched_doc*)raptor_sequence_get_at(grddl_parser->prefetched_docs, i);
+    if(doc && doc->uri && raptor_uri_equals(doc->uri, uri))
+      return (raptor_grddl_prefetched_doc*)raptor_sequence_delete_at(grddl_parser->prefetched_docs, i);
+  }
+
+  return NULL;
+}
+
+
 static int
 raptor_grddl_parse_init_common(raptor_parser* rdf_parser, const char *name)
 {
@@ -341,6 +432,9 @@ raptor_grddl_parse_terminate(raptor_parser *rdf_parser)
   if(grddl_parser->profile_uris)
     raptor_free_sequence(grddl_parser->profile_uris);
 
+  if(grddl_parser->prefetched_docs)
+    raptor_free_sequence(grddl_parser->prefetched_docs);
+
   if(grddl_parser->namespace_transformation_uri)
     raptor_free_uri(grddl_parser->namespace_transformation_uri);
 
@@ -658,19 +752,130 @@ raptor_grddl_ensure_internal_parser(raptor_parser* rdf_parser,
 }
 
 
-/* Run a GRDDL transform using a pre-parsed XSLT stylesheet already
- * formed into a libxml document (with URI)
+static void
+raptor_free_grddl_stylesheet_cache_entry(raptor_grddl_stylesheet_cache_entry* entry)
+{
+  if(entry->sheet)
+    xsltFreeStylesheet(entry->sheet);
+  if(entry->buffer)
+    RAPTOR_FREE(char*, entry->buffer);
+  if(entry->uri)
+    raptor_free_uri(entry->uri);
+  RAPTOR_FREE(raptor_grddl_stylesheet_cache_entry*, entry);
+}
+
+
+/* Look up a fresh cached stylesheet by URI; returns NULL on a miss or
+ * when the entry has passed its TTL
+ */
+static raptor_grddl_stylesheet_cache_entry*
+raptor_grddl_cache_lookup(raptor_world* world, raptor_uri* uri)
+{
+  int i;
+  int size;
+
+  if(!world->grddl_xslt_cache)
+    return NULL;
+
+  size = raptor_sequence_size(world->grddl_xslt_cache);
+  for(i = 0; i < size; i++) {
+    raptor_grddl_stylesheet_cache_entry* entry;
+
+    entry = (raptor_grddl_stylesheet_cache_entry*)raptor_sequence_get_at(world->grddl_xslt_cache, i);
+    if(!raptor_uri_equals(entry->uri, uri))
+      continue;
+
+    if((time(NULL) - entry->stored) >= RAPTOR_GRDDL_CACHE_TTL) {
+      RAPTOR_DEBUG2("Cached XSLT stylesheet for URI '%s' has expired\n",
+                    raptor_uri_as_string(uri));
+      return NULL;
+    }
+
+    return entry;
+  }
+
+  return NULL;
+}
+
+
+/* Store a stylesheet in the world cache, taking ownership of @buffer
+ * and @sheet whether or not the store succeeds.  An existing entry
+ * for the URI (such as one that expired) is replaced in place; when
+ * the cache is full the oldest entry is evicted.
+ */
+static void
+raptor_grddl_cache_store(raptor_world* world, raptor_uri* uri,
+                         char* buffer, size_t buffer_len,
+                         xsltStylesheetPtr sheet)
+{
+  raptor_grddl_stylesheet_cache_entry* entry;
+  int i;
+  int size;
+
+  if(!world->grddl_xslt_cache)
+    goto failed;
+
+  size = raptor_sequence_size(world->grddl_xslt_cache);
+  for(i = 0; i < size; i++) {
+    entry = (raptor_grddl_stylesheet_cache_entry*)raptor_sequence_get_at(world->grddl_xslt_cache, i);
+    if(raptor_uri_equals(entry->uri, uri)) {
+      if(entry->sheet)
+        xsltFreeStylesheet(entry->sheet);
+      if(entry->buffer)
+        RAPTOR_FREE(char*, entry->buffer);
+      entry->buffer = buffer;
+      entry->buffer_len = buffer_len;
+      entry->sheet = sheet;
+      entry->stored = time(NULL);
+      return;
+    }
+  }
+
+  if(size >= RAPTOR_GRDDL_CACHE_SIZE) {
+    /* entries are pushed in fetch order so the oldest is first */
+    entry = (raptor_grddl_stylesheet_cache_entry*)raptor_sequence_unshift(world->grddl_xslt_cache);
+    if(entry)
+      raptor_free_grddl_stylesheet_cache_entry(entry);
+  }
+
+  entry = RAPTOR_CALLOC(raptor_grddl_stylesheet_cache_entry*, 1,
+                        sizeof(*entry));
+  if(!entry)
+    goto failed;
+
+  entry->uri = raptor_uri_copy(uri);
+  entry->buffer = buffer;
+  entry->buffer_len = buffer_len;
+  entry->sheet = sheet;
+  entry->stored = time(NULL);
+
+  if(raptor_sequence_push(world->grddl_xslt_cache, entry))
+    /* push frees the entry and all it owns on failure */
+    return;
+
+  return;
+
+  failed:
+  if(sheet)
+    xsltFreeStylesheet(sheet);
+  if(buffer)
+    RAPTOR_FREE(char*, buffer);
+}
+
+
+/* Run a GRDDL transform using an already-compiled XSLT stylesheet.
+ * The stylesheet is not freed and the libxslt global state must
+ * already be set by the caller.
  */
 static int
-raptor_grddl_run_grddl_transform_doc(raptor_parser* rdf_parser,
-                                     grddl_xml_context* xml_context,
-                                     xmlDocPtr xslt_doc,
-                                     xmlDocPtr doc)
+raptor_grddl_run_grddl_transform_sheet(raptor_parser* rdf_parser,
+                                       grddl_xml_context* xml_context,
+                                       xsltStylesheetPtr sheet,
+                                       xmlDocPtr doc)
 {
   raptor_world* world = rdf_parser->world;
   raptor_grddl_parser_context* grddl_parser;
   int ret = 0;
-  xsltStylesheetPtr sheet = NULL;
   xmlDocPtr res = NULL;
   xmlChar *doc_txt = NULL;
   int doc_txt_len = 0;
@@ -693,17 +898,6 @@ raptor_grddl_run_grddl_transform_doc(raptor_parser* rdf_parser,
   RAPTOR_DEBUG3("Running GRDDL transform with XSLT URI '%s' with doc base URI '%s'\n",
                 raptor_uri_as_string(xslt_uri),
                 base_uri_string);
-  
-  raptor_libxslt_set_global_state(rdf_parser);
-
-  /* This calls xsltGetDefaultSecurityPrefs() */
-  sheet = xsltParseStylesheetDoc(xslt_doc);
-  if(!sheet) {
-    raptor_parser_error(rdf_parser, "Failed to parse stylesheet in '%s'",
-                        raptor_uri_as_string(xslt_uri));
-    ret = 1;
-    goto cleanup_xslt;
-  }
 
   /* This calls xsltGetDefaultSecurityPrefs() */
   userCtxt = xsltNewTransformContext(sheet, doc);
@@ -839,23 +1033,55 @@ raptor_grddl_run_grddl_transform_doc(raptor_parser* rdf_parser,
   
   if(res)
     xmlFreeDoc(res);
-  
-  if(sheet)
+
+  return ret;
+}
+
+
+/* Run a GRDDL transform using a pre-parsed XSLT stylesheet already
+ * formed into a libxml document (with URI)
+ */
+static int
+raptor_grddl_run_grddl_transform_doc(raptor_parser* rdf_parser,
+                                     grddl_xml_context* xml_context,
+                                     xmlDocPtr xslt_doc,
+                                     xmlDocPtr doc)
+{
+  int ret = 0;
+  xsltStylesheetPtr sheet = NULL;
+
+  raptor_libxslt_set_global_state(rdf_parser);
+
+  /* This calls xsltGetDefaultSecurityPrefs() */
+  sheet = xsltParseStylesheetDoc(xslt_doc);
+  if(!sheet) {
+    raptor_parser_error(rdf_parser, "Failed to parse stylesheet in '%s'",
+                        raptor_uri_as_string(xml_context->uri));
+    ret = 1;
+  } else {
+    ret = raptor_grddl_run_grddl_transform_sheet(rdf_parser, xml_context,
+                                                 sheet, doc);
     xsltFreeStylesheet(sheet);
-  
+  }
+
   raptor_libxslt_reset_global_state(rdf_parser);
 
   return ret;
 }
 
 
-typedef struct 
+typedef struct
 {
   raptor_parser* rdf_parser;
   xmlParserCtxtPtr xc;
   raptor_uri* base_uri;
+  /* when non-0, accumulate the raw fetched bytes here for the
+   * stylesheet cache; reset to 0 if a buffer allocation fails */
+  int save_bytes;
+  char* buffer;
+  size_t buffer_len;
 } raptor_grddl_xml_parse_bytes_context;
-  
+
 
 static void
 raptor_grddl_uri_xml_parse_bytes(raptor_www* www,
@@ -868,6 +1094,24 @@ raptor_grddl_uri_xml_parse_bytes(raptor_www* www,
   
   xpbc = (raptor_grddl_xml_parse_bytes_context*)userdata;
 
+  if(xpbc->save_bytes) {
+    char* new_buffer;
+
+    new_buffer = RAPTOR_REALLOC(char*, xpbc->buffer, xpbc->buffer_len + len);
+    if(new_buffer) {
+      memcpy(new_buffer + xpbc->buffer_len, ptr, len);
+      xpbc->buffer = new_buffer;
+      xpbc->buffer_len += len;
+    } else {
+      /* out of memory - give up saving bytes but continue parsing */
+      if(xpbc->buffer)
+        RAPTOR_FREE(char*, xpbc->buffer);
+      xpbc->buffer = NULL;
+      xpbc->buffer_len = 0;
+      xpbc->save_bytes = 0;
+    }
+  }
+
   if(!xpbc->xc) {
     xmlParserCtxtPtr xc;
     
@@ -902,31 +1146,24 @@ raptor_grddl_uri_xml_parse_bytes(raptor_www* www,
 #define FETCH_IGNORE_ERRORS 1
 #define FETCH_ACCEPT_XSLT   2
 
-static int
-raptor_grddl_fetch_uri(raptor_parser* rdf_parser, 
-                       raptor_uri* uri,
-                       raptor_www_write_bytes_handler write_bytes_handler,
-                       void* write_bytes_user_data,
-                       raptor_www_content_type_handler content_type_handler,
-                       void* content_type_user_data,
-                       int flags)
+/* Make a raptor_www configured the way raptor_grddl_fetch_uri() uses one */
+static raptor_www*
+raptor_grddl_new_fetch_www(raptor_parser* rdf_parser,
+                           raptor_www_write_bytes_handler write_bytes_handler,
+                           void* write_bytes_user_data,
+                           raptor_www_content_type_handler content_type_handler,
+                           void* content_type_user_data,
+                           int flags)
 {
   raptor_www *www;
   const char *accept_h;
-  int ret = 0;
-  int ignore_errors = (flags & FETCH_IGNORE_ERRORS);
-  
-  if(RAPTOR_OPTIONS_GET_NUMERIC(rdf_parser, RAPTOR_OPTION_NO_NET)) {
-    if(!raptor_uri_uri_string_is_file_uri(raptor_uri_as_string(uri)))
-      return 1;
-  }
-  
+
   www = raptor_new_www(rdf_parser->world);
   if(!www)
-    return 1;
-  
+    return NULL;
+
   raptor_www_set_user_agent(www, "grddl/0.1");
-  
+
   if(flags & FETCH_ACCEPT_XSLT) {
     raptor_www_set_http_accept(www, "application/xml");
   } else {
@@ -939,8 +1176,6 @@ raptor_grddl_fetch_uri(raptor_parser* rdf_parser,
   if(rdf_parser->uri_filter)
     raptor_www_set_uri_filter(www, rdf_parser->uri_filter,
                               rdf_parser->uri_filter_user_data);
-  if(ignore_errors)
-    raptor_world_internal_set_ignore_errors(rdf_parser->world, 1);
 
   raptor_www_set_write_bytes_handler(www, write_bytes_handler,
                                      write_bytes_user_data);
@@ -948,11 +1183,53 @@ raptor_grddl_fetch_uri(raptor_parser* rdf_parser,
                                       content_type_user_data);
 
   if(RAPTOR_OPTIONS_GET_NUMERIC(rdf_parser, RAPTOR_OPTION_WWW_TIMEOUT) > 0)
-    raptor_www_set_connection_timeout(www, 
+    raptor_www_set_connection_timeout(www,
                                       RAPTOR_OPTIONS_GET_NUMERIC(rdf_parser, RAPTOR_OPTION_WWW_TIMEOUT));
 
+  return www;
+}
+
+
+/* Return non-0 if @uri may not be retrieved under the parser options */
+static int
+raptor_grddl_fetch_uri_forbidden(raptor_parser* rdf_parser, raptor_uri* uri)
+{
+  if(RAPTOR_OPTIONS_GET_NUMERIC(rdf_parser, RAPTOR_OPTION_NO_NET)) {
+    if(!raptor_uri_uri_string_is_file_uri(raptor_uri_as_string(uri)))
+      return 1;
+  }
+  return 0;
+}
+
+
+static int
+raptor_grddl_fetch_uri(raptor_parser* rdf_parser,
+                       raptor_uri* uri,
+                       raptor_www_write_bytes_handler write_bytes_handler,
+                       void* write_bytes_user_data,
+                       raptor_www_content_type_handler content_type_handler,
+                       void* content_type_user_data,
+                       int flags)
+{
+  raptor_www *www;
+  int ret = 0;
+  int ignore_errors = (flags & FETCH_IGNORE_ERRORS);
+
+  if(raptor_grddl_fetch_uri_forbidden(rdf_parser, uri))
+    return 1;
+
+  www = raptor_grddl_new_fetch_www(rdf_parser,
+                                   write_bytes_handler, write_bytes_user_data,
+                                   content_type_handler, content_type_user_data,
+                                   flags);
+  if(!www)
+    return 1;
+
+  if(ignore_errors)
+    raptor_world_internal_set_ignore_errors(rdf_parser->world, 1);
+
   ret = raptor_www_fetch(www, uri);
-  
+
   raptor_free_www(www);
 
   if(ignore_errors)
@@ -975,6 +1252,7 @@ raptor_grddl_run_grddl_transform_uri(raptor_parser* rdf_parser,
   raptor_uri* base_uri;
   raptor_uri* old_locator_uri;
   raptor_locator *locator = &rdf_parser->locator;
+  raptor_grddl_stylesheet_cache_entry* entry;
 
   xslt_uri = xml_context->uri;
   base_uri = xml_context->base_uri ? xml_context->base_uri : xml_context->uri;
@@ -982,13 +1260,36 @@ raptor_grddl_run_grddl_transform_uri(raptor_parser* rdf_parser,
   RAPTOR_DEBUG3("Running GRDDL transform with XSLT URI %s and base URI %s\n",
                 raptor_uri_as_string(xslt_uri),
                 raptor_uri_as_string(base_uri));
-  
-  /* make an xsltStylesheetPtr via the raptor_grddl_uri_xml_parse_bytes 
+
+  /* Check the world's stylesheet cache: on a hit only the transform
+   * itself needs to run - no fetch, no compile
+   */
+  entry = raptor_grddl_cache_lookup(rdf_parser->world, xslt_uri);
+  if(entry && entry->sheet) {
+    RAPTOR_DEBUG2("Applying cached XSLT stylesheet URI '%s'\n",
+                  raptor_uri_as_string(xslt_uri));
+
+    old_locator_uri = locator->uri;
+    locator->uri = xslt_uri;
+
+    raptor_libxslt_set_global_state(rdf_parser);
+    ret = raptor_grddl_run_grddl_transform_sheet(rdf_parser, xml_context,
+                                                 entry->sheet, doc);
+    raptor_libxslt_reset_global_state(rdf_parser);
+
+    locator->uri = old_locator_uri;
+    return ret;
+  }
+
+  /* make an xsltStylesheetPtr via the raptor_grddl_uri_xml_parse_bytes
    * callback as bytes are returned
    */
   xpbc.xc = NULL;
   xpbc.rdf_parser = rdf_parser;
   xpbc.base_uri = base_uri;
+  xpbc.save_bytes = 1;
+  xpbc.buffer = NULL;
+  xpbc.buffer_len = 0;
 
   old_locator_uri = locator->uri;
   locator->uri = xslt_uri;
@@ -1004,18 +1305,40 @@ raptor_grddl_run_grddl_transform_uri(raptor_parser* rdf_parser,
                           raptor_uri_as_string(xslt_uri));
     ret = 0;
   } else {
+    xsltStylesheetPtr sheet;
+
     xmlParseChunk(xpbc.xc, NULL, 0, 1);
-  
-    ret = raptor_grddl_run_grddl_transform_doc(rdf_parser,
-                                               xml_context,
-                                               xslt_ctxt->myDoc,
-                                               doc);
+
+    raptor_libxslt_set_global_state(rdf_parser);
+
+    /* This calls xsltGetDefaultSecurityPrefs() */
+    sheet = xsltParseStylesheetDoc(xslt_ctxt->myDoc);
+    if(!sheet) {
+      raptor_parser_error(rdf_parser, "Failed to parse stylesheet in '%s'",
+                          raptor_uri_as_string(xslt_uri));
+      ret = 1;
+    } else {
+      ret = raptor_grddl_run_grddl_transform_sheet(rdf_parser, xml_context,
+                                                   sheet, doc);
+
+      /* hand the fetched bytes and the compiled sheet to the world
+       * cache instead of freeing them */
+      raptor_grddl_cache_store(rdf_parser->world, xslt_uri,
+                               xpbc.buffer, xpbc.buffer_len, sheet);
+      xpbc.buffer = NULL;
+    }
+
+    raptor_libxslt_reset_global_state(rdf_parser);
+
     locator->uri = old_locator_uri;
   }
 
+  if(xpbc.buffer)
+    RAPTOR_FREE(char*, xpbc.buffer);
+
   if(xslt_ctxt)
-    xmlFreeParserCtxt(xslt_ctxt); 
-  
+    xmlFreeParserCtxt(xslt_ctxt);
+
   return ret;
 }
 
@@ -1047,6 +1370,290 @@ raptor_grddl_seen_uri(raptor_grddl_parser_context* grddl_parser,
 }
 
 
+static void
+raptor_grddl_prefetch_write_bytes(raptor_www* www, void* userdata,
+                                  const void *ptr, size_t size, size_t nmemb)
+{
+  raptor_grddl_prefetched_doc* doc = (raptor_grddl_prefetched_doc*)userdata;
+  size_t len = size * nmemb;
+  char* new_buffer;
+
+  new_buffer = RAPTOR_REALLOC(char*, doc->buffer, doc->buffer_len + len);
+  if(!new_buffer) {
+    doc->failed = 1;
+    return;
+  }
+
+  memcpy(new_buffer + doc->buffer_len, ptr, len);
+  doc->buffer = new_buffer;
+  doc->buffer_len += len;
+}
+
+
+static void
+raptor_grddl_prefetch_content_type_handler(raptor_www* www, void* userdata,
+                                           const char* content_type)
+{
+  raptor_grddl_prefetched_doc* doc = (raptor_grddl_prefetched_doc*)userdata;
+  size_t len;
+
+  if(!content_type)
+    return;
+
+  len = strlen(content_type);
+  if(doc->content_type)
+    RAPTOR_FREE(char*, doc->content_type);
+  doc->content_type = RAPTOR_MALLOC(char*, len + 1);
+  if(doc->content_type)
+    memcpy(doc->content_type, content_type, len + 1);
+}
+
+
+/* Retrieve all outstanding <head profile> URIs through one concurrent
+ * fetch group so that the recursive GRDDL walk consumes local buffers
+ * instead of making one round trip per profile
+ */
+static void
+raptor_grddl_prefetch_profile_uris(raptor_parser* rdf_parser)
+{
+  raptor_grddl_parser_context* grddl_parser;
+  raptor_www_group* group = NULL;
+  raptor_www** wwws = NULL;
+  raptor_grddl_prefetched_doc** docs = NULL;
+  int size;
+  int i;
+  int queued = 0;
+
+  grddl_parser = (raptor_grddl_parser_context*)rdf_parser->context;
+
+  /* entry 0 is never processed by the walk; below two remaining URIs
+   * there is nothing to overlap */
+  size = raptor_sequence_size(grddl_parser->profile_uris);
+  if(size < 3)
+    return;
+
+  wwws = RAPTOR_CALLOC(raptor_www**, size, sizeof(raptor_www*));
+  docs = RAPTOR_CALLOC(raptor_grddl_prefetched_doc**, size, sizeof(*docs));
+  if(!wwws || !docs)
+    goto tidy;
+
+  if(!grddl_parser->prefetched_docs) {
+    grddl_parser->prefetched_docs = raptor_new_sequence(raptor_grddl_free_prefetched_doc, NULL);
+    if(!grddl_parser->prefetched_docs)
+      goto tidy;
+  }
+
+  group = raptor_new_www_group(rdf_parser->world);
+  if(!group)
+    goto tidy;
+
+  for(i = 1; i < size; i++) {
+    grddl_xml_context* xml_context;
+    raptor_uri* uri;
+    raptor_grddl_prefetched_doc* doc;
+    int j;
+
+    xml_context = (grddl_xml_context*)raptor_sequence_get_at(grddl_parser->profile_uris, i);
+    uri = xml_context->uri;
+    if(!uri)
+      continue;
+
+    if(raptor_grddl_seen_uri(grddl_parser, uri))
+      continue;
+
+    if(raptor_grddl_fetch_uri_forbidden(rdf_parser, uri))
+      continue;
+
+    /* skip duplicates within this batch */
+    for(j = 1; j < i; j++) {
+      grddl_xml_context* xml_context2;
+      xml_context2 = (grddl_xml_context*)raptor_sequence_get_at(grddl_parser->profile_uris, j);
+      if(xml_context2->uri && raptor_uri_equals(xml_context2->uri, uri))
+        break;
+    }
+    if(j < i)
+      continue;
+
+    doc = RAPTOR_CALLOC(raptor_grddl_prefetched_doc*, 1, sizeof(*doc));
+    if(!doc)
+      continue;
+    doc->uri = raptor_uri_copy(uri);
+
+    wwws[i] = raptor_grddl_new_fetch_www(rdf_parser,
+                                         raptor_grddl_prefetch_write_bytes,
+                                         doc,
+                                         raptor_grddl_prefetch_content_type_handler,
+                                         doc,
+                                         0);
+    if(!wwws[i] || raptor_www_group_add(group, wwws[i], uri)) {
+      raptor_grddl_free_prefetched_doc(doc);
+      continue;
+    }
+    docs[i] = doc;
+    queued++;
+  }
+
+  if(queued > 1) {
+    RAPTOR_DEBUG2("Prefetching %d profile URIs concurrently\n", queued);
+
+    /* failures are reported (or ignored) by the walk below when it
+     * finds the prefetched document marked failed */
+    raptor_world_internal_set_ignore_errors(rdf_parser->world, 1);
+    raptor_www_group_fetch(group);
+    raptor_world_internal_set_ignore_errors(rdf_parser->world, 0);
+
+    for(i = 1; i < size; i++) {
+      if(!docs[i])
+        continue;
+      if(wwws[i]->failed)
+        docs[i]->failed = 1;
+      else
+        docs[i]->final_uri = raptor_www_get_final_uri(wwws[i]);
+      if(!raptor_sequence_push(grddl_parser->prefetched_docs, docs[i]))
+        docs[i] = NULL;
+    }
+  }
+
+ tidy:
+  for(i = 0; i < size; i++) {
+    if(wwws && wwws[i])
+      raptor_free_www(wwws[i]);
+    if(docs && docs[i])
+      raptor_grddl_free_prefetched_doc(docs[i]);
+  }
+  if(group)
+    raptor_free_www_group(group);
+  if(wwws)
+    RAPTOR_FREE(raptor_www**, wwws);
+  if(docs)
+    RAPTOR_FREE(raptor_grddl_prefetched_doc**, docs);
+}
+
+
+/* Fetch every uncached transformation stylesheet through one
+ * concurrent fetch group and compile the results into the world
+ * cache; the apply loop then runs from cache hits with no further
+ * round trips
+ */
+static void
+raptor_grddl_prefetch_transform_uris(raptor_parser* rdf_parser)
+{
+  raptor_grddl_parser_context* grddl_parser;
+  raptor_www_group* group = NULL;
+  raptor_www** wwws = NULL;
+  raptor_grddl_xml_parse_bytes_context* xpbcs = NULL;
+  int size;
+  int i;
+  int queued = 0;
+
+  grddl_parser = (raptor_grddl_parser_context*)rdf_parser->context;
+
+  size = raptor_sequence_size(grddl_parser->doc_transform_uris);
+  if(size < 2)
+    return;
+
+  wwws = RAPTOR_CALLOC(raptor_www**, size, sizeof(raptor_www*));
+  xpbcs = RAPTOR_CALLOC(raptor_grddl_xml_parse_bytes_context*, size,
+                        sizeof(*xpbcs));
+  if(!wwws || !xpbcs)
+    goto tidy;
+
+  group = raptor_new_www_group(rdf_parser->world);
+  if(!group)
+    goto tidy;
+
+  for(i = 0; i < size; i++) {
+    grddl_xml_context* xml_context;
+    raptor_uri* uri;
+    int j;
+
+    xml_context = (grddl_xml_context*)raptor_sequence_get_at(grddl_parser->doc_transform_uris, i);
+    uri = xml_context->uri;
+    if(!uri)
+      continue;
+
+    if(raptor_grddl_cache_lookup(rdf_parser->world, uri))
+      continue;
+
+    if(raptor_grddl_fetch_uri_forbidden(rdf_parser, uri))
+      continue;
+
+    /* skip duplicates within this batch */
+    for(j = 0; j < i; j++) {
+      grddl_xml_context* xml_context2;
+      xml_context2 = (grddl_xml_context*)raptor_sequence_get_at(grddl_parser->doc_transform_uris, j);
+      if(xml_context2->uri && raptor_uri_equals(xml_context2->uri, uri))
+        break;
+    }
+    if(j < i)
+      continue;
+
+    xpbcs[i].xc = NULL;
+    xpbcs[i].rdf_parser = rdf_parser;
+    xpbcs[i].base_uri = xml_context->base_uri ? xml_context->base_uri : uri;
+    xpbcs[i].save_bytes = 1;
+    xpbcs[i].buffer = NULL;
+    xpbcs[i].buffer_len = 0;
+
+    wwws[i] = raptor_grddl_new_fetch_www(rdf_parser,
+                                         raptor_grddl_uri_xml_parse_bytes,
+                                         &xpbcs[i],
+                                         NULL, NULL,
+                                         FETCH_ACCEPT_XSLT);
+    if(!wwws[i] || raptor_www_group_add(group, wwws[i], uri))
+      continue;
+    queued++;
+  }
+
+  if(queued > 1) {
+    RAPTOR_DEBUG2("Prefetching %d transformation URIs concurrently\n", queued);
+
+    /* failures are reported by the apply loop when its own fetch of
+     * the still-uncached stylesheet fails */
+    raptor_world_internal_set_ignore_errors(rdf_parser->world, 1);
+    raptor_www_group_fetch(group);
+    raptor_world_internal_set_ignore_errors(rdf_parser->world, 0);
+
+    for(i = 0; i < size; i++) {
+      grddl_xml_context* xml_context;
+      xsltStylesheetPtr sheet;
+
+      if(!wwws[i] || wwws[i]->failed || !xpbcs[i].xc)
+        continue;
+
+      xml_context = (grddl_xml_context*)raptor_sequence_get_at(grddl_parser->doc_transform_uris, i);
+
+      xmlParseChunk(xpbcs[i].xc, NULL, 0, 1);
+
+      raptor_libxslt_set_global_state(rdf_parser);
+      sheet = xsltParseStylesheetDoc(xpbcs[i].xc->myDoc);
+      if(sheet) {
+        raptor_grddl_cache_store(rdf_parser->world, xml_context->uri,
+                                 xpbcs[i].buffer, xpbcs[i].buffer_len, sheet);
+        xpbcs[i].buffer = NULL;
+      }
+      raptor_libxslt_reset_global_state(rdf_parser);
+    }
+  }
+
+ tidy:
+  for(i = 0; i < size; i++) {
+    if(wwws && wwws[i])
+      raptor_free_www(wwws[i]);
+    if(xpbcs && xpbcs[i].buffer)
+      RAPTOR_FREE(char*, xpbcs[i].buffer);
+    if(xpbcs && xpbcs[i].xc)
+      xmlFreeParserCtxt(xpbcs[i].xc);
+  }
+  if(group)
+    raptor_free_www_group(group);
+  if(wwws)
+    RAPTOR_FREE(raptor_www**, wwws);
+  if(xpbcs)
+    RAPTOR_FREE(raptor_grddl_xml_parse_bytes_context*, xpbcs);
+}
+
+
 static void
 raptor_grddl_done_uri(raptor_grddl_parser_context* grddl_parser,
                       raptor_uri* uri)
@@ -1271,6 +1878,7 @@ raptor_grddl_run_recursive(raptor_parser* rdf_parser, raptor_uri* uri,
   int filter = (flags & RECURSIVE_FLAGS_FILTER) > 0;
   int fetch_uri_flags = 0;
   int is_grddl=!strcmp(parser_name, "grddl");
+  raptor_grddl_prefetched_doc* prefetched = NULL;
   
   grddl_parser = (raptor_grddl_parser_context*)rdf_parser->context;
 
@@ -1293,15 +1901,41 @@ raptor_grddl_run_recursive(raptor_parser* rdf_parser, raptor_uri* uri,
   rpbc.base_uri = NULL;
   rpbc.final_uri = NULL;
   rpbc.started = 0;
-  
+
   if(ignore_errors)
     fetch_uri_flags |=FETCH_IGNORE_ERRORS;
-  
-  if(raptor_grddl_fetch_uri(grddl_parser->internal_parser,
-                            uri,
-                            raptor_parser_parse_uri_write_bytes, &rpbc,
-                            content_type_handler, grddl_parser->internal_parser,
-                            fetch_uri_flags)) {
+
+  prefetched = raptor_grddl_take_prefetched_doc(grddl_parser, uri);
+  if(prefetched && !prefetched->failed) {
+    /* document body already retrieved by a concurrent fetch group */
+    raptor_uri* fetch_base_uri;
+
+    if(content_type_handler && prefetched->content_type)
+      content_type_handler(NULL, grddl_parser->internal_parser,
+                           prefetched->content_type);
+
+    fetch_base_uri = prefetched->final_uri ? prefetched->final_uri : uri;
+    if(prefetched->buffer_len) {
+      if(raptor_parser_parse_start(grddl_parser->internal_parser,
+                                   fetch_base_uri) ||
+         raptor_parser_parse_chunk(grddl_parser->internal_parser,
+                                   (const unsigned char*)prefetched->buffer,
+                                   prefetched->buffer_len, 0)) {
+        raptor_grddl_free_prefetched_doc(prefetched);
+        ret = 0;
+        goto tidy;
+      }
+    }
+    raptor_grddl_free_prefetched_doc(prefetched);
+  } else if(prefetched ||
+            raptor_grddl_fetch_uri(grddl_parser->internal_parser,
+                                   uri,
+                                   raptor_parser_parse_uri_write_bytes, &rpbc,
+                                   content_type_handler,
+                                   grddl_parser->internal_parser,
+                                   fetch_uri_flags)) {
+    if(prefetched)
+      raptor_grddl_free_prefetched_doc(prefetched);
     if(!ignore_errors)
       raptor_parser_warning(rdf_parser,
                             "Fetching GRDDL document URI '%s' failed\n",
@@ -1722,7 +2356,10 @@ raptor_grddl_parse_chunk(raptor_parser* rdf_parser,
       raptor_free_sequence(result);
 
 
-      /* Recursive GRDDL through all the <head profile> URIs */
+      /* Recursive GRDDL through all the <head profile> URIs,
+       * retrieving them all concurrently first */
+      raptor_grddl_prefetch_profile_uris(rdf_parser);
+
       size = raptor_sequence_size(grddl_parser->profile_uris);
       for(i = 1; i < size; i++) {
         grddl_xml_context* xml_context;
@@ -1867,8 +2504,11 @@ raptor_grddl_parse_chunk(raptor_parser* rdf_parser,
   }
 
   
-  /* Apply all transformation URIs seen */
+  /* Apply all transformation URIs seen, fetching the uncached
+   * stylesheets concurrently first */
   transform:
+  raptor_grddl_prefetch_transform_uris(rdf_parser);
+
   while(raptor_sequence_size(grddl_parser->doc_transform_uris)) {
     grddl_xml_context* xml_context;
 
@@ -2039,7 +2679,10 @@ raptor_init_parser_grddl_common(raptor_world* world)
     
     world->xslt_security_preferences = (void*)raptor_xslt_sec;
   }
-  
+
+  if(!world->grddl_xslt_cache)
+    world->grddl_xslt_cache = raptor_new_sequence((raptor_data_free_handler)raptor_free_grddl_stylesheet_cache_entry, NULL);
+
   return 0;
 }
 
@@ -2055,6 +2698,11 @@ raptor_init_parser_grddl(raptor_world* world)
 void
 raptor_terminate_parser_grddl_common(raptor_world *world)
 {
+  if(world->grddl_xslt_cache) {
+    raptor_free_sequence(world->grddl_xslt_cache);
+    world->grddl_xslt_cache = NULL;
+  }
+
   if(world->xslt_security_preferences &&
      !world->xslt_security_preferences_policy)  {
 
@@ -41,6 +41,13 @@
 #include "raptor_internal.h"
 
 
+/* Maximum number of bytes examined when guessing the content syntax.
+ * Chunks are otherwise passed to the inner parser zero-copy; only when
+ * the first chunk is smaller than this window is a prefix accumulated.
+ */
+#define RAPTOR_GUESS_SNIFF_WINDOW 1024
+
+
 /*
  * guess parser object
  */
@@ -53,9 +60,14 @@ struct raptor_guess_parser_context_s {
 
   /* Non-0 when we need to guess */
   int do_guess;
-  
+
   /* Actual parser to use */
   raptor_parser* parser;
+
+  /* prefix accumulated for sniffing when the first chunk is smaller
+   * than RAPTOR_GUESS_SNIFF_WINDOW; never grows beyond the window */
+  unsigned char* sniff_buffer;
+  size_t sniff_len;
 };
 
 
@@ -70,6 +82,9 @@ raptor_guess_parse_init(raptor_parser* rdf_parser, const char *name)
 
   guess_parser->do_guess = 1;
 
+  guess_parser->sniff_buffer = NULL;
+  guess_parser->sniff_len = 0;
+
   return 0;
 }
 
@@ -82,6 +97,9 @@ raptor_guess_parse_terminate(raptor_parser *rdf_parser)
   if(guess_parser->content_type)
     RAPTOR_FREE(char*, guess_parser->content_type);
 
+  if(guess_parser->sniff_buffer)
+    RAPTOR_FREE(unsigned char*, guess_parser->sniff_buffer);
+
   if(guess_parser->parser)
     raptor_free_parser(guess_parser->parser);
 }
@@ -111,69 +129,148 @@ raptor_guess_parse_content_type_handler(raptor_parser* rdf_parser,
 }
 
 
+/*
+ * raptor_guess_parse_sniff:
+ * @rdf_parser: guess parser
+ * @buffer: prefix of the content to sniff (at most the sniff window)
+ * @len: length of @buffer
+ *
+ * INTERNAL - Guess the syntax from a content prefix and construct the
+ * inner parser ready for chunks.
+ *
+ * Return value: non-0 on failure
+ */
 static int
-raptor_guess_parse_chunk(raptor_parser* rdf_parser, 
+raptor_guess_parse_sniff(raptor_parser* rdf_parser,
+                         const unsigned char *buffer, size_t len)
+{
+  raptor_guess_parser_context* guess_parser = (raptor_guess_parser_context*)rdf_parser->context;
+  const unsigned char *identifier = NULL;
+  const char *name;
+
+  if(rdf_parser->base_uri)
+    identifier = raptor_uri_as_string(rdf_parser->base_uri);
+
+  name = raptor_world_guess_parser_name(rdf_parser->world,
+                                        NULL, guess_parser->content_type,
+                                        buffer, len, identifier);
+  if(!name) {
+    raptor_parser_error(rdf_parser,
+                        "Failed to guess parser from content type '%s'",
+                        guess_parser->content_type ?
+                        guess_parser->content_type : "(none)");
+    raptor_parser_parse_abort(rdf_parser);
+    if(guess_parser->parser) {
+      raptor_free_parser(guess_parser->parser);
+      guess_parser->parser = NULL;
+    }
+    return 1;
+  }
+
+#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
+  RAPTOR_DEBUG2("Guessed parser name '%s'\n", name);
+#endif
+
+  /* If there is an existing guessed parser factory present and
+   * it's different from the wanted parser, free it
+   */
+  if(guess_parser->parser) {
+    raptor_parser_factory* factory = raptor_world_get_parser_factory(rdf_parser->world, name);
+
+    if(guess_parser->parser->factory != factory) {
+      raptor_free_parser(guess_parser->parser);
+      guess_parser->parser = NULL;
+    }
+  }
+
+  if(!guess_parser->parser) {
+    guess_parser->parser = raptor_new_parser(rdf_parser->world, name);
+    if(!guess_parser->parser)
+      return 1;
+  }
+
+  /* copy any user data to the grddl parser */
+  if(raptor_parser_copy_user_state(guess_parser->parser, rdf_parser))
+    return 1;
+
+  return raptor_parser_parse_start(guess_parser->parser, rdf_parser->base_uri);
+}
+
+
+static int
+raptor_guess_parse_chunk(raptor_parser* rdf_parser,
                         const unsigned char *buffer, size_t len,
                         int is_end)
 {
   raptor_guess_parser_context* guess_parser = (raptor_guess_parser_context*)rdf_parser->context;
 
   if(guess_parser->do_guess) {
-    const unsigned char *identifier = NULL;
-    const char *name;
-    
-    guess_parser->do_guess = 0;
+    if(!guess_parser->sniff_buffer &&
+       (len >= RAPTOR_GUESS_SNIFF_WINDOW || is_end)) {
+      /* common case - the first chunk alone fills the sniff window (or
+       * is the whole document): sniff on a bounded prefix view of it
+       * and hand the original chunk to the inner parser zero-copy
+       */
+      size_t sniff_len = len;
 
-    if(rdf_parser->base_uri)
-      identifier = raptor_uri_as_string(rdf_parser->base_uri);
-    
-    name = raptor_world_guess_parser_name(rdf_parser->world,
-                                          NULL, guess_parser->content_type,
-                                          buffer, len, identifier);
-    if(!name) {
-      raptor_parser_error(rdf_parser,
-                          "Failed to guess parser from content type '%s'",
-                          guess_parser->content_type ? 
-                          guess_parser->content_type : "(none)");
-      raptor_parser_parse_abort(rdf_parser);
-      if(guess_parser->parser) {
-        raptor_free_parser(guess_parser->parser);
-        guess_parser->parser = NULL;
-      }
-      return 1;
-    } else {
-    
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
-      RAPTOR_DEBUG2("Guessed parser name '%s'\n", name);
-#endif
+      if(sniff_len > RAPTOR_GUESS_SNIFF_WINDOW)
+        sniff_len = RAPTOR_GUESS_SNIFF_WINDOW;
 
-      /* If there is an existing guessed parser factory present and
-       * it's different from the wanted parser, free it
-       */
-      if(guess_parser->parser) {
-        raptor_parser_factory* factory = raptor_world_get_parser_factory(rdf_parser->world, name);
+      guess_parser->do_guess = 0;
 
-        if(guess_parser->parser->factory != factory) {
-          raptor_free_parser(guess_parser->parser);
-          guess_parser->parser = NULL;
-        }
-      }
-      
-      if(!guess_parser->parser) {
-        guess_parser->parser = raptor_new_parser(rdf_parser->world, name);
-        if(!guess_parser->parser)
+      if(raptor_guess_parse_sniff(rdf_parser, buffer, sniff_len))
+        return 1;
+    } else {
+      /* short first chunks - accumulate a prefix, never more than the
+       * sniff window, until it fills or the content ends
+       */
+      size_t space = RAPTOR_GUESS_SNIFF_WINDOW - guess_parser->sniff_len;
+      size_t take = (len < space) ? len : space;
+      int rc;
+
+      if(!guess_parser->sniff_buffer) {
+        guess_parser->sniff_buffer = RAPTOR_MALLOC(unsigned char*,
+                                                   RAPTOR_GUESS_SNIFF_WINDOW);
+        if(!guess_parser->sniff_buffer)
           return 1;
       }
 
-      /* copy any user data to the grddl parser */
-      if(raptor_parser_copy_user_state(guess_parser->parser, rdf_parser))
-        return 1;
-      
-      if(raptor_parser_parse_start(guess_parser->parser, rdf_parser->base_uri))
+      if(take) {
+        memcpy(guess_parser->sniff_buffer + guess_parser->sniff_len,
+               buffer, take);
+        guess_parser->sniff_len += take;
+      }
+
+      if(guess_parser->sniff_len < RAPTOR_GUESS_SNIFF_WINDOW && !is_end)
+        /* whole chunk absorbed; wait for more content */
+        return 0;
+
+      guess_parser->do_guess = 0;
+
+      if(raptor_guess_parse_sniff(rdf_parser,
+                                  guess_parser->sniff_buffer,
+                                  guess_parser->sniff_len))
         return 1;
+
+      /* deliver the accumulated prefix, then fall through with any
+       * remainder of the current chunk passed zero-copy
+       */
+      rc = raptor_parser_parse_chunk(guess_parser->parser,
+                                     guess_parser->sniff_buffer,
+                                     guess_parser->sniff_len,
+                                     is_end && take == len);
+
+      RAPTOR_FREE(unsigned char*, guess_parser->sniff_buffer);
+      guess_parser->sniff_buffer = NULL;
+      guess_parser->sniff_len = 0;
+
+      if(rc || take == len)
+        return rc;
+
+      buffer += take;
+      len -= take;
     }
   }
-  
 
   /* now we can pass on calls to internal guess_parser */
   return raptor_parser_parse_chunk(guess_parser->parser, buffer, len, is_end);
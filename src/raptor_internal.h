@@ -42,6 +42,11 @@ extern "C" {
 #undef HAVE_STDLIB_H
 #endif
 
+/* for the world mutex (RAPTOR_WORLD_FLAG_THREAD_SAFE) */
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
 /* Some internal functions are needed by the test programs */
 #ifndef RAPTOR_INTERNAL_API
 #define RAPTOR_INTERNAL_API RAPTOR_API
@@ -56,6 +61,34 @@ extern "C" {
 #define RAPTOR_DEBUG 1
 #endif
 
+/* Library-wide statistics counters - see raptor_world_get_statistics().
+ * Parallel parse workers (and their allocations) update these from
+ * several threads at once, so the increments must not lose updates;
+ * relaxed atomic adds cost no ordering and keep the totals right.
+ * Define RAPTOR_DISABLE_STATISTICS to compile the accounting out
+ * entirely.
+ */
+#ifndef RAPTOR_DISABLE_STATISTICS
+extern raptor_statistics raptor_statistics_counters;
+#if defined(__GNUC__) || defined(__clang__)
+#define RAPTOR_STATS_INC(field) ((void)__atomic_fetch_add(&raptor_statistics_counters.field, 1UL, __ATOMIC_RELAXED))
+#define RAPTOR_STATS_ADD(field, count) ((void)__atomic_fetch_add(&raptor_statistics_counters.field, (unsigned long)(count), __ATOMIC_RELAXED))
+#else
+#define RAPTOR_STATS_INC(field) (raptor_statistics_counters.field++)
+#define RAPTOR_STATS_ADD(field, count) (raptor_statistics_counters.field += (unsigned long)(count))
+#endif
+#else
+#define RAPTOR_STATS_INC(field) ((void)0)
+#define RAPTOR_STATS_ADD(field, count) ((void)0)
+#endif
+
+/* raptor_general.c - allocation routed through the hooks set by
+ * raptor_memory_set_allocator(), falling back to the C library */
+void* raptor_memory_malloc(size_t size);
+void* raptor_memory_calloc(size_t nmemb, size_t size);
+void* raptor_memory_realloc(void *ptr, size_t size);
+void raptor_memory_free(void *ptr);
+
 #if defined(RAPTOR_MEMORY_SIGN)
 #define RAPTOR_SIGN_KEY 0x08A61080
 void* raptor_sign_malloc(size_t size);
@@ -63,16 +96,16 @@ void* raptor_sign_calloc(size_t nmemb, size_t size);
 void* raptor_sign_realloc(void *ptr, size_t size);
 void raptor_sign_free(void *ptr);
   
-#define RAPTOR_MALLOC(type, size)   (type)raptor_sign_malloc(size)
-#define RAPTOR_CALLOC(type, nmemb, size) (type)raptor_sign_calloc(nmemb, size)
-#define RAPTOR_REALLOC(type, ptr, size) (type)raptor_sign_realloc(ptr, size)
-#define RAPTOR_FREE(type, ptr)   raptor_sign_free((void*)ptr)
+#define RAPTOR_MALLOC(type, size)   (type)(RAPTOR_STATS_INC(allocations), raptor_sign_malloc(size))
+#define RAPTOR_CALLOC(type, nmemb, size) (type)(RAPTOR_STATS_INC(allocations), raptor_sign_calloc(nmemb, size))
+#define RAPTOR_REALLOC(type, ptr, size) (type)(RAPTOR_STATS_INC(allocations), raptor_sign_realloc(ptr, size))
+#define RAPTOR_FREE(type, ptr)   (RAPTOR_STATS_INC(frees), raptor_sign_free((void*)ptr))
 
 #else
-#define RAPTOR_MALLOC(type, size) (type)malloc(size)
-#define RAPTOR_CALLOC(type, nmemb, size) (type)calloc(nmemb, size)
-#define RAPTOR_REALLOC(type, ptr, size) (type)realloc(ptr, size)
-#define RAPTOR_FREE(type, ptr)   free((void*)ptr)
+#define RAPTOR_MALLOC(type, size) (type)(RAPTOR_STATS_INC(allocations), raptor_memory_malloc(size))
+#define RAPTOR_CALLOC(type, nmemb, size) (type)(RAPTOR_STATS_INC(allocations), raptor_memory_calloc(nmemb, size))
+#define RAPTOR_REALLOC(type, ptr, size) (type)(RAPTOR_STATS_INC(allocations), raptor_memory_realloc(ptr, size))
+#define RAPTOR_FREE(type, ptr)   (RAPTOR_STATS_INC(frees), raptor_memory_free((void*)ptr))
 
 #endif
 
@@ -422,21 +455,62 @@ void raptor_concepts_finish(raptor_world* world);
 
 /* raptor_iostream.c */
 raptor_world* raptor_iostream_get_world(raptor_iostream *iostr);
+raptor_iostream* raptor_new_iostream_from_file_handle_read_ahead(raptor_world *world, FILE *handle, size_t buffer_size, int owns_handle);
 
 
 /* Raptor Namespace Stack node */
+/* number of slots in the per-stack URI to qname cache; must be a
+ * power of two */
+#define RAPTOR_NSTACK_QNAME_CACHE_SIZE 64
+
+/* entry in the URI to qname cache of a namespace stack */
+typedef struct {
+  /* URI looked up (owned reference) or NULL if the slot is empty */
+  raptor_uri* uri;
+  /* resulting qname, shared via its usage count, or NULL when no
+   * in-scope namespace abbreviates the URI (negative entry) */
+  raptor_qname* qname;
+  /* namespace stack generation the entry was built under */
+  int generation;
+  int xml_version;
+} raptor_namespace_qname_cache_entry;
+
 struct raptor_namespace_stack_s {
   raptor_world* world;
   int size;
 
   int table_size;
   raptor_namespace** table;
+  /* reverse index of the same namespaces bucketed by URI string,
+   * chained through raptor_namespace uri_next */
+  raptor_namespace** uri_table;
   raptor_namespace* def_namespace;
 
+  /* bumped whenever the in-scope mappings change; lets qname caches
+   * detect stale entries */
+  int generation;
+
+  /* direct-mapped cache of raptor_new_qname_from_namespace_uri()
+   * results; entries are invalidated by the generation counter */
+  raptor_namespace_qname_cache_entry qname_cache[RAPTOR_NSTACK_QNAME_CACHE_SIZE];
+
   raptor_uri *rdf_ms_uri;
   raptor_uri *rdf_schema_uri;
+
+  /* free list of recycled namespace objects chained through next;
+   * every entry has RAPTOR_NAMESPACE_POOL_PREFIX_LEN bytes of inline
+   * prefix space so re-declaring the usual handful of prefixes per
+   * document reuses these instead of allocating */
+  raptor_namespace* ns_pool;
+  int ns_pool_size;
 };
 
+/* inline prefix space of pooled namespace objects; longer prefixes
+ * get an exact-sized heap allocation instead */
+#define RAPTOR_NAMESPACE_POOL_PREFIX_LEN 32
+/* most namespace objects kept on a stack's free list */
+#define RAPTOR_NAMESPACE_POOL_MAX 16
+
 
 /* Forms:
  * 1) prefix=NULL uri=<URI>      - default namespace defined
@@ -447,6 +521,9 @@ struct raptor_namespace_s {
   /* next down the stack, NULL at bottom */
   struct raptor_namespace_s* next;
 
+  /* next in the same URI-index bucket */
+  struct raptor_namespace_s* uri_next;
+
   raptor_namespace_stack *nstack;
 
   /* NULL means is the default namespace */
@@ -465,6 +542,9 @@ struct raptor_namespace_s {
   int is_rdf_ms;
   /* Non 0 if is RDF Schema Namespace */
   int is_rdf_schema;
+  /* Non 0 if sized with RAPTOR_NAMESPACE_POOL_PREFIX_LEN inline
+   * prefix space and recyclable via the stack's namespace pool */
+  int from_pool;
 };
 
 raptor_namespace** raptor_namespace_stack_to_array(raptor_namespace_stack *nstack, size_t *size_p);
@@ -481,6 +561,9 @@ raptor_namespace** raptor_namespace_stack_to_array(raptor_namespace_stack *nstac
 #define RAPTOR_READ_BUFFER_SIZE 4096
 #endif
 
+/* Default number of statements per raptor_statement_batch_handler call */
+#define RAPTOR_STATEMENT_BATCH_SIZE_DEFAULT 1024
+
 
 /*
  * Raptor parser object
@@ -519,12 +602,61 @@ struct raptor_parser_s {
   /* Options (per-object) */
   raptor_object_options options;
 
+  /* snapshot of hot boolean options, rebuilt by
+   * raptor_parser_snapshot_options() at parse start and whenever an
+   * option is set, so per-statement and per-line paths load a direct
+   * member instead of indexing the options array */
+  struct {
+    unsigned int deduplicate : 1;
+    unsigned int cheap_locator : 1;
+    unsigned int fail_fast : 1;
+    /* derived: no per-statement option is enabled, so
+     * raptor_parser_emit_statement_inline() may hand statements
+     * straight to the user handler */
+    unsigned int emit_directly : 1;
+  } option_snapshot;
+
+  /* non-0 when this parser's statement handler is an internal
+   * forwarding sink (parallel parse workers) rather than the
+   * application's: statistics count the statement when the
+   * destination parser delivers it, not here, so each statement is
+   * counted once at the user-handler boundary */
+  int internal_sink;
+
+  /* range of blank node IDs bulk-reserved from the world for
+   * raptor_parser_internal_generate_id(); a range is valid while
+   * @bnodeid_next < @bnodeid_end and @bnodeid_generation matches the
+   * world generation counter (stale after
+   * raptor_world_set_generate_bnodeid_parameters() resets the base) */
+  int bnodeid_next;
+  int bnodeid_end;
+  int bnodeid_generation;
+
+  /* open addressing map from document blank node labels to shared
+   * terms, used by raptor_parser_get_blank_term(); created lazily at
+   * the first label and emptied at parse start since labels are
+   * scoped to one document */
+  struct raptor_bnode_map_s* bnode_map;
+
   /* stuff for our user */
   void *user_data;
 
   /* parser callbacks */
   raptor_statement_handler statement_handler;
 
+  /* batched statement delivery - when set, @statement_handler is an
+   * internal trampoline accumulating into @statement_batch and
+   * @statement_batch_user_data holds the user pointer */
+  raptor_statement_batch_handler statement_batch_handler;
+  void* statement_batch_user_data;
+  raptor_statement** statement_batch;
+  size_t statement_batch_size;
+  size_t statement_batch_count;
+
+  /* duplicate-statement suppression state, created lazily when
+   * RAPTOR_OPTION_DEDUPLICATE is set (or NULL) */
+  struct raptor_statement_dedup_s* dedup;
+
   raptor_graph_mark_handler graph_mark_handler;
 
   void* uri_filter_user_data;
@@ -703,6 +835,23 @@ raptor_parser_factory* raptor_world_register_parser_factory(raptor_world* world,
 int raptor_parser_factory_add_mime_type(raptor_parser_factory* factory, const char* mime_type, int q);
 
 unsigned char* raptor_world_internal_generate_id(raptor_world *world, unsigned char *user_bnodeid);
+int raptor_world_reserve_bnodeids(raptor_world* world, int count);
+unsigned char* raptor_parser_internal_generate_id(raptor_parser* rdf_parser, unsigned char *user_bnodeid);
+raptor_term* raptor_parser_get_blank_term(raptor_parser* rdf_parser, const unsigned char* label, size_t label_len);
+void raptor_parser_clear_bnode_map(raptor_parser* rdf_parser);
+void raptor_parser_free_bnode_map(raptor_parser* rdf_parser);
+
+/* entry in a registry name index mapping a syntax name or alias to
+ * the parser or serializer factory serving it */
+typedef struct {
+  const char* name;
+  void* factory;
+} raptor_syntax_name_index_entry;
+
+int raptor_world_index_syntax_name(raptor_avltree** tree_p, const char* name, void* factory);
+void* raptor_world_lookup_syntax_name(raptor_avltree* tree, const char* name);
+unsigned char* raptor_world_borrow_scratch(raptor_world* world, size_t size);
+void raptor_world_return_scratch(raptor_world* world, unsigned char* buffer);
 
 #ifdef RAPTOR_DEBUG
 void raptor_stats_print(raptor_parser *rdf_parser, FILE *stream);
@@ -711,7 +860,9 @@ RAPTOR_INTERNAL_API const char* raptor_basename(const char *name);
 int raptor_term_print_as_ntriples(const raptor_term *term, FILE* stream);
 
 /* raptor_ntriples.c */
-size_t raptor_ntriples_parse_term(raptor_world* world, raptor_locator* locator, unsigned char *string, size_t *len_p, raptor_term** term_p, int allow_turtle);
+size_t raptor_ntriples_parse_term(raptor_world* world, raptor_parser* rdf_parser, raptor_locator* locator, unsigned char *string, size_t *len_p, raptor_term** term_p, int allow_turtle);
+size_t raptor_ntriples_scan_line_special(const unsigned char *p, size_t len);
+size_t raptor_ntriples_scan_clean_span(const unsigned char *p, size_t len, unsigned char end_char, unsigned char stop_char);
 
 /* raptor_parse.c */
 raptor_parser_factory* raptor_world_get_parser_factory(raptor_world* world, const char *name);  
@@ -799,6 +950,8 @@ struct raptor_qname_s {
   /* optional value - used when name is an attribute */
   const unsigned char *value;
   size_t value_length;
+  /* usage count - shared qnames from the SAX2 cache bump this */
+  int usage;
 };
 
 
@@ -829,6 +982,7 @@ int raptor_init_parser_rss(raptor_world* world);
 int raptor_init_parser_rdfa(raptor_world* world);
 int raptor_init_parser_json(raptor_world* world);
 int raptor_init_parser_nquads(raptor_world* world);
+int raptor_init_parser_binary(raptor_world* world);
 
 void raptor_terminate_parser_grddl_common(raptor_world *world);
 
@@ -909,7 +1063,36 @@ void raptor_parsers_finish(raptor_world *world);
 void raptor_parser_save_content(raptor_parser* rdf_parser, int save);
 const unsigned char* raptor_parser_get_content(raptor_parser* rdf_parser, size_t* length_p);
 void raptor_parser_start_graph(raptor_parser* parser, raptor_uri* uri, int is_declared);
+void raptor_parser_emit_statement(raptor_parser* rdf_parser, raptor_statement* statement);
 void raptor_parser_end_graph(raptor_parser* parser, raptor_uri* uri, int is_declared);
+void raptor_parser_snapshot_options(raptor_parser* rdf_parser);
+
+/*
+ * raptor_parser_emit_statement_inline:
+ * @rdf_parser: parser
+ * @statement: statement
+ *
+ * INTERNAL - Deliver a statement, specialized for the common configuration.
+ *
+ * raptor_parser_snapshot_options() decides once per parse whether any
+ * per-statement option (currently only deduplication) is enabled.
+ * When none is, this hands the statement straight to the user handler
+ * so the call chain from the per-syntax generate code is direct and
+ * can be inlined; otherwise it falls back to the general
+ * raptor_parser_emit_statement() path.  Same contract: the handler
+ * must be non-NULL.
+ */
+static RAPTOR_INLINE void
+raptor_parser_emit_statement_inline(raptor_parser* rdf_parser,
+                                    raptor_statement* statement)
+{
+  if(rdf_parser->option_snapshot.emit_directly) {
+    if(!rdf_parser->internal_sink)
+      RAPTOR_STATS_INC(statements_emitted);
+    (*rdf_parser->statement_handler)(rdf_parser->user_data, statement);
+  } else
+    raptor_parser_emit_statement(rdf_parser, statement);
+}
 
 /* raptor_rss.c */
 int raptor_init_serializer_rss10(raptor_world* world);
@@ -933,6 +1116,7 @@ int raptor_init_serializer_dot(raptor_world* world);
 /* raptor_serializer_ntriples.c */
 int raptor_init_serializer_ntriples(raptor_world* world);
 int raptor_init_serializer_nquads(raptor_world* world);
+int raptor_init_serializer_binary(raptor_world* world);
 
 /* raptor_serialize_rdfxml.c */  
 int raptor_init_serializer_rdfxml(raptor_world* world);
@@ -956,6 +1140,16 @@ extern const raptor_unichar raptor_unicode_max_codepoint;
 int raptor_unicode_is_namestartchar(raptor_unichar c);
 int raptor_unicode_is_namechar(raptor_unichar c);
 int raptor_unicode_check_utf8_nfc_string(const unsigned char *input, size_t length, int* error);
+int raptor_world_check_utf8_nfc_string(raptor_world* world, const unsigned char *input, size_t length, int* error);
+
+/* cache of recently NFC-validated non-ASCII spans (raptor_unicode.c);
+ * slot count must be a power of two */
+#define RAPTOR_NFC_CACHE_SLOTS 256
+#define RAPTOR_NFC_CACHE_MAX_LEN 64
+typedef struct {
+  unsigned char string[RAPTOR_NFC_CACHE_MAX_LEN];
+  size_t length;                 /* 0 for an empty slot */
+} raptor_nfc_cache_slot;
 
 /* raptor_www*.c */
 #ifdef RAPTOR_WWW_LIBXML
@@ -974,12 +1168,26 @@ int raptor_unicode_check_utf8_nfc_string(const unsigned char *input, size_t leng
 #define RAPTOR_WWW_BUFFER_SIZE 4096
 #endif
 
+/* Size of the transient buffer used for bulk reads during a
+ * retrieval; allocated per fetch, not per raptor_www */
+#ifndef RAPTOR_WWW_READ_BUFFER_SIZE
+#define RAPTOR_WWW_READ_BUFFER_SIZE (256 * 1024)
+#endif
+
+/* Number of idle curl handles kept per world for connection reuse */
+#ifndef RAPTOR_WWW_CURL_POOL_SIZE
+#define RAPTOR_WWW_CURL_POOL_SIZE 8
+#endif
+
 /* WWW library state */
 struct  raptor_www_s {
   raptor_world* world;
   char *type;
   int free_type;
   size_t total_bytes;
+  /* bytes promised by the Content-Length header or the file size;
+   * 0 when unknown */
+  size_t content_length;
   int failed;
   int status_code;
 
@@ -1045,6 +1253,9 @@ void raptor_www_curl_free(raptor_www *www);
 int raptor_www_curl_fetch(raptor_www *www);
 int raptor_www_curl_set_ssl_cert_options(raptor_www* www, const char* cert_filename, const char* cert_type, const char* cert_passphrase);
 int raptor_www_curl_set_ssl_verify_options(raptor_www* www, int verify_peer, int verify_host);
+int raptor_www_curl_multi_fetch(raptor_www **wwws, int www_count);
+int raptor_www_curl_world_init(raptor_world* world);
+void raptor_www_curl_world_finish(raptor_world* world);
 
 void raptor_www_libfetch_init(raptor_www *www);
 void raptor_www_libfetch_free(raptor_www *www);
@@ -1089,6 +1300,23 @@ struct raptor_xml_element_s {
 };
 
 
+/* number of entries in the SAX2 element qname cache */
+#define RAPTOR_SAX2_QNAME_CACHE_SIZE 64
+
+/* number of recycled elements kept in the SAX2 element pool */
+#define RAPTOR_SAX2_ELEMENT_POOL_SIZE 8
+
+/* one entry in the SAX2 element qname cache */
+typedef struct {
+  /* raw element name as seen by the lexer (owned) or NULL if empty */
+  unsigned char* name;
+  size_t name_length;
+  /* shared qname built for @name (owned reference) */
+  raptor_qname* qname;
+  /* namespace stack generation the qname was built under */
+  int generation;
+} raptor_sax2_qname_cache_entry;
+
 struct raptor_sax2_s {
 #ifdef RAPTOR_XML_LIBXML
   int magic;
@@ -1152,8 +1380,31 @@ struct raptor_sax2_s {
   /* call SAX2 handlers if non-0 */
   int enabled;
 
+  /* snapshot of RAPTOR_OPTION_NORMALIZE_LANGUAGE taken at parse
+   * start; checked once per xml:lang attribute */
+  int normalize_language;
+
   void* uri_filter_user_data;
   raptor_uri_filter_func uri_filter;
+
+  /* cache of recently built element qnames - XML documents repeat the
+   * same few element names many times */
+  raptor_sax2_qname_cache_entry qname_cache[RAPTOR_SAX2_QNAME_CACHE_SIZE];
+
+  /* pool of cleared elements recycled between an end tag and the
+   * next start tag to avoid per-element allocation churn */
+  raptor_xml_element* element_pool[RAPTOR_SAX2_ELEMENT_POOL_SIZE];
+  int element_pool_size;
+
+  /* scratch copy of the raw attribute pointer array, grown as needed
+   * and reused across elements */
+  unsigned char** atts_scratch;
+  size_t atts_scratch_size;
+
+  /* when non-0, the depth of an element whose subtree is being
+   * discarded - no elements are built and no handlers are called for
+   * content below this depth.  See raptor_sax2_skip_subtree() */
+  int skip_depth;
 };
 
 int raptor_sax2_init(raptor_world* world);
@@ -1161,6 +1412,8 @@ void raptor_sax2_finish(raptor_world* world);
 
 
 raptor_xml_element* raptor_xml_element_pop(raptor_sax2* sax2);
+void raptor_xml_element_clear(raptor_xml_element* element);
+void raptor_sax2_skip_subtree(raptor_sax2* sax2);
 void raptor_xml_element_push(raptor_sax2* sax2, raptor_xml_element* element);
 int raptor_sax2_get_depth(raptor_sax2* sax2);
 void raptor_sax2_inc_depth(raptor_sax2* sax2);
@@ -1172,6 +1425,11 @@ int raptor_sax2_set_option(raptor_sax2 *sax2, raptor_option option, char* string
 void raptor_print_xml_element(raptor_xml_element *element, FILE* stream);
 #endif
 
+/* raptor_xml_writer.c */
+raptor_xml_element* raptor_xml_writer_new_element(raptor_xml_writer* xml_writer, raptor_qname* name, const unsigned char* xml_language, raptor_uri* xml_base);
+raptor_xml_element* raptor_xml_writer_new_element_from_namespace_local_name(raptor_xml_writer* xml_writer, raptor_namespace* ns, const unsigned char* name, const unsigned char* xml_language, raptor_uri* xml_base);
+void raptor_xml_writer_recycle_element(raptor_xml_writer* xml_writer, raptor_xml_element* element);
+
 void raptor_sax2_start_element(void* user_data, const unsigned char *name, const unsigned char **atts);
 void raptor_sax2_end_element(void* user_data, const unsigned char *name);
 void raptor_sax2_characters(void* user_data, const unsigned char *s, int len);
@@ -1247,6 +1505,7 @@ typedef void (*raptor_simple_message_handler)(void *user_data, const char *messa
 
 /* turtle_common.c */
 RAPTOR_INTERNAL_API int raptor_stringbuffer_append_turtle_string(raptor_stringbuffer* stringbuffer, const unsigned char *text, size_t len, int delim, raptor_simple_message_handler error_handler, void *error_data, int is_uri);
+RAPTOR_INTERNAL_API void raptor_stringbuffer_reset(raptor_stringbuffer* stringbuffer);
 
 
 /* raptor_abbrev.c */
@@ -1281,6 +1540,10 @@ typedef struct {
   raptor_avltree *properties;    /* list of properties
                                   * (predicate/object pair) of this
                                   * subject */
+  raptor_sequence *pending_properties; /* properties appended flat as
+                                  * statements arrive; sorted into
+                                  * ->properties in one pass by
+                                  * raptor_abbrev_subject_commit_properties() */
   raptor_sequence *list_items;   /* list of container elements if
                                   * is rdf container */
   int valid;                     /* set 0 for blank nodes that do not
@@ -1296,12 +1559,22 @@ raptor_abbrev_node* raptor_abbrev_node_lookup(raptor_avltree* nodes, raptor_term
 
 void raptor_free_abbrev_subject(raptor_abbrev_subject* subject);
 int raptor_abbrev_subject_add_property(raptor_abbrev_subject* subject, raptor_abbrev_node* predicate, raptor_abbrev_node* object);
+int raptor_abbrev_subject_commit_properties(raptor_abbrev_subject* subject);
 int raptor_abbrev_subject_compare(raptor_abbrev_subject* subject1, raptor_abbrev_subject* subject2);
 raptor_abbrev_subject* raptor_abbrev_subject_find(raptor_avltree *subjects, raptor_term* node);
 raptor_abbrev_subject* raptor_abbrev_subject_lookup(raptor_avltree* nodes, raptor_avltree* subjects, raptor_avltree* blanks, raptor_term* term);
 int raptor_abbrev_subject_valid(raptor_abbrev_subject *subject);
 int raptor_abbrev_subject_invalidate(raptor_abbrev_subject *subject);
 
+/* Disk-backed statement store for the abbreviating serializers - see
+ * RAPTOR_OPTION_SERIALIZE_SPILL_SIZE */
+typedef struct raptor_abbrev_spill_s raptor_abbrev_spill;
+
+raptor_abbrev_spill* raptor_new_abbrev_spill(raptor_world* world, int run_size);
+void raptor_free_abbrev_spill(raptor_abbrev_spill* spill);
+int raptor_abbrev_spill_add(raptor_abbrev_spill* spill, raptor_statement* statement);
+int raptor_abbrev_spill_replay(raptor_abbrev_spill* spill, raptor_statement_handler handler, void* user_data);
+
 
 /* avltree */
 #ifdef RAPTOR_DEBUG
@@ -1345,6 +1618,7 @@ RAPTOR_INTERNAL_API void raptor_turtle_writer_decrease_indent(raptor_turtle_writ
 RAPTOR_INTERNAL_API void raptor_turtle_writer_newline(raptor_turtle_writer *turtle_writer);
 RAPTOR_INTERNAL_API int raptor_turtle_writer_reference(raptor_turtle_writer* turtle_writer, raptor_uri* uri);
 RAPTOR_INTERNAL_API int raptor_turtle_writer_literal(raptor_turtle_writer* turtle_writer, raptor_namespace_stack *nstack, const unsigned char *s, const unsigned char* lang, raptor_uri* datatype);
+RAPTOR_INTERNAL_API int raptor_turtle_writer_counted_literal(raptor_turtle_writer* turtle_writer, raptor_namespace_stack *nstack, const unsigned char *s, size_t s_len, const unsigned char* lang, raptor_uri* datatype);
 RAPTOR_INTERNAL_API void raptor_turtle_writer_csv_string(raptor_turtle_writer* turtle_writer, const unsigned char *s);
 RAPTOR_INTERNAL_API void raptor_turtle_writer_qname(raptor_turtle_writer* turtle_writer, raptor_qname* qname);
 RAPTOR_INTERNAL_API int raptor_turtle_writer_quoted_counted_string(raptor_turtle_writer* turtle_writer, const unsigned char *s, size_t length);
@@ -1366,6 +1640,10 @@ int raptor_turtle_is_legal_turtle_qname(raptor_qname* qname);
  */
 typedef struct raptor_json_writer_s raptor_json_writer;
 
+/* raptor_escaped.c */
+void raptor_escaped_write_fill_clean_table(unsigned char *table, const char delim, unsigned int flags);
+int raptor_string_escaped_write_clean_table(const unsigned char *string, size_t len, const char delim, unsigned int flags, const unsigned char *clean, raptor_iostream *iostr);
+
 /* raptor_json_writer.c */
 raptor_json_writer* raptor_new_json_writer(raptor_world* world, raptor_uri* base_uri, raptor_iostream* iostr);
 void raptor_free_json_writer(raptor_json_writer* json_writer);
@@ -1382,6 +1660,7 @@ int raptor_json_writer_key_uri_value(raptor_json_writer* json_writer, const char
 
 /* raptor_memstr.c */
 const char* raptor_memstr(const char *haystack, size_t haystack_len, const char *needle);
+int raptor_memstr_multi(const char *haystack, size_t haystack_len, const char* const *needles, int count, int *founds);
 
 /* raptor_serialize_rdfxmla.c special functions for embedding rdf/xml */
 int raptor_rdfxmla_serialize_set_write_rdf_RDF(raptor_serializer* serializer, int value);
@@ -1391,6 +1670,7 @@ int raptor_rdfxmla_serialize_set_write_typed_nodes(raptor_serializer* serializer
 
 /* snprintf.c */
 size_t raptor_format_integer(char* buffer, size_t bufsize, int integer, unsigned int base, int width, char padding);
+size_t raptor_format_double(char* buffer, size_t bufsize, double value);
 
 /* raptor_world structure */
 #define RAPTOR1_WORLD_MAGIC_1 0
@@ -1408,6 +1688,12 @@ RAPTOR_INTERNAL_API int raptor_check_world_internal(raptor_world* world, const c
 
 
 
+/* number of slots in the feed date string memo cache (power of two) */
+#define RAPTOR_RSS_DATE_CACHE_SIZE 8
+
+/* number of recycled scratch buffers kept on the world */
+#define RAPTOR_WORLD_SCRATCH_BUFFERS 4
+
 struct raptor_world_s {
   /* signature to check this is a world object */
   unsigned int magic;
@@ -1415,12 +1701,47 @@ struct raptor_world_s {
   /* world has been initialized with raptor_world_open() */
   int opened;
 
+  /* non-0 to serialize access to shared world state so that
+   * concurrent parsers / serializers may share one world
+   * (RAPTOR_WORLD_FLAG_THREAD_SAFE; requires pthreads) */
+  int thread_safe;
+
+#ifdef HAVE_PTHREAD_H
+  /* recursive lock guarding the intern tables, caches, object pools
+   * and the blank node ID counter when thread_safe is set */
+  pthread_mutex_t mutex;
+#endif
+
+  /* bitmask of parser / serializer factory constructors already run;
+   * factories are registered lazily on first use by name unless the
+   * world is thread_safe (then everything registers at open time) */
+  unsigned int parsers_registered;
+  int parsers_fully_registered;
+  unsigned int serializers_registered;
+  int serializers_fully_registered;
+
+  /* name to factory indexes over the parser / serializer registries,
+   * maintained at factory registration time so name lookups need not
+   * rescan every registered name and alias */
+  raptor_avltree* parser_name_index;
+  raptor_avltree* serializer_name_index;
+
+  /* memo of the last MIME-type-only raptor_world_guess_parser_name()
+   * resolution; the name points into a factory description */
+  char* guess_mime_type;
+  const char* guess_mime_parser_name;
+
   /* internal flag used to ignore errors for e.g. child GRDDL parsers */
   int internal_ignore_errors;
   
   void* message_handler_user_data;
   raptor_log_handler message_handler;
 
+  /* messages below this level are dropped before being formatted;
+   * RAPTOR_LOG_LEVEL_NONE (the default) passes everything through.
+   * Set by raptor_world_set_minimum_log_level() */
+  raptor_log_level minimum_log_level;
+
   /* sequence of parser factories */
   raptor_sequence *parsers;
 
@@ -1437,10 +1758,31 @@ struct raptor_world_s {
   raptor_uri **rss_fields_info_uris;
   raptor_qname **rss_fields_info_qnames;
 
+  /* free list of raptor_rss_field objects reused across items, chained
+   * through the field next pointer; drained by raptor_rss_common_terminate */
+  void *rss_field_pool;
+  int rss_field_pool_size;
+
+  /* memo cache of recently parsed feed date strings, direct-mapped by
+   * string hash - see raptor_rss_date_parse() */
+  char* rss_date_cache_strings[RAPTOR_RSS_DATE_CACHE_SIZE];
+  time_t rss_date_cache_times[RAPTOR_RSS_DATE_CACHE_SIZE];
+
   /* raptor_www v2 flags */
   int www_skip_www_init_finish;
   int www_initialized;
 
+#ifdef RAPTOR_WWW_LIBCURL
+  /* share handle passing DNS and TLS session data between fetches */
+  CURLSH* curl_share;
+  /* pthread mutexes protecting curl_share, or NULL if single threaded */
+  void* curl_share_locks;
+  /* idle curl easy handles kept alive so their connection caches
+   * survive across fetches */
+  CURL* curl_handle_pool[RAPTOR_WWW_CURL_POOL_SIZE];
+  int curl_handle_pool_size;
+#endif
+
   /* This is used to store a #xsltSecurityPrefsPtr typed object
    * pointer when libxslt is compiled in.
    */
@@ -1451,6 +1793,12 @@ struct raptor_world_s {
    */
   int xslt_security_preferences_policy;
 
+  /* Cache of fetched and compiled GRDDL XSLT stylesheets - a
+   * sequence of raptor_grddl_stylesheet_cache_entry objects managed
+   * by raptor_grddl.c when the GRDDL parser is compiled in.
+   */
+  raptor_sequence* grddl_xslt_cache;
+
   /* Flags for libxml set by raptor_world_set_libxml_flags().
    * See #raptor_libxml_flags for meanings 
    */
@@ -1464,7 +1812,34 @@ struct raptor_world_s {
   xmlGenericErrorFunc libxml_saved_generic_error_handler;
 #endif  
 
-  raptor_avltree *uris_tree;
+  /* open addressing hash table of interned URIs */
+  struct raptor_uri_intern_table_s *uris_table;
+
+  /* open addressing hash table of interned terms */
+  struct raptor_term_intern_table_s *terms_table;
+
+  /* direct-mapped cache of recent relative URI resolutions */
+  struct raptor_uri_resolve_cache_s *uri_resolve_cache;
+
+  /* direct-mapped cache of recent relative URI generations */
+  struct raptor_uri_relative_cache_s *uri_relative_cache;
+
+  /* direct-mapped cache of recently NFC-validated strings; lazily
+   * allocated by raptor_world_check_utf8_nfc_string() */
+  raptor_nfc_cache_slot *nfc_cache;
+
+  /* free lists recycling fixed-size raptor_term / raptor_statement
+   * allocations; chained through the first pointer-sized field of
+   * each freed object */
+  void *term_pool;
+  int term_pool_size;
+  void *statement_pool;
+  int statement_pool_size;
+
+  /* recycled transient buffers handed out by
+   * raptor_world_borrow_scratch(); each slot points at a base block
+   * carrying its capacity in a leading size_t */
+  unsigned char* scratch_buffers[RAPTOR_WORLD_SCRATCH_BUFFERS];
 
   raptor_uri* concepts[RDF_NS_LAST + 1];
 
@@ -1476,6 +1851,9 @@ struct raptor_world_s {
   /* should */
   int uri_interning;
 
+  /* non-0 to share identical URI / literal terms (default off) */
+  int term_interning;
+
   /* generate blank node ID policy */
   void *generate_bnodeid_handler_user_data;
   raptor_generate_bnodeid_handler generate_bnodeid_handler;
@@ -1483,14 +1861,48 @@ struct raptor_world_s {
   int default_generate_bnodeid_handler_base;
   char *default_generate_bnodeid_handler_prefix;
   unsigned int default_generate_bnodeid_handler_prefix_length;
+  /* bumped when the parameters above change so parsers discard
+   * bulk-reserved ID ranges taken under the old base */
+  int default_generate_bnodeid_handler_generation;
 
   raptor_uri* xsd_namespace_uri;
-  raptor_uri* xsd_boolean_uri;
-  raptor_uri* xsd_decimal_uri;
-  raptor_uri* xsd_double_uri;
-  raptor_uri* xsd_integer_uri;
+
+  /* xsd:* datatype URIs and URI terms indexed by #raptor_xsd_datatype;
+   * entry RAPTOR_XSD_DATATYPE_NONE is NULL */
+  raptor_uri* xsd_datatype_uris[RAPTOR_XSD_DATATYPE_LAST + 1];
+  raptor_term* xsd_datatype_terms[RAPTOR_XSD_DATATYPE_LAST + 1];
 };
 
+/* Guard shared world state (intern tables, caches, pools, counters).
+ * No-ops unless RAPTOR_WORLD_FLAG_THREAD_SAFE was set on the world.
+ * The mutex is recursive so locked sections may nest - e.g. interning
+ * a URI term copies an interned URI while the lock is held.
+ */
+#ifdef HAVE_PTHREAD_H
+#define RAPTOR_WORLD_LOCK(world)                \
+  do {                                          \
+    if((world)->thread_safe)                    \
+      pthread_mutex_lock(&(world)->mutex);      \
+  } while(0)
+#define RAPTOR_WORLD_UNLOCK(world)              \
+  do {                                          \
+    if((world)->thread_safe)                    \
+      pthread_mutex_unlock(&(world)->mutex);    \
+  } while(0)
+#else
+#define RAPTOR_WORLD_LOCK(world)
+#define RAPTOR_WORLD_UNLOCK(world)
+#endif
+
+/* raptor_statement.c */
+void raptor_statement_finish(raptor_world* world);
+
+/* raptor_term.c */
+int raptor_term_init(raptor_world* world);
+void raptor_term_finish(raptor_world* world);
+unsigned char* raptor_term_detach_literal_string(raptor_term* term);
+unsigned long raptor_hash_finalize(unsigned long hash);
+
 /* raptor_www.c */
 int raptor_www_init(raptor_world* world);
 void raptor_www_finish(raptor_world* world);
@@ -35,6 +35,16 @@
 #include "raptor2.h"
 #include "raptor_internal.h"
 
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#ifndef ZSTD_CLEVEL_DEFAULT
+#define ZSTD_CLEVEL_DEFAULT 3
+#endif
+#endif
+
 
 #ifndef STANDALONE
 
@@ -44,6 +54,9 @@
 #define RAPTOR_IOSTREAM_FLAGS_EOF           1
 #define RAPTOR_IOSTREAM_FLAGS_FREE_HANDLER  2
 
+/* initial size of the cork buffer */
+#define RAPTOR_IOSTREAM_CORK_INITIAL_SIZE 1024
+
 struct raptor_iostream_s
 {
   raptor_world *world;
@@ -53,6 +66,13 @@ struct raptor_iostream_s
   size_t offset;
   unsigned int mode;
   int flags;
+
+  /* while non-0 writes accumulate in @cork_buffer - see
+   * raptor_iostream_cork() */
+  int corked;
+  unsigned char *cork_buffer;
+  size_t cork_length;
+  size_t cork_capacity;
 };
 
 
@@ -75,6 +95,10 @@ raptor_iostream_calculate_modes(const raptor_iostream_handler * const handler)
      (handler->write_byte || handler->write_bytes))
     mode |= RAPTOR_IOSTREAM_MODE_WRITE;
 
+  /* API V3 checks */
+  if((handler->version >= 3) && handler->write_bytes_v)
+    mode |= RAPTOR_IOSTREAM_MODE_WRITE;
+
   return mode;
 }
 
@@ -86,7 +110,7 @@ raptor_iostream_check_handler(const raptor_iostream_handler * const handler,
 {
   int mode;
 
-  if(handler->version < 1 || handler->version > 2)
+  if(handler->version < 1 || handler->version > 3)
     return 0;
 
   mode = raptor_iostream_calculate_modes(handler);
@@ -169,15 +193,29 @@ raptor_sink_iostream_read_eof(void *user_data)
   return 1; /* EOF always */
 }
 
+static int
+raptor_sink_iostream_write_bytes_v(void *user_data, const raptor_iovec *vec,
+                                   size_t count)
+{
+  size_t total = 0;
+  size_t i;
+
+  for(i = 0; i < count; i++)
+    total += vec[i].length;
+
+  return RAPTOR_BAD_CAST(int, total); /* success */
+}
+
 static const raptor_iostream_handler raptor_iostream_sink_handler = {
-  /* .version     = */ 2,
-  /* .init        = */ NULL,
-  /* .finish      = */ NULL,
-  /* .write_byte  = */ raptor_sink_iostream_write_byte,
-  /* .write_bytes = */ raptor_sink_iostream_write_bytes,
-  /* .write_end   = */ NULL,
-  /* .read_bytes  = */ raptor_sink_iostream_read_bytes,
-  /* .read_eof    = */ raptor_sink_iostream_read_eof
+  /* .version       = */ 3,
+  /* .init          = */ NULL,
+  /* .finish        = */ NULL,
+  /* .write_byte    = */ raptor_sink_iostream_write_byte,
+  /* .write_bytes   = */ raptor_sink_iostream_write_bytes,
+  /* .write_end     = */ NULL,
+  /* .read_bytes    = */ raptor_sink_iostream_read_bytes,
+  /* .read_eof      = */ raptor_sink_iostream_read_eof,
+  /* .write_bytes_v = */ raptor_sink_iostream_write_bytes_v
 };
 
 
@@ -250,6 +288,197 @@ raptor_filename_iostream_read_eof(void *user_data)
   return feof(handle);
 }
 
+#ifdef HAVE_ZLIB
+struct raptor_gzip_write_iostream_context {
+  gzFile handle;
+};
+
+
+static void
+raptor_gzip_write_iostream_finish(void *user_data)
+{
+  struct raptor_gzip_write_iostream_context* con;
+
+  con = (struct raptor_gzip_write_iostream_context*)user_data;
+  if(con->handle)
+    gzclose(con->handle);
+  RAPTOR_FREE(raptor_gzip_write_iostream_context*, con);
+}
+
+static int
+raptor_gzip_write_iostream_write_byte(void *user_data, const int byte)
+{
+  struct raptor_gzip_write_iostream_context* con;
+
+  con = (struct raptor_gzip_write_iostream_context*)user_data;
+  return (gzputc(con->handle, byte) == byte);
+}
+
+static int
+raptor_gzip_write_iostream_write_bytes(void *user_data,
+                                       const void *ptr, size_t size,
+                                       size_t nmemb)
+{
+  struct raptor_gzip_write_iostream_context* con;
+  int bytes;
+
+  con = (struct raptor_gzip_write_iostream_context*)user_data;
+  bytes = gzwrite(con->handle, ptr,
+                  RAPTOR_BAD_CAST(unsigned int, size * nmemb));
+  if(bytes <= 0)
+    return 0;
+
+  return bytes / RAPTOR_BAD_CAST(int, size);
+}
+
+static int
+raptor_gzip_write_iostream_write_end(void *user_data)
+{
+  struct raptor_gzip_write_iostream_context* con;
+  int rc = 0;
+
+  con = (struct raptor_gzip_write_iostream_context*)user_data;
+  if(con->handle) {
+    rc = (gzclose(con->handle) != Z_OK);
+    con->handle = NULL;
+  }
+
+  return rc;
+}
+
+static const raptor_iostream_handler raptor_iostream_write_gzip_handler = {
+  /* .version     = */ 2,
+  /* .init        = */ NULL,
+  /* .finish      = */ raptor_gzip_write_iostream_finish,
+  /* .write_byte  = */ raptor_gzip_write_iostream_write_byte,
+  /* .write_bytes = */ raptor_gzip_write_iostream_write_bytes,
+  /* .write_end   = */ raptor_gzip_write_iostream_write_end,
+  /* .read_bytes  = */ NULL,
+  /* .read_eof    = */ NULL
+};
+#endif /* HAVE_ZLIB */
+
+
+#ifdef HAVE_ZSTD
+struct raptor_zstd_write_iostream_context {
+  FILE* handle;
+  ZSTD_CStream* stream;
+  /* output staging buffer of the compressor's preferred size */
+  unsigned char* out_buffer;
+  size_t out_capacity;
+};
+
+
+/* INTERNAL - free zstd compression write state without flushing */
+static void
+raptor_zstd_write_iostream_free(struct raptor_zstd_write_iostream_context* con)
+{
+  if(con->stream)
+    ZSTD_freeCStream(con->stream);
+  if(con->handle)
+    fclose(con->handle);
+  if(con->out_buffer)
+    RAPTOR_FREE(unsigned char*, con->out_buffer);
+  RAPTOR_FREE(raptor_zstd_write_iostream_context*, con);
+}
+
+static void
+raptor_zstd_write_iostream_finish(void *user_data)
+{
+  raptor_zstd_write_iostream_free((struct raptor_zstd_write_iostream_context*)user_data);
+}
+
+static int
+raptor_zstd_write_iostream_write_bytes(void *user_data,
+                                       const void *ptr, size_t size,
+                                       size_t nmemb)
+{
+  struct raptor_zstd_write_iostream_context* con;
+  ZSTD_inBuffer in;
+
+  con = (struct raptor_zstd_write_iostream_context*)user_data;
+
+  in.src = ptr;
+  in.size = size * nmemb;
+  in.pos = 0;
+
+  while(in.pos < in.size) {
+    ZSTD_outBuffer out;
+    size_t rc;
+
+    out.dst = con->out_buffer;
+    out.size = con->out_capacity;
+    out.pos = 0;
+
+    rc = ZSTD_compressStream(con->stream, &out, &in);
+    if(ZSTD_isError(rc))
+      return 0;
+
+    if(out.pos && fwrite(con->out_buffer, 1, out.pos, con->handle) != out.pos)
+      return 0;
+  }
+
+  return RAPTOR_BAD_CAST(int, nmemb);
+}
+
+static int
+raptor_zstd_write_iostream_write_byte(void *user_data, const int byte)
+{
+  const unsigned char c = (unsigned char)byte;
+
+  return (raptor_zstd_write_iostream_write_bytes(user_data, &c, 1, 1) == 1);
+}
+
+static int
+raptor_zstd_write_iostream_write_end(void *user_data)
+{
+  struct raptor_zstd_write_iostream_context* con;
+  size_t remaining;
+  int rc = 0;
+
+  con = (struct raptor_zstd_write_iostream_context*)user_data;
+  if(!con->handle)
+    return 0;
+
+  do {
+    ZSTD_outBuffer out;
+
+    out.dst = con->out_buffer;
+    out.size = con->out_capacity;
+    out.pos = 0;
+
+    remaining = ZSTD_endStream(con->stream, &out);
+    if(ZSTD_isError(remaining)) {
+      rc = 1;
+      break;
+    }
+
+    if(out.pos && fwrite(con->out_buffer, 1, out.pos, con->handle) != out.pos) {
+      rc = 1;
+      break;
+    }
+  } while(remaining > 0);
+
+  if(fclose(con->handle))
+    rc = 1;
+  con->handle = NULL;
+
+  return rc;
+}
+
+static const raptor_iostream_handler raptor_iostream_write_zstd_handler = {
+  /* .version     = */ 2,
+  /* .init        = */ NULL,
+  /* .finish      = */ raptor_zstd_write_iostream_finish,
+  /* .write_byte  = */ raptor_zstd_write_iostream_write_byte,
+  /* .write_bytes = */ raptor_zstd_write_iostream_write_bytes,
+  /* .write_end   = */ raptor_zstd_write_iostream_write_end,
+  /* .read_bytes  = */ NULL,
+  /* .read_eof    = */ NULL
+};
+#endif /* HAVE_ZSTD */
+
+
 static const raptor_iostream_handler raptor_iostream_write_filename_handler = {
   /* .version     = */ 2,
   /* .init        = */ NULL,
@@ -314,6 +543,130 @@ raptor_new_iostream_to_filename(raptor_world *world, const char *filename)
 }
 
 
+/**
+ * raptor_new_iostream_to_compressed_filename:
+ * @world: raptor world
+ * @filename: Output filename to open and write compressed output to
+ * @compression_level: compression level (1-9 for gzip, 1-22 for zstd) or 0 or negative for the compressor default
+ *
+ * Constructor - create a new iostream writing compressed output to a filename.
+ *
+ * The compression format is chosen from the @filename suffix: ".gz"
+ * for gzip and ".zst" for zstd.  A filename with any other suffix
+ * gets plain uncompressed output as with
+ * raptor_new_iostream_to_filename().  Compressed data is staged in an
+ * internal buffer sized for the compressor, so the stream can be the
+ * target of raptor_serializer_start_to_iostream() without further
+ * buffering.
+ *
+ * Requires raptor to be built with the matching compression library;
+ * returns NULL when the format for @filename is not available.
+ *
+ * Return value: new #raptor_iostream object or NULL on failure
+ **/
+raptor_iostream*
+raptor_new_iostream_to_compressed_filename(raptor_world *world,
+                                           const char *filename,
+                                           int compression_level)
+{
+  size_t len;
+
+  RAPTOR_CHECK_CONSTRUCTOR_WORLD(world);
+
+  raptor_world_open(world);
+
+  if(!filename)
+    return NULL;
+
+  len = strlen(filename);
+
+  if(len > 3 && !strcmp(filename + len - 3, ".gz")) {
+#ifdef HAVE_ZLIB
+    struct raptor_gzip_write_iostream_context* con;
+    raptor_iostream* iostr;
+    char gz_mode[4] = "wb";
+
+    if(compression_level >= 1 && compression_level <= 9) {
+      gz_mode[2] = (char)('0' + compression_level);
+      gz_mode[3] = '\0';
+    }
+
+    con = RAPTOR_CALLOC(struct raptor_gzip_write_iostream_context*, 1,
+                        sizeof(*con));
+    if(!con)
+      return NULL;
+
+    con->handle = gzopen(filename, gz_mode);
+    if(!con->handle) {
+      RAPTOR_FREE(raptor_gzip_write_iostream_context*, con);
+      return NULL;
+    }
+
+    iostr = RAPTOR_CALLOC(raptor_iostream*, 1, sizeof(*iostr));
+    if(!iostr) {
+      gzclose(con->handle);
+      RAPTOR_FREE(raptor_gzip_write_iostream_context*, con);
+      return NULL;
+    }
+
+    iostr->world = world;
+    iostr->handler = &raptor_iostream_write_gzip_handler;
+    iostr->user_data = (void*)con;
+    iostr->mode = RAPTOR_IOSTREAM_MODE_WRITE;
+
+    return iostr;
+#else
+    return NULL;
+#endif
+  }
+
+  if(len > 4 && !strcmp(filename + len - 4, ".zst")) {
+#ifdef HAVE_ZSTD
+    struct raptor_zstd_write_iostream_context* con;
+    raptor_iostream* iostr;
+
+    con = RAPTOR_CALLOC(struct raptor_zstd_write_iostream_context*, 1,
+                        sizeof(*con));
+    if(!con)
+      return NULL;
+
+    con->stream = ZSTD_createCStream();
+    con->out_capacity = ZSTD_CStreamOutSize();
+    con->out_buffer = RAPTOR_MALLOC(unsigned char*, con->out_capacity);
+    con->handle = fopen(filename, "wb");
+    if(!con->stream || !con->out_buffer || !con->handle) {
+      raptor_zstd_write_iostream_free(con);
+      return NULL;
+    }
+
+    if(compression_level < 1)
+      compression_level = ZSTD_CLEVEL_DEFAULT;
+    if(ZSTD_isError(ZSTD_initCStream(con->stream, compression_level))) {
+      raptor_zstd_write_iostream_free(con);
+      return NULL;
+    }
+
+    iostr = RAPTOR_CALLOC(raptor_iostream*, 1, sizeof(*iostr));
+    if(!iostr) {
+      raptor_zstd_write_iostream_free(con);
+      return NULL;
+    }
+
+    iostr->world = world;
+    iostr->handler = &raptor_iostream_write_zstd_handler;
+    iostr->user_data = (void*)con;
+    iostr->mode = RAPTOR_IOSTREAM_MODE_WRITE;
+
+    return iostr;
+#else
+    return NULL;
+#endif
+  }
+
+  return raptor_new_iostream_to_filename(world, filename);
+}
+
+
 static const raptor_iostream_handler raptor_iostream_write_file_handler = {
   /* .version     = */ 2,
   /* .init        = */ NULL,
@@ -555,6 +908,203 @@ raptor_new_iostream_from_sink(raptor_world *world)
 }
 
 
+#ifdef HAVE_ZLIB
+static void
+raptor_gzip_iostream_finish(void *user_data)
+{
+  gzclose((gzFile)user_data);
+}
+
+static int
+raptor_gzip_iostream_read_bytes(void *user_data,
+                                void *ptr, size_t size, size_t nmemb)
+{
+  gzFile handle = (gzFile)user_data;
+  int bytes;
+
+  bytes = gzread(handle, ptr, RAPTOR_BAD_CAST(unsigned int, size * nmemb));
+  if(bytes <= 0)
+    return 0;
+
+  return bytes / RAPTOR_BAD_CAST(int, size);
+}
+
+static int
+raptor_gzip_iostream_read_eof(void *user_data)
+{
+  return gzeof((gzFile)user_data);
+}
+
+static const raptor_iostream_handler raptor_iostream_read_gzip_handler = {
+  /* .version     = */ 2,
+  /* .init        = */ NULL,
+  /* .finish      = */ raptor_gzip_iostream_finish,
+  /* .write_byte  = */ NULL,
+  /* .write_bytes = */ NULL,
+  /* .write_end   = */ NULL,
+  /* .read_bytes  = */ raptor_gzip_iostream_read_bytes,
+  /* .read_eof    = */ raptor_gzip_iostream_read_eof
+};
+
+
+/* INTERNAL - make a decompressing iostream over a gzip compressed file */
+static raptor_iostream*
+raptor_new_iostream_from_gzip_filename(raptor_world *world,
+                                       const char *filename)
+{
+  gzFile handle;
+  raptor_iostream* iostr;
+
+  handle = gzopen(filename, "rb");
+  if(!handle)
+    return NULL;
+
+  iostr = RAPTOR_CALLOC(raptor_iostream*, 1, sizeof(*iostr));
+  if(!iostr) {
+    gzclose(handle);
+    return NULL;
+  }
+
+  iostr->world = world;
+  iostr->handler = &raptor_iostream_read_gzip_handler;
+  iostr->user_data = (void*)handle;
+  iostr->mode = RAPTOR_IOSTREAM_MODE_READ;
+
+  return iostr;
+}
+#endif /* HAVE_ZLIB */
+
+
+#ifdef HAVE_ZSTD
+/* Input buffer size for streaming zstd decompression */
+#define RAPTOR_ZSTD_IN_BUFFER_SIZE (128 * 1024)
+
+struct raptor_zstd_iostream_context {
+  FILE* handle;
+  ZSTD_DStream* stream;
+  unsigned char* in_buffer;
+  ZSTD_inBuffer in;
+  /* no more bytes to read from handle */
+  int input_eof;
+  /* last ZSTD_decompressStream() return; 0 means frame complete */
+  size_t pending;
+};
+
+
+static void
+raptor_zstd_iostream_finish(void *user_data)
+{
+  struct raptor_zstd_iostream_context* con;
+
+  con = (struct raptor_zstd_iostream_context*)user_data;
+  ZSTD_freeDStream(con->stream);
+  fclose(con->handle);
+  RAPTOR_FREE(unsigned char*, con->in_buffer);
+  RAPTOR_FREE(raptor_zstd_iostream_context*, con);
+}
+
+static int
+raptor_zstd_iostream_read_bytes(void *user_data,
+                                void *ptr, size_t size, size_t nmemb)
+{
+  struct raptor_zstd_iostream_context* con;
+  ZSTD_outBuffer out;
+
+  con = (struct raptor_zstd_iostream_context*)user_data;
+
+  out.dst = ptr;
+  out.size = size * nmemb;
+  out.pos = 0;
+
+  while(out.pos < out.size) {
+    size_t rc;
+
+    if(con->in.pos >= con->in.size) {
+      if(con->input_eof)
+        break;
+      con->in.size = fread(con->in_buffer, 1, RAPTOR_ZSTD_IN_BUFFER_SIZE,
+                           con->handle);
+      con->in.pos = 0;
+      if(!con->in.size) {
+        con->input_eof = 1;
+        break;
+      }
+    }
+
+    rc = ZSTD_decompressStream(con->stream, &out, &con->in);
+    if(ZSTD_isError(rc))
+      return 0;
+    con->pending = rc;
+  }
+
+  return RAPTOR_BAD_CAST(int, out.pos / size);
+}
+
+static int
+raptor_zstd_iostream_read_eof(void *user_data)
+{
+  struct raptor_zstd_iostream_context* con;
+
+  con = (struct raptor_zstd_iostream_context*)user_data;
+  return con->input_eof && con->in.pos >= con->in.size && !con->pending;
+}
+
+static const raptor_iostream_handler raptor_iostream_read_zstd_handler = {
+  /* .version     = */ 2,
+  /* .init        = */ NULL,
+  /* .finish      = */ raptor_zstd_iostream_finish,
+  /* .write_byte  = */ NULL,
+  /* .write_bytes = */ NULL,
+  /* .write_end   = */ NULL,
+  /* .read_bytes  = */ raptor_zstd_iostream_read_bytes,
+  /* .read_eof    = */ raptor_zstd_iostream_read_eof
+};
+
+
+/* INTERNAL - make a decompressing iostream over an open zstd
+ * compressed file positioned at the start; takes ownership of @handle
+ */
+static raptor_iostream*
+raptor_new_iostream_from_zstd_file_handle(raptor_world *world, FILE* handle)
+{
+  struct raptor_zstd_iostream_context* con;
+  raptor_iostream* iostr;
+
+  con = RAPTOR_CALLOC(struct raptor_zstd_iostream_context*, 1, sizeof(*con));
+  if(!con)
+    return NULL;
+
+  con->handle = handle;
+  con->stream = ZSTD_createDStream();
+  con->in_buffer = RAPTOR_MALLOC(unsigned char*, RAPTOR_ZSTD_IN_BUFFER_SIZE);
+  if(!con->stream || !con->in_buffer) {
+    if(con->stream)
+      ZSTD_freeDStream(con->stream);
+    if(con->in_buffer)
+      RAPTOR_FREE(unsigned char*, con->in_buffer);
+    RAPTOR_FREE(raptor_zstd_iostream_context*, con);
+    return NULL;
+  }
+  con->in.src = con->in_buffer;
+
+  iostr = RAPTOR_CALLOC(raptor_iostream*, 1, sizeof(*iostr));
+  if(!iostr) {
+    ZSTD_freeDStream(con->stream);
+    RAPTOR_FREE(unsigned char*, con->in_buffer);
+    RAPTOR_FREE(raptor_zstd_iostream_context*, con);
+    return NULL;
+  }
+
+  iostr->world = world;
+  iostr->handler = &raptor_iostream_read_zstd_handler;
+  iostr->user_data = (void*)con;
+  iostr->mode = RAPTOR_IOSTREAM_MODE_READ;
+
+  return iostr;
+}
+#endif /* HAVE_ZSTD */
+
+
 static const raptor_iostream_handler raptor_iostream_read_filename_handler = {
   /* .version     = */ 2,
   /* .init        = */ NULL,
@@ -598,7 +1148,30 @@ raptor_new_iostream_from_filename(raptor_world *world, const char *filename)
   handle = fopen(filename, "rb");
   if(!handle)
     return NULL;
-  
+
+#if defined(HAVE_ZLIB) || defined(HAVE_ZSTD)
+  /* transparently decompress compressed content, detected by magic bytes */
+  {
+    unsigned char magic[4];
+    size_t magic_len = fread(magic, 1, sizeof(magic), handle);
+
+#ifdef HAVE_ZLIB
+    if(magic_len >= 2 && magic[0] == 0x1F && magic[1] == 0x8B) {
+      fclose(handle);
+      return raptor_new_iostream_from_gzip_filename(world, filename);
+    }
+#endif
+#ifdef HAVE_ZSTD
+    if(magic_len == 4 && magic[0] == 0x28 && magic[1] == 0xB5 &&
+       magic[2] == 0x2F && magic[3] == 0xFD) {
+      rewind(handle);
+      return raptor_new_iostream_from_zstd_file_handle(world, handle);
+    }
+#endif
+    rewind(handle);
+  }
+#endif
+
   iostr = RAPTOR_CALLOC(raptor_iostream*, 1, sizeof(*iostr));
   if(!iostr) {
     fclose(handle);
@@ -619,6 +1192,351 @@ raptor_new_iostream_from_filename(raptor_world *world, const char *filename)
 }
 
 
+#ifdef HAVE_PTHREAD_H
+
+/* Local handlers for reading from a filename with a read-ahead thread.
+ *
+ * A background thread fills two buffers alternately while the
+ * consumer drains them in order, so disk reads overlap parsing
+ * instead of being serial with it.
+ */
+
+#define RAPTOR_READ_AHEAD_DEFAULT_BUFFER_SIZE (1 << 20)
+
+struct raptor_read_ahead_iostream_context {
+  FILE* handle;
+
+  pthread_t thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+
+  size_t buffer_size;
+  unsigned char* buffers[2];
+  size_t lens[2];     /* valid bytes in each buffer */
+  int full[2];        /* buffer holds unconsumed data */
+
+  int finished;       /* producer will fill no more buffers */
+  int failed;         /* producer saw a read error */
+  int stop;           /* consumer is shutting down */
+
+  /* consumer side */
+  int read_index;     /* buffer currently being drained */
+  size_t read_offset; /* bytes of it already consumed */
+
+  int owns_handle;    /* non-0 to fclose the handle at finish */
+};
+
+
+static void*
+raptor_read_ahead_iostream_run(void* arg)
+{
+  struct raptor_read_ahead_iostream_context* con;
+  int w = 0;
+
+  con = (struct raptor_read_ahead_iostream_context*)arg;
+
+  while(1) {
+    size_t n;
+
+    pthread_mutex_lock(&con->mutex);
+    while(con->full[w] && !con->stop)
+      pthread_cond_wait(&con->cond, &con->mutex);
+    if(con->stop) {
+      pthread_mutex_unlock(&con->mutex);
+      return NULL;
+    }
+    pthread_mutex_unlock(&con->mutex);
+
+    /* the consumer never touches an empty buffer so reading outside
+     * the lock is safe */
+    n = fread(con->buffers[w], 1, con->buffer_size, con->handle);
+
+    pthread_mutex_lock(&con->mutex);
+    con->lens[w] = n;
+    con->full[w] = 1;
+    if(n < con->buffer_size) {
+      if(ferror(con->handle))
+        con->failed = 1;
+      con->finished = 1;
+    }
+    pthread_cond_signal(&con->cond);
+    pthread_mutex_unlock(&con->mutex);
+
+    if(n < con->buffer_size)
+      return NULL;
+
+    w ^= 1;
+  }
+}
+
+
+static void
+raptor_read_ahead_iostream_finish(void *user_data)
+{
+  struct raptor_read_ahead_iostream_context* con;
+
+  con = (struct raptor_read_ahead_iostream_context*)user_data;
+
+  pthread_mutex_lock(&con->mutex);
+  con->stop = 1;
+  pthread_cond_broadcast(&con->cond);
+  pthread_mutex_unlock(&con->mutex);
+  pthread_join(con->thread, NULL);
+
+  pthread_cond_destroy(&con->cond);
+  pthread_mutex_destroy(&con->mutex);
+
+  if(con->buffers[0])
+    RAPTOR_FREE(char*, con->buffers[0]);
+  if(con->buffers[1])
+    RAPTOR_FREE(char*, con->buffers[1]);
+  if(con->owns_handle)
+    fclose(con->handle);
+  RAPTOR_FREE(raptor_read_ahead_iostream_context, con);
+}
+
+
+static int
+raptor_read_ahead_iostream_read_bytes(void *user_data,
+                                      void *ptr, size_t size, size_t nmemb)
+{
+  struct raptor_read_ahead_iostream_context* con;
+  size_t wanted = size * nmemb;
+  size_t copied = 0;
+
+  con = (struct raptor_read_ahead_iostream_context*)user_data;
+
+  while(copied < wanted) {
+    int r = con->read_index;
+    size_t available;
+
+    pthread_mutex_lock(&con->mutex);
+    while(!con->full[r] && !con->finished)
+      pthread_cond_wait(&con->cond, &con->mutex);
+    if(!con->full[r]) {
+      /* producer finished and this buffer will never fill - EOF */
+      pthread_mutex_unlock(&con->mutex);
+      break;
+    }
+    available = con->lens[r] - con->read_offset;
+    pthread_mutex_unlock(&con->mutex);
+
+    if(available) {
+      size_t len = wanted - copied;
+      if(len > available)
+        len = available;
+      memcpy((unsigned char*)ptr + copied,
+             con->buffers[r] + con->read_offset, len);
+      con->read_offset += len;
+      copied += len;
+    }
+
+    if(con->read_offset == con->lens[r]) {
+      /* hand the drained buffer back to the producer */
+      pthread_mutex_lock(&con->mutex);
+      con->full[r] = 0;
+      pthread_cond_signal(&con->cond);
+      pthread_mutex_unlock(&con->mutex);
+      con->read_index = r ^ 1;
+      con->read_offset = 0;
+
+      if(!available)
+        break; /* final zero-length buffer - EOF */
+    }
+  }
+
+  return RAPTOR_BAD_CAST(int, copied / size);
+}
+
+
+static int
+raptor_read_ahead_iostream_read_eof(void *user_data)
+{
+  struct raptor_read_ahead_iostream_context* con;
+  int is_eof;
+
+  con = (struct raptor_read_ahead_iostream_context*)user_data;
+
+  pthread_mutex_lock(&con->mutex);
+  is_eof = con->finished &&
+           !con->full[con->read_index] && !con->full[con->read_index ^ 1];
+  pthread_mutex_unlock(&con->mutex);
+
+  return is_eof;
+}
+
+
+static const raptor_iostream_handler raptor_iostream_read_ahead_filename_handler = {
+  /* .version     = */ 2,
+  /* .init        = */ NULL,
+  /* .finish      = */ raptor_read_ahead_iostream_finish,
+  /* .write_byte  = */ NULL,
+  /* .write_bytes = */ NULL,
+  /* .write_end   = */ NULL,
+  /* .read_bytes  = */ raptor_read_ahead_iostream_read_bytes,
+  /* .read_eof    = */ raptor_read_ahead_iostream_read_eof
+};
+
+#endif /* HAVE_PTHREAD_H */
+
+
+/**
+ * raptor_new_iostream_from_file_handle_read_ahead:
+ * @world: raptor world
+ * @handle: Input file handle, open for reading
+ * @buffer_size: read-ahead buffer size in bytes
+ * @owns_handle: non-0 for the iostream to fclose @handle when finished
+ *
+ * INTERNAL - Constructor - create an iostream reading a file handle ahead of the consumer.
+ *
+ * Unlike the public filename constructor this does not fall back:
+ * when threads are unavailable or the reader cannot be started it
+ * returns NULL (leaving @handle untouched) so the caller can read the
+ * handle itself.
+ *
+ * Return value: new #raptor_iostream object or NULL on failure
+ **/
+raptor_iostream*
+raptor_new_iostream_from_file_handle_read_ahead(raptor_world *world,
+                                                FILE *handle,
+                                                size_t buffer_size,
+                                                int owns_handle)
+{
+#ifdef HAVE_PTHREAD_H
+  raptor_iostream* iostr = NULL;
+  struct raptor_read_ahead_iostream_context* con = NULL;
+  int mutex_initialized = 0;
+  int cond_initialized = 0;
+
+  if(!handle || !buffer_size)
+    return NULL;
+
+  con = RAPTOR_CALLOC(struct raptor_read_ahead_iostream_context*, 1,
+                      sizeof(*con));
+  if(!con)
+    return NULL;
+
+  con->handle = handle;
+  con->owns_handle = owns_handle;
+  con->buffer_size = buffer_size;
+  con->buffers[0] = RAPTOR_MALLOC(unsigned char*, buffer_size);
+  con->buffers[1] = RAPTOR_MALLOC(unsigned char*, buffer_size);
+  if(!con->buffers[0] || !con->buffers[1])
+    goto failed;
+
+  if(pthread_mutex_init(&con->mutex, NULL))
+    goto failed;
+  mutex_initialized = 1;
+  if(pthread_cond_init(&con->cond, NULL))
+    goto failed;
+  cond_initialized = 1;
+
+  iostr = RAPTOR_CALLOC(raptor_iostream*, 1, sizeof(*iostr));
+  if(!iostr)
+    goto failed;
+
+  iostr->world = world;
+  iostr->handler = &raptor_iostream_read_ahead_filename_handler;
+  iostr->user_data = (void*)con;
+  iostr->mode = RAPTOR_IOSTREAM_MODE_READ;
+
+  if(pthread_create(&con->thread, NULL,
+                    raptor_read_ahead_iostream_run, con))
+    goto failed;
+
+  return iostr;
+
+  failed:
+  if(iostr)
+    RAPTOR_FREE(raptor_iostream, iostr);
+  if(cond_initialized)
+    pthread_cond_destroy(&con->cond);
+  if(mutex_initialized)
+    pthread_mutex_destroy(&con->mutex);
+  if(con->buffers[0])
+    RAPTOR_FREE(char*, con->buffers[0]);
+  if(con->buffers[1])
+    RAPTOR_FREE(char*, con->buffers[1]);
+  RAPTOR_FREE(raptor_read_ahead_iostream_context, con);
+  return NULL;
+#else
+  return NULL;
+#endif
+}
+
+
+/**
+ * raptor_new_iostream_from_filename_read_ahead:
+ * @world: raptor world
+ * @filename: Input filename to open and read from
+ * @buffer_size: read-ahead buffer size in bytes (0 for a default)
+ *
+ * Constructor - create a new iostream reading from a filename ahead of the consumer.
+ *
+ * A background thread keeps up to two buffers of @buffer_size bytes
+ * filled from the file while the consumer drains them, so disk reads
+ * overlap parsing instead of alternating with it.  When threads are
+ * not available, the file is compressed, or starting the reader
+ * fails, this falls back to the equivalent of
+ * raptor_new_iostream_from_filename() so callers can use it
+ * unconditionally.
+ *
+ * Return value: new #raptor_iostream object or NULL on failure
+ **/
+raptor_iostream*
+raptor_new_iostream_from_filename_read_ahead(raptor_world *world,
+                                             const char *filename,
+                                             size_t buffer_size)
+{
+#ifdef HAVE_PTHREAD_H
+  FILE *handle;
+  raptor_iostream* iostr;
+
+  RAPTOR_CHECK_CONSTRUCTOR_WORLD(world);
+
+  if(!filename)
+    return NULL;
+
+  raptor_world_open(world);
+
+  if(!buffer_size)
+    buffer_size = RAPTOR_READ_AHEAD_DEFAULT_BUFFER_SIZE;
+
+  handle = fopen(filename, "rb");
+  if(!handle)
+    return NULL;
+
+#if defined(HAVE_ZLIB) || defined(HAVE_ZSTD)
+  /* compressed content needs the decompressing handlers - let the
+   * plain constructor dispatch it */
+  {
+    unsigned char magic[4];
+    size_t magic_len = fread(magic, 1, sizeof(magic), handle);
+
+    if((magic_len >= 2 && magic[0] == 0x1F && magic[1] == 0x8B) ||
+       (magic_len == 4 && magic[0] == 0x28 && magic[1] == 0xB5 &&
+        magic[2] == 0x2F && magic[3] == 0xFD)) {
+      fclose(handle);
+      return raptor_new_iostream_from_filename(world, filename);
+    }
+    rewind(handle);
+  }
+#endif
+
+  iostr = raptor_new_iostream_from_file_handle_read_ahead(world, handle,
+                                                          buffer_size, 1);
+  if(!iostr) {
+    fclose(handle);
+    return raptor_new_iostream_from_filename(world, filename);
+  }
+
+  return iostr;
+#else
+  return raptor_new_iostream_from_filename(world, filename);
+#endif
+}
+
+
 static const raptor_iostream_handler raptor_iostream_read_file_handle_handler = {
   /* .version     = */ 2,
   /* .init        = */ NULL,
@@ -691,6 +1609,12 @@ raptor_free_iostream(raptor_iostream *iostr)
   if(!iostr)
     return;
   
+  if(iostr->corked)
+    raptor_iostream_uncork(iostr);
+
+  if(iostr->cork_buffer)
+    RAPTOR_FREE(char*, iostr->cork_buffer);
+
   if(iostr->flags & RAPTOR_IOSTREAM_FLAGS_EOF)
     raptor_iostream_write_end(iostr);
 
@@ -705,6 +1629,114 @@ raptor_free_iostream(raptor_iostream *iostr)
 
 
 
+/*
+ * raptor_iostream_cork_append:
+ * @iostr: raptor iostream
+ * @ptr: bytes to buffer
+ * @len: number of bytes
+ *
+ * INTERNAL - Append bytes to the cork buffer, growing it as needed.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_iostream_cork_append(raptor_iostream *iostr,
+                            const void *ptr, size_t len)
+{
+  if(iostr->cork_length + len > iostr->cork_capacity) {
+    size_t new_capacity = iostr->cork_capacity;
+    unsigned char *new_buffer;
+
+    if(!new_capacity)
+      new_capacity = RAPTOR_IOSTREAM_CORK_INITIAL_SIZE;
+    while(new_capacity < iostr->cork_length + len)
+      new_capacity <<= 1;
+
+    new_buffer = RAPTOR_MALLOC(unsigned char*, new_capacity);
+    if(!new_buffer)
+      return 1;
+    if(iostr->cork_length)
+      memcpy(new_buffer, iostr->cork_buffer, iostr->cork_length);
+    if(iostr->cork_buffer)
+      RAPTOR_FREE(char*, iostr->cork_buffer);
+    iostr->cork_buffer = new_buffer;
+    iostr->cork_capacity = new_capacity;
+  }
+
+  memcpy(iostr->cork_buffer + iostr->cork_length, ptr, len);
+  iostr->cork_length += len;
+  return 0;
+}
+
+
+/**
+ * raptor_iostream_cork:
+ * @iostr: raptor iostream
+ *
+ * Start buffering writes to the iostream.
+ *
+ * Until raptor_iostream_uncork() is called, writes accumulate in an
+ * internal buffer instead of being dispatched to the handler, so a
+ * burst of small writes (such as one statement worth of serializer
+ * output) reaches the underlying sink as a single large write.
+ *
+ * Corks nest: corking an already-corked iostream just increases the
+ * cork count, and the buffer is only flushed when
+ * raptor_iostream_uncork() has been called a matching number of times.
+ *
+ * Return value: non-0 on failure
+ **/
+int
+raptor_iostream_cork(raptor_iostream *iostr)
+{
+  if(iostr->flags & RAPTOR_IOSTREAM_FLAGS_EOF)
+    return 1;
+  if(!(iostr->mode & RAPTOR_IOSTREAM_MODE_WRITE))
+    return 1;
+
+  iostr->corked++;
+  return 0;
+}
+
+
+/**
+ * raptor_iostream_uncork:
+ * @iostr: raptor iostream
+ *
+ * Stop buffering writes and flush the buffered bytes.
+ *
+ * Uncorking an iostream that is not corked does nothing.  If the
+ * iostream was corked more than once, the buffer is only flushed by
+ * the uncork matching the outermost cork.
+ *
+ * Return value: non-0 on failure
+ **/
+int
+raptor_iostream_uncork(raptor_iostream *iostr)
+{
+  int rc = 0;
+
+  if(!iostr->corked)
+    return 0;
+
+  if(--iostr->corked)
+    return 0;
+
+  if(iostr->cork_length) {
+    if(iostr->handler->write_bytes) {
+      int nobj = iostr->handler->write_bytes(iostr->user_data,
+                                             iostr->cork_buffer, 1,
+                                             iostr->cork_length);
+      rc = (RAPTOR_BAD_CAST(size_t, nobj) != iostr->cork_length);
+    } else
+      rc = 1;
+    iostr->cork_length = 0;
+  }
+
+  return rc;
+}
+
+
 /**
  * raptor_iostream_write_byte:
  * @byte: byte to write
@@ -721,10 +1753,19 @@ raptor_iostream_write_byte(const int byte, raptor_iostream *iostr)
 
   if(iostr->flags & RAPTOR_IOSTREAM_FLAGS_EOF)
     return 1;
-  if(!iostr->handler->write_byte)
-    return 1;
   if(!(iostr->mode & RAPTOR_IOSTREAM_MODE_WRITE))
     return 1;
+
+  if(iostr->corked) {
+    const unsigned char c = RAPTOR_BAD_CAST(unsigned char, byte);
+    RAPTOR_STATS_INC(iostream_bytes_written);
+    return raptor_iostream_cork_append(iostr, &c, 1);
+  }
+
+  if(!iostr->handler->write_byte)
+    return 1;
+
+  RAPTOR_STATS_INC(iostream_bytes_written);
   return iostr->handler->write_byte(iostr->user_data, byte);
 }
 
@@ -748,19 +1789,95 @@ raptor_iostream_write_bytes(const void *ptr, size_t size, size_t nmemb,
   
   if(iostr->flags & RAPTOR_IOSTREAM_FLAGS_EOF)
     return -1;
-  if(!iostr->handler->write_bytes)
-    return -1;
   if(!(iostr->mode & RAPTOR_IOSTREAM_MODE_WRITE))
     return -1;
 
+  if(iostr->corked) {
+    if(raptor_iostream_cork_append(iostr, ptr, size * nmemb))
+      return -1;
+    iostr->offset += (size * nmemb);
+    RAPTOR_STATS_ADD(iostream_bytes_written, size * nmemb);
+    return RAPTOR_BAD_CAST(int, nmemb);
+  }
+
+  if(!iostr->handler->write_bytes)
+    return -1;
+
   nobj = iostr->handler->write_bytes(iostr->user_data, ptr, size, nmemb);
-  if(nobj > 0)
+  if(nobj > 0) {
     iostr->offset += (size * nobj);
+    RAPTOR_STATS_ADD(iostream_bytes_written, size * nobj);
+  }
 
   return nobj;
 }
 
 
+/**
+ * raptor_iostream_write_bytes_v:
+ * @vec: array of byte regions to write
+ * @count: number of regions in @vec
+ * @iostr: raptor iostream
+ *
+ * Write several byte regions to the iostream in one call.
+ *
+ * If the handler implements the write_bytes_v slot (V3), the regions
+ * are passed through in one gather-write; otherwise they are written
+ * one at a time.
+ *
+ * Return value: number of bytes written, which may be less than the
+ * total region length. <0 on failure
+ **/
+int
+raptor_iostream_write_bytes_v(const raptor_iovec *vec, size_t count,
+                              raptor_iostream *iostr)
+{
+  size_t i;
+  int total = 0;
+
+  if(iostr->flags & RAPTOR_IOSTREAM_FLAGS_EOF)
+    return -1;
+  if(!(iostr->mode & RAPTOR_IOSTREAM_MODE_WRITE))
+    return -1;
+
+  if(iostr->corked) {
+    for(i = 0; i < count; i++) {
+      if(raptor_iostream_cork_append(iostr, vec[i].data, vec[i].length))
+        return -1;
+      iostr->offset += vec[i].length;
+      RAPTOR_STATS_ADD(iostream_bytes_written, vec[i].length);
+      total += RAPTOR_BAD_CAST(int, vec[i].length);
+    }
+    return total;
+  }
+
+  if(iostr->handler->version >= 3 && iostr->handler->write_bytes_v) {
+    total = iostr->handler->write_bytes_v(iostr->user_data, vec, count);
+    if(total > 0) {
+      iostr->offset += RAPTOR_GOOD_CAST(size_t, total);
+      RAPTOR_STATS_ADD(iostream_bytes_written, total);
+    }
+    return total;
+  }
+
+  if(!iostr->handler->write_bytes)
+    return -1;
+
+  for(i = 0; i < count; i++) {
+    int nobj = iostr->handler->write_bytes(iostr->user_data, vec[i].data, 1,
+                                           vec[i].length);
+    if(nobj < 0)
+      return -1;
+    iostr->offset += RAPTOR_GOOD_CAST(size_t, nobj);
+    total += nobj;
+    if(RAPTOR_BAD_CAST(size_t, nobj) != vec[i].length)
+      break;
+  }
+
+  return total;
+}
+
+
 /**
  * raptor_iostream_string_write:
  * @string: string
@@ -832,8 +1949,10 @@ raptor_iostream_write_end(raptor_iostream *iostr)
   
   if(iostr->flags & RAPTOR_IOSTREAM_FLAGS_EOF)
     return 1;
+  if(iostr->corked)
+    rc = raptor_iostream_uncork(iostr);
   if(iostr->handler->write_end)
-    rc = iostr->handler->write_end(iostr->user_data);
+    rc |= iostr->handler->write_end(iostr->user_data);
   iostr->flags |= RAPTOR_IOSTREAM_FLAGS_EOF;
 
   return rc;
@@ -910,6 +2029,35 @@ raptor_iostream_decimal_write(int integer, raptor_iostream* iostr)
 }
 
 
+/**
+ * raptor_iostream_double_write:
+ * @value: double to format
+ * @iostr: raptor iostream
+ *
+ * Write a double to the iostream as the shortest decimal string that
+ * parses back to exactly the same value.
+ *
+ * The output is in xsd:double style scientific notation such as
+ * "4.2E1" and is locale-independent.
+ *
+ * Return value: non-0 on failure
+ **/
+int
+raptor_iostream_double_write(double value, raptor_iostream* iostr)
+{
+  char buf[32];
+  size_t length;
+  int nobj;
+
+  length = raptor_format_double(buf, sizeof(buf), value);
+  if(!length)
+    return 1;
+
+  nobj = raptor_iostream_write_bytes(buf, 1, length, iostr);
+  return (RAPTOR_BAD_CAST(size_t, nobj) != length);
+}
+
+
 /**
  * raptor_iostream_hexadecimal_write:
  * @integer: unsigned integer to format as hexadecimal
@@ -83,6 +83,22 @@ typedef enum {
 #define RAPTOR_YAJL_LEN_TYPE unsigned int
 #endif
 
+/* Maximum JSON nesting depth accepted.  Valid RDF/JSON never nests
+ * deeper than 4 levels; allow headroom but guarantee a bound so
+ * hostile documents cannot grow the YAJL state stack. */
+#define RAPTOR_JSON_MAX_DEPTH 16
+
+/* A term attribute string buffer, recycled between terms so
+ * steady-state parsing does not allocate per term */
+typedef struct {
+  unsigned char* buffer;
+  /* allocated size of @buffer */
+  size_t size;
+  /* non-0 when holding a value for the current term */
+  int is_set;
+} raptor_json_term_buffer;
+
+
 /*
  * JSON parser object
  */
@@ -98,11 +114,14 @@ struct raptor_json_parser_context_s {
   raptor_json_term        term;
   raptor_json_term_attrib attrib;
 
+  /* current JSON nesting depth (maps and arrays) */
+  int depth;
+
   /* Temporary storage, while creating terms */
   raptor_term_type term_type;
-  unsigned char*   term_value;
-  unsigned char*   term_datatype;
-  unsigned char*   term_lang;
+  raptor_json_term_buffer term_value;
+  raptor_json_term_buffer term_datatype;
+  raptor_json_term_buffer term_lang;
 
   /* Temporary storage, while creating statements */
   raptor_statement statement;
@@ -114,20 +133,60 @@ typedef struct raptor_json_parser_context_s raptor_json_parser_context;
 static void
 raptor_json_reset_term(raptor_json_parser_context *context)
 {
-  if(context->term_value)
-    RAPTOR_FREE(char*, context->term_value);
-  if(context->term_lang)
-    RAPTOR_FREE(char*, context->term_lang);
-  if(context->term_datatype)
-    RAPTOR_FREE(char*, context->term_datatype);
-
-  context->term_value = NULL;
-  context->term_lang = NULL;
-  context->term_datatype = NULL;
+  /* keep the buffers for the next term; just mark them unset */
+  context->term_value.is_set = 0;
+  context->term_lang.is_set = 0;
+  context->term_datatype.is_set = 0;
   context->term_type = RAPTOR_TERM_TYPE_UNKNOWN;
   context->attrib = RAPTOR_JSON_ATTRIB_UNKNOWN;
 }
 
+
+static void
+raptor_json_free_term_buffers(raptor_json_parser_context *context)
+{
+  if(context->term_value.buffer)
+    RAPTOR_FREE(char*, context->term_value.buffer);
+  if(context->term_lang.buffer)
+    RAPTOR_FREE(char*, context->term_lang.buffer);
+  if(context->term_datatype.buffer)
+    RAPTOR_FREE(char*, context->term_datatype.buffer);
+
+  memset(&context->term_value, '\0', sizeof(context->term_value));
+  memset(&context->term_lang, '\0', sizeof(context->term_lang));
+  memset(&context->term_datatype, '\0', sizeof(context->term_datatype));
+}
+
+
+/* store a copy of (str, len) in @tbuf, reusing its allocation when
+ * large enough */
+static int
+raptor_json_term_buffer_set(raptor_parser *rdf_parser,
+                            raptor_json_term_buffer *tbuf,
+                            const unsigned char* str,
+                            RAPTOR_YAJL_LEN_TYPE len)
+{
+  size_t needed = RAPTOR_GOOD_CAST(size_t, len) + 1;
+
+  if(needed > tbuf->size) {
+    unsigned char* new_buffer = RAPTOR_MALLOC(unsigned char*, needed);
+    if(!new_buffer) {
+      raptor_parser_fatal_error(rdf_parser, "Out of memory");
+      return 1;
+    }
+    if(tbuf->buffer)
+      RAPTOR_FREE(char*, tbuf->buffer);
+    tbuf->buffer = new_buffer;
+    tbuf->size = needed;
+  }
+
+  memcpy(tbuf->buffer, str, len);
+  tbuf->buffer[len] = '\0';
+  tbuf->is_set = 1;
+
+  return 0;
+}
+
 static unsigned char*
 raptor_json_cstring_from_counted_string(raptor_parser *rdf_parser, const unsigned char* str, RAPTOR_YAJL_LEN_TYPE len)
 {
@@ -175,16 +234,16 @@ raptor_json_generate_term(raptor_parser *rdf_parser)
   raptor_json_parser_context *context = (raptor_json_parser_context*)rdf_parser->context;
   raptor_term *term = NULL;
 
-  if(!context->term_value) {
+  if(!context->term_value.is_set) {
     raptor_parser_error(rdf_parser, "No value for term defined");
     return NULL;
   }
 
   switch(context->term_type) {
     case RAPTOR_TERM_TYPE_URI: {
-      raptor_uri *uri = raptor_new_uri(rdf_parser->world, context->term_value);
+      raptor_uri *uri = raptor_new_uri(rdf_parser->world, context->term_value.buffer);
       if(!uri) {
-        raptor_parser_error(rdf_parser, "Could not create uri from '%s'", context->term_value);
+        raptor_parser_error(rdf_parser, "Could not create uri from '%s'", context->term_value.buffer);
         return NULL;
       }
       term = raptor_new_term_from_uri(rdf_parser->world, uri);
@@ -193,16 +252,16 @@ raptor_json_generate_term(raptor_parser *rdf_parser)
     }
     case RAPTOR_TERM_TYPE_LITERAL: {
       raptor_uri *datatype_uri = NULL;
-      if(context->term_datatype) {
-        datatype_uri = raptor_new_uri(rdf_parser->world, context->term_datatype);
+      if(context->term_datatype.is_set) {
+        datatype_uri = raptor_new_uri(rdf_parser->world, context->term_datatype.buffer);
       }
-      term = raptor_new_term_from_literal(rdf_parser->world, context->term_value, datatype_uri, context->term_lang);
+      term = raptor_new_term_from_literal(rdf_parser->world, context->term_value.buffer, datatype_uri, context->term_lang.is_set ? context->term_lang.buffer : NULL);
       if(datatype_uri)
         raptor_free_uri(datatype_uri);
       break;
     }
     case RAPTOR_TERM_TYPE_BLANK: {
-      unsigned char *node_id = context->term_value;
+      unsigned char *node_id = context->term_value.buffer;
       if(strlen((const char*)node_id) > 2 && node_id[0] == '_' && node_id[1] == ':') {
           node_id = &node_id[2];
       }
@@ -263,10 +322,12 @@ static int raptor_json_yajl_string(void * ctx, const unsigned char * str,
       context->state == RAPTOR_JSON_STATE_RESOURCES_OBJECT) {
     switch(context->attrib) {
       case RAPTOR_JSON_ATTRIB_VALUE:
-        context->term_value = raptor_json_cstring_from_counted_string(rdf_parser, str, len);
+        if(raptor_json_term_buffer_set(rdf_parser, &context->term_value, str, len))
+          return 0;
       break;
       case RAPTOR_JSON_ATTRIB_LANG:
-        context->term_lang = raptor_json_cstring_from_counted_string(rdf_parser, str, len);
+        if(raptor_json_term_buffer_set(rdf_parser, &context->term_lang, str, len))
+          return 0;
       break;
       case RAPTOR_JSON_ATTRIB_TYPE:
         if(!strncmp((const char*)str, "uri", len)) {
@@ -283,7 +344,8 @@ static int raptor_json_yajl_string(void * ctx, const unsigned char * str,
         }
       break;
       case RAPTOR_JSON_ATTRIB_DATATYPE:
-        context->term_datatype = raptor_json_cstring_from_counted_string(rdf_parser, str, len);
+        if(raptor_json_term_buffer_set(rdf_parser, &context->term_datatype, str, len))
+          return 0;
       break;
       case RAPTOR_JSON_ATTRIB_UNKNOWN:
       default:
@@ -369,6 +431,12 @@ static int raptor_json_yajl_start_map(void * ctx)
   raptor_json_parser_context *context;
   context = (raptor_json_parser_context*)rdf_parser->context;
 
+  if(++context->depth > RAPTOR_JSON_MAX_DEPTH) {
+    raptor_parser_error(rdf_parser, "JSON nested deeper than %d levels",
+                        RAPTOR_JSON_MAX_DEPTH);
+    return 0;
+  }
+
   if(context->state == RAPTOR_JSON_STATE_ROOT) {
     context->state = RAPTOR_JSON_STATE_MAP_ROOT;
     return 1;
@@ -400,13 +468,15 @@ static int raptor_json_yajl_end_map(void * ctx)
   raptor_json_parser_context *context;
   context = (raptor_json_parser_context*)rdf_parser->context;
 
+  context->depth--;
+
   if(context->state == RAPTOR_JSON_STATE_RESOURCES_OBJECT) {
     context->statement.object = raptor_json_generate_term(rdf_parser);
     if(!context->statement.object)
       return 0;
 
     /* Generate the statement */
-    (*rdf_parser->statement_handler)(rdf_parser->user_data, &context->statement);
+    raptor_parser_emit_statement(rdf_parser, &context->statement);
 
     raptor_free_term(context->statement.object);
     context->statement.object = NULL;
@@ -460,7 +530,7 @@ static int raptor_json_yajl_end_map(void * ctx)
       return 0;
     } else {
       /* Generate the statement */
-      (*rdf_parser->statement_handler)(rdf_parser->user_data, &context->statement);
+      raptor_parser_emit_statement(rdf_parser, &context->statement);
     }
     raptor_statement_clear(&context->statement);
     context->state = RAPTOR_JSON_STATE_TRIPLES_ARRAY;
@@ -483,6 +553,12 @@ static int raptor_json_yajl_start_array(void * ctx)
   raptor_json_parser_context *context;
   context = (raptor_json_parser_context*)rdf_parser->context;
 
+  if(++context->depth > RAPTOR_JSON_MAX_DEPTH) {
+    raptor_parser_error(rdf_parser, "JSON nested deeper than %d levels",
+                        RAPTOR_JSON_MAX_DEPTH);
+    return 0;
+  }
+
   if(context->state == RAPTOR_JSON_STATE_RESOURCES_PREDICATE) {
     context->state = RAPTOR_JSON_STATE_RESOURCES_OBJECT_ARRAY;
     return 1;
@@ -501,6 +577,8 @@ static int raptor_json_yajl_end_array(void * ctx)
   raptor_json_parser_context *context;
   context = (raptor_json_parser_context*)rdf_parser->context;
 
+  context->depth--;
+
   if(context->state == RAPTOR_JSON_STATE_RESOURCES_OBJECT_ARRAY) {
     context->state = RAPTOR_JSON_STATE_RESOURCES_PREDICATE;
     return 1;
@@ -597,7 +675,7 @@ raptor_json_parse_terminate(raptor_parser* rdf_parser)
   if(context->handle)
     yajl_free(context->handle);
 
-  raptor_json_reset_term(context);
+  raptor_json_free_term_buffers(context);
   raptor_statement_clear(&context->statement);
 }
 
@@ -687,6 +765,7 @@ raptor_json_parse_start(raptor_parser* rdf_parser)
 #endif
 
   context->state = RAPTOR_JSON_STATE_ROOT;
+  context->depth = 0;
   raptor_json_reset_term(context);
   raptor_statement_clear(&context->statement);
 
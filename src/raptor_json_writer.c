@@ -60,6 +60,11 @@ struct raptor_json_writer_s {
 
   /* indent step */
   int indent_step;
+
+  /* clean byte table for the JSON literal escaping profile, filled
+   * once at construction so raptor_json_writer_quoted() need not
+   * rebuild it per string */
+  unsigned char escape_clean[256];
 };
 
 
@@ -91,7 +96,10 @@ raptor_new_json_writer(raptor_world* world,
   json_writer->base_uri = base_uri;
 
   json_writer->indent_step = 2;
-  
+
+  raptor_escaped_write_fill_clean_table(json_writer->escape_clean, '"',
+                                        RAPTOR_ESCAPED_WRITE_JSON_LITERAL);
+
   return json_writer;
 }
 
@@ -124,31 +132,46 @@ raptor_json_writer_quoted(raptor_json_writer* json_writer,
   }
 
   raptor_iostream_write_byte('\"', json_writer->iostr);
-  rc = raptor_string_escaped_write((const unsigned char*)value, value_len,
-                                   '"', RAPTOR_ESCAPED_WRITE_JSON_LITERAL,
-                                   json_writer->iostr);
+  rc = raptor_string_escaped_write_clean_table((const unsigned char*)value,
+                                               value_len,
+                                               '"',
+                                               RAPTOR_ESCAPED_WRITE_JSON_LITERAL,
+                                               json_writer->escape_clean,
+                                               json_writer->iostr);
   raptor_iostream_write_byte('\"', json_writer->iostr);
 
   return rc;
 }
 
 
-static int
-raptor_json_writer_spaces(raptor_json_writer* json_writer, int depth) 
-{
-  int i;
-  for(i = 0; i < depth; i++)
-    raptor_iostream_write_byte(' ', json_writer->iostr);
-  return 0;
-}
+/* newline followed by the deepest indentation written in one call */
+static const char raptor_json_writer_indent[] =
+  "\n                                ";
+
+#define RAPTOR_JSON_WRITER_MAX_INDENT \
+  RAPTOR_GOOD_CAST(int, sizeof(raptor_json_writer_indent) - 2)
 
 
 int
 raptor_json_writer_newline(raptor_json_writer* json_writer)
 {
-  raptor_iostream_write_byte('\n', json_writer->iostr);
-  if(json_writer->indent)
-    raptor_json_writer_spaces(json_writer, json_writer->indent);
+  int depth = json_writer->indent;
+  int count = (depth < RAPTOR_JSON_WRITER_MAX_INDENT) ?
+              depth : RAPTOR_JSON_WRITER_MAX_INDENT;
+
+  /* newline and indentation in a single counted write */
+  raptor_iostream_counted_string_write(raptor_json_writer_indent,
+                                       RAPTOR_GOOD_CAST(size_t, count + 1),
+                                       json_writer->iostr);
+
+  for(depth -= count; depth > 0; depth -= count) {
+    count = (depth < RAPTOR_JSON_WRITER_MAX_INDENT) ?
+            depth : RAPTOR_JSON_WRITER_MAX_INDENT;
+    raptor_iostream_counted_string_write(raptor_json_writer_indent + 1,
+                                         RAPTOR_GOOD_CAST(size_t, count),
+                                         json_writer->iostr);
+  }
+
   return 0;
 }
 
@@ -228,7 +228,7 @@ raptor_librdfa_generate_statement(rdftriple* triple, void* callback_data)
   s->object = object_term;
   
   /* Generate statement */
-  (*parser->statement_handler)(parser->user_data, s);
+  raptor_parser_emit_statement(parser, s);
 
   cleanup:
   rdfa_free_triple(triple);
@@ -83,6 +83,10 @@ raptor_log_error_varargs(raptor_world* world, raptor_log_level level,
   if(world && world->internal_ignore_errors)
     return;
 
+  /* drop gated messages before paying for the formatting */
+  if(world && level < world->minimum_log_level)
+    return;
+
   length = raptor_vasprintf(&buffer, message, arguments);
   if(!buffer) {
     if(locator) {
@@ -133,6 +137,9 @@ raptor_log_error(raptor_world* world, raptor_log_level level,
     if(world->internal_ignore_errors)
       return;
 
+    if(level < world->minimum_log_level)
+      return;
+
     memset(&world->message, '\0', sizeof(world->message));
     world->message.code = -1;
     world->message.domain = RAPTOR_DOMAIN_NONE;
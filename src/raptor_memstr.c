@@ -44,33 +44,117 @@
  * The block of memory in @haystack may not be NUL terminated but
  * the searching for @needle will end if a NUL is found in @haystack.
  *
+ * Uses memchr() to skip to candidate positions for the first needle
+ * byte rather than testing every offset.
+ *
  * Return value: pointer to match string or NULL on failure or failed to find
  */
 const char*
 raptor_memstr(const char *haystack, size_t haystack_len, const char *needle)
 {
   size_t needle_len;
+  size_t search_len;
+  const char *nul;
   const char *p;
-  
+
   if(!haystack || !needle)
     return NULL;
-  
+
   if(!*needle)
     return haystack;
-  
+
   needle_len = strlen(needle);
 
-  /* loop invariant: haystack_len is always length of remaining buffer at *p */
-  for(p = haystack;
-      (haystack_len >= needle_len) && *p;
-      p++, haystack_len--) {
+  if(haystack_len < needle_len)
+    return NULL;
+
+  /* a match cannot start at or after a NUL in the haystack; the
+   * needle has no NULs so a match cannot span one either */
+  nul = (const char*)memchr(haystack, '\0', haystack_len);
+  search_len = nul ? RAPTOR_GOOD_CAST(size_t, nul - haystack)
+                   : haystack_len;
+  if(search_len > haystack_len - needle_len + 1)
+    search_len = haystack_len - needle_len + 1;
+
+  p = haystack;
+  while(search_len) {
+    const char *q = (const char*)memchr(p, *needle, search_len);
+    if(!q)
+      break;
 
-    /* check match */
-    if(!memcmp(p, needle, needle_len))
-      return p;
+    /* safe: q is a valid start so q + needle_len <= haystack end */
+    if(!memcmp(q, needle, needle_len))
+      return q;
+
+    search_len -= (size_t)(q - p) + 1;
+    p = q + 1;
   }
-  
+
   return NULL;
 }
 
+
+/*
+ * raptor_memstr_multi:
+ * @haystack: memory block to search in
+ * @haystack_len: size of memory block
+ * @needles: array of strings to search for
+ * @count: number of strings in @needles
+ * @founds: array of @count ints each set non-0 when the needle was found
+ *
+ * INTERNAL: Search for several strings in a block of memory in one pass
+ *
+ * Same matching rules as raptor_memstr() but scans the haystack once
+ * for all the needles rather than once per needle - used by the
+ * syntax recognizers which probe a content sample for many markers.
+ *
+ * Return value: number of needles found
+ */
+int
+raptor_memstr_multi(const char *haystack, size_t haystack_len,
+                    const char* const *needles, int count, int *founds)
+{
+  size_t needle_lens[16];
+  int remaining = count;
+  const char *p;
+  int i;
+
+  if(!haystack || !needles || !founds || count < 1)
+    return 0;
+
+  if(count > RAPTOR_GOOD_CAST(int, (sizeof(needle_lens) / sizeof(needle_lens[0])))) {
+    /* more needles than the one-pass scan handles - search separately */
+    int found_count = 0;
+    for(i = 0; i < count; i++) {
+      founds[i] = (raptor_memstr(haystack, haystack_len, needles[i]) != NULL);
+      found_count += founds[i];
+    }
+    return found_count;
+  }
+
+  for(i = 0; i < count; i++) {
+    needle_lens[i] = strlen(needles[i]);
+    founds[i] = !needle_lens[i]; /* the empty string always matches */
+    if(founds[i])
+      remaining--;
+  }
+
+  for(p = haystack;
+      remaining && haystack_len && *p;
+      p++, haystack_len--) {
+    for(i = 0; i < count; i++) {
+      if(founds[i])
+        continue;
+      if(*p == needles[i][0] &&
+         haystack_len >= needle_lens[i] &&
+         !memcmp(p, needles[i], needle_lens[i])) {
+        founds[i] = 1;
+        remaining--;
+      }
+    }
+  }
+
+  return count - remaining;
+}
+
     
@@ -137,7 +137,12 @@ raptor_namespaces_init(raptor_world* world,
   nstack->world = world;
 
   nstack->size = 0;
-  
+  nstack->generation = 0;
+  memset(nstack->qname_cache, '\0', sizeof(nstack->qname_cache));
+  nstack->ns_pool = NULL;
+  nstack->ns_pool_size = 0;
+
+
   nstack->table_size = RAPTOR_NAMESPACES_HASHTABLE_SIZE;
   nstack->table = RAPTOR_CALLOC(raptor_namespace**,
                                 RAPTOR_NAMESPACES_HASHTABLE_SIZE,
@@ -145,6 +150,12 @@ raptor_namespaces_init(raptor_world* world,
   if(!nstack->table)
     return -1;
 
+  nstack->uri_table = RAPTOR_CALLOC(raptor_namespace**,
+                                    RAPTOR_NAMESPACES_HASHTABLE_SIZE,
+                                    sizeof(raptor_namespace*));
+  if(!nstack->uri_table)
+    return -1;
+
   nstack->def_namespace = NULL;
 
   nstack->rdf_ms_uri = raptor_new_uri_from_counted_string(nstack->world,
@@ -218,6 +229,27 @@ raptor_new_namespaces(raptor_world* world, int defaults)
 }
  
 
+/*
+ * raptor_namespaces_uri_bucket:
+ * @nstack: namespace stack
+ * @uri: namespace URI
+ *
+ * INTERNAL - Map a namespace URI to its bucket in the URI index.
+ *
+ * Return value: bucket index
+ */
+static int
+raptor_namespaces_uri_bucket(raptor_namespace_stack *nstack, raptor_uri* uri)
+{
+  size_t uri_len;
+  const unsigned char* uri_string = raptor_uri_as_counted_string(uri, &uri_len);
+  unsigned int hash = raptor_hash_ns_string(uri_string,
+                                            RAPTOR_BAD_CAST(int, uri_len));
+
+  return RAPTOR_GOOD_CAST(int, hash % nstack->table_size);
+}
+
+
 /**
  * raptor_namespaces_start_namespace:
  * @nstack: namespace stack
@@ -234,11 +266,19 @@ raptor_namespaces_start_namespace(raptor_namespace_stack *nstack,
   const int bucket = hash % nstack->table_size;
 
   nstack->size++;
+  nstack->generation++;
   
   if(nstack->table[bucket])
     nspace->next = nstack->table[bucket];
   nstack->table[bucket] = nspace;
 
+  if(nspace->uri && nstack->uri_table) {
+    const int uri_bucket = raptor_namespaces_uri_bucket(nstack, nspace->uri);
+
+    nspace->uri_next = nstack->uri_table[uri_bucket];
+    nstack->uri_table[uri_bucket] = nspace;
+  }
+
   if(!nstack->def_namespace)
     nstack->def_namespace = nspace;
 
@@ -291,6 +331,21 @@ raptor_namespaces_start_namespace_full(raptor_namespace_stack *nstack,
 void
 raptor_namespaces_clear(raptor_namespace_stack *nstack)
 {
+  int i;
+
+  for(i = 0; i < RAPTOR_NSTACK_QNAME_CACHE_SIZE; i++) {
+    raptor_namespace_qname_cache_entry* entry = &nstack->qname_cache[i];
+
+    if(entry->uri) {
+      raptor_free_uri(entry->uri);
+      entry->uri = NULL;
+      if(entry->qname) {
+        raptor_free_qname(entry->qname);
+        entry->qname = NULL;
+      }
+    }
+  }
+
   if(nstack->table) {
     int bucket;
 
@@ -311,6 +366,20 @@ raptor_namespaces_clear(raptor_namespace_stack *nstack)
     nstack->table_size = 0;
   }
 
+  if(nstack->uri_table) {
+    RAPTOR_FREE(raptor_namespaces, nstack->uri_table);
+    nstack->uri_table = NULL;
+  }
+
+  /* drain the recycled namespace pool (the table teardown above may
+   * have refilled it) */
+  while(nstack->ns_pool) {
+    raptor_namespace* ns = nstack->ns_pool;
+    nstack->ns_pool = ns->next;
+    RAPTOR_FREE(raptor_namespace, ns);
+  }
+  nstack->ns_pool_size = 0;
+
   if(nstack->world) {
     if(nstack->rdf_ms_uri) {
       raptor_free_uri(nstack->rdf_ms_uri);
@@ -346,6 +415,34 @@ raptor_free_namespaces(raptor_namespace_stack *nstack)
 }
 
 
+/*
+ * raptor_namespaces_uri_index_remove:
+ * @nstack: namespace stack
+ * @nspace: namespace being ended
+ *
+ * INTERNAL - Unlink a namespace from the URI index.
+ */
+static void
+raptor_namespaces_uri_index_remove(raptor_namespace_stack *nstack,
+                                   raptor_namespace *nspace)
+{
+  raptor_namespace **ns_p;
+  int uri_bucket;
+
+  if(!nspace->uri || !nstack->uri_table)
+    return;
+
+  uri_bucket = raptor_namespaces_uri_bucket(nstack, nspace->uri);
+  for(ns_p = &nstack->uri_table[uri_bucket]; *ns_p;
+      ns_p = &(*ns_p)->uri_next) {
+    if(*ns_p == nspace) {
+      *ns_p = nspace->uri_next;
+      break;
+    }
+  }
+}
+
+
 /**
  * raptor_namespaces_end_for_depth:
  * @nstack: namespace stack
@@ -357,6 +454,9 @@ void
 raptor_namespaces_end_for_depth(raptor_namespace_stack *nstack, int depth)
 {
   int bucket;
+
+  nstack->generation++;
+
   for(bucket = 0; bucket < nstack->table_size; bucket++) {
     while(nstack->table[bucket] &&
           nstack->table[bucket]->depth == depth) {
@@ -369,6 +469,7 @@ raptor_namespaces_end_for_depth(raptor_namespace_stack *nstack, int depth)
                     ns->prefix ? (char*)ns->prefix : "(default)", depth);
 #endif
 #endif
+      raptor_namespaces_uri_index_remove(nstack, ns);
       raptor_free_namespace(ns);
       nstack->size--;
 
@@ -457,7 +558,18 @@ raptor_namespaces_find_namespace_by_uri(raptor_namespace_stack *nstack,
 
   if(!ns_uri)
     return NULL;
-  
+
+  if(nstack->uri_table) {
+    raptor_namespace* ns;
+
+    for(ns = nstack->uri_table[raptor_namespaces_uri_bucket(nstack, ns_uri)];
+        ns; ns = ns->uri_next)
+      if(raptor_uri_equals(ns->uri, ns_uri))
+        return ns;
+
+    return NULL;
+  }
+
   for(bucket = 0; bucket < nstack->table_size; bucket++) {
     raptor_namespace* ns;
     for(ns = nstack->table[bucket]; ns ; ns = ns->next)
@@ -479,12 +591,22 @@ raptor_namespaces_find_namespace_by_uri(raptor_namespace_stack *nstack,
  * Return value: non-0 if the namespace is in scope.
  **/
 int
-raptor_namespaces_namespace_in_scope(raptor_namespace_stack *nstack, 
+raptor_namespaces_namespace_in_scope(raptor_namespace_stack *nstack,
                                      const raptor_namespace *nspace)
 {
   raptor_namespace* ns;
   int bucket;
-  
+
+  if(nspace->uri && nstack->uri_table) {
+    /* only the URI-index bucket for this namespace URI needs scanning */
+    for(ns = nstack->uri_table[raptor_namespaces_uri_bucket(nstack, nspace->uri)];
+        ns; ns = ns->uri_next)
+      if(raptor_uri_equals(ns->uri, nspace->uri))
+        return 1;
+
+    return 0;
+  }
+
   for(bucket = 0; bucket < nstack->table_size; bucket++) {
     for(ns = nstack->table[bucket]; ns ; ns = ns->next)
       if(raptor_uri_equals(ns->uri, nspace->uri))
@@ -547,10 +669,28 @@ raptor_new_namespace_from_uri(raptor_namespace_stack *nstack,
     len += prefix_length + 1;
   }
 
-  /* Just one malloc for structure + namespace (maybe) + prefix (maybe)*/
-  ns = RAPTOR_CALLOC(raptor_namespace*, 1, len);
-  if(!ns)
-    return NULL;
+  if(prefix_length < RAPTOR_NAMESPACE_POOL_PREFIX_LEN) {
+    /* pool-sized prefix: reuse a recycled namespace when available */
+    if(nstack->ns_pool) {
+      ns = nstack->ns_pool;
+      nstack->ns_pool = ns->next;
+      nstack->ns_pool_size--;
+      memset(ns, '\0',
+             sizeof(raptor_namespace) + RAPTOR_NAMESPACE_POOL_PREFIX_LEN);
+    } else {
+      ns = RAPTOR_CALLOC(raptor_namespace*, 1,
+                         sizeof(raptor_namespace) +
+                         RAPTOR_NAMESPACE_POOL_PREFIX_LEN);
+      if(!ns)
+        return NULL;
+    }
+    ns->from_pool = 1;
+  } else {
+    /* Just one malloc for structure + namespace (maybe) + prefix (maybe)*/
+    ns = RAPTOR_CALLOC(raptor_namespace*, 1, len);
+    if(!ns)
+      return NULL;
+  }
 
   p = (unsigned char*)ns + sizeof(raptor_namespace);
   if(ns_uri) {
@@ -677,14 +817,25 @@ raptor_namespace_stack_start_namespace(raptor_namespace_stack *nstack,
  * 
  * Destructor - destroy a namespace.
  **/
-void 
+void
 raptor_free_namespace(raptor_namespace *ns)
 {
   if(!ns)
     return;
 
-  if(ns->uri)
+  if(ns->uri) {
     raptor_free_uri(ns->uri);
+    ns->uri = NULL;
+  }
+
+  /* recycle pool-sized namespaces through the stack's free list */
+  if(ns->from_pool && ns->nstack &&
+     ns->nstack->ns_pool_size < RAPTOR_NAMESPACE_POOL_MAX) {
+    ns->next = ns->nstack->ns_pool;
+    ns->nstack->ns_pool = ns;
+    ns->nstack->ns_pool_size++;
+    return;
+  }
 
   RAPTOR_FREE(raptor_namespace, ns);
 }
@@ -967,8 +1118,45 @@ raptor_xml_namespace_string_parse(const unsigned char *string,
  *
  * Return value: #raptor_qname for the URI or NULL on failure
  **/
+/*
+ * raptor_namespaces_qname_cache_store:
+ * @nstack: namespace stack
+ * @entry: cache slot for @uri
+ * @uri: URI looked up
+ * @qname: resulting qname or NULL for a negative entry
+ * @xml_version: XML version the lookup was made under
+ *
+ * INTERNAL - Record a URI to qname resolution in the stack cache.
+ */
+static void
+raptor_namespaces_qname_cache_store(raptor_namespace_stack *nstack,
+                                    raptor_namespace_qname_cache_entry* entry,
+                                    raptor_uri *uri, raptor_qname* qname,
+                                    int xml_version)
+{
+  raptor_uri* uri_copy;
+
+  uri_copy = raptor_uri_copy(uri);
+  if(!uri_copy)
+    return;
+
+  if(entry->uri) {
+    raptor_free_uri(entry->uri);
+    if(entry->qname)
+      raptor_free_qname(entry->qname);
+  }
+
+  entry->uri = uri_copy;
+  entry->qname = qname;
+  if(qname)
+    qname->usage++;
+  entry->generation = nstack->generation;
+  entry->xml_version = xml_version;
+}
+
+
 raptor_qname*
-raptor_new_qname_from_namespace_uri(raptor_namespace_stack *nstack, 
+raptor_new_qname_from_namespace_uri(raptor_namespace_stack *nstack,
                                     raptor_uri *uri, int xml_version)
 {
   unsigned char *uri_string;
@@ -978,12 +1166,32 @@ raptor_new_qname_from_namespace_uri(raptor_namespace_stack *nstack,
   size_t ns_uri_len;
   unsigned char *name = NULL;
   int bucket;
+  unsigned int hash = 5381;
+  size_t i;
+  raptor_namespace_qname_cache_entry* entry;
+  raptor_qname* qname;
 
   if(!uri)
     return NULL;
-  
+
   uri_string = raptor_uri_as_counted_string(uri, &uri_len);
 
+  /* check the cache of recent resolutions - predicates and datatypes
+   * repeat constantly during serializing */
+  for(i = 0; i < uri_len; i++)
+    hash = ((hash << 5) + hash) + uri_string[i];
+  entry = &nstack->qname_cache[hash & (RAPTOR_NSTACK_QNAME_CACHE_SIZE - 1)];
+
+  if(entry->uri &&
+     entry->generation == nstack->generation &&
+     entry->xml_version == xml_version &&
+     raptor_uri_equals(entry->uri, uri)) {
+    if(!entry->qname)
+      return NULL;
+    entry->qname->usage++;
+    return entry->qname;
+  }
+
   for(bucket = 0; bucket < nstack->table_size; bucket++) {
     for(ns = nstack->table[bucket]; ns ; ns = ns->next) {
       if(!ns->uri)
@@ -1010,11 +1218,19 @@ raptor_new_qname_from_namespace_uri(raptor_namespace_stack *nstack,
       break;
   }
   
-  if(!ns)
+  if(!ns) {
+    /* remember that no in-scope namespace abbreviates this URI */
+    raptor_namespaces_qname_cache_store(nstack, entry, uri, NULL, xml_version);
     return NULL;
+  }
+
+  qname = raptor_new_qname_from_namespace_local_name(nstack->world, ns,
+                                                     name,  NULL);
+  if(qname)
+    raptor_namespaces_qname_cache_store(nstack, entry, uri, qname,
+                                        xml_version);
 
-  return raptor_new_qname_from_namespace_local_name(nstack->world, ns,
-                                                    name,  NULL);
+  return qname;
 }
 
 
@@ -42,6 +42,19 @@
 #include "raptor_internal.h"
 
 
+/* Vectorized byte scanning - pick the widest unit the compiler targets.
+ * SSE2 is baseline on x86-64; NEON is baseline on AArch64; everything
+ * else falls back to the scalar loops below.
+ */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAPTOR_NTRIPLES_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define RAPTOR_NTRIPLES_NEON 1
+#include <arm_neon.h>
+#endif
+
+
 /* These are for 7-bit ASCII and not locale-specific */
 #define IS_ASCII_ALPHA(c) (((c) > 0x40 && (c) < 0x5B) || ((c) > 0x60 && (c) < 0x7B))
 #define IS_ASCII_UPPER(c) ((c) > 0x40 && (c) < 0x5B)
@@ -103,6 +116,160 @@ raptor_ntriples_term_valid(unsigned char c, int position,
 }
 
 
+/*
+ * raptor_ntriples_scan_clean_span:
+ * @p: start of input
+ * @len: length of input
+ * @end_char: term ending character
+ * @stop_char: additional character to stop at (or '\0' for none)
+ *
+ * INTERNAL - Count leading bytes needing no per-character handling.
+ *
+ * Returns the length of the leading run of printable ASCII bytes
+ * (0x20..0x7E) containing no '\\', no @end_char and no @stop_char.
+ * Such a run can be copied to the destination wholesale; anything
+ * else (escape, delimiter, control or non-ASCII byte) is left for
+ * the caller's scalar loop.  This is the span primitive shared by
+ * the N-Triples term scanner here and the Turtle escape path in
+ * turtle_common.c, so vector improvements land in both parsers.
+ */
+size_t
+raptor_ntriples_scan_clean_span(const unsigned char *p, size_t len,
+                                unsigned char end_char,
+                                unsigned char stop_char)
+{
+  size_t i = 0;
+
+#ifdef RAPTOR_NTRIPLES_SSE2
+  const __m128i v_space = _mm_set1_epi8(0x20);
+  const __m128i v_del   = _mm_set1_epi8(0x7F);
+  const __m128i v_bsl   = _mm_set1_epi8('\\');
+  const __m128i v_end   = _mm_set1_epi8((char)end_char);
+  const __m128i v_stop  = _mm_set1_epi8((char)stop_char);
+
+  while(i + 16 <= len) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+    /* signed compare: < 0x20 catches controls AND bytes >= 0x80 */
+    __m128i bad = _mm_cmplt_epi8(v, v_space);
+    bad = _mm_or_si128(bad, _mm_cmpeq_epi8(v, v_del));
+    bad = _mm_or_si128(bad, _mm_cmpeq_epi8(v, v_bsl));
+    bad = _mm_or_si128(bad, _mm_cmpeq_epi8(v, v_end));
+    bad = _mm_or_si128(bad, _mm_cmpeq_epi8(v, v_stop));
+    if(_mm_movemask_epi8(bad))
+      break;
+    i += 16;
+  }
+#endif
+#ifdef RAPTOR_NTRIPLES_NEON
+  const int8x16_t v_space = vdupq_n_s8(0x20);
+  const uint8x16_t v_del  = vdupq_n_u8(0x7F);
+  const uint8x16_t v_bsl  = vdupq_n_u8('\\');
+  const uint8x16_t v_end  = vdupq_n_u8(end_char);
+  const uint8x16_t v_stop = vdupq_n_u8(stop_char);
+
+  while(i + 16 <= len) {
+    uint8x16_t v = vld1q_u8(p + i);
+    uint8x16_t bad = vreinterpretq_u8_s8(vcltq_s8(vreinterpretq_s8_u8(v),
+                                                  v_space));
+    bad = vorrq_u8(bad, vceqq_u8(v, v_del));
+    bad = vorrq_u8(bad, vceqq_u8(v, v_bsl));
+    bad = vorrq_u8(bad, vceqq_u8(v, v_end));
+    bad = vorrq_u8(bad, vceqq_u8(v, v_stop));
+    if(vmaxvq_u8(bad))
+      break;
+    i += 16;
+  }
+#endif
+
+  /* scalar tail; also finds the exact stop byte after a vector hit */
+  while(i < len) {
+    unsigned char c = p[i];
+    if(c < 0x20 || c >= 0x7F || c == '\\' || c == end_char || c == stop_char)
+      break;
+    i++;
+  }
+
+  return i;
+}
+
+
+/*
+ * raptor_ntriples_scan_line_special:
+ * @p: start of input
+ * @len: length of input
+ *
+ * INTERNAL - Count leading bytes with no effect on line splitting.
+ *
+ * Returns the length of the leading run of bytes containing none of
+ * the characters the N-Triples/N-Quads line scanner tracks state for:
+ * '\\', '<', '>', '\'', '"', '\n' and '\r'.  Used by
+ * raptor_ntriples_parse_chunk() to skip over the body of a line in
+ * vector-width steps.
+ */
+size_t
+raptor_ntriples_scan_line_special(const unsigned char *p, size_t len)
+{
+  size_t i = 0;
+
+#ifdef RAPTOR_NTRIPLES_SSE2
+  const __m128i v_bsl  = _mm_set1_epi8('\\');
+  const __m128i v_lt   = _mm_set1_epi8('<');
+  const __m128i v_gt   = _mm_set1_epi8('>');
+  const __m128i v_sq   = _mm_set1_epi8('\'');
+  const __m128i v_dq   = _mm_set1_epi8('"');
+  const __m128i v_nl   = _mm_set1_epi8('\n');
+  const __m128i v_cr   = _mm_set1_epi8('\r');
+
+  while(i + 16 <= len) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+    __m128i hit = _mm_cmpeq_epi8(v, v_bsl);
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, v_lt));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, v_gt));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, v_sq));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, v_dq));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, v_nl));
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, v_cr));
+    if(_mm_movemask_epi8(hit))
+      break;
+    i += 16;
+  }
+#endif
+#ifdef RAPTOR_NTRIPLES_NEON
+  const uint8x16_t v_bsl = vdupq_n_u8('\\');
+  const uint8x16_t v_lt  = vdupq_n_u8('<');
+  const uint8x16_t v_gt  = vdupq_n_u8('>');
+  const uint8x16_t v_sq  = vdupq_n_u8('\'');
+  const uint8x16_t v_dq  = vdupq_n_u8('"');
+  const uint8x16_t v_nl  = vdupq_n_u8('\n');
+  const uint8x16_t v_cr  = vdupq_n_u8('\r');
+
+  while(i + 16 <= len) {
+    uint8x16_t v = vld1q_u8(p + i);
+    uint8x16_t hit = vceqq_u8(v, v_bsl);
+    hit = vorrq_u8(hit, vceqq_u8(v, v_lt));
+    hit = vorrq_u8(hit, vceqq_u8(v, v_gt));
+    hit = vorrq_u8(hit, vceqq_u8(v, v_sq));
+    hit = vorrq_u8(hit, vceqq_u8(v, v_dq));
+    hit = vorrq_u8(hit, vceqq_u8(v, v_nl));
+    hit = vorrq_u8(hit, vceqq_u8(v, v_cr));
+    if(vmaxvq_u8(hit))
+      break;
+    i += 16;
+  }
+#endif
+
+  while(i < len) {
+    unsigned char c = p[i];
+    if(c == '\\' || c == '<' || c == '>' || c == '\'' || c == '"' ||
+       c == '\n' || c == '\r')
+      break;
+    i++;
+  }
+
+  return i;
+}
+
+
 /*
  * raptor_ntriples_parse_term_internal:
  * @world: raptor world
@@ -141,6 +308,7 @@ raptor_ntriples_parse_term_internal(raptor_world* world,
                                     raptor_ntriples_term_class term_class)
 {
   const unsigned char *p = *start;
+  const unsigned char *dest_start = dest;
   unsigned char c = '\0';
   size_t ulen = 0;
   unsigned long unichar = 0;
@@ -151,6 +319,31 @@ raptor_ntriples_parse_term_internal(raptor_world* world,
   while(*lenp > 0) {
     int unichar_width;
 
+    if(term_class == RAPTOR_TERM_CLASS_URI ||
+       term_class == RAPTOR_TERM_CLASS_STRING) {
+      /* Bulk-copy the leading run of plain ASCII bytes - the
+       * overwhelming majority of real data - leaving escapes,
+       * delimiters and UTF-8 sequences to the loop below.  URIs also
+       * stop at ' ' which is an error handled below.
+       */
+      size_t span;
+
+      span = raptor_ntriples_scan_clean_span(p, *lenp, end_char,
+               (term_class == RAPTOR_TERM_CLASS_URI) ? ' ' : '\0');
+      if(span) {
+        memmove(dest, p, span);
+        dest += span;
+        p += span;
+        (*lenp) -= span;
+        position += RAPTOR_GOOD_CAST(unsigned int, span);
+        if(locator) {
+          locator->column += RAPTOR_GOOD_CAST(int, span);
+          locator->byte += RAPTOR_GOOD_CAST(int, span);
+        }
+        continue;
+      }
+    }
+
     c = *p;
 
     p++;
@@ -368,7 +561,9 @@ raptor_ntriples_parse_term_internal(raptor_world* world,
   *dest = '\0';
 
   if(dest_lenp)
-    *dest_lenp = p - *start;
+    /* length of the decoded term, not of the input consumed - the
+     * two differ when escapes were decoded or a delimiter was eaten */
+    *dest_lenp = RAPTOR_GOOD_CAST(size_t, dest - dest_start);
 
   *start = p;
 
@@ -428,11 +623,11 @@ raptor_parse_turtle_term_internal(raptor_world* world,
   *start = p;
 
   if(dtype == 0)
-    *datatype_uri_p = raptor_uri_copy(world->xsd_integer_uri);
+    *datatype_uri_p = raptor_uri_copy(world->xsd_datatype_uris[RAPTOR_XSD_DATATYPE_INTEGER]);
   else if (dtype == 1)
-    *datatype_uri_p = raptor_uri_copy(world->xsd_decimal_uri);
+    *datatype_uri_p = raptor_uri_copy(world->xsd_datatype_uris[RAPTOR_XSD_DATATYPE_DECIMAL]);
   else
-    *datatype_uri_p = raptor_uri_copy(world->xsd_double_uri);
+    *datatype_uri_p = raptor_uri_copy(world->xsd_datatype_uris[RAPTOR_XSD_DATATYPE_DOUBLE]);
 
   return 0;
 }
@@ -441,6 +636,7 @@ raptor_parse_turtle_term_internal(raptor_world* world,
 /*
  * raptor_ntriples_parse_term:
  * @world: raptor world
+ * @rdf_parser: parser resolving blank node labels via its label map (or NULL)
  * @locator: raptor locator (in/out) (or NULL)
  * @string: string input (in)
  * @len_p: pointer to length of @string (in/out)
@@ -456,7 +652,8 @@ raptor_parse_turtle_term_internal(raptor_world* world,
  * Return value: number of bytes processed or 0 on failure
  */
 size_t
-raptor_ntriples_parse_term(raptor_world* world, raptor_locator* locator,
+raptor_ntriples_parse_term(raptor_world* world, raptor_parser* rdf_parser,
+                           raptor_locator* locator,
                            unsigned char *string, size_t *len_p,
                            raptor_term** term_p, int allow_turtle)
 {
@@ -497,7 +694,7 @@ raptor_ntriples_parse_term(raptor_world* world, raptor_locator* locator,
           goto fail;
         }
 
-        uri = raptor_new_uri(world, dest);
+        uri = raptor_new_uri_from_counted_string(world, dest, term_length);
         if(!uri) {
           raptor_log_error_formatted(world, RAPTOR_LOG_LEVEL_ERROR, locator, "Could not create URI for '%s'", (const char *)dest);
           goto fail;
@@ -560,6 +757,7 @@ raptor_ntriples_parse_term(raptor_world* world, raptor_locator* locator,
       if(1) {
         unsigned char *object_literal_language = NULL;
         unsigned char *object_literal_datatype = NULL;
+        size_t datatype_length = 0;
         raptor_uri* datatype_uri = NULL;
 
         if(*len_p && *p == '@') {
@@ -632,7 +830,8 @@ raptor_ntriples_parse_term(raptor_world* world, raptor_locator* locator,
 
           if(raptor_ntriples_parse_term_internal(world, locator,
                                   (const unsigned char**)&p,
-                                  object_literal_datatype, len_p, NULL,
+                                  object_literal_datatype, len_p,
+                                  &datatype_length,
                                   '>', RAPTOR_TERM_CLASS_URI)) {
             goto fail;
           }
@@ -650,8 +849,9 @@ raptor_ntriples_parse_term(raptor_world* world, raptor_locator* locator,
         }
 
         if(object_literal_datatype) {
-          datatype_uri = raptor_new_uri(world,
-                                        object_literal_datatype);
+          datatype_uri = raptor_new_uri_from_counted_string(world,
+                                                            object_literal_datatype,
+                                                            datatype_length);
           if(!datatype_uri) {
             raptor_log_error_formatted(world, RAPTOR_LOG_LEVEL_ERROR, locator, "Could not create literal datatype uri '%s'", object_literal_datatype);
             goto fail;
@@ -706,7 +906,11 @@ raptor_ntriples_parse_term(raptor_world* world, raptor_locator* locator,
           goto fail;
         }
 
-        *term_p = raptor_new_term_from_blank(world, dest);
+        if(rdf_parser)
+          *term_p = raptor_parser_get_blank_term(rdf_parser, dest,
+                                                 term_length);
+        else
+          *term_p = raptor_new_term_from_blank(world, dest);
 
         break;
 
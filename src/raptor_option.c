@@ -296,6 +296,48 @@ static const struct
     RAPTOR_OPTION_VALUE_TYPE_BOOL,
     "loadExternalEntities",
     "Parsers and SAX2 should load external entities."
+  },
+  { RAPTOR_OPTION_SERIALIZE_FLUSH_INTERVAL,
+    RAPTOR_OPTION_AREA_SERIALIZER,
+    RAPTOR_OPTION_VALUE_TYPE_INT,
+    "serializeFlushInterval",
+    "Abbreviating serializers flush completed subjects every N statements"
+  },
+  { RAPTOR_OPTION_CHEAP_LOCATOR,
+    RAPTOR_OPTION_AREA_PARSER,
+    RAPTOR_OPTION_VALUE_TYPE_BOOL,
+    "cheapLocator",
+    "Parsers skip per-character error location tracking"
+  },
+  { RAPTOR_OPTION_DEDUPLICATE,
+    RAPTOR_OPTION_AREA_PARSER,
+    RAPTOR_OPTION_VALUE_TYPE_BOOL,
+    "deduplicate",
+    "Parsers drop exact duplicate statements before the statement handler"
+  },
+  { RAPTOR_OPTION_SERIALIZE_SPILL_SIZE,
+    RAPTOR_OPTION_AREA_SERIALIZER,
+    RAPTOR_OPTION_VALUE_TYPE_INT,
+    "serializeSpillSize",
+    "Abbreviating serializers spill statements beyond N to sorted temporary files"
+  },
+  { RAPTOR_OPTION_READ_BUFFER_SIZE,
+    RAPTOR_OPTION_AREA_PARSER,
+    RAPTOR_OPTION_VALUE_TYPE_INT,
+    "readBufferSize",
+    "Read buffer size in bytes for parsing files and streams"
+  },
+  { RAPTOR_OPTION_SERIALIZE_ROW_LIMIT,
+    RAPTOR_OPTION_AREA_SERIALIZER,
+    RAPTOR_OPTION_VALUE_TYPE_INT,
+    "serializeRowLimit",
+    "HTML table serializer renders only the first N triples as rows"
+  },
+  { RAPTOR_OPTION_FAIL_FAST,
+    RAPTOR_OPTION_AREA_PARSER,
+    RAPTOR_OPTION_VALUE_TYPE_BOOL,
+    "failFast",
+    "Parsers stop at the first error without recovery scanning"
   }
 };
 
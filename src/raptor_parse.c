@@ -43,6 +43,12 @@
 #ifdef HAVE_FCNTL_H
 #include <fcntl.h>
 #endif
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
 
 /* Raptor includes */
 #include "raptor2.h"
@@ -53,6 +59,48 @@
 
 /* prototypes for helper functions */
 static void raptor_parser_set_strict(raptor_parser* rdf_parser, int is_strict);
+static void raptor_parser_flush_statement_batch(raptor_parser* parser);
+
+
+/* Duplicate-statement suppression (RAPTOR_OPTION_DEDUPLICATE) */
+
+/* bloom prefilter size in bits (power of two) */
+#define RAPTOR_DEDUP_BLOOM_BITS 65536
+/* exact hash table slots (power of two); a fresh window starts when
+ * the table reaches 3/4 full */
+#define RAPTOR_DEDUP_TABLE_CAPACITY 65536
+
+struct raptor_statement_dedup_s {
+  /* bloom prefilter over statement hashes; a clear bit proves a
+   * statement is new without probing the table */
+  unsigned char bloom[RAPTOR_DEDUP_BLOOM_BITS >> 3];
+  /* open-addressed table of statement hashes; 0 marks an empty slot */
+  unsigned long hashes[RAPTOR_DEDUP_TABLE_CAPACITY];
+  /* the statement behind each occupied hash slot, kept so a hash hit
+   * can be confirmed by raptor_statement_equals() - suppressing on
+   * the hash alone dropped distinct statements that collided */
+  raptor_statement* statements[RAPTOR_DEDUP_TABLE_CAPACITY];
+  size_t count;
+};
+
+/*
+ * raptor_parser_dedup_clear:
+ * @dedup: dedup state
+ *
+ * INTERNAL - Release the retained statements and empty the tables.
+ */
+static void
+raptor_parser_dedup_clear(struct raptor_statement_dedup_s* dedup)
+{
+  size_t i;
+
+  for(i = 0; i < RAPTOR_DEDUP_TABLE_CAPACITY; i++) {
+    if(dedup->statements[i])
+      raptor_free_statement(dedup->statements[i]);
+  }
+
+  memset(dedup, '\0', sizeof(*dedup));
+}
 
 /* helper methods */
 
@@ -70,68 +118,165 @@ raptor_free_parser_factory(raptor_parser_factory* factory)
 
 /* class methods */
 
-int
-raptor_parsers_init(raptor_world *world)
+#ifdef RAPTOR_PARSER_GRDDL
+static int
+raptor_init_parser_grddl_with_common(raptor_world* world)
 {
-  int rc = 0;
+  int rc;
 
-  world->parsers = raptor_new_sequence((raptor_data_free_handler)raptor_free_parser_factory, NULL);
-  if(!world->parsers)
-    return 1;
-  
-#ifdef RAPTOR_PARSER_RDFXML
-  rc+= raptor_init_parser_rdfxml(world) != 0;
+  rc = raptor_init_parser_grddl_common(world) != 0;
+  rc += raptor_init_parser_grddl(world) != 0;
+
+  return rc;
+}
 #endif
 
+
+/* Constructors of the compiled-in parser factories and the syntax
+ * names each serves.  Factories are registered lazily from this table
+ * on first lookup of one of their names so that a world which only
+ * ever uses one syntax does not construct the others; enumerating or
+ * guessing registers everything.  The table order matches the old
+ * eager registration order so the default (first) parser and the
+ * enumeration order are unchanged.
+ */
+typedef struct {
+  /* syntax names served, NULL terminated */
+  const char* const names[4];
+  int (*init)(raptor_world* world);
+} raptor_parser_registration;
+
+static const raptor_parser_registration raptor_parser_registrations[] = {
+#ifdef RAPTOR_PARSER_RDFXML
+  { { "rdfxml", "raptor", NULL, NULL }, raptor_init_parser_rdfxml },
+#endif
 #ifdef RAPTOR_PARSER_NTRIPLES
-  rc+= raptor_init_parser_ntriples(world) != 0;
+  { { "ntriples", NULL, NULL, NULL }, raptor_init_parser_ntriples },
 #endif
-
 #ifdef RAPTOR_PARSER_N3
-  rc+= raptor_init_parser_n3(world) != 0;
+  { { "n3", NULL, NULL, NULL }, raptor_init_parser_n3 },
 #endif
-
 #ifdef RAPTOR_PARSER_TURTLE
-  rc+= raptor_init_parser_turtle(world) != 0;
+  { { "turtle", "ntriples-plus", "n3", NULL }, raptor_init_parser_turtle },
 #endif
-
 #ifdef RAPTOR_PARSER_TRIG
-  rc+= raptor_init_parser_trig(world) != 0;
+  { { "trig", NULL, NULL, NULL }, raptor_init_parser_trig },
 #endif
-
 #ifdef RAPTOR_PARSER_RSS
-  rc+= raptor_init_parser_rss(world) != 0;
+  { { "rss-tag-soup", NULL, NULL, NULL }, raptor_init_parser_rss },
 #endif
-
-#if defined(RAPTOR_PARSER_GRDDL)
-  rc+= raptor_init_parser_grddl_common(world) != 0;
-
 #ifdef RAPTOR_PARSER_GRDDL
-  rc+= raptor_init_parser_grddl(world) != 0;
+  { { "grddl", NULL, NULL, NULL }, raptor_init_parser_grddl_with_common },
 #endif
-
-#endif
-
 #ifdef RAPTOR_PARSER_GUESS
-  rc+= raptor_init_parser_guess(world) != 0;
+  { { "guess", NULL, NULL, NULL }, raptor_init_parser_guess },
 #endif
-
 #ifdef RAPTOR_PARSER_RDFA
-  rc+= raptor_init_parser_rdfa(world) != 0;
+  { { "rdfa", "rdfa11", "rdfa10", NULL }, raptor_init_parser_rdfa },
 #endif
-
 #ifdef RAPTOR_PARSER_JSON
-  rc+= raptor_init_parser_json(world) != 0;
+  { { "json", NULL, NULL, NULL }, raptor_init_parser_json },
 #endif
-
 #ifdef RAPTOR_PARSER_NQUADS
-  rc+= raptor_init_parser_nquads(world) != 0;
+  { { "nquads", NULL, NULL, NULL }, raptor_init_parser_nquads },
 #endif
+#ifdef RAPTOR_PARSER_BINARY
+  { { "raptor-binary", NULL, NULL, NULL }, raptor_init_parser_binary },
+#endif
+  { { NULL, NULL, NULL, NULL }, NULL }
+};
+
+
+/*
+ * raptor_parsers_register_all:
+ * @world: raptor_world object
+ *
+ * INTERNAL - Register any parser factories not yet constructed.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_parsers_register_all(raptor_world* world)
+{
+  int rc = 0;
+  int i;
+
+  if(world->parsers_fully_registered)
+    return 0;
+
+  for(i = 0; raptor_parser_registrations[i].init; i++) {
+    if(world->parsers_registered & (1U << i))
+      continue;
+    world->parsers_registered |= (1U << i);
+    rc += raptor_parser_registrations[i].init(world) != 0;
+  }
+  world->parsers_fully_registered = 1;
 
   return rc;
 }
 
 
+/*
+ * raptor_parsers_register_name:
+ * @world: raptor_world object
+ * @name: syntax name
+ *
+ * INTERNAL - Ensure the parser factory serving syntax @name is registered.
+ *
+ * A name not in the registration table may still be a factory alias
+ * the table does not list, so it falls back to registering everything.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_parsers_register_name(raptor_world* world, const char* name)
+{
+  int i;
+
+  if(world->parsers_fully_registered)
+    return 0;
+
+  for(i = 0; raptor_parser_registrations[i].init; i++) {
+    int namei;
+    const char* fname;
+
+    for(namei = 0;
+        (fname = raptor_parser_registrations[i].names[namei]);
+        namei++) {
+      if(!strcmp(fname, name))
+        break;
+    }
+    if(!fname)
+      continue;
+
+    if(world->parsers_registered & (1U << i))
+      return 0;
+    world->parsers_registered |= (1U << i);
+    return raptor_parser_registrations[i].init(world) != 0;
+  }
+
+  return raptor_parsers_register_all(world);
+}
+
+
+int
+raptor_parsers_init(raptor_world *world)
+{
+  world->parsers = raptor_new_sequence((raptor_data_free_handler)raptor_free_parser_factory, NULL);
+  if(!world->parsers)
+    return 1;
+
+  /* A thread safe world registers everything up front so that the
+   * factory registry is immutable once raptor_world_open() returns;
+   * otherwise factories are constructed lazily on first use.
+   */
+  if(world->thread_safe)
+    return raptor_parsers_register_all(world) != 0;
+
+  return 0;
+}
+
+
 /*
  * raptor_finish_parsers - delete all the registered parsers
  */
@@ -142,6 +287,14 @@ raptor_parsers_finish(raptor_world *world)
     raptor_free_sequence(world->parsers);
     world->parsers = NULL;
   }
+  if(world->parser_name_index) {
+    raptor_free_avltree(world->parser_name_index);
+    world->parser_name_index = NULL;
+  }
+  if(world->guess_mime_type) {
+    RAPTOR_FREE(char*, world->guess_mime_type);
+    world->guess_mime_type = NULL;
+  }
 #if defined(RAPTOR_PARSER_GRDDL)
   raptor_terminate_parser_grddl_common(world);
 #endif
@@ -187,8 +340,17 @@ raptor_world_register_parser_factory(raptor_world* world,
                      "Parser description failed to validate\n");
     goto tidy;
   }
-  
 
+  /* index every name; the index is an optimization so an indexing
+   * failure just leaves lookups to the linear scan */
+  {
+    int namei;
+    const char* fname;
+
+    for(namei = 0; (fname = parser->desc.names[namei]); namei++)
+      raptor_world_index_syntax_name(&world->parser_name_index, fname,
+                                     parser);
+  }
 
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
   RAPTOR_DEBUG2("Registered parser %s\n", parser->desc.names[0]);
@@ -217,6 +379,11 @@ raptor_world_get_parser_factory(raptor_world *world, const char *name)
 {
   raptor_parser_factory *factory = NULL;
 
+  if(name)
+    raptor_parsers_register_name(world, name);
+  else
+    raptor_parsers_register_all(world);
+
   /* return 1st parser if no particular one wanted - why? */
   if(!name) {
     factory = (raptor_parser_factory *)raptor_sequence_get_at(world->parsers, 0);
@@ -225,23 +392,27 @@ raptor_world_get_parser_factory(raptor_world *world, const char *name)
       return NULL;
     }
   } else {
-    int i;
-    
-    for(i = 0;
-        (factory = (raptor_parser_factory*)raptor_sequence_get_at(world->parsers, i));
-        i++) {
-      int namei;
-      const char* fname;
-      
-      for(namei = 0; (fname = factory->desc.names[namei]); namei++) {
-        if(!strcmp(fname, name))
+    factory = (raptor_parser_factory*)raptor_world_lookup_syntax_name(world->parser_name_index, name);
+    if(!factory) {
+      /* linear scan in case the name could not be indexed */
+      int i;
+
+      for(i = 0;
+          (factory = (raptor_parser_factory*)raptor_sequence_get_at(world->parsers, i));
+          i++) {
+        int namei;
+        const char* fname;
+
+        for(namei = 0; (fname = factory->desc.names[namei]); namei++) {
+          if(!strcmp(fname, name))
+            break;
+        }
+        if(fname)
           break;
       }
-      if(fname)
-        break;
     }
   }
-        
+
   return factory;
 }
 
@@ -261,6 +432,8 @@ raptor_world_get_parsers_count(raptor_world* world)
 
   raptor_world_open(world);
 
+  raptor_parsers_register_all(world);
+
   return raptor_sequence_size(world->parsers);
 }
 
@@ -283,7 +456,9 @@ raptor_world_get_parser_description(raptor_world* world,
   RAPTOR_ASSERT_OBJECT_POINTER_RETURN_VALUE(world, raptor_world, NULL);
 
   raptor_world_open(world);
-  
+
+  raptor_parsers_register_all(world);
+
   factory = (raptor_parser_factory*)raptor_sequence_get_at(world->parsers,
                                                            counter);
 
@@ -428,8 +603,34 @@ raptor_new_parser_for_content(raptor_world* world,
  * 
  * Return value: non-0 on failure, <0 if a required base URI was missing
  **/
+/*
+ * raptor_parser_snapshot_options:
+ * @rdf_parser: RDF parser
+ *
+ * INTERNAL - Capture the hot boolean options as direct-load fields.
+ *
+ * Called at parse start and whenever an option is set so the
+ * per-statement and per-line paths never index the options array.
+ */
+void
+raptor_parser_snapshot_options(raptor_parser* rdf_parser)
+{
+  rdf_parser->option_snapshot.deduplicate =
+    RAPTOR_OPTIONS_GET_NUMERIC(rdf_parser, RAPTOR_OPTION_DEDUPLICATE) ? 1 : 0;
+  rdf_parser->option_snapshot.cheap_locator =
+    RAPTOR_OPTIONS_GET_NUMERIC(rdf_parser, RAPTOR_OPTION_CHEAP_LOCATOR) ? 1 : 0;
+  rdf_parser->option_snapshot.fail_fast =
+    RAPTOR_OPTIONS_GET_NUMERIC(rdf_parser, RAPTOR_OPTION_FAIL_FAST) ? 1 : 0;
+
+  /* with no per-statement option enabled the specialized emit path
+   * can bypass raptor_parser_emit_statement() entirely */
+  rdf_parser->option_snapshot.emit_directly =
+    rdf_parser->option_snapshot.deduplicate ? 0 : 1;
+}
+
+
 int
-raptor_parser_parse_start(raptor_parser *rdf_parser, raptor_uri *uri) 
+raptor_parser_parse_start(raptor_parser *rdf_parser, raptor_uri *uri)
 {
   if((rdf_parser->factory->desc.flags & RAPTOR_SYNTAX_NEED_BASE_URI) && !uri) {
     raptor_parser_error(rdf_parser, "Missing base URI for %s parser.",
@@ -449,6 +650,11 @@ raptor_parser_parse_start(raptor_parser *rdf_parser, raptor_uri *uri)
   rdf_parser->locator.column = -1;
   rdf_parser->locator.byte   = -1;
 
+  raptor_parser_snapshot_options(rdf_parser);
+
+  /* blank node labels are scoped to one document */
+  raptor_parser_clear_bnode_map(rdf_parser);
+
   if(rdf_parser->factory->start)
     return rdf_parser->factory->start(rdf_parser);
   else
@@ -456,6 +662,43 @@ raptor_parser_parse_start(raptor_parser *rdf_parser, raptor_uri *uri)
 }
 
 
+/**
+ * raptor_parser_parse_start_at_offset:
+ * @rdf_parser: RDF parser
+ * @uri: base URI or may be NULL if no base URI is required
+ * @byte_offset: byte offset in the original file at which the first chunk starts
+ *
+ * Start a parse of content taken from the middle of a file.
+ *
+ * Works like raptor_parser_parse_start() but presets the locator byte
+ * position to @byte_offset, so errors and locator queries report
+ * absolute positions in the original file while the caller feeds only
+ * the bytes from @byte_offset onwards to
+ * raptor_parser_parse_chunk().  Line numbers are counted from the
+ * start of the fed content since the true line number is unknown.
+ *
+ * Intended for line-oriented syntaxes such as N-Triples and N-Quads
+ * together with raptor_parser_get_split_offsets(), which finds byte
+ * offsets that fall on safe line boundaries.
+ *
+ * Return value: non-0 on failure, <0 if a required base URI was missing
+ **/
+int
+raptor_parser_parse_start_at_offset(raptor_parser *rdf_parser,
+                                    raptor_uri *uri, size_t byte_offset)
+{
+  int rc;
+
+  rc = raptor_parser_parse_start(rdf_parser, uri);
+  if(rc)
+    return rc;
+
+  rdf_parser->locator.byte = RAPTOR_BAD_CAST(int, byte_offset);
+
+  return 0;
+}
+
+
 
 
 /**
@@ -476,10 +719,24 @@ int
 raptor_parser_parse_chunk(raptor_parser* rdf_parser,
                           const unsigned char *buffer, size_t len, int is_end) 
 {
+  int rc;
+
+  RAPTOR_STATS_ADD(bytes_parsed, len);
+
   if(rdf_parser->sb)
     raptor_stringbuffer_append_counted_string(rdf_parser->sb, buffer, len, 1);
     
-  return rdf_parser->factory->chunk(rdf_parser, buffer, len, is_end);
+  rc = rdf_parser->factory->chunk(rdf_parser, buffer, len, is_end);
+
+  /* with fail-fast an error marks the parser failed even where the
+   * syntax-level chunk handler would have recovered and carried on */
+  if(!rc && rdf_parser->failed && rdf_parser->option_snapshot.fail_fast)
+    rc = 1;
+
+  if(is_end && rdf_parser->statement_batch)
+    raptor_parser_flush_statement_batch(rdf_parser);
+
+  return rc;
 }
 
 
@@ -511,12 +768,96 @@ raptor_free_parser(raptor_parser* rdf_parser)
   if(rdf_parser->sb)
     raptor_free_stringbuffer(rdf_parser->sb);
 
+  if(rdf_parser->statement_batch) {
+    raptor_parser_flush_statement_batch(rdf_parser);
+    RAPTOR_FREE(raptor_statement**, rdf_parser->statement_batch);
+  }
+
+  if(rdf_parser->dedup) {
+    raptor_parser_dedup_clear(rdf_parser->dedup);
+    RAPTOR_FREE(raptor_statement_dedup, rdf_parser->dedup);
+  }
+
+  raptor_parser_free_bnode_map(rdf_parser);
+
   raptor_object_options_clear(&rdf_parser->options);
 
   RAPTOR_FREE(raptor_parser, rdf_parser);
 }
 
 
+/**
+ * raptor_parser_reset:
+ * @rdf_parser: #raptor_parser object
+ *
+ * Return a parser to its post-construction state for reuse.
+ *
+ * Makes the parser ready for a new raptor_parser_parse_start()
+ * without destroying and re-creating it, so loops over many small
+ * documents keep the parser object, its read buffer and the factory
+ * lookup warm instead of paying the full construction cost per
+ * document.
+ *
+ * Options and the statement, graph mark, namespace and URI filter
+ * handlers set on the parser are preserved.  Statements batched but
+ * not yet delivered are discarded along with any other state of the
+ * current document.
+ *
+ * Return value: non-0 on failure
+ **/
+int
+raptor_parser_reset(raptor_parser* rdf_parser)
+{
+  size_t i;
+
+  RAPTOR_ASSERT_OBJECT_POINTER_RETURN_VALUE(rdf_parser, raptor_parser, 1);
+
+  if(rdf_parser->factory)
+    rdf_parser->factory->terminate(rdf_parser);
+
+  if(rdf_parser->www) {
+    raptor_free_www(rdf_parser->www);
+    rdf_parser->www = NULL;
+  }
+
+  if(rdf_parser->base_uri) {
+    raptor_free_uri(rdf_parser->base_uri);
+    rdf_parser->base_uri = NULL;
+  }
+
+  if(rdf_parser->sb) {
+    raptor_free_stringbuffer(rdf_parser->sb);
+    rdf_parser->sb = NULL;
+  }
+
+  /* drop - not deliver - statements pending from an unfinished parse */
+  for(i = 0; i < rdf_parser->statement_batch_count; i++)
+    raptor_free_statement(rdf_parser->statement_batch[i]);
+  rdf_parser->statement_batch_count = 0;
+
+  /* statements of the next document must not count as duplicates of
+   * this one's */
+  if(rdf_parser->dedup)
+    raptor_parser_dedup_clear(rdf_parser->dedup);
+
+  raptor_parser_clear_bnode_map(rdf_parser);
+
+  raptor_statement_clear(&rdf_parser->statement);
+
+  memset(&rdf_parser->locator, '\0', sizeof(rdf_parser->locator));
+
+  rdf_parser->failed = 0;
+  rdf_parser->emit_graph_marks = 1;
+  rdf_parser->emitted_default_graph = 0;
+  rdf_parser->genid = 0;
+
+  /* re-initialize the factory context like raptor_new_parser() */
+  memset(rdf_parser->context, '\0', rdf_parser->factory->context_length);
+  return rdf_parser->factory->init(rdf_parser,
+                                   rdf_parser->factory->desc.names[0]);
+}
+
+
 /**
  * raptor_parser_parse_file_stream:
  * @rdf_parser: parser
@@ -536,6 +877,7 @@ raptor_parser_parse_file_stream(raptor_parser* rdf_parser,
                                 raptor_uri *base_uri)
 {
   int rc = 0;
+  int buffer_size;
   raptor_locator *locator = &rdf_parser->locator;
 
   if(!stream || !base_uri)
@@ -546,7 +888,53 @@ raptor_parser_parse_file_stream(raptor_parser* rdf_parser,
 
   if(raptor_parser_parse_start(rdf_parser, base_uri))
     return 1;
-  
+
+  buffer_size = RAPTOR_OPTIONS_GET_NUMERIC(rdf_parser,
+                                           RAPTOR_OPTION_READ_BUFFER_SIZE);
+  if(buffer_size > 0) {
+    /* RAPTOR_OPTION_READ_BUFFER_SIZE: read in large chunks and, where
+     * threads are available, let a readahead thread fill the next
+     * chunk while this one is parsed */
+    size_t len = RAPTOR_GOOD_CAST(size_t, buffer_size);
+    unsigned char* buffer;
+    raptor_iostream* iostr;
+
+#if defined(HAVE_POSIX_FADVISE) && defined(HAVE_UNISTD_H)
+    posix_fadvise(fileno(stream), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    buffer = RAPTOR_MALLOC(unsigned char*, len + 1);
+    if(!buffer)
+      return 1;
+
+    /* NULL means threads are unavailable; read directly instead */
+    iostr = raptor_new_iostream_from_file_handle_read_ahead(rdf_parser->world,
+                                                            stream, len, 0);
+
+    while(1) {
+      size_t read_len;
+      int is_end;
+
+      if(iostr) {
+        int ilen = raptor_iostream_read_bytes(buffer, 1, len, iostr);
+        read_len = (ilen > 0) ? RAPTOR_GOOD_CAST(size_t, ilen) : 0;
+      } else
+        read_len = fread(buffer, 1, len, stream);
+
+      is_end = (read_len < len);
+      buffer[read_len] = '\0';
+      rc = raptor_parser_parse_chunk(rdf_parser, buffer, read_len, is_end);
+      if(rc || is_end)
+        break;
+    }
+
+    if(iostr)
+      raptor_free_iostream(iostr);
+    RAPTOR_FREE(char*, buffer);
+
+    return (rc != 0);
+  }
+
   while(!feof(stream)) {
     size_t len = fread(rdf_parser->buffer, 1, RAPTOR_READ_BUFFER_SIZE, stream);
     int is_end = (len < RAPTOR_READ_BUFFER_SIZE);
@@ -628,6 +1016,111 @@ raptor_parser_parse_file(raptor_parser* rdf_parser, raptor_uri *uri,
 }
 
 
+/**
+ * raptor_parser_parse_file_mapped:
+ * @rdf_parser: parser
+ * @uri: URI of RDF content or NULL to read from standard input
+ * @base_uri: the base URI to use (or NULL if the same)
+ *
+ * Parse RDF content at a file URI via a single memory mapping.
+ *
+ * Maps the whole file and hands the parser one contiguous region, so
+ * the content is scanned in place with no copy through an intermediate
+ * read buffer and no chunk-boundary buffering.  The mapping is advised
+ * for sequential access where madvise() is available.
+ *
+ * Where mapping is unavailable (no mmap() on the platform, @uri is
+ * NULL meaning standard input, or the file cannot be mapped) this
+ * falls back to raptor_parser_parse_file().
+ *
+ * Return value: non 0 on failure
+ **/
+int
+raptor_parser_parse_file_mapped(raptor_parser* rdf_parser, raptor_uri *uri,
+                                raptor_uri *base_uri)
+{
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_UNISTD_H) && defined(HAVE_SYS_STAT_H) && defined(HAVE_FCNTL_H)
+  int rc = 0;
+  int free_base_uri = 0;
+  const char *filename = NULL;
+  int fd = -1;
+  void *addr = MAP_FAILED;
+  size_t size = 0;
+  struct stat buf;
+  raptor_locator *locator = &rdf_parser->locator;
+
+  if(!uri)
+    /* stdin cannot be mapped */
+    return raptor_parser_parse_file(rdf_parser, uri, base_uri);
+
+  filename = raptor_uri_uri_string_to_filename(raptor_uri_as_string(uri));
+  if(!filename)
+    return 1;
+
+  fd = open(filename, O_RDONLY);
+  if(fd < 0) {
+    raptor_parser_error(rdf_parser, "file '%s' open failed - %s",
+                        filename, strerror(errno));
+    rc = 1;
+    goto cleanup;
+  }
+
+  if(fstat(fd, &buf) || !S_ISREG(buf.st_mode)) {
+    /* not a regular file - let the stream path deal with it */
+    close(fd);
+    RAPTOR_FREE(char*, filename);
+    return raptor_parser_parse_file(rdf_parser, uri, base_uri);
+  }
+  size = (size_t)buf.st_size;
+
+  if(size) {
+    addr = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(addr == MAP_FAILED) {
+      close(fd);
+      RAPTOR_FREE(char*, filename);
+      return raptor_parser_parse_file(rdf_parser, uri, base_uri);
+    }
+#ifdef MADV_SEQUENTIAL
+    (void)madvise(addr, size, MADV_SEQUENTIAL);
+#endif
+  }
+
+  if(!base_uri) {
+    base_uri = raptor_uri_copy(uri);
+    free_base_uri = 1;
+  }
+
+  locator->line = locator->column = -1;
+  locator->file = filename;
+
+  if(raptor_parser_parse_start(rdf_parser, base_uri)) {
+    rc = 1;
+    goto cleanup;
+  }
+
+  rc = raptor_parser_parse_chunk(rdf_parser,
+                                 size ? (const unsigned char*)addr
+                                      : (const unsigned char*)"",
+                                 size, 1);
+
+  cleanup:
+  if(addr != MAP_FAILED)
+    (void)munmap(addr, size);
+  if(fd >= 0)
+    close(fd);
+  locator->file = NULL;
+  if(filename)
+    RAPTOR_FREE(char*, filename);
+  if(free_base_uri)
+    raptor_free_uri(base_uri);
+
+  return (rc != 0);
+#else
+  return raptor_parser_parse_file(rdf_parser, uri, base_uri);
+#endif
+}
+
+
 void
 raptor_parser_parse_uri_write_bytes(raptor_www* www,
                                     void *userdata, const void *ptr, 
@@ -697,138 +1190,470 @@ int
 raptor_parser_parse_uri(raptor_parser* rdf_parser, raptor_uri *uri,
                         raptor_uri *base_uri)
 {
-  return raptor_parser_parse_uri_with_connection(rdf_parser, uri, base_uri,
-                                                 NULL);
+  return raptor_parser_parse_uri_with_connection(rdf_parser, uri, base_uri,
+                                                 NULL);
+}
+
+
+/**
+ * raptor_parser_parse_uri_with_connection:
+ * @rdf_parser: parser
+ * @uri: URI of RDF content
+ * @base_uri: the base URI to use (or NULL if the same)
+ * @connection: connection object pointer or NULL to create a new one
+ *
+ * Parse RDF content at URI using existing WWW connection.
+ * 
+ * If @base_uri is not given and during resolution of the URI, a
+ * protocol redirection occurs, the final resolved URI will be
+ * used as the base URI.  If redirection does not occur, the
+ * base URI will be @uri.
+ *
+ * If @base_uri is given, it overrides the process above.
+ *
+ * When @connection is NULL and a MIME Type exists for the parser
+ * type, this type is sent in an HTTP Accept: header in the form
+ * Accept: MIME-TYPE along with a wildcard of 0.1 quality, so MIME-TYPE is
+ * prefered rather than the sole answer.  The latter part may not be
+ * necessary but should ensure an HTTP 200 response.
+ *
+ * Return value: non 0 on failure
+ **/
+/*
+ * raptor_parser_prepare_www:
+ * @rdf_parser: parser
+ * @connection: connection object pointer or NULL to create a new one
+ *
+ * INTERNAL - Create and configure the parser WWW object for a fetch.
+ *
+ * Applies the accept header, URI filter, cache control, user agent
+ * and SSL options; the caller sets the write bytes and content type
+ * handlers.
+ *
+ * Return value: non 0 on failure
+ */
+static int
+raptor_parser_prepare_www(raptor_parser* rdf_parser, void *connection)
+{
+  char* ua = NULL;
+  char* cert_filename = NULL;
+  char* cert_type = NULL;
+  char* cert_passphrase = NULL;
+  int ssl_verify_peer;
+  int ssl_verify_host;
+
+  if(connection) {
+    if(rdf_parser->www)
+      raptor_free_www(rdf_parser->www);
+    rdf_parser->www = raptor_new_www_with_connection(rdf_parser->world,
+                                                     connection);
+    if(!rdf_parser->www)
+      return 1;
+  } else {
+    const char *accept_h;
+    
+    if(rdf_parser->www)
+      raptor_free_www(rdf_parser->www);
+    rdf_parser->www = raptor_new_www(rdf_parser->world);
+    if(!rdf_parser->www)
+      return 1;
+
+    accept_h = raptor_parser_get_accept_header(rdf_parser);
+    if(accept_h) {
+      raptor_www_set_http_accept(rdf_parser->www, accept_h);
+      RAPTOR_FREE(char*, accept_h);
+    }
+  }
+
+  if(rdf_parser->uri_filter)
+    raptor_www_set_uri_filter(rdf_parser->www, rdf_parser->uri_filter,
+                              rdf_parser->uri_filter_user_data);
+  else if(RAPTOR_OPTIONS_GET_NUMERIC(rdf_parser, RAPTOR_OPTION_NO_NET))
+    raptor_www_set_uri_filter(rdf_parser->www,
+                              raptor_parser_set_uri_filter_no_net, rdf_parser);
+
+  raptor_www_set_http_cache_control(rdf_parser->www, 
+                                    RAPTOR_OPTIONS_GET_STRING(rdf_parser, 
+                                                              RAPTOR_OPTION_WWW_HTTP_CACHE_CONTROL));
+
+  ua = RAPTOR_OPTIONS_GET_STRING(rdf_parser, RAPTOR_OPTION_WWW_HTTP_USER_AGENT);
+  if(ua)
+    raptor_www_set_user_agent(rdf_parser->www, ua);
+
+  cert_filename = RAPTOR_OPTIONS_GET_STRING(rdf_parser,
+                                            RAPTOR_OPTION_WWW_CERT_FILENAME);
+  cert_type = RAPTOR_OPTIONS_GET_STRING(rdf_parser,
+                                        RAPTOR_OPTION_WWW_CERT_TYPE);
+  cert_passphrase = RAPTOR_OPTIONS_GET_STRING(rdf_parser,
+                                              RAPTOR_OPTION_WWW_CERT_PASSPHRASE);
+  if(cert_filename || cert_type || cert_passphrase)
+    raptor_www_set_ssl_cert_options(rdf_parser->www, cert_filename,
+                                    cert_type, cert_passphrase);
+  
+  ssl_verify_peer = RAPTOR_OPTIONS_GET_NUMERIC(rdf_parser,
+                                               RAPTOR_OPTION_WWW_SSL_VERIFY_PEER);
+  ssl_verify_host = RAPTOR_OPTIONS_GET_NUMERIC(rdf_parser,
+                                               RAPTOR_OPTION_WWW_SSL_VERIFY_HOST);
+  raptor_www_set_ssl_verify_options(rdf_parser->www, ssl_verify_peer,
+                                    ssl_verify_host);
+
+  return 0;
+}
+
+
+int
+raptor_parser_parse_uri_with_connection(raptor_parser* rdf_parser,
+                                        raptor_uri *uri,
+                                        raptor_uri *base_uri, void *connection)
+{
+  int ret = 0;
+  raptor_parse_bytes_context rpbc;
+
+  if(raptor_parser_prepare_www(rdf_parser, connection))
+    return 1;
+
+  rpbc.rdf_parser = rdf_parser;
+  rpbc.base_uri = base_uri;
+  rpbc.final_uri = NULL;
+  rpbc.started = 0;
+  
+  raptor_www_set_write_bytes_handler(rdf_parser->www,
+                                     raptor_parser_parse_uri_write_bytes, 
+                                     &rpbc);
+
+  raptor_www_set_content_type_handler(rdf_parser->www,
+                                      raptor_parser_parse_uri_content_type_handler,
+                                      rdf_parser);
+
+  ret = raptor_www_fetch(rdf_parser->www, uri);
+  
+  if(!rpbc.started && !ret)
+    ret = raptor_parser_parse_start(rdf_parser, base_uri);
+
+  if(rpbc.final_uri)
+    raptor_free_uri(rpbc.final_uri);
+
+  if(ret) {
+    raptor_free_www(rdf_parser->www);
+    rdf_parser->www = NULL;
+    return 1;
+  }
+
+  if(raptor_parser_parse_chunk(rdf_parser, NULL, 0, 1))
+    rdf_parser->failed = 1;
+
+  raptor_free_www(rdf_parser->www);
+  rdf_parser->www = NULL;
+
+  return rdf_parser->failed;
+}
+
+
+/*
+ * Overlapped fetch-and-parse engine.
+ *
+ * raptor_parser_parse_uri_with_connection() parses from inside the
+ * WWW write callback, so network wait and parse CPU time serialize.
+ * Here the fetch runs on a worker thread that copies incoming chunks
+ * into a bounded queue while the calling thread drains the queue into
+ * raptor_parser_parse_chunk(), overlapping network and CPU.
+ */
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+
+/* stop queueing more than this many bytes ahead of the parser */
+#define RAPTOR_FETCH_QUEUE_MAX_BYTES (256 * 1024)
+
+/* one fetched data chunk or content type event, in arrival order */
+typedef struct raptor_fetch_chunk_s {
+  struct raptor_fetch_chunk_s* next;
+  /* non-NULL for a content type event; data is then unused */
+  char* content_type;
+  /* final URI after redirects, known at the first data chunk */
+  raptor_uri* final_uri;
+  /* points into trailing storage of this same allocation; the source
+   * buffer is only valid during the WWW write callback so this is the
+   * one place the bytes are copied on their way to parse_chunk()
+   */
+  unsigned char* data;
+  size_t length;
+} raptor_fetch_chunk;
+
+typedef struct {
+  raptor_parser* rdf_parser;
+  raptor_uri* uri;
+  pthread_mutex_t lock;
+  pthread_cond_t not_empty;
+  pthread_cond_t not_full;
+  raptor_fetch_chunk* head;
+  raptor_fetch_chunk* tail;
+  size_t queued_bytes;
+  int done;     /* fetch thread has finished */
+  int failed;   /* consumer failed; fetch should abort */
+  int fetch_rc;
+  int got_first_chunk;
+} raptor_fetch_queue;
+
+
+static void
+raptor_free_fetch_chunk(raptor_fetch_chunk* chunk)
+{
+  if(chunk->content_type)
+    RAPTOR_FREE(char*, chunk->content_type);
+  if(chunk->final_uri)
+    raptor_free_uri(chunk->final_uri);
+  /* chunk->data lives in the same allocation */
+  RAPTOR_FREE(raptor_fetch_chunk*, chunk);
+}
+
+
+/* INTERNAL - append a chunk, blocking while the queue is full.
+ * Takes ownership of @chunk.  Return value: non 0 if the consumer
+ * failed and the fetch should abort.
+ */
+static int
+raptor_fetch_queue_push(raptor_fetch_queue* queue, raptor_fetch_chunk* chunk)
+{
+  pthread_mutex_lock(&queue->lock);
+  while(queue->queued_bytes >= RAPTOR_FETCH_QUEUE_MAX_BYTES && !queue->failed)
+    pthread_cond_wait(&queue->not_full, &queue->lock);
+
+  if(queue->failed) {
+    pthread_mutex_unlock(&queue->lock);
+    raptor_free_fetch_chunk(chunk);
+    return 1;
+  }
+
+  chunk->next = NULL;
+  if(queue->tail)
+    queue->tail->next = chunk;
+  else
+    queue->head = chunk;
+  queue->tail = chunk;
+  queue->queued_bytes += chunk->length;
+
+  pthread_cond_signal(&queue->not_empty);
+  pthread_mutex_unlock(&queue->lock);
+  return 0;
+}
+
+
+static void
+raptor_parser_fetch_write_bytes(raptor_www* www, void *userdata,
+                                const void *ptr, size_t size, size_t nmemb)
+{
+  raptor_fetch_queue* queue = (raptor_fetch_queue*)userdata;
+  size_t len = size * nmemb;
+  raptor_fetch_chunk* chunk;
+
+  /* one allocation holding the chunk header and the payload bytes */
+  chunk = RAPTOR_CALLOC(raptor_fetch_chunk*, 1, sizeof(*chunk) + len);
+  if(!chunk) {
+    raptor_www_abort(www, "Out of memory");
+    return;
+  }
+
+  if(!queue->got_first_chunk) {
+    /* base URI after URI resolution is finally chosen */
+    chunk->final_uri = raptor_www_get_final_uri(www);
+    queue->got_first_chunk = 1;
+  }
+
+  if(len) {
+    chunk->data = (unsigned char*)chunk + sizeof(*chunk);
+    memcpy(chunk->data, ptr, len);
+    chunk->length = len;
+  }
+
+  if(raptor_fetch_queue_push(queue, chunk))
+    raptor_www_abort(www, "Parsing failed");
+}
+
+
+static void
+raptor_parser_fetch_content_type_handler(raptor_www* www, void* userdata,
+                                         const char* content_type)
+{
+  raptor_fetch_queue* queue = (raptor_fetch_queue*)userdata;
+  size_t ct_len = strlen(content_type);
+  raptor_fetch_chunk* chunk;
+
+  chunk = RAPTOR_CALLOC(raptor_fetch_chunk*, 1, sizeof(*chunk));
+  if(!chunk)
+    return;
+
+  chunk->content_type = RAPTOR_MALLOC(char*, ct_len + 1);
+  if(!chunk->content_type) {
+    RAPTOR_FREE(raptor_fetch_chunk*, chunk);
+    return;
+  }
+  memcpy(chunk->content_type, content_type, ct_len + 1);
+
+  if(raptor_fetch_queue_push(queue, chunk))
+    raptor_www_abort(www, "Parsing failed");
+}
+
+
+static void*
+raptor_parser_fetch_thread(void* arg)
+{
+  raptor_fetch_queue* queue = (raptor_fetch_queue*)arg;
+  int rc;
+
+  rc = raptor_www_fetch(queue->rdf_parser->www, queue->uri);
+
+  pthread_mutex_lock(&queue->lock);
+  queue->fetch_rc = rc;
+  queue->done = 1;
+  pthread_cond_signal(&queue->not_empty);
+  pthread_mutex_unlock(&queue->lock);
+
+  return NULL;
 }
+#endif /* HAVE_PTHREAD_H */
 
 
 /**
- * raptor_parser_parse_uri_with_connection:
+ * raptor_parser_parse_uri_overlapped:
  * @rdf_parser: parser
  * @uri: URI of RDF content
  * @base_uri: the base URI to use (or NULL if the same)
- * @connection: connection object pointer or NULL to create a new one
  *
- * Parse RDF content at URI using existing WWW connection.
- * 
- * If @base_uri is not given and during resolution of the URI, a
- * protocol redirection occurs, the final resolved URI will be
- * used as the base URI.  If redirection does not occur, the
- * base URI will be @uri.
+ * Parse the RDF content at URI, overlapping fetch and parse.
  *
- * If @base_uri is given, it overrides the process above.
+ * The network fetch runs on an internal thread that queues incoming
+ * chunks while the calling thread parses them, so network wait and
+ * parse CPU time overlap instead of serializing as they do in
+ * raptor_parser_parse_uri().  Statement and other parser handlers
+ * are called on the calling thread as usual; errors from the fetch
+ * side may however be logged from the internal thread, so the log
+ * handler must be safe to call from a second thread in this mode.
  *
- * When @connection is NULL and a MIME Type exists for the parser
- * type, this type is sent in an HTTP Accept: header in the form
- * Accept: MIME-TYPE along with a wildcard of 0.1 quality, so MIME-TYPE is
- * prefered rather than the sole answer.  The latter part may not be
- * necessary but should ensure an HTTP 200 response.
+ * The @base_uri is chosen as described for
+ * raptor_parser_parse_uri_with_connection().
+ *
+ * Falls back to raptor_parser_parse_uri() when the platform has no
+ * thread support.
  *
  * Return value: non 0 on failure
  **/
 int
-raptor_parser_parse_uri_with_connection(raptor_parser* rdf_parser,
-                                        raptor_uri *uri,
-                                        raptor_uri *base_uri, void *connection)
+raptor_parser_parse_uri_overlapped(raptor_parser* rdf_parser, raptor_uri *uri,
+                                   raptor_uri *base_uri)
 {
-  int ret = 0;
-  raptor_parse_bytes_context rpbc;
-  char* ua = NULL;
-  char* cert_filename = NULL;
-  char* cert_type = NULL;
-  char* cert_passphrase = NULL;
-  int ssl_verify_peer;
-  int ssl_verify_host;
+#ifdef HAVE_PTHREAD_H
+  raptor_fetch_queue queue;
+  pthread_t thread;
+  int started = 0;
+  int failed = 0;
+  int ret;
+
+  if(raptor_parser_prepare_www(rdf_parser, NULL))
+    return 1;
 
-  if(connection) {
-    if(rdf_parser->www)
-      raptor_free_www(rdf_parser->www);
-    rdf_parser->www = raptor_new_www_with_connection(rdf_parser->world,
-                                                     connection);
-    if(!rdf_parser->www)
-      return 1;
-  } else {
-    const char *accept_h;
-    
-    if(rdf_parser->www)
-      raptor_free_www(rdf_parser->www);
-    rdf_parser->www = raptor_new_www(rdf_parser->world);
-    if(!rdf_parser->www)
-      return 1;
+  memset(&queue, '\0', sizeof(queue));
+  queue.rdf_parser = rdf_parser;
+  queue.uri = uri;
+  pthread_mutex_init(&queue.lock, NULL);
+  pthread_cond_init(&queue.not_empty, NULL);
+  pthread_cond_init(&queue.not_full, NULL);
 
-    accept_h = raptor_parser_get_accept_header(rdf_parser);
-    if(accept_h) {
-      raptor_www_set_http_accept(rdf_parser->www, accept_h);
-      RAPTOR_FREE(char*, accept_h);
-    }
+  raptor_www_set_write_bytes_handler(rdf_parser->www,
+                                     raptor_parser_fetch_write_bytes,
+                                     &queue);
+  raptor_www_set_content_type_handler(rdf_parser->www,
+                                      raptor_parser_fetch_content_type_handler,
+                                      &queue);
+
+  if(pthread_create(&thread, NULL, raptor_parser_fetch_thread, &queue)) {
+    pthread_cond_destroy(&queue.not_full);
+    pthread_cond_destroy(&queue.not_empty);
+    pthread_mutex_destroy(&queue.lock);
+    raptor_free_www(rdf_parser->www);
+    rdf_parser->www = NULL;
+    return raptor_parser_parse_uri(rdf_parser, uri, base_uri);
   }
 
-  rpbc.rdf_parser = rdf_parser;
-  rpbc.base_uri = base_uri;
-  rpbc.final_uri = NULL;
-  rpbc.started = 0;
-  
-  if(rdf_parser->uri_filter)
-    raptor_www_set_uri_filter(rdf_parser->www, rdf_parser->uri_filter,
-                              rdf_parser->uri_filter_user_data);
-  else if(RAPTOR_OPTIONS_GET_NUMERIC(rdf_parser, RAPTOR_OPTION_NO_NET))
-    raptor_www_set_uri_filter(rdf_parser->www,
-                              raptor_parser_set_uri_filter_no_net, rdf_parser);
-  
-  raptor_www_set_write_bytes_handler(rdf_parser->www,
-                                     raptor_parser_parse_uri_write_bytes, 
-                                     &rpbc);
+  for(;;) {
+    raptor_fetch_chunk* chunk;
 
-  raptor_www_set_content_type_handler(rdf_parser->www,
-                                      raptor_parser_parse_uri_content_type_handler,
-                                      rdf_parser);
+    pthread_mutex_lock(&queue.lock);
+    while(!queue.head && !queue.done)
+      pthread_cond_wait(&queue.not_empty, &queue.lock);
 
-  raptor_www_set_http_cache_control(rdf_parser->www, 
-                                    RAPTOR_OPTIONS_GET_STRING(rdf_parser, 
-                                                              RAPTOR_OPTION_WWW_HTTP_CACHE_CONTROL));
+    chunk = queue.head;
+    if(chunk) {
+      queue.head = chunk->next;
+      if(!queue.head)
+        queue.tail = NULL;
+      queue.queued_bytes -= chunk->length;
+      pthread_cond_signal(&queue.not_full);
+    }
+    pthread_mutex_unlock(&queue.lock);
 
-  ua = RAPTOR_OPTIONS_GET_STRING(rdf_parser, RAPTOR_OPTION_WWW_HTTP_USER_AGENT);
-  if(ua)
-    raptor_www_set_user_agent(rdf_parser->www, ua);
+    if(!chunk)
+      /* queue drained and fetch finished */
+      break;
 
-  cert_filename = RAPTOR_OPTIONS_GET_STRING(rdf_parser,
-                                            RAPTOR_OPTION_WWW_CERT_FILENAME);
-  cert_type = RAPTOR_OPTIONS_GET_STRING(rdf_parser,
-                                        RAPTOR_OPTION_WWW_CERT_TYPE);
-  cert_passphrase = RAPTOR_OPTIONS_GET_STRING(rdf_parser,
-                                              RAPTOR_OPTION_WWW_CERT_PASSPHRASE);
-  if(cert_filename || cert_type || cert_passphrase)
-    raptor_www_set_ssl_cert_options(rdf_parser->www, cert_filename,
-                                    cert_type, cert_passphrase);
-  
-  ssl_verify_peer = RAPTOR_OPTIONS_GET_NUMERIC(rdf_parser,
-                                               RAPTOR_OPTION_WWW_SSL_VERIFY_PEER);
-  ssl_verify_host = RAPTOR_OPTIONS_GET_NUMERIC(rdf_parser,
-                                               RAPTOR_OPTION_WWW_SSL_VERIFY_HOST);
-  raptor_www_set_ssl_verify_options(rdf_parser->www, ssl_verify_peer,
-                                    ssl_verify_host);
+    if(failed) {
+      raptor_free_fetch_chunk(chunk);
+      continue;
+    }
 
-  ret = raptor_www_fetch(rdf_parser->www, uri);
-  
-  if(!rpbc.started && !ret)
-    ret = raptor_parser_parse_start(rdf_parser, base_uri);
+    if(chunk->content_type) {
+      if(rdf_parser->factory->content_type_handler)
+        rdf_parser->factory->content_type_handler(rdf_parser,
+                                                  chunk->content_type);
+    } else {
+      if(!started) {
+        raptor_uri* doc_base_uri = base_uri;
 
-  if(rpbc.final_uri)
-    raptor_free_uri(rpbc.final_uri);
+        if(!doc_base_uri)
+          doc_base_uri = chunk->final_uri ? chunk->final_uri : uri;
 
-  if(ret) {
-    raptor_free_www(rdf_parser->www);
-    rdf_parser->www = NULL;
-    return 1;
+        if(raptor_parser_parse_start(rdf_parser, doc_base_uri))
+          failed = 1;
+        started = 1;
+      }
+
+      if(!failed &&
+         raptor_parser_parse_chunk(rdf_parser, chunk->data, chunk->length, 0))
+        failed = 1;
+
+      if(failed) {
+        /* make the fetch side abort rather than fill the queue */
+        pthread_mutex_lock(&queue.lock);
+        queue.failed = 1;
+        pthread_cond_signal(&queue.not_full);
+        pthread_mutex_unlock(&queue.lock);
+      }
+    }
+
+    raptor_free_fetch_chunk(chunk);
   }
 
-  if(raptor_parser_parse_chunk(rdf_parser, NULL, 0, 1))
+  pthread_join(thread, NULL);
+
+  ret = failed || queue.fetch_rc;
+
+  if(!started && !ret)
+    ret = raptor_parser_parse_start(rdf_parser, base_uri);
+
+  if(!ret && raptor_parser_parse_chunk(rdf_parser, NULL, 0, 1))
     rdf_parser->failed = 1;
 
+  pthread_cond_destroy(&queue.not_full);
+  pthread_cond_destroy(&queue.not_empty);
+  pthread_mutex_destroy(&queue.lock);
+
   raptor_free_www(rdf_parser->www);
   rdf_parser->www = NULL;
 
-  return rdf_parser->failed;
+  return ret || rdf_parser->failed;
+#else
+  return raptor_parser_parse_uri(rdf_parser, uri, base_uri);
+#endif
 }
 
 
@@ -881,11 +1706,15 @@ raptor_parser_error(raptor_parser* parser, const char *message, ...)
  *
  * Error from a parser - Internal.
  */  
-void  
+void
 raptor_parser_log_error_varargs(raptor_parser* parser,
                                 raptor_log_level level,
                                 const char *message, va_list arguments)
 {
+  if(parser && level >= RAPTOR_LOG_LEVEL_ERROR &&
+     parser->option_snapshot.fail_fast)
+    parser->failed = 1;
+
   if(parser)
     raptor_log_error_varargs(parser->world,
                              level,
@@ -916,16 +1745,7 @@ raptor_parser_log_error(raptor_parser* parser,
 
   va_start(arguments, message);
 
-  if(parser)
-    raptor_log_error_varargs(parser->world,
-                             level,
-                             &parser->locator,
-                             message, arguments);
-  else
-    raptor_log_error_varargs(NULL,
-                             level,
-                             NULL,
-                             message, arguments);
+  raptor_parser_log_error_varargs(parser, level, message, arguments);
 
   va_end(arguments);
 }
@@ -957,6 +1777,147 @@ raptor_parser_warning(raptor_parser* parser, const char *message, ...)
 
 
 
+/*
+ * raptor_parser_flush_statement_batch:
+ * @parser: parser
+ *
+ * INTERNAL - Deliver any accumulated statements to the batch handler.
+ */
+static void
+raptor_parser_flush_statement_batch(raptor_parser* parser)
+{
+  size_t i;
+
+  if(!parser->statement_batch_count)
+    return;
+
+  (*parser->statement_batch_handler)(parser->statement_batch_user_data,
+                                     parser->statement_batch,
+                                     parser->statement_batch_count);
+
+  for(i = 0; i < parser->statement_batch_count; i++)
+    raptor_free_statement(parser->statement_batch[i]);
+  parser->statement_batch_count = 0;
+}
+
+
+/*
+ * raptor_parser_dedup_seen:
+ * @dedup: dedup state
+ * @statement: statement
+ *
+ * INTERNAL - Record a statement and test whether it was already seen.
+ *
+ * Suppression is windowed: when the exact table fills up, both it and
+ * the bloom prefilter are cleared, so duplicates further apart than
+ * one window of distinct statements are delivered again.  A hash hit
+ * is confirmed with raptor_statement_equals() against the retained
+ * statement before anything is suppressed, so only exact duplicates
+ * are ever dropped.
+ *
+ * Return value: non-0 if @statement is a repeat
+ */
+static int
+raptor_parser_dedup_seen(struct raptor_statement_dedup_s* dedup,
+                         raptor_statement* statement)
+{
+  unsigned long hash;
+  size_t bit;
+  size_t i;
+  int possibly_seen = 1;
+
+  /* term hashes are cached in the terms, so with interned terms this
+   * usually does no string scanning at all */
+  hash = raptor_statement_hash(statement);
+
+  /* start a fresh window when the table gets too full to probe */
+  if(dedup->count >= (RAPTOR_DEDUP_TABLE_CAPACITY -
+                      (RAPTOR_DEDUP_TABLE_CAPACITY >> 2)))
+    raptor_parser_dedup_clear(dedup);
+
+  bit = (size_t)(hash & (RAPTOR_DEDUP_BLOOM_BITS - 1));
+  if(!(dedup->bloom[bit >> 3] & (1 << (bit & 7))))
+    possibly_seen = 0;
+  dedup->bloom[bit >> 3] |= RAPTOR_GOOD_CAST(unsigned char, 1 << (bit & 7));
+
+  bit = (size_t)((hash >> 16) & (RAPTOR_DEDUP_BLOOM_BITS - 1));
+  if(!(dedup->bloom[bit >> 3] & (1 << (bit & 7))))
+    possibly_seen = 0;
+  dedup->bloom[bit >> 3] |= RAPTOR_GOOD_CAST(unsigned char, 1 << (bit & 7));
+
+  for(i = (size_t)(hash & (RAPTOR_DEDUP_TABLE_CAPACITY - 1));
+      dedup->hashes[i];
+      i = (i + 1) & (RAPTOR_DEDUP_TABLE_CAPACITY - 1)) {
+    if(possibly_seen && dedup->hashes[i] == hash &&
+       raptor_statement_equals(dedup->statements[i], statement))
+      return 1;
+  }
+
+  /* if the copy fails the statement is just not recorded; a repeat of
+   * it gets delivered again, which errs on the safe side */
+  dedup->statements[i] = raptor_statement_copy(statement);
+  if(!dedup->statements[i])
+    return 0;
+
+  dedup->hashes[i] = hash;
+  dedup->count++;
+
+  return 0;
+}
+
+
+/*
+ * raptor_parser_emit_statement:
+ * @rdf_parser: parser
+ * @statement: statement
+ *
+ * INTERNAL - Deliver a statement to the current statement handler.
+ *
+ * The handler must be non-NULL; callers check before generating.
+ */
+void
+raptor_parser_emit_statement(raptor_parser* rdf_parser,
+                             raptor_statement* statement)
+{
+  if(rdf_parser->option_snapshot.deduplicate) {
+    if(!rdf_parser->dedup)
+      rdf_parser->dedup = RAPTOR_CALLOC(struct raptor_statement_dedup_s*, 1,
+                                        sizeof(*rdf_parser->dedup));
+
+    if(rdf_parser->dedup &&
+       raptor_parser_dedup_seen(rdf_parser->dedup, statement)) {
+      RAPTOR_STATS_INC(statements_deduplicated);
+      return;
+    }
+  }
+
+  if(!rdf_parser->internal_sink)
+    RAPTOR_STATS_INC(statements_emitted);
+  (*rdf_parser->statement_handler)(rdf_parser->user_data, statement);
+}
+
+
+/*
+ * raptor_parser_batch_statement_handler:
+ * @user_data: parser
+ * @statement: statement
+ *
+ * INTERNAL - Statement handler trampoline accumulating into the batch.
+ */
+static void
+raptor_parser_batch_statement_handler(void *user_data,
+                                      raptor_statement *statement)
+{
+  raptor_parser* parser = (raptor_parser*)user_data;
+
+  parser->statement_batch[parser->statement_batch_count++] =
+    raptor_statement_copy(statement);
+
+  if(parser->statement_batch_count == parser->statement_batch_size)
+    raptor_parser_flush_statement_batch(parser);
+}
+
+
 /* PUBLIC FUNCTIONS */
 
 /**
@@ -981,6 +1942,63 @@ raptor_parser_set_statement_handler(raptor_parser* parser,
 }
 
 
+/**
+ * raptor_parser_set_statement_batch_handler:
+ * @parser: #raptor_parser parser object
+ * @user_data: user data pointer for callback
+ * @handler: new statement batch callback function
+ * @batch_size: maximum number of statements per callback (0 for default)
+ *
+ * Set a batched statement handler function for the parser.
+ *
+ * Like raptor_parser_set_statement_handler() but @handler receives
+ * statements in blocks of up to @batch_size, amortizing per-statement
+ * callback overhead.  A partial batch is delivered when parsing ends
+ * - at raptor_parser_parse_chunk() with is_end non-0 or at the end of
+ * the raptor_parser_parse_file() family - and any remainder when the
+ * parser is destroyed.  Statements in the batch must be copied with
+ * raptor_statement_copy() to be kept beyond the handler call.
+ *
+ * This replaces any statement handler set with
+ * raptor_parser_set_statement_handler().
+ *
+ * Return value: non-0 on failure
+ **/
+int
+raptor_parser_set_statement_batch_handler(raptor_parser* parser,
+                                          void *user_data,
+                                          raptor_statement_batch_handler handler,
+                                          size_t batch_size)
+{
+  raptor_statement** batch;
+
+  if(!batch_size)
+    batch_size = RAPTOR_STATEMENT_BATCH_SIZE_DEFAULT;
+
+  batch = RAPTOR_MALLOC(raptor_statement**,
+                        sizeof(raptor_statement*) * batch_size);
+  if(!batch)
+    return 1;
+
+  if(parser->statement_batch) {
+    raptor_parser_flush_statement_batch(parser);
+    RAPTOR_FREE(raptor_statement**, parser->statement_batch);
+  }
+
+  parser->statement_batch = batch;
+  parser->statement_batch_size = batch_size;
+  parser->statement_batch_count = 0;
+  parser->statement_batch_user_data = user_data;
+  parser->statement_batch_handler = handler;
+
+  /* statements reach the batch via the normal handler path */
+  parser->user_data = parser;
+  parser->statement_handler = raptor_parser_batch_statement_handler;
+
+  return 0;
+}
+
+
 /**
  * raptor_parser_set_graph_mark_handler:
  * @parser: #raptor_parser parser object
@@ -1082,6 +2100,9 @@ raptor_parser_set_option(raptor_parser *parser, raptor_option option,
     raptor_parser_set_strict(parser, is_strict);
   }
 
+  if(!rc)
+    raptor_parser_snapshot_options(parser);
+
   return rc;
 }
 
@@ -1291,6 +2312,26 @@ raptor_world_guess_parser_name(raptor_world* world,
 
   raptor_world_open(world);
 
+  raptor_parsers_register_all(world);
+
+  /* a MIME type alone fully determines the guess - check the memo of
+   * the last such resolution */
+  if(mime_type && !uri && !buffer && !identifier) {
+    const char* memo_name = NULL;
+    int memo_hit = 0;
+
+    RAPTOR_WORLD_LOCK(world);
+    if(world->guess_mime_type &&
+       !strcmp(world->guess_mime_type, mime_type)) {
+      memo_hit = 1;
+      memo_name = world->guess_mime_parser_name;
+    }
+    RAPTOR_WORLD_UNLOCK(world);
+
+    if(memo_hit)
+      return memo_name;
+  }
+
   scores = RAPTOR_CALLOC(struct syntax_score*,
                          raptor_sequence_size(world->parsers),
                          sizeof(struct syntax_score));
@@ -1406,7 +2447,27 @@ raptor_world_guess_parser_name(raptor_world* world,
     RAPTOR_FREE(char*, suffix);
 
   RAPTOR_FREE(syntax_scores, scores);
-  
+
+  if(mime_type && !uri && !buffer && !identifier) {
+    /* memoize a MIME-type-only resolution (including a NULL result) */
+    size_t mime_type_len = strlen(mime_type);
+    char* copy;
+
+    copy = RAPTOR_MALLOC(char*, mime_type_len + 1);
+    if(copy) {
+      char* old;
+
+      memcpy(copy, mime_type, mime_type_len + 1);
+      RAPTOR_WORLD_LOCK(world);
+      old = world->guess_mime_type;
+      world->guess_mime_type = copy;
+      world->guess_mime_parser_name = factory ? factory->desc.names[0] : NULL;
+      RAPTOR_WORLD_UNLOCK(world);
+      if(old)
+        RAPTOR_FREE(char*, old);
+    }
+  }
+
   return factory ? factory->desc.names[0] : NULL;
 }
 
@@ -1557,7 +2618,9 @@ raptor_parser_get_accept_header_all(raptor_world* world)
   size_t len;
   char *p;
   int i;
-  
+
+  raptor_parsers_register_all(world);
+
   len = 0;
   for(i = 0;
       (factory = (raptor_parser_factory*)raptor_sequence_get_at(world->parsers, i));
@@ -1730,6 +2793,7 @@ raptor_parser_parse_iostream(raptor_parser* rdf_parser, raptor_iostream *iostr,
                              raptor_uri *base_uri)
 {
   int rc = 0;
+  int buffer_size;
 
   RAPTOR_ASSERT_OBJECT_POINTER_RETURN_VALUE(rdf_parser, raptor_parser, 1);
   RAPTOR_ASSERT_OBJECT_POINTER_RETURN_VALUE(iostr, raptor_iostr, 1);
@@ -1737,7 +2801,38 @@ raptor_parser_parse_iostream(raptor_parser* rdf_parser, raptor_iostream *iostr,
   rc = raptor_parser_parse_start(rdf_parser, base_uri);
   if(rc)
     return rc;
-  
+
+  buffer_size = RAPTOR_OPTIONS_GET_NUMERIC(rdf_parser,
+                                           RAPTOR_OPTION_READ_BUFFER_SIZE);
+  if(buffer_size > 0) {
+    /* RAPTOR_OPTION_READ_BUFFER_SIZE: read in large chunks */
+    size_t want_len = RAPTOR_GOOD_CAST(size_t, buffer_size);
+    unsigned char* buffer;
+
+    buffer = RAPTOR_MALLOC(unsigned char*, want_len + 1);
+    if(!buffer)
+      return 1;
+
+    while(!raptor_iostream_read_eof(iostr)) {
+      int ilen;
+      size_t len;
+      int is_end;
+
+      ilen = raptor_iostream_read_bytes(buffer, 1, want_len, iostr);
+      if(ilen < 0)
+        break;
+      len = RAPTOR_GOOD_CAST(size_t, ilen);
+      is_end = (len < want_len);
+
+      rc = raptor_parser_parse_chunk(rdf_parser, buffer, len, is_end);
+      if(rc || is_end)
+        break;
+    }
+
+    RAPTOR_FREE(char*, buffer);
+    return rc;
+  }
+
   while(!raptor_iostream_read_eof(iostr)) {
     int ilen;
     size_t len;
@@ -1754,7 +2849,7 @@ raptor_parser_parse_iostream(raptor_parser* rdf_parser, raptor_iostream *iostr,
     if(rc || is_end)
       break;
   }
-  
+
   return rc;
 }
 
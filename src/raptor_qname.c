@@ -111,6 +111,7 @@ raptor_new_qname(raptor_namespace_stack *nstack,
   if(!qname)
     return NULL;
   qname->world = nstack->world;
+  qname->usage = 1;
 
   if(value) {
     size_t value_length = strlen((char*)value);
@@ -204,7 +205,9 @@ raptor_new_qname(raptor_namespace_stack *nstack,
   if(qname->nspace && local_name_length) {
     raptor_uri *uri = raptor_namespace_get_uri(qname->nspace);
     if(uri)
-      uri = raptor_new_uri_from_uri_local_name(qname->world, uri, new_name);
+      uri = raptor_new_uri_from_uri_counted_local_name(qname->world, uri,
+                                                       new_name,
+                                                       local_name_length);
 
     qname->uri = uri;
   }
@@ -251,6 +254,7 @@ raptor_new_qname_from_namespace_local_name(raptor_world* world,
   if(!qname)
     return NULL;
   qname->world = world;
+  qname->usage = 1;
 
   if(value) {
     unsigned int value_length = (unsigned int)strlen((char*)value);
@@ -283,7 +287,10 @@ raptor_new_qname_from_namespace_local_name(raptor_world* world,
   if(qname->nspace) {
     qname->uri = raptor_namespace_get_uri(qname->nspace);
     if(qname->uri)
-      qname->uri = raptor_new_uri_from_uri_local_name(qname->world, qname->uri, new_name);
+      qname->uri = raptor_new_uri_from_uri_counted_local_name(qname->world,
+                                                              qname->uri,
+                                                              new_name,
+                                                              local_name_length);
   }
   
   return qname;
@@ -310,6 +317,7 @@ raptor_qname_copy(raptor_qname *qname)
   if(!new_qname)
     return NULL;
   new_qname->world = qname->world;
+  new_qname->usage = 1;
 
   if(qname->value) {
     size_t value_length = qname->value_length;
@@ -340,7 +348,10 @@ raptor_qname_copy(raptor_qname *qname)
 
   new_qname->uri = raptor_namespace_get_uri(new_qname->nspace);
   if(new_qname->uri)
-    new_qname->uri = raptor_new_uri_from_uri_local_name(qname->world, new_qname->uri, new_name);
+    new_qname->uri = raptor_new_uri_from_uri_counted_local_name(qname->world,
+                                                                new_qname->uri,
+                                                                new_name,
+                                                                new_qname->local_name_length);
   
   return new_qname;
 }
@@ -374,6 +385,9 @@ raptor_free_qname(raptor_qname* name)
   if(!name)
     return;
 
+  if(--name->usage)
+    return;
+
   if(name->local_name)
     RAPTOR_FREE(char*, name->local_name);
 
@@ -494,7 +508,9 @@ raptor_qname_string_to_uri(raptor_namespace_stack *nstack,
    */
   if(ns && (uri = raptor_namespace_get_uri(ns))) {
     if(local_name_length)
-      uri = raptor_new_uri_from_uri_local_name(nstack->world, uri, local_name);
+      uri = raptor_new_uri_from_uri_counted_local_name(nstack->world, uri,
+                                                       local_name,
+                                                       local_name_length);
     else
       uri = raptor_uri_copy(uri);
   }
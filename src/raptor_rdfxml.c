@@ -832,6 +832,13 @@ raptor_rdfxml_start_element_handler(void *user_data,
   /* Right, now ready to enter the grammar */
   raptor_rdfxml_start_element_grammar(rdf_parser, element);
 
+  /* A skipped element ignores all of its content, so have SAX2
+   * discard the subtree instead of building elements and delivering
+   * events that would be thrown away
+   */
+  if(element->state == RAPTOR_STATE_SKIPPING)
+    raptor_sax2_skip_subtree(rdf_xml_parser->sax2);
+
   return;
 }
 
@@ -1123,24 +1130,43 @@ raptor_rdfxml_parse_recognise_syntax(raptor_parser_factory* factory,
     /* Check it's an XML namespace declared and not N3 or Turtle which
      * mention the namespace URI but not in this form.
      */
-#define  HAS_RDF_XMLNS1 (raptor_memstr((const char*)buffer, len, "xmlns:rdf=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#") != NULL)
-#define  HAS_RDF_XMLNS2 (raptor_memstr((const char*)buffer, len, "xmlns:rdf='http://www.w3.org/1999/02/22-rdf-syntax-ns#") != NULL)
-#define  HAS_RDF_XMLNS3 (raptor_memstr((const char*)buffer, len, "xmlns=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#") != NULL)
-#define  HAS_RDF_XMLNS4 (raptor_memstr((const char*)buffer, len, "xmlns='http://www.w3.org/1999/02/22-rdf-syntax-ns#") != NULL)
-#define  HAS_RDF_ENTITY1 (raptor_memstr((const char*)buffer, len, "!ENTITY rdf 'http://www.w3.org/1999/02/22-rdf-syntax-ns#'") != NULL)
-#define  HAS_RDF_ENTITY2 (raptor_memstr((const char*)buffer, len, "!ENTITY rdf \"http://www.w3.org/1999/02/22-rdf-syntax-ns#\"") != NULL)
-#define  HAS_RDF_ENTITY3 (raptor_memstr((const char*)buffer, len, "xmlns:rdf=\"&rdf;\"") != NULL)
-#define  HAS_RDF_ENTITY4 (raptor_memstr((const char*)buffer, len, "xmlns:rdf='&rdf;'") != NULL)
-#define  HAS_HTML_NS (raptor_memstr((const char*)buffer, len, "http://www.w3.org/1999/xhtml") != NULL)
-#define  HAS_HTML_ROOT (raptor_memstr((const char*)buffer, len, "<html") != NULL)
+    static const char* const markers[13] = {
+      "xmlns:rdf=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#",
+      "xmlns:rdf='http://www.w3.org/1999/02/22-rdf-syntax-ns#",
+      "xmlns=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#",
+      "xmlns='http://www.w3.org/1999/02/22-rdf-syntax-ns#",
+      "!ENTITY rdf 'http://www.w3.org/1999/02/22-rdf-syntax-ns#'",
+      "!ENTITY rdf \"http://www.w3.org/1999/02/22-rdf-syntax-ns#\"",
+      "xmlns:rdf=\"&rdf;\"",
+      "xmlns:rdf='&rdf;'",
+      "http://www.w3.org/1999/xhtml",
+      "<html",
+      "<rdf:RDF",
+      "rdf:Description",
+      "rdf:about"
+    };
+#define  HAS_RDF_XMLNS1  (founds[0])
+#define  HAS_RDF_XMLNS2  (founds[1])
+#define  HAS_RDF_XMLNS3  (founds[2])
+#define  HAS_RDF_XMLNS4  (founds[3])
+#define  HAS_RDF_ENTITY1 (founds[4])
+#define  HAS_RDF_ENTITY2 (founds[5])
+#define  HAS_RDF_ENTITY3 (founds[6])
+#define  HAS_RDF_ENTITY4 (founds[7])
+#define  HAS_HTML_NS     (founds[8])
+#define  HAS_HTML_ROOT   (founds[9])
+    int founds[13];
+
+    /* search for all the markers in one pass over the content */
+    raptor_memstr_multi((const char*)buffer, len, markers, 13, founds);
 
     if(!HAS_HTML_NS && !HAS_HTML_ROOT &&
        (HAS_RDF_XMLNS1 || HAS_RDF_XMLNS2 || HAS_RDF_XMLNS3 || HAS_RDF_XMLNS4 ||
         HAS_RDF_ENTITY1 || HAS_RDF_ENTITY2 || HAS_RDF_ENTITY3 || HAS_RDF_ENTITY4)
       ) {
-      int has_rdf_RDF = (raptor_memstr((const char*)buffer, len, "<rdf:RDF") != NULL);
-      int has_rdf_Description = (raptor_memstr((const char*)buffer, len, "rdf:Description") != NULL);
-      int has_rdf_about = (raptor_memstr((const char*)buffer, len, "rdf:about") != NULL);
+      int has_rdf_RDF = founds[10];
+      int has_rdf_Description = founds[11];
+      int has_rdf_about = founds[12];
 
       score += 7;
       if(has_rdf_RDF)
@@ -1232,7 +1258,7 @@ raptor_rdfxml_generate_statement(raptor_parser *rdf_parser,
     goto generate_tidy;
 
   /* Generate the statement; or is it a fact? */
-  (*rdf_parser->statement_handler)(rdf_parser->user_data, statement);
+  raptor_parser_emit_statement_inline(rdf_parser, statement);
 
 
   /* the bagID mess */
@@ -1265,7 +1291,7 @@ raptor_rdfxml_generate_statement(raptor_parser *rdf_parser,
       unsigned char *reified_id = NULL;
 
       /* reified_term is NULL so generate a bag ID */
-      reified_id = raptor_world_generate_bnodeid(rdf_parser->world);
+      reified_id = raptor_parser_internal_generate_id(rdf_parser, NULL);
       if(!reified_id)
         goto generate_tidy;
 
@@ -1278,7 +1304,7 @@ raptor_rdfxml_generate_statement(raptor_parser *rdf_parser,
     }
     
     statement->object = reified_term;
-    (*rdf_parser->statement_handler)(rdf_parser->user_data, statement);
+    raptor_parser_emit_statement_inline(rdf_parser, statement);
 
     if(bag_predicate_term)
       raptor_free_term(bag_predicate_term);
@@ -1295,23 +1321,23 @@ raptor_rdfxml_generate_statement(raptor_parser *rdf_parser,
   statement->subject = reified_term;
   statement->predicate = RAPTOR_RDF_type_term(rdf_parser->world);
   statement->object = RAPTOR_RDF_Statement_term(rdf_parser->world);
-  (*rdf_parser->statement_handler)(rdf_parser->user_data, statement);
+  raptor_parser_emit_statement_inline(rdf_parser, statement);
 
   /* statement->subject = reified_term; */
   statement->predicate = RAPTOR_RDF_subject_term(rdf_parser->world);
   statement->object = subject_term;
-  (*rdf_parser->statement_handler)(rdf_parser->user_data, statement);
+  raptor_parser_emit_statement_inline(rdf_parser, statement);
 
 
   /* statement->subject = reified_term; */
   statement->predicate = RAPTOR_RDF_predicate_term(rdf_parser->world);
   statement->object = predicate_term;
-  (*rdf_parser->statement_handler)(rdf_parser->user_data, statement);
+  raptor_parser_emit_statement_inline(rdf_parser, statement);
 
   /* statement->subject = reified_term; */
   statement->predicate = RAPTOR_RDF_object_term(rdf_parser->world);
   statement->object = object_term;
-  (*rdf_parser->statement_handler)(rdf_parser->user_data, statement);
+  raptor_parser_emit_statement_inline(rdf_parser, statement);
 
 
  generate_tidy:
@@ -1396,8 +1422,8 @@ raptor_rdfxml_process_property_attributes(raptor_parser *rdf_parser,
     }
 
 
-    if(!raptor_unicode_check_utf8_nfc_string(value, strlen((const char*)value),
-                                             NULL)) {
+    if(!raptor_world_check_utf8_nfc_string(rdf_parser->world, value,
+                                           strlen((const char*)value), NULL)) {
       raptor_log_level l;
 
       raptor_rdfxml_update_document_locator(rdf_parser);
@@ -1505,7 +1531,8 @@ raptor_rdfxml_process_property_attributes(raptor_parser *rdf_parser,
     }
 
     if(object_is_literal &&
-       !raptor_unicode_check_utf8_nfc_string(value, value_len, NULL)) {
+       !raptor_world_check_utf8_nfc_string(rdf_parser->world, value, value_len,
+                                           NULL)) {
       raptor_log_level l;
 
       raptor_rdfxml_update_document_locator(rdf_parser);
@@ -1797,8 +1824,8 @@ raptor_rdfxml_start_element_grammar(raptor_parser *rdf_parser,
 
         } else if(element->rdf_attr[RDF_NS_nodeID]) {
           unsigned char* subject_id;
-          subject_id = raptor_world_internal_generate_id(rdf_parser->world,
-                                                         (unsigned char*)element->rdf_attr[RDF_NS_nodeID]);
+          subject_id = raptor_parser_internal_generate_id(rdf_parser,
+                                                          (unsigned char*)element->rdf_attr[RDF_NS_nodeID]);
           if(!subject_id)
             goto oom;
           
@@ -1826,7 +1853,7 @@ raptor_rdfxml_start_element_grammar(raptor_parser *rdf_parser,
           element->subject = raptor_term_copy(element->parent->object);
         } else {
           unsigned char* subject_id;
-          subject_id = raptor_world_generate_bnodeid(rdf_parser->world);
+          subject_id = raptor_parser_internal_generate_id(rdf_parser, NULL);
           if(!subject_id)
             goto oom;
 
@@ -1910,7 +1937,7 @@ raptor_rdfxml_start_element_grammar(raptor_parser *rdf_parser,
             raptor_term* idList_term;
             raptor_term* object_term;
               
-            idList = raptor_world_generate_bnodeid(rdf_parser->world);
+            idList = raptor_parser_internal_generate_id(rdf_parser, NULL);
             if(!idList)
               goto oom;
             /* idList string is saved below in element->parent->tail_id */
@@ -2256,7 +2283,7 @@ raptor_rdfxml_start_element_grammar(raptor_parser *rdf_parser,
             element->child_content_type = RAPTOR_RDFXML_ELEMENT_CONTENT_TYPE_PROPERTIES;
 
             /* create a node for the subject of the contained properties */
-            subject_id = raptor_world_generate_bnodeid(rdf_parser->world);
+            subject_id = raptor_parser_internal_generate_id(rdf_parser, NULL);
             if(!subject_id)
               goto oom;
 
@@ -2630,8 +2657,8 @@ raptor_rdfxml_end_element_grammar(raptor_parser *rdf_parser,
                 element->content_type = RAPTOR_RDFXML_ELEMENT_CONTENT_TYPE_RESOURCE;
               } else if(element->rdf_attr[RDF_NS_nodeID]) {
                 unsigned char* resource_id;
-                resource_id = raptor_world_internal_generate_id(rdf_parser->world,
-                                                                (unsigned char*)element->rdf_attr[RDF_NS_nodeID]);
+                resource_id = raptor_parser_internal_generate_id(rdf_parser,
+                                                                 (unsigned char*)element->rdf_attr[RDF_NS_nodeID]);
                 if(!resource_id)
                   goto oom;
                 
@@ -2652,7 +2679,7 @@ raptor_rdfxml_end_element_grammar(raptor_parser *rdf_parser,
                 }
               } else {
                 unsigned char* resource_id;
-                resource_id = raptor_world_generate_bnodeid(rdf_parser->world);
+                resource_id = raptor_parser_internal_generate_id(rdf_parser, NULL);
                 if(!resource_id)
                   goto oom;
                 
@@ -2724,7 +2751,7 @@ raptor_rdfxml_end_element_grammar(raptor_parser *rdf_parser,
                  raptor_rdfxml_element_has_property_attributes(element) &&
                  !element->object) {
                 unsigned char* object_id;
-                object_id = raptor_world_generate_bnodeid(rdf_parser->world);
+                object_id = raptor_parser_internal_generate_id(rdf_parser, NULL);
                 if(!object_id)
                   goto oom;
                 
@@ -2779,9 +2806,10 @@ raptor_rdfxml_end_element_grammar(raptor_parser *rdf_parser,
                   literal_language = (unsigned char*)raptor_sax2_inscope_xml_language(rdf_xml_parser->sax2);
 
                 if(!literal_datatype && literal &&
-                   !raptor_unicode_check_utf8_nfc_string(literal,
-                                                         xml_element->content_cdata_length,
-                                                         NULL)) {
+                   !raptor_world_check_utf8_nfc_string(rdf_parser->world,
+                                                       literal,
+                                                       xml_element->content_cdata_length,
+                                                       NULL)) {
                   raptor_log_level l;
 
                   raptor_rdfxml_update_document_locator(rdf_parser);
@@ -2836,7 +2864,8 @@ raptor_rdfxml_end_element_grammar(raptor_parser *rdf_parser,
                 length = xml_element->content_cdata_length;
               }
 
-              if(!raptor_unicode_check_utf8_nfc_string(buffer, length, NULL)) {
+              if(!raptor_world_check_utf8_nfc_string(rdf_parser->world,
+                                                     buffer, length, NULL)) {
                 raptor_log_level l;
 
                 raptor_rdfxml_update_document_locator(rdf_parser);
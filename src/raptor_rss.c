@@ -98,6 +98,11 @@ struct raptor_rss_parser_s {
 
   /* current BLOCK pointer (inside CONTAINER of type current_type) */
   raptor_rss_block *current_block;
+
+  /* when non-0, depth inside an unrecognized foreign-namespace
+   * element whose entire subtree is being consumed without building
+   * any per-element state */
+  int skip_depth;
 };
 
 typedef struct raptor_rss_parser_s raptor_rss_parser;
@@ -169,6 +174,7 @@ raptor_rss_parse_init(raptor_parser* rdf_parser, const char *name)
   rss_parser->current_field = RAPTOR_RSS_FIELD_NONE;
   rss_parser->current_type = RAPTOR_RSS_NONE;
   rss_parser->current_block = NULL;
+  rss_parser->skip_depth = 0;
 
   if(rss_parser->sax2) {
     raptor_free_sax2(rss_parser->sax2);
@@ -244,6 +250,8 @@ raptor_rss_parse_start(raptor_parser *rdf_parser)
   for(n = 0; n < RAPTOR_RSS_NAMESPACES_SIZE; n++)
     rss_parser->nspaces_seen[n] = 'N';
 
+  rss_parser->skip_depth = 0;
+
   /* Optionally forbid internal network and file requests in the XML parser */
   raptor_sax2_set_option(rss_parser->sax2, 
                          RAPTOR_OPTION_NO_NET, NULL,
@@ -339,6 +347,22 @@ raptor_rss_promote_namespace_uri(raptor_world *world, raptor_uri* nspace_URI)
 }
 
 
+/* Return non-0 if the namespace URI is one the RSS/Atom parser knows about */
+static int
+raptor_rss_is_known_namespace(raptor_world* world, raptor_uri* nspace_URI)
+{
+  int n;
+
+  for(n = 0; n < RAPTOR_RSS_NAMESPACES_SIZE; n++) {
+    raptor_uri* ns_uri = world->rss_namespaces_info_uris[n];
+    if(ns_uri && raptor_uri_equals(ns_uri, nspace_URI))
+      return 1;
+  }
+
+  return 0;
+}
+
+
 
 static raptor_rss_item*
 raptor_rss_get_current_item(raptor_rss_parser *rss_parser)
@@ -408,6 +432,13 @@ raptor_rss_start_element_handler(void *user_data,
   rdf_parser = (raptor_parser*)user_data;
   rss_parser = (raptor_rss_parser*)rdf_parser->context;
 
+  if(rss_parser->skip_depth) {
+    /* inside a skipped foreign subtree - just track the depth, do not
+     * build any element state */
+    rss_parser->skip_depth++;
+    return;
+  }
+
   rss_element = RAPTOR_CALLOC(raptor_rss_element*, 1, sizeof(*rss_element));
   if(!rss_element) {
     rdf_parser->failed = 1;
@@ -482,7 +513,13 @@ raptor_rss_start_element_handler(void *user_data,
     return;
   } else if(rss_parser->current_type == RAPTOR_RSS_NONE) {
     RAPTOR_DEBUG2("Unknown container element named %s\n", name);
-    /* Nothing more that can be done with unknown element - skip it */
+    /* Nothing more that can be done with unknown element - skip it.
+     * If it is in a foreign namespace, consume its entire subtree with
+     * a depth counter rather than inspecting every descendant. */
+    if(el_nspace &&
+       !raptor_rss_is_known_namespace(rdf_parser->world,
+                                      raptor_namespace_get_uri(el_nspace)))
+      rss_parser->skip_depth = 1;
     return;
   }
 
@@ -525,8 +562,12 @@ raptor_rss_start_element_handler(void *user_data,
   }
 
   if(rss_parser->current_field == RAPTOR_RSS_FIELD_UNKNOWN) {
-    RAPTOR_DEBUG3("Unknown field element named %s inside type %s\n", name, 
+    RAPTOR_DEBUG3("Unknown field element named %s inside type %s\n", name,
                   raptor_rss_items_info[rss_parser->current_type].name);
+    if(el_nspace &&
+       !raptor_rss_is_known_namespace(rdf_parser->world,
+                                      raptor_namespace_get_uri(el_nspace)))
+      rss_parser->skip_depth = 1;
     return;
   }
 
@@ -546,7 +587,7 @@ raptor_rss_start_element_handler(void *user_data,
 
     update_item = raptor_rss_get_current_item(rss_parser);
 
-    id = raptor_world_generate_bnodeid(rdf_parser->world);
+    id = raptor_parser_internal_generate_id(rdf_parser, NULL);
     block_term = raptor_new_term_from_blank(rdf_parser->world, id);
     RAPTOR_FREE(char*, id);
 
@@ -709,11 +750,24 @@ raptor_rss_end_element_handler(void *user_data,
   size_t cdata_len = 0;
   unsigned char* cdata = NULL;
 
-  rss_element = (raptor_rss_element*)xml_element->user_data;
-
   rdf_parser = (raptor_parser*)user_data;
   rss_parser = (raptor_rss_parser*)rdf_parser->context;
 
+  if(rss_parser->skip_depth) {
+    if(!--rss_parser->skip_depth) {
+      /* leaving the element that engaged skipping; it was created
+       * before the skip started so tidy it up and reset the field
+       * state the way a normally-ended unknown element would */
+      if(xml_element->user_data)
+        raptor_free_rss_element((raptor_rss_element*)xml_element->user_data);
+      if(rss_parser->current_field == RAPTOR_RSS_FIELD_UNKNOWN)
+        rss_parser->current_field = RAPTOR_RSS_FIELD_NONE;
+    }
+    return;
+  }
+
+  rss_element = (raptor_rss_element*)xml_element->user_data;
+
   if(rss_element->xml_writer) {
     if(rss_element->type != RAPTOR_RSS_CONTENT_TYPE_XML) {
       raptor_xml_writer_end_element(rss_element->xml_writer, xml_element);
@@ -889,9 +943,14 @@ raptor_rss_end_element_handler(void *user_data,
 static void
 raptor_rss_cdata_handler(void *user_data, raptor_xml_element* xml_element,
                          const unsigned char *s, int len)
-{      
+{
+  raptor_parser* rdf_parser = (raptor_parser*)user_data;
+  raptor_rss_parser* rss_parser = (raptor_rss_parser*)rdf_parser->context;
   raptor_rss_element* rss_element;
 
+  if(rss_parser->skip_depth)
+    return;
+
   rss_element = (raptor_rss_element*)xml_element->user_data;
 
   if(rss_element->xml_writer) {
@@ -900,7 +959,7 @@ raptor_rss_cdata_handler(void *user_data, raptor_xml_element* xml_element,
   }
 
   raptor_stringbuffer_append_counted_string(rss_element->sb, s, len, 1);
-}      
+}
       
 
 static void
@@ -911,8 +970,10 @@ raptor_rss_comment_handler(void *user_data, raptor_xml_element* xml_element,
 
   if(!xml_element)
     return;
-  
+
   rss_element = (raptor_rss_element*)xml_element->user_data;
+  if(!rss_element)
+    return;
 
   if(rss_element->xml_writer) {
     raptor_xml_writer_comment(rss_element->xml_writer, s);
@@ -1058,7 +1119,7 @@ raptor_rss_insert_identifiers(raptor_parser* rdf_parser)
           const unsigned char *id;
 
           /* need to make bnode */
-          id = raptor_world_generate_bnodeid(rdf_parser->world);
+          id = raptor_parser_internal_generate_id(rdf_parser, NULL);
           item->term = raptor_new_term_from_blank(rdf_parser->world, id);
           RAPTOR_FREE(char*, id);
         }
@@ -1114,7 +1175,7 @@ raptor_rss_insert_identifiers(raptor_parser* rdf_parser)
       if(!block->identifier) {
         const unsigned char *id;
         /* need to make bnode */
-        id = raptor_world_generate_bnodeid(rdf_parser->world);
+        id = raptor_parser_internal_generate_id(rdf_parser, NULL);
         item->term = raptor_new_term_from_blank(rdf_parser->world, id);
         RAPTOR_FREE(char*, id);
       }
@@ -1152,7 +1213,7 @@ raptor_rss_emit_type_triple(raptor_parser* rdf_parser,
   rss_parser->statement.object = object_term;
   
   /* Generate the statement */
-  (*rdf_parser->statement_handler)(rdf_parser->user_data, &rss_parser->statement);
+  raptor_parser_emit_statement(rdf_parser, &rss_parser->statement);
 
   raptor_free_term(predicate_term);
   raptor_free_term(object_term);
@@ -1186,7 +1247,7 @@ raptor_rss_emit_block(raptor_parser* rdf_parser,
   rss_parser->statement.subject = resource;
   rss_parser->statement.predicate = predicate_term;
   rss_parser->statement.object = block->identifier;
-  (*rdf_parser->statement_handler)(rdf_parser->user_data,
+  raptor_parser_emit_statement(rdf_parser,
                                    &rss_parser->statement);
 
   raptor_free_term(predicate_term); predicate_term = NULL;
@@ -1220,7 +1281,7 @@ raptor_rss_emit_block(raptor_parser* rdf_parser,
         
         object_term = raptor_new_term_from_uri(rdf_parser->world, uri);
         rss_parser->statement.object = object_term;
-        (*rdf_parser->statement_handler)(rdf_parser->user_data,
+        raptor_parser_emit_statement(rdf_parser,
                                          &rss_parser->statement);
         raptor_free_term(object_term);
       }
@@ -1233,7 +1294,7 @@ raptor_rss_emit_block(raptor_parser* rdf_parser,
                                                    (const unsigned char*)str,
                                                    NULL, NULL);
         rss_parser->statement.object = object_term;
-        (*rdf_parser->statement_handler)(rdf_parser->user_data,
+        raptor_parser_emit_statement(rdf_parser,
                                          &rss_parser->statement);
         raptor_free_term(object_term);
       }
@@ -1306,7 +1367,7 @@ raptor_rss_emit_item(raptor_parser* rdf_parser, raptor_rss_item *item)
       rss_parser->statement.object = object_term;
       
       /* Generate the statement */
-      (*rdf_parser->statement_handler)(rdf_parser->user_data,
+      raptor_parser_emit_statement(rdf_parser,
                                        &rss_parser->statement);
 
       raptor_free_term(object_term);
@@ -1351,7 +1412,7 @@ raptor_rss_emit_connection(raptor_parser* rdf_parser,
   rss_parser->statement.object = object_identifier;
   
   /* Generate the statement */
-  (*rdf_parser->statement_handler)(rdf_parser->user_data,
+  raptor_parser_emit_statement(rdf_parser,
                                    &rss_parser->statement);
 
   raptor_free_term(predicate_term);
@@ -1425,7 +1486,7 @@ raptor_rss_emit(raptor_parser* rdf_parser)
     const unsigned char* id;
     raptor_term *items;
 
-    id = raptor_world_generate_bnodeid(rdf_parser->world);
+    id = raptor_parser_internal_generate_id(rdf_parser, NULL);
     
     /* make a new genid for the <rdf:Seq> node */
     items = raptor_new_term_from_blank(rdf_parser->world, id);
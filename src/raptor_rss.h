@@ -438,6 +438,7 @@ void raptor_rss_field_free(raptor_rss_field* field);
 
 #define RAPTOR_ISO_DATE_LEN 20
 int raptor_rss_format_iso_date(char* buffer, size_t len, time_t unix_time);
+time_t raptor_rss_date_parse(raptor_world* world, const char* date_string);
 int raptor_rss_set_date_field(raptor_rss_field* field, time_t unix_time);
 int raptor_rss_date_uplift(raptor_rss_field* to_field, const unsigned char *date_string);
 
@@ -357,6 +357,20 @@ raptor_rss_common_terminate(raptor_world* world) {
   if(--world->rss_common_initialised)
     return;
 
+  while(world->rss_field_pool) {
+    raptor_rss_field* field = (raptor_rss_field*)world->rss_field_pool;
+    world->rss_field_pool = field->next;
+    RAPTOR_FREE(raptor_rss_field, field);
+  }
+  world->rss_field_pool_size = 0;
+
+  for(i = 0; i < RAPTOR_RSS_DATE_CACHE_SIZE; i++) {
+    if(world->rss_date_cache_strings[i]) {
+      RAPTOR_FREE(char*, world->rss_date_cache_strings[i]);
+      world->rss_date_cache_strings[i] = NULL;
+    }
+  }
+
   if(world->rss_types_info_uris) {
     for(i = 0; i< RAPTOR_RSS_COMMON_SIZE; i++) {
       if(world->rss_types_info_uris[i])
@@ -650,10 +664,27 @@ raptor_free_rss_block(raptor_rss_block *block)
 }
 
 
+/* Maximum number of raptor_rss_field objects kept for reuse */
+#define RAPTOR_RSS_FIELD_POOL_MAX 64
+
 raptor_rss_field*
 raptor_rss_new_field(raptor_world* world)
 {
-  raptor_rss_field* field = RAPTOR_CALLOC(raptor_rss_field*, 1, sizeof(*field));
+  raptor_rss_field* field = NULL;
+
+  RAPTOR_WORLD_LOCK(world);
+  if(world->rss_field_pool) {
+    field = (raptor_rss_field*)world->rss_field_pool;
+    world->rss_field_pool = field->next;
+    world->rss_field_pool_size--;
+  }
+  RAPTOR_WORLD_UNLOCK(world);
+
+  if(field)
+    memset(field, '\0', sizeof(*field));
+  else
+    field = RAPTOR_CALLOC(raptor_rss_field*, 1, sizeof(*field));
+
   if(field)
     field->world = world;
   return field;
@@ -663,13 +694,28 @@ raptor_rss_new_field(raptor_world* world)
 void
 raptor_rss_field_free(raptor_rss_field* field)
 {
+  raptor_world* world = field->world;
+
   if(field->value)
     RAPTOR_FREE(char*, field->value);
   if(field->uri)
     raptor_free_uri(field->uri);
   if(field->next)
     raptor_rss_field_free(field->next);
-  RAPTOR_FREE(raptor_rss_field, field);
+
+  if(world) {
+    RAPTOR_WORLD_LOCK(world);
+    if(world->rss_field_pool_size < RAPTOR_RSS_FIELD_POOL_MAX) {
+      field->next = (raptor_rss_field*)world->rss_field_pool;
+      world->rss_field_pool = field;
+      world->rss_field_pool_size++;
+      field = NULL;
+    }
+    RAPTOR_WORLD_UNLOCK(world);
+  }
+
+  if(field)
+    RAPTOR_FREE(raptor_rss_field, field);
 }
 
 
@@ -710,23 +756,285 @@ raptor_rss_set_date_field(raptor_rss_field* field, time_t unix_time)
 }
 
 
+/* scan exactly @min_digits to @max_digits decimal digits at *@sp,
+ * advancing it past them; non-0 on too few digits */
+static int
+raptor_rss_date_scan_int(const char** sp, int min_digits, int max_digits,
+                         int* value_p)
+{
+  const char* s = *sp;
+  int value = 0;
+  int digits = 0;
+
+  while(digits < max_digits && *s >= '0' && *s <= '9') {
+    value = value * 10 + (*s - '0');
+    s++;
+    digits++;
+  }
+  if(digits < min_digits)
+    return 1;
+
+  *sp = s;
+  *value_p = value;
+  return 0;
+}
+
+
+/* scan a timezone covering the rest of @s - Z, a named zone or a
+ * +-hh[:]mm offset - into seconds east of UTC; non-0 on anything the
+ * fast path should not guess at */
+static int
+raptor_rss_date_scan_zone(const char* s, int* offset_p)
+{
+  /* named zones RFC 822 allows, plus UTC which is common in the wild */
+  static const struct { const char name[4]; int offset_hours; } zones[] = {
+    { "GMT",  0 }, { "UT",   0 }, { "UTC",  0 },
+    { "EST", -5 }, { "EDT", -4 }, { "CST", -6 }, { "CDT", -5 },
+    { "MST", -7 }, { "MDT", -6 }, { "PST", -8 }, { "PDT", -7 }
+  };
+  unsigned int i;
+
+  if(*s == '+' || *s == '-') {
+    int sign = (*s == '-') ? -1 : 1;
+    int hours, minutes;
+
+    s++;
+    if(raptor_rss_date_scan_int(&s, 2, 2, &hours))
+      return 1;
+    if(*s == ':')
+      s++;
+    if(raptor_rss_date_scan_int(&s, 2, 2, &minutes))
+      return 1;
+    if(*s || hours > 23 || minutes > 59)
+      return 1;
+
+    *offset_p = sign * (hours * 3600 + minutes * 60);
+    return 0;
+  }
+
+  if((*s == 'Z' || *s == 'z') && !s[1]) {
+    *offset_p = 0;
+    return 0;
+  }
+
+  for(i = 0; i < sizeof(zones) / sizeof(zones[0]); i++) {
+    if(!raptor_strcasecmp(s, zones[i].name)) {
+      *offset_p = zones[i].offset_hours * 3600;
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+
+/* convert broken-down date/time fields plus a zone offset (seconds
+ * east of UTC) to a Unix time without consulting the local timezone;
+ * -1 on out-of-range fields */
+static time_t
+raptor_rss_date_to_epoch(int year, int month, int day,
+                         int hour, int minute, int second,
+                         int zone_offset)
+{
+  long era, yoe, doy, doe, days;
+  int y = year;
+
+  if(month < 1 || month > 12 || day < 1 || day > 31 ||
+     hour > 23 || minute > 59 || second > 60)
+    return -1;
+
+  /* days between civil date and 1970-01-01 using 400-year eras */
+  y -= (month <= 2);
+  era = ((y >= 0) ? y : y - 399) / 400;
+  yoe = y - era * 400;
+  doy = (153L * (month + ((month > 2) ? -3 : 9)) + 2) / 5 + day - 1;
+  doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  days = era * 146097L + doe - 719468L;
+
+  return ((time_t)days * 86400) + hour * 3600 + minute * 60 + second -
+         zone_offset;
+}
+
+
+/* try to parse @s in one of the two fixed date shapes nearly all
+ * real-world feeds use - RFC 822 (RSS pubDate) or ISO 8601 / RFC 3339
+ * (Atom updated) with an explicit timezone - without invoking the
+ * general parsedate grammar; non-0 when the string does not match */
+static int
+raptor_rss_date_scan(const char* s, time_t* when_p)
+{
+  static const char* const months[12] = {
+    "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+    "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+  };
+  int year, month, day, hour, minute, second;
+  int zone_offset;
+  time_t when;
+
+  while(*s == ' ' || *s == '\t')
+    s++;
+
+  if(*s >= '0' && *s <= '9') {
+    /* ISO 8601: YYYY-MM-DDThh:mm:ss[.frac](Z|+-hh[:]mm) */
+    if(raptor_rss_date_scan_int(&s, 4, 4, &year) || *s++ != '-' ||
+       raptor_rss_date_scan_int(&s, 2, 2, &month) || *s++ != '-' ||
+       raptor_rss_date_scan_int(&s, 2, 2, &day))
+      return 1;
+    if(*s != 'T' && *s != 't' && *s != ' ')
+      return 1;
+    s++;
+    if(raptor_rss_date_scan_int(&s, 2, 2, &hour) || *s++ != ':' ||
+       raptor_rss_date_scan_int(&s, 2, 2, &minute) || *s++ != ':' ||
+       raptor_rss_date_scan_int(&s, 2, 2, &second))
+      return 1;
+
+    if(*s == '.') {
+      /* ignore any fractional seconds */
+      s++;
+      if(*s < '0' || *s > '9')
+        return 1;
+      while(*s >= '0' && *s <= '9')
+        s++;
+    }
+  } else {
+    /* RFC 822: [Www, ]D[D] Mon YYYY hh:mm[:ss] zone */
+    int i;
+
+    if((*s >= 'A' && *s <= 'Z') || (*s >= 'a' && *s <= 'z')) {
+      while((*s >= 'A' && *s <= 'Z') || (*s >= 'a' && *s <= 'z'))
+        s++;
+      if(*s++ != ',')
+        return 1;
+      while(*s == ' ')
+        s++;
+    }
+
+    if(raptor_rss_date_scan_int(&s, 1, 2, &day) || *s++ != ' ')
+      return 1;
+
+    for(month = 0, i = 0; i < 12; i++) {
+      if(!raptor_strncasecmp(s, months[i], 3)) {
+        month = i + 1;
+        break;
+      }
+    }
+    if(!month)
+      return 1;
+    s += 3;
+
+    if(*s++ != ' ' || raptor_rss_date_scan_int(&s, 2, 4, &year) || *s++ != ' ')
+      return 1;
+    if(year < 100)
+      /* RFC 2822 obsolete two-digit years */
+      year += (year < 70) ? 2000 : 1900;
+
+    if(raptor_rss_date_scan_int(&s, 2, 2, &hour) || *s++ != ':' ||
+       raptor_rss_date_scan_int(&s, 2, 2, &minute))
+      return 1;
+    second = 0;
+    if(*s == ':') {
+      s++;
+      if(raptor_rss_date_scan_int(&s, 2, 2, &second))
+        return 1;
+    }
+    if(*s++ != ' ')
+      return 1;
+  }
+
+  if(raptor_rss_date_scan_zone(s, &zone_offset))
+    return 1;
+
+  when = raptor_rss_date_to_epoch(year, month, day, hour, minute, second,
+                                  zone_offset);
+  if(when < 0)
+    return 1;
+
+  *when_p = when;
+  return 0;
+}
+
+
+/*
+ * raptor_rss_date_parse:
+ * @world: raptor world for the memo cache (or NULL for no caching)
+ * @date_string: date string from a feed field
+ *
+ * INTERNAL - Parse a feed date string to a Unix time.
+ *
+ * Feeds repeat identical timestamps heavily, so recent results are
+ * memoized on the world; misses try the fixed-format scanner for the
+ * RFC 822 and ISO 8601 shapes before falling back to the general
+ * parsedate grammar.
+ *
+ * Return value: Unix time or -1 on failure
+ */
+time_t
+raptor_rss_date_parse(raptor_world* world, const char* date_string)
+{
+  time_t when;
+  unsigned int slot = 0;
+
+  if(!date_string)
+    return -1;
+
+  if(world) {
+    unsigned int hash = 5381;
+    const char* p;
+
+    for(p = date_string; *p; p++)
+      hash = ((hash << 5) + hash) + (unsigned char)*p;
+    slot = hash & (RAPTOR_RSS_DATE_CACHE_SIZE - 1);
+
+    RAPTOR_WORLD_LOCK(world);
+    if(world->rss_date_cache_strings[slot] &&
+       !strcmp(world->rss_date_cache_strings[slot], date_string)) {
+      when = world->rss_date_cache_times[slot];
+      RAPTOR_WORLD_UNLOCK(world);
+      return when;
+    }
+    RAPTOR_WORLD_UNLOCK(world);
+  }
+
+  if(raptor_rss_date_scan(date_string, &when)) {
+#ifdef RAPTOR_PARSEDATE_FUNCTION
+    when = RAPTOR_PARSEDATE_FUNCTION(date_string, NULL);
+#else
+    when = -1;
+#endif
+  }
+
+  if(world && when >= 0) {
+    size_t len = strlen(date_string);
+    char* copy = RAPTOR_MALLOC(char*, len + 1);
+
+    if(copy) {
+      memcpy(copy, date_string, len + 1);
+      RAPTOR_WORLD_LOCK(world);
+      if(world->rss_date_cache_strings[slot])
+        RAPTOR_FREE(char*, world->rss_date_cache_strings[slot]);
+      world->rss_date_cache_strings[slot] = copy;
+      world->rss_date_cache_times[slot] = when;
+      RAPTOR_WORLD_UNLOCK(world);
+    }
+  }
+
+  return when;
+}
+
+
 static int
 raptor_rss_field_conversion_date_uplift(raptor_rss_field* from_field,
                                         raptor_rss_field* to_field)
 {
-#ifdef RAPTOR_PARSEDATE_FUNCTION
   time_t unix_time;
   char *date_string = (char*)from_field->value;
-  
+
   if(!date_string)
     return 1;
-  
-  unix_time = RAPTOR_PARSEDATE_FUNCTION(date_string, NULL);
+
+  unix_time = raptor_rss_date_parse(from_field->world, date_string);
   if(unix_time < 0)
     return 1;
 
   return raptor_rss_set_date_field(to_field, unix_time);
-#else
-  return 1;
-#endif
 }
@@ -103,6 +103,31 @@ raptor_new_sax2(raptor_world *world, raptor_locator *locator,
 }
 
 
+/*
+ * raptor_sax2_clear_qname_cache:
+ * @sax2: SAX2 object
+ *
+ * INTERNAL - Release all cached element qnames.
+ *
+ * Must be called before the namespace stack the qnames point into is
+ * cleared or re-initialised.
+ */
+static void
+raptor_sax2_clear_qname_cache(raptor_sax2* sax2)
+{
+  int i;
+
+  for(i = 0; i < RAPTOR_SAX2_QNAME_CACHE_SIZE; i++) {
+    if(sax2->qname_cache[i].qname) {
+      raptor_free_qname(sax2->qname_cache[i].qname);
+      RAPTOR_FREE(char*, sax2->qname_cache[i].name);
+      sax2->qname_cache[i].qname = NULL;
+      sax2->qname_cache[i].name = NULL;
+    }
+  }
+}
+
+
 /**
  * raptor_free_sax2:
  * @sax2: SAX2 object
@@ -127,6 +152,14 @@ raptor_free_sax2(raptor_sax2 *sax2)
   while( (xml_element = raptor_xml_element_pop(sax2)) )
     raptor_free_xml_element(xml_element);
 
+  while(sax2->element_pool_size > 0)
+    raptor_free_xml_element(sax2->element_pool[--sax2->element_pool_size]);
+
+  if(sax2->atts_scratch)
+    RAPTOR_FREE(cstringpointer, sax2->atts_scratch);
+
+  raptor_sax2_clear_qname_cache(sax2);
+
   raptor_namespaces_clear(&sax2->namespaces);
 
   if(sax2->base_uri)
@@ -397,6 +430,25 @@ raptor_sax2_dec_depth(raptor_sax2 *sax2)
 }
 
 
+/*
+ * raptor_sax2_skip_subtree:
+ * @sax2: SAX2 object
+ *
+ * INTERNAL - Discard the content of the element currently being started.
+ *
+ * Called from a start element handler.  The rest of the element's
+ * subtree is skipped without building elements or invoking any
+ * handlers - only the depth is tracked - and the element's own end
+ * event is still delivered normally.  Much cheaper than delivering
+ * events just to throw them away.
+ */
+void
+raptor_sax2_skip_subtree(raptor_sax2* sax2)
+{
+  sax2->skip_depth = sax2->depth;
+}
+
+
 static void raptor_sax2_simple_error(void* user_data, const char *message, ...) RAPTOR_PRINTF_FORMAT(2, 3);
 
 /*
@@ -436,9 +488,14 @@ void
 raptor_sax2_parse_start(raptor_sax2* sax2, raptor_uri *base_uri)
 {
   sax2->depth = 0;
+  sax2->skip_depth = 0;
   sax2->root_element = NULL;
   sax2->current_element = NULL;
 
+  /* snapshot the per-attribute hot option as a direct member load */
+  sax2->normalize_language =
+    RAPTOR_OPTIONS_GET_NUMERIC(sax2, RAPTOR_OPTION_NORMALIZE_LANGUAGE);
+
   if(sax2->base_uri)
     raptor_free_uri(sax2->base_uri);
   if(base_uri)
@@ -459,6 +516,8 @@ raptor_sax2_parse_start(raptor_sax2* sax2, raptor_uri *base_uri)
   }
 #endif
 
+  raptor_sax2_clear_qname_cache(sax2);
+
   raptor_namespaces_clear(&sax2->namespaces);
 
   if(raptor_namespaces_init(sax2->world, &sax2->namespaces, 1)) {
@@ -581,6 +640,68 @@ raptor_sax2_parse_chunk(raptor_sax2* sax2, const unsigned char *buffer,
 }
 
 
+/*
+ * raptor_sax2_new_element_qname:
+ * @sax2: SAX2 object
+ * @name: raw element name
+ *
+ * INTERNAL - Get a qname for an element name, reusing a cached one.
+ *
+ * XML documents repeat the same few element names many times, so a
+ * small direct-mapped cache keyed on the raw name avoids re-splitting
+ * and re-resolving the name on every start tag.  Cached qnames are
+ * shared via their usage count and entries are invalidated by the
+ * namespace stack generation counter when any mapping changes.
+ *
+ * Return value: new qname reference or NULL on failure
+ */
+static raptor_qname*
+raptor_sax2_new_element_qname(raptor_sax2* sax2, const unsigned char* name)
+{
+  unsigned int hash = 5381;
+  const unsigned char* p;
+  size_t name_length;
+  raptor_sax2_qname_cache_entry* entry;
+  raptor_qname* qname;
+  unsigned char* name_copy;
+
+  for(p = name; *p; p++)
+    hash = ((hash << 5) + hash) + *p;
+  name_length = RAPTOR_GOOD_CAST(size_t, p - name);
+
+  entry = &sax2->qname_cache[hash & (RAPTOR_SAX2_QNAME_CACHE_SIZE - 1)];
+
+  if(entry->qname &&
+     entry->generation == sax2->namespaces.generation &&
+     entry->name_length == name_length &&
+     !memcmp(entry->name, name, name_length)) {
+    entry->qname->usage++;
+    return entry->qname;
+  }
+
+  qname = raptor_new_qname(&sax2->namespaces, name, NULL);
+  if(!qname)
+    return NULL;
+
+  name_copy = RAPTOR_MALLOC(unsigned char*, name_length + 1);
+  if(name_copy) {
+    memcpy(name_copy, name, name_length + 1);
+
+    if(entry->qname) {
+      raptor_free_qname(entry->qname);
+      RAPTOR_FREE(char*, entry->name);
+    }
+    entry->name = name_copy;
+    entry->name_length = name_length;
+    entry->generation = sax2->namespaces.generation;
+    entry->qname = qname;
+    qname->usage++;
+  }
+
+  return qname;
+}
+
+
 /**
  * raptor_sax2_set_option:
  * @sax2: #raptor_sax2 SAX2 object
@@ -641,10 +762,16 @@ raptor_sax2_start_element(void* user_data, const unsigned char *name,
   if(sax2->failed || !sax2->enabled)
     return;
 
+  if(sax2->skip_depth) {
+    /* inside a skipped subtree - just track the depth */
+    raptor_sax2_inc_depth(sax2);
+    return;
+  }
+
 #ifdef RAPTOR_XML_LIBXML
   if(atts) {
     int i;
-    
+
     /* Do XML attribute value normalization */
     for(i = 0; atts[i]; i += 2) {
       unsigned char *value = (unsigned char*)atts[i+1];
@@ -682,15 +809,24 @@ raptor_sax2_start_element(void* user_data, const unsigned char *name,
   if(atts) {
     int i;
 
-    /* Save passed in XML attributes pointers so we can 
+    /* Save passed in XML attributes pointers so we can
      * NULL the pointers when they get handled below (various atts[i]=NULL)
+     * using a scratch array kept in the sax2 object across elements
      */
     for(i = 0; atts[i]; i++) ;
     xml_atts_size = sizeof(unsigned char*) * i;
     if(xml_atts_size) {
-      xml_atts_copy = RAPTOR_MALLOC(unsigned char**, xml_atts_size);
-      if(!xml_atts_copy)
-        goto fail;
+      if(xml_atts_size > sax2->atts_scratch_size) {
+        unsigned char** new_scratch;
+
+        new_scratch = RAPTOR_REALLOC(unsigned char**, sax2->atts_scratch,
+                                     xml_atts_size);
+        if(!new_scratch)
+          goto fail;
+        sax2->atts_scratch = new_scratch;
+        sax2->atts_scratch_size = xml_atts_size;
+      }
+      xml_atts_copy = sax2->atts_scratch;
       memcpy(xml_atts_copy, atts, xml_atts_size);
     }
 
@@ -737,7 +873,7 @@ raptor_sax2_start_element(void* user_data, const unsigned char *name,
         }
 
         /* optionally normalize language to lowercase */
-        if(RAPTOR_OPTIONS_GET_NUMERIC(sax2, RAPTOR_OPTION_NORMALIZE_LANGUAGE)) {
+        if(sax2->normalize_language) {
           unsigned char *from = (unsigned char*)atts[i+1];
           unsigned char *to = xml_language;
           
@@ -766,11 +902,18 @@ raptor_sax2_start_element(void* user_data, const unsigned char *name,
 
 
   /* Create new element structure */
-  el_name = raptor_new_qname(&sax2->namespaces, name, NULL);
+  el_name = raptor_sax2_new_element_qname(sax2, name);
   if(!el_name)
     goto fail;
 
-  xml_element = raptor_new_xml_element(el_name, xml_language, xml_base);
+  if(sax2->element_pool_size > 0) {
+    /* reuse a cleared element recycled by raptor_sax2_end_element() */
+    xml_element = sax2->element_pool[--sax2->element_pool_size];
+    xml_element->name = el_name;
+    xml_element->xml_language = xml_language;
+    xml_element->base_uri = xml_base;
+  } else
+    xml_element = raptor_new_xml_element(el_name, xml_language, xml_base);
   if(!xml_element) {
     raptor_free_qname(el_name);
     goto fail;
@@ -825,17 +968,16 @@ raptor_sax2_start_element(void* user_data, const unsigned char *name,
   if(sax2->start_element_handler)
     sax2->start_element_handler(sax2->user_data, xml_element);
 
-  if(xml_atts_copy) {
-    /* Restore passed in XML attributes, free the copy */
+  if(xml_atts_copy)
+    /* Restore passed in XML attributes; the copy is kept in the sax2
+     * object for the next element */
     memcpy((void*)atts, xml_atts_copy, xml_atts_size);
-    RAPTOR_FREE(cstringpointer, xml_atts_copy);
-  }
 
   return;
 
   fail:
   if(xml_atts_copy)
-    RAPTOR_FREE(cstringpointer, xml_atts_copy);
+    memcpy((void*)atts, xml_atts_copy, xml_atts_size);
   if(xml_base)
     raptor_free_uri(xml_base);
   if(xml_language)
@@ -845,6 +987,26 @@ raptor_sax2_start_element(void* user_data, const unsigned char *name,
 }
 
 
+/*
+ * raptor_sax2_recycle_xml_element:
+ * @sax2: SAX2 object
+ * @xml_element: finished XML element
+ *
+ * INTERNAL - Return an element to the pool for reuse by the next
+ * start tag, or free it when the pool is full.
+ */
+static void
+raptor_sax2_recycle_xml_element(raptor_sax2* sax2,
+                                raptor_xml_element* xml_element)
+{
+  if(sax2->element_pool_size < RAPTOR_SAX2_ELEMENT_POOL_SIZE) {
+    raptor_xml_element_clear(xml_element);
+    sax2->element_pool[sax2->element_pool_size++] = xml_element;
+  } else
+    raptor_free_xml_element(xml_element);
+}
+
+
 /* end of an element */
 void
 raptor_sax2_end_element(void* user_data, const unsigned char *name)
@@ -855,6 +1017,16 @@ raptor_sax2_end_element(void* user_data, const unsigned char *name)
   if(sax2->failed || !sax2->enabled)
     return;
 
+  if(sax2->skip_depth) {
+    if(raptor_sax2_get_depth(sax2) > sax2->skip_depth) {
+      raptor_sax2_dec_depth(sax2);
+      return;
+    }
+    /* this end tag closes the element whose subtree was skipped -
+     * resume normal delivery with its own end event */
+    sax2->skip_depth = 0;
+  }
+
   xml_element = sax2->current_element;
   if(xml_element) {
 #ifdef RAPTOR_DEBUG_VERBOSE
@@ -871,7 +1043,7 @@ raptor_sax2_end_element(void* user_data, const unsigned char *name)
                                   raptor_sax2_get_depth(sax2));
   xml_element = raptor_xml_element_pop(sax2);
   if(xml_element)
-    raptor_free_xml_element(xml_element);
+    raptor_sax2_recycle_xml_element(sax2, xml_element);
 
   raptor_sax2_dec_depth(sax2);
 }
@@ -888,6 +1060,9 @@ raptor_sax2_characters(void* user_data, const unsigned char *s, int len)
   if(sax2->failed || !sax2->enabled)
     return;
 
+  if(sax2->skip_depth)
+    return;
+
   if(sax2->characters_handler)
     sax2->characters_handler(sax2->user_data, sax2->current_element, s, len);
 }
@@ -902,6 +1077,9 @@ raptor_sax2_cdata(void* user_data, const unsigned char *s, int len)
   if(sax2->failed || !sax2->enabled)
     return;
 
+  if(sax2->skip_depth)
+    return;
+
   if(sax2->cdata_handler)
     sax2->cdata_handler(sax2->user_data, sax2->current_element, s, len);
 }
@@ -916,6 +1094,9 @@ raptor_sax2_comment(void* user_data, const unsigned char *s)
   if(sax2->failed || !sax2->enabled)
     return;
 
+  if(sax2->skip_depth)
+    return;
+
   if(sax2->comment_handler)
     sax2->comment_handler(sax2->user_data, sax2->current_element, s);
 }
@@ -564,6 +564,34 @@ raptor_sequence_sort_r(raptor_sequence* seq,
 }
 
 
+/**
+ * raptor_sequence_sort_r_parallel:
+ * @seq: sequence to sort
+ * @compare: comparison function with args (a, b, user data)
+ * @user_data: User data argument for @compare
+ *
+ * Sort a large sequence inline on multiple threads
+ *
+ * Like raptor_sequence_sort_r() but sorts with
+ * raptor_sort_r_parallel(), so @compare may be called from several
+ * threads at once and must be thread-safe.  Small sequences are
+ * sorted on the calling thread.
+ *
+ **/
+RAPTOR_EXTERN_C
+void
+raptor_sequence_sort_r_parallel(raptor_sequence* seq,
+                                raptor_data_compare_arg_handler compare,
+                                void* user_data)
+{
+  RAPTOR_ASSERT_OBJECT_POINTER_RETURN(seq, raptor_sequence);
+
+  if(seq->size > 1)
+    raptor_sort_r_parallel(&seq->sequence[seq->start], seq->size, sizeof(void*),
+                           compare, user_data);
+}
+
+
 /**
  * raptor_sequence_print:
  * @seq: sequence to sort
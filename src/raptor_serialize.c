@@ -62,63 +62,147 @@ raptor_free_serializer_factory(raptor_serializer_factory* factory)
 
 /* class methods */
 
-int
-raptor_serializers_init(raptor_world* world)
-{
-  int rc = 0;
-
-  world->serializers = raptor_new_sequence((raptor_data_free_handler)raptor_free_serializer_factory, NULL);
-  if(!world->serializers)
-    return 1;
+/* Constructors of the compiled-in serializer factories and the syntax
+ * names each serves; same lazy registration scheme as the parser table
+ * in raptor_parse.c and in the old eager registration order.
+ */
+typedef struct {
+  /* syntax names served, NULL terminated */
+  const char* const names[3];
+  int (*init)(raptor_world* world);
+} raptor_serializer_registration;
 
+static const raptor_serializer_registration raptor_serializer_registrations[] = {
 #ifdef RAPTOR_SERIALIZER_NTRIPLES
-  rc += raptor_init_serializer_ntriples(world) != 0;
+  { { "ntriples", NULL, NULL }, raptor_init_serializer_ntriples },
 #endif
-
 #ifdef RAPTOR_SERIALIZER_TURTLE
-  rc += raptor_init_serializer_turtle(world) != 0;
+  { { "turtle", NULL, NULL }, raptor_init_serializer_turtle },
 #endif
-
 #ifdef RAPTOR_SERIALIZER_MKR
-  rc += raptor_init_serializer_mkr(world) != 0;
+  { { "mkr", NULL, NULL }, raptor_init_serializer_mkr },
 #endif
-
 #ifdef RAPTOR_SERIALIZER_RDFXML_ABBREV
-  rc += raptor_init_serializer_rdfxmla(world) != 0;
+  { { "rdfxml-xmp", "rdfxml-abbrev", NULL }, raptor_init_serializer_rdfxmla },
 #endif
-
 #ifdef RAPTOR_SERIALIZER_RDFXML
-  rc += raptor_init_serializer_rdfxml(world) != 0;
+  { { "rdfxml", NULL, NULL }, raptor_init_serializer_rdfxml },
 #endif
-
 #ifdef RAPTOR_SERIALIZER_RSS_1_0
-  rc += raptor_init_serializer_rss10(world) != 0;
+  { { "rss-1.0", NULL, NULL }, raptor_init_serializer_rss10 },
 #endif
-
 #ifdef RAPTOR_SERIALIZER_ATOM
-  rc += raptor_init_serializer_atom(world) != 0;
+  { { "atom", NULL, NULL }, raptor_init_serializer_atom },
 #endif
-
 #ifdef RAPTOR_SERIALIZER_DOT
-  rc += raptor_init_serializer_dot(world) != 0;
+  { { "dot", NULL, NULL }, raptor_init_serializer_dot },
 #endif
-
 #ifdef RAPTOR_SERIALIZER_JSON
-  rc += raptor_init_serializer_json(world) != 0;
+  { { "json-triples", "json", NULL }, raptor_init_serializer_json },
 #endif
-
 #ifdef RAPTOR_SERIALIZER_HTML
-  rc += raptor_init_serializer_html(world) != 0;
+  { { "html", NULL, NULL }, raptor_init_serializer_html },
 #endif
-
 #ifdef RAPTOR_SERIALIZER_NQUADS
-  rc += raptor_init_serializer_nquads(world) != 0;
+  { { "nquads", NULL, NULL }, raptor_init_serializer_nquads },
+#endif
+#ifdef RAPTOR_SERIALIZER_BINARY
+  { { "raptor-binary", NULL, NULL }, raptor_init_serializer_binary },
 #endif
+  { { NULL, NULL, NULL }, NULL }
+};
+
+
+/*
+ * raptor_serializers_register_all:
+ * @world: raptor_world object
+ *
+ * INTERNAL - Register any serializer factories not yet constructed.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_serializers_register_all(raptor_world* world)
+{
+  int rc = 0;
+  int i;
+
+  if(world->serializers_fully_registered)
+    return 0;
+
+  for(i = 0; raptor_serializer_registrations[i].init; i++) {
+    if(world->serializers_registered & (1U << i))
+      continue;
+    world->serializers_registered |= (1U << i);
+    rc += raptor_serializer_registrations[i].init(world) != 0;
+  }
+  world->serializers_fully_registered = 1;
 
   return rc;
 }
 
 
+/*
+ * raptor_serializers_register_name:
+ * @world: raptor_world object
+ * @name: syntax name
+ *
+ * INTERNAL - Ensure the serializer factory serving syntax @name is registered.
+ *
+ * A name not in the registration table may still be a factory alias
+ * the table does not list, so it falls back to registering everything.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_serializers_register_name(raptor_world* world, const char* name)
+{
+  int i;
+
+  if(world->serializers_fully_registered)
+    return 0;
+
+  for(i = 0; raptor_serializer_registrations[i].init; i++) {
+    int namei;
+    const char* fname;
+
+    for(namei = 0;
+        (fname = raptor_serializer_registrations[i].names[namei]);
+        namei++) {
+      if(!strcmp(fname, name))
+        break;
+    }
+    if(!fname)
+      continue;
+
+    if(world->serializers_registered & (1U << i))
+      return 0;
+    world->serializers_registered |= (1U << i);
+    return raptor_serializer_registrations[i].init(world) != 0;
+  }
+
+  return raptor_serializers_register_all(world);
+}
+
+
+int
+raptor_serializers_init(raptor_world* world)
+{
+  world->serializers = raptor_new_sequence((raptor_data_free_handler)raptor_free_serializer_factory, NULL);
+  if(!world->serializers)
+    return 1;
+
+  /* A thread safe world registers everything up front so that the
+   * factory registry is immutable once raptor_world_open() returns;
+   * otherwise factories are constructed lazily on first use.
+   */
+  if(world->thread_safe)
+    return raptor_serializers_register_all(world) != 0;
+
+  return 0;
+}
+
+
 /*
  * raptor_serializers_finish - delete all the registered serializers
  */
@@ -129,6 +213,10 @@ raptor_serializers_finish(raptor_world* world)
     raptor_free_sequence(world->serializers);
     world->serializers = NULL;
   }
+  if(world->serializer_name_index) {
+    raptor_free_avltree(world->serializer_name_index);
+    world->serializer_name_index = NULL;
+  }
 }
 
 
@@ -173,6 +261,17 @@ raptor_serializer_register_factory(raptor_world* world,
     goto tidy;
   }
 
+  /* index every name; the index is an optimization so an indexing
+   * failure just leaves lookups to the linear scan */
+  {
+    int namei;
+    const char* fname;
+
+    for(namei = 0; (fname = serializer->desc.names[namei]); namei++)
+      raptor_world_index_syntax_name(&world->serializer_name_index, fname,
+                                     serializer);
+  }
+
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
   RAPTOR_DEBUG2("Registered serializer %s\n", serializer->desc.names[0]);
 #endif
@@ -204,6 +303,11 @@ raptor_get_serializer_factory(raptor_world* world, const char *name)
 
   raptor_world_open(world);
 
+  if(name)
+    raptor_serializers_register_name(world, name);
+  else
+    raptor_serializers_register_all(world);
+
   /* return 1st serializer if no particular one wanted - why? */
   if(!name) {
     factory = (raptor_serializer_factory *)raptor_sequence_get_at(world->serializers, 0);
@@ -212,23 +316,27 @@ raptor_get_serializer_factory(raptor_world* world, const char *name)
       return NULL;
     }
   } else {
-    int i;
-    
-    for(i = 0;
-        (factory = (raptor_serializer_factory*)raptor_sequence_get_at(world->serializers, i));
-        i++) {
-      int namei;
-      const char* fname;
-      
-      for(namei = 0; (fname = factory->desc.names[namei]); namei++) {
-        if(!strcmp(fname, name))
+    factory = (raptor_serializer_factory*)raptor_world_lookup_syntax_name(world->serializer_name_index, name);
+    if(!factory) {
+      /* linear scan in case the name could not be indexed */
+      int i;
+
+      for(i = 0;
+          (factory = (raptor_serializer_factory*)raptor_sequence_get_at(world->serializers, i));
+          i++) {
+        int namei;
+        const char* fname;
+
+        for(namei = 0; (fname = factory->desc.names[namei]); namei++) {
+          if(!strcmp(fname, name))
+            break;
+        }
+        if(fname)
           break;
       }
-      if(fname)
-        break;
     }
   }
-        
+
   return factory;
 }
 
@@ -248,6 +356,8 @@ raptor_world_get_serializers_count(raptor_world* world)
 
   raptor_world_open(world);
 
+  raptor_serializers_register_all(world);
+
   return raptor_sequence_size(world->serializers);
 }
 
@@ -271,6 +381,8 @@ raptor_world_get_serializer_description(raptor_world* world,
 
   raptor_world_open(world);
 
+  raptor_serializers_register_all(world);
+
   factory = (raptor_serializer_factory*)raptor_sequence_get_at(world->serializers,
                                                                counter);
 
@@ -40,6 +40,16 @@
 #include "raptor2.h"
 #include "raptor_internal.h"
 
+/* entry in the seen-node hash set, chained per bucket */
+typedef struct raptor_dot_node_entry_s {
+  /* term owned by one of the node sequences below */
+  raptor_term* term;
+  struct raptor_dot_node_entry_s* next;
+} raptor_dot_node_entry;
+
+/* initial number of buckets in the seen-node hash set (power of two) */
+#define RAPTOR_DOT_NODES_INITIAL_BUCKETS 64
+
 /*
  * Raptor dot serializer object
  */
@@ -50,6 +60,13 @@ typedef struct {
   raptor_sequence *resources;
   raptor_sequence *literals;
   raptor_sequence *bnodes;
+
+  /* hash set over all terms in the three node sequences, keyed by
+   * raptor_term_hash(), so registering a node is O(1) instead of a
+   * linear scan of the sequences */
+  raptor_dot_node_entry** node_buckets;
+  unsigned int node_buckets_size;
+  unsigned int node_count;
 } raptor_dot_context;
 
 
@@ -125,10 +142,42 @@ raptor_dot_serializer_init(raptor_serializer *serializer, const char *name)
   context->bnodes =
     raptor_new_sequence((raptor_data_free_handler)raptor_free_term, NULL);
 
+  context->node_buckets = RAPTOR_CALLOC(raptor_dot_node_entry**,
+                                        RAPTOR_DOT_NODES_INITIAL_BUCKETS,
+                                        sizeof(raptor_dot_node_entry*));
+  context->node_buckets_size = RAPTOR_DOT_NODES_INITIAL_BUCKETS;
+  context->node_count = 0;
+
   return 0;
 }
 
 
+/* free the seen-node hash set; the terms belong to the node sequences */
+static void
+raptor_dot_serializer_free_nodes(raptor_dot_context* context)
+{
+  unsigned int i;
+
+  if(!context->node_buckets)
+    return;
+
+  for(i = 0; i < context->node_buckets_size; i++) {
+    raptor_dot_node_entry* entry = context->node_buckets[i];
+
+    while(entry) {
+      raptor_dot_node_entry* next = entry->next;
+      RAPTOR_FREE(raptor_dot_node_entry, entry);
+      entry = next;
+    }
+  }
+
+  RAPTOR_FREE(raptor_dot_node_entry**, context->node_buckets);
+  context->node_buckets = NULL;
+  context->node_buckets_size = 0;
+  context->node_count = 0;
+}
+
+
 /**
  * raptor_dot_iostream_write_string:
  * @iostr: #raptor_iostream to write to
@@ -259,8 +308,44 @@ raptor_dot_serializer_write_term(raptor_serializer * serializer,
 }
 
 
-/* Check the list to see if the node is a duplicate. If not, add it
- * to the list.
+/* double the seen-node bucket array and redistribute the entries
+ * using the hashes cached in the terms */
+static void
+raptor_dot_serializer_grow_nodes(raptor_dot_context* context)
+{
+  raptor_dot_node_entry** new_buckets;
+  unsigned int new_size = context->node_buckets_size << 1;
+  unsigned int i;
+
+  new_buckets = RAPTOR_CALLOC(raptor_dot_node_entry**, new_size,
+                              sizeof(raptor_dot_node_entry*));
+  if(!new_buckets)
+    return;
+
+  for(i = 0; i < context->node_buckets_size; i++) {
+    raptor_dot_node_entry* entry = context->node_buckets[i];
+
+    while(entry) {
+      raptor_dot_node_entry* next = entry->next;
+      unsigned int bucket;
+
+      bucket = RAPTOR_GOOD_CAST(unsigned int,
+                                raptor_term_hash(entry->term) & (new_size - 1));
+      entry->next = new_buckets[bucket];
+      new_buckets[bucket] = entry;
+
+      entry = next;
+    }
+  }
+
+  RAPTOR_FREE(raptor_dot_node_entry**, context->node_buckets);
+  context->node_buckets = new_buckets;
+  context->node_buckets_size = new_size;
+}
+
+
+/* Check the seen-node hash set to see if the node is a duplicate. If
+ * not, add it to the set and to the emission list for its type.
  */
 static void
 raptor_dot_serializer_assert_node(raptor_serializer* serializer,
@@ -268,9 +353,11 @@ raptor_dot_serializer_assert_node(raptor_serializer* serializer,
 {
   raptor_dot_context* context = (raptor_dot_context*)serializer->context;
   raptor_sequence* seq = NULL;
-  int i;
+  raptor_dot_node_entry* entry;
+  raptor_term* node;
+  unsigned int bucket;
 
-  /* Which list are we searching? */
+  /* Which list does this node belong in? */
   switch(assert_node->type) {
     case RAPTOR_TERM_TYPE_URI:
       seq = context->resources;
@@ -285,17 +372,34 @@ raptor_dot_serializer_assert_node(raptor_serializer* serializer,
       break;
 
     case RAPTOR_TERM_TYPE_UNKNOWN:
-      break;
+      return;
   }
 
-  for(i = 0 ; i < raptor_sequence_size(seq) ; i++ ) {
-    raptor_term* node = (raptor_term*)raptor_sequence_get_at(seq, i);
-
-    if(raptor_term_equals(node, assert_node))
+  bucket = RAPTOR_GOOD_CAST(unsigned int,
+                            raptor_term_hash(assert_node) &
+                            (context->node_buckets_size - 1));
+  for(entry = context->node_buckets[bucket]; entry; entry = entry->next) {
+    if(raptor_term_equals(entry->term, assert_node))
       return;
   }
 
-  raptor_sequence_push(seq, raptor_term_copy(assert_node));
+  node = raptor_term_copy(assert_node);
+  if(!node)
+    return;
+  raptor_sequence_push(seq, node);
+
+  entry = RAPTOR_MALLOC(raptor_dot_node_entry*, sizeof(*entry));
+  if(!entry)
+    /* the node was recorded for emission; the worst effect of losing
+     * the hash entry is re-registering it on a later statement */
+    return;
+
+  entry->term = node;
+  entry->next = context->node_buckets[bucket];
+  context->node_buckets[bucket] = entry;
+
+  if(++context->node_count > context->node_buckets_size)
+    raptor_dot_serializer_grow_nodes(context);
 }
 
 
@@ -498,6 +602,8 @@ raptor_dot_serializer_end(raptor_serializer* serializer)
   raptor_iostream_string_write((const unsigned char*) "}\n",
                                serializer->iostream);
 
+  raptor_dot_serializer_free_nodes(context);
+
   return 0;
 }
 
@@ -506,9 +612,10 @@ raptor_dot_serializer_end(raptor_serializer* serializer)
 static void
 raptor_dot_serializer_terminate(raptor_serializer* serializer)
 {
-  /* raptor_dot_context* context = (raptor_dot_context*)serializer->context; */
+  raptor_dot_context* context = (raptor_dot_context*)serializer->context;
 
-  /* Everything should have been freed in raptor_dot_serializer_end */
+  /* Everything else should have been freed in raptor_dot_serializer_end */
+  raptor_dot_serializer_free_nodes(context);
 }
 
 /* serialize a statement */
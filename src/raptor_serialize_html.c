@@ -45,8 +45,21 @@
  */
 typedef struct {
   int count;
+
+  /* render at most this many triples as table rows, 0 for no limit -
+   * see RAPTOR_OPTION_SERIALIZE_ROW_LIMIT */
+  int row_limit;
+
+  /* non-0 when the output iostream is corked for row assembly */
+  int corked;
+  /* iostream offset when the cork was applied */
+  unsigned long cork_offset;
 } raptor_html_context;
 
+/* flush the corked output iostream once this many bytes of table rows
+ * have been assembled */
+#define RAPTOR_HTML_FLUSH_SIZE 4096
+
 
 
 /* create a new serializer */
@@ -61,7 +74,15 @@ raptor_html_serialize_init(raptor_serializer* serializer, const char *name)
 static void
 raptor_html_serialize_terminate(raptor_serializer* serializer)
 {
-
+  raptor_html_context* context = (raptor_html_context *)serializer->context;
+
+  /* flush any rows still corked if the serializer is destroyed
+   * without raptor_serializer_serialize_end() */
+  if(context->corked) {
+    context->corked = 0;
+    if(serializer->iostream)
+      raptor_iostream_uncork(serializer->iostream);
+  }
 }
 
 
@@ -74,6 +95,11 @@ raptor_html_serialize_start(raptor_serializer* serializer)
 
   context->count = 0;
 
+  context->row_limit = RAPTOR_OPTIONS_GET_NUMERIC(serializer,
+                                                  RAPTOR_OPTION_SERIALIZE_ROW_LIMIT);
+  if(context->row_limit < 0)
+    context->row_limit = 0;
+
   /* XML and HTML declarations */
   raptor_iostream_counted_string_write(
     "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n", 39, iostr);
@@ -172,6 +198,22 @@ raptor_html_serialize_statement(raptor_serializer* serializer,
   raptor_html_context * context = (raptor_html_context *)serializer->context;
   raptor_iostream *iostr = serializer->iostream;
 
+  if(context->row_limit > 0 && context->count >= context->row_limit) {
+    /* past the rendered prefix - keep counting but emit nothing */
+    context->count++;
+    return 0;
+  }
+
+  /* assemble table rows in the iostream cork buffer so the handler
+   * sees one large write per flush instead of many small writes per
+   * triple */
+  if(!context->corked) {
+    if(!raptor_iostream_cork(iostr)) {
+      context->corked = 1;
+      context->cork_offset = raptor_iostream_tell(iostr);
+    }
+  }
+
   raptor_iostream_counted_string_write("    <tr class=\"triple\">\n", 24,
                                        iostr);
 
@@ -194,6 +236,13 @@ raptor_html_serialize_statement(raptor_serializer* serializer,
 
   context->count++;
 
+  if(context->corked &&
+     (raptor_iostream_tell(iostr) - context->cork_offset) >=
+       RAPTOR_HTML_FLUSH_SIZE) {
+    raptor_iostream_uncork(iostr);
+    context->corked = 0;
+  }
+
   return 0;
 }
 
@@ -205,8 +254,21 @@ raptor_html_serialize_end(raptor_serializer* serializer)
   raptor_html_context * context = (raptor_html_context *)serializer->context;
   raptor_iostream *iostr = serializer->iostream;
 
+  if(context->corked) {
+    context->corked = 0;
+    raptor_iostream_uncork(iostr);
+  }
+
   raptor_iostream_counted_string_write("  </table>\n", 11, iostr);
 
+  if(context->row_limit > 0 && context->count > context->row_limit) {
+    raptor_iostream_counted_string_write(
+      "  <p>Only the first <span class=\"limit\">", 40, iostr);
+    raptor_iostream_decimal_write(context->row_limit, iostr);
+    raptor_iostream_counted_string_write(
+      "</span> triples are shown.</p>\n", 31, iostr);
+  }
+
   raptor_iostream_counted_string_write(
     "  <p>Total number of triples: <span class=\"count\">", 50, iostr);
   raptor_iostream_decimal_write(context->count, iostr);
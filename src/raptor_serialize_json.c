@@ -57,8 +57,18 @@ typedef struct {
 
   int need_object_comma;
 
+  /* non-0 when the output iostream is corked for statement assembly
+   * in the streaming json-triples flavor */
+  int corked;
+  /* iostream offset when the cork was applied */
+  unsigned long cork_offset;
+
 } raptor_json_context;
 
+/* flush the corked output iostream once this many bytes of statements
+ * have been assembled */
+#define RAPTOR_JSON_FLUSH_SIZE 4096
+
 
 static int raptor_json_serialize_init(raptor_serializer* serializer,
                                       const char *name);
@@ -96,6 +106,14 @@ raptor_json_serialize_terminate(raptor_serializer* serializer)
 {
   raptor_json_context* context = (raptor_json_context*)serializer->context;
 
+  /* flush any statements still corked if the serializer is destroyed
+   * without raptor_serializer_serialize_end() */
+  if(context->corked) {
+    context->corked = 0;
+    if(serializer->iostream)
+      raptor_iostream_uncork(serializer->iostream);
+  }
+
   if(context->json_writer) {
     raptor_free_json_writer(context->json_writer);
     context->json_writer = NULL;
@@ -171,6 +189,16 @@ raptor_json_serialize_statement(raptor_serializer* serializer,
     return raptor_avltree_add(context->avltree, s);
   }
 
+  /* streaming flavor: each statement goes straight to the output;
+   * cork the iostream so a statement object reaches the handler as
+   * one write per flush */
+  if(!context->corked) {
+    if(!raptor_iostream_cork(serializer->iostream)) {
+      context->corked = 1;
+      context->cork_offset = raptor_iostream_tell(serializer->iostream);
+    }
+  }
+
   if(context->need_subject_comma) {
     raptor_iostream_write_byte(',', serializer->iostream);
     raptor_json_writer_newline(context->json_writer);
@@ -204,6 +232,14 @@ raptor_json_serialize_statement(raptor_serializer* serializer,
   raptor_json_writer_end_block(context->json_writer, '}');
 
   context->need_subject_comma = 1;
+
+  if(context->corked &&
+     (raptor_iostream_tell(serializer->iostream) - context->cork_offset) >=
+       RAPTOR_JSON_FLUSH_SIZE) {
+    raptor_iostream_uncork(serializer->iostream);
+    context->corked = 0;
+  }
+
   return 0;
 }
 
@@ -337,7 +373,12 @@ raptor_json_serialize_end(raptor_serializer* serializer)
 {
   raptor_json_context* context = (raptor_json_context*)serializer->context;
   char* value;
-  
+
+  if(context->corked) {
+    context->corked = 0;
+    raptor_iostream_uncork(serializer->iostream);
+  }
+
   raptor_json_writer_newline(context->json_writer);
 
   if(context->is_resource) {
@@ -46,8 +46,17 @@
  */
 typedef struct {
   int is_nquads;
+
+  /* non-0 when the output iostream is corked for line assembly */
+  int corked;
+  /* iostream offset when the cork was applied */
+  unsigned long cork_offset;
 } raptor_ntriples_serializer_context;
 
+/* flush the corked output iostream once this many bytes of statement
+ * lines have been assembled */
+#define RAPTOR_NTRIPLES_FLUSH_SIZE 4096
+
 
 
 /* create a new serializer */
@@ -67,7 +76,17 @@ raptor_ntriples_serialize_init(raptor_serializer* serializer, const char *name)
 static void
 raptor_ntriples_serialize_terminate(raptor_serializer* serializer)
 {
+  raptor_ntriples_serializer_context* ntriples_serializer;
+
+  ntriples_serializer = (raptor_ntriples_serializer_context*)serializer->context;
 
+  /* flush any statement lines still corked if the serializer is
+   * destroyed without raptor_serializer_serialize_end() */
+  if(ntriples_serializer->corked) {
+    ntriples_serializer->corked = 0;
+    if(serializer->iostream)
+      raptor_iostream_uncork(serializer->iostream);
+  }
 }
   
 
@@ -219,24 +238,49 @@ raptor_ntriples_serialize_statement(raptor_serializer* serializer,
                                     raptor_statement *statement)
 {
   raptor_ntriples_serializer_context* ntriples_serializer;
+  raptor_iostream* iostr = serializer->iostream;
 
   ntriples_serializer = (raptor_ntriples_serializer_context*)serializer->context;
 
-  raptor_statement_ntriples_write(statement,
-                                  serializer->iostream,
+  /* assemble statement lines in the iostream cork buffer so the
+   * handler sees one large write per flush instead of several small
+   * writes per triple */
+  if(!ntriples_serializer->corked) {
+    if(!raptor_iostream_cork(iostr)) {
+      ntriples_serializer->corked = 1;
+      ntriples_serializer->cork_offset = raptor_iostream_tell(iostr);
+    }
+  }
+
+  raptor_statement_ntriples_write(statement, iostr,
                                   ntriples_serializer->is_nquads);
+
+  if(ntriples_serializer->corked &&
+     (raptor_iostream_tell(iostr) - ntriples_serializer->cork_offset) >=
+       RAPTOR_NTRIPLES_FLUSH_SIZE) {
+    raptor_iostream_uncork(iostr);
+    ntriples_serializer->corked = 0;
+  }
+
   return 0;
 }
 
 
-#if 0
 /* end a serialize */
 static int
 raptor_ntriples_serialize_end(raptor_serializer* serializer)
 {
+  raptor_ntriples_serializer_context* ntriples_serializer;
+
+  ntriples_serializer = (raptor_ntriples_serializer_context*)serializer->context;
+
+  if(ntriples_serializer->corked) {
+    ntriples_serializer->corked = 0;
+    return raptor_iostream_uncork(serializer->iostream);
+  }
+
   return 0;
 }
-#endif
   
 /* finish the serializer factory */
 static void
@@ -278,7 +322,7 @@ raptor_ntriples_serializer_register_factory(raptor_serializer_factory *factory)
   factory->declare_namespace   = raptor_ntriples_serialize_declare_namespace;
   factory->serialize_start     = NULL;
   factory->serialize_statement = raptor_ntriples_serialize_statement;
-  factory->serialize_end       = NULL;
+  factory->serialize_end       = raptor_ntriples_serialize_end;
   factory->finish_factory      = raptor_ntriples_serialize_finish_factory;
 
   return 0;
@@ -316,7 +360,7 @@ raptor_nquads_serializer_register_factory(raptor_serializer_factory *factory)
   factory->declare_namespace   = raptor_ntriples_serialize_declare_namespace;
   factory->serialize_start     = NULL;
   factory->serialize_statement = raptor_ntriples_serialize_statement;
-  factory->serialize_end       = NULL;
+  factory->serialize_end       = raptor_ntriples_serialize_end;
   factory->finish_factory      = raptor_ntriples_serialize_finish_factory;
 
   return 0;
@@ -358,11 +358,16 @@ raptor_rdfxml_serialize_statement(raptor_serializer* serializer,
     size_t name_len = 1;
     unsigned char c;
 
-    /* Do not use raptor_uri_as_counted_string() - we want a modifiable copy */
-    uri_string = raptor_uri_to_counted_string(statement->predicate->value.uri,
-                                              &uri_len);
+    const unsigned char* stored_uri_string;
+
+    /* copy into scratch - we want a modifiable copy for the qname
+     * split below without a malloc per statement */
+    stored_uri_string = raptor_uri_as_counted_string(statement->predicate->value.uri,
+                                                     &uri_len);
+    uri_string = raptor_world_borrow_scratch(serializer->world, uri_len + 1);
     if(!uri_string)
       goto oom;
+    memcpy(uri_string, stored_uri_string, uri_len + 1);
 
     p= uri_string;
     name_len = uri_len;
@@ -413,9 +418,10 @@ raptor_rdfxml_serialize_statement(raptor_serializer* serializer,
     base_uri = raptor_uri_copy(serializer->base_uri);
 
 
-  rdf_Description_element = raptor_new_xml_element_from_namespace_local_name(context->rdf_nspace,
-                                                                             (unsigned const char*)"Description",
-                                                                             NULL, base_uri);
+  rdf_Description_element = raptor_xml_writer_new_element_from_namespace_local_name(xml_writer,
+                                                                                    context->rdf_nspace,
+                                                                                    (unsigned const char*)"Description",
+                                                                                    NULL, base_uri);
   if(!rdf_Description_element)
     goto oom;
 
@@ -481,7 +487,7 @@ raptor_rdfxml_serialize_statement(raptor_serializer* serializer,
 
 
   /* predicate */
-  predicate_element = raptor_new_xml_element_from_namespace_local_name(predicate_ns, name, NULL, base_uri);
+  predicate_element = raptor_xml_writer_new_element_from_namespace_local_name(xml_writer, predicate_ns, name, NULL, base_uri);
   if(!predicate_element)
     goto oom;
 
@@ -548,7 +554,7 @@ raptor_rdfxml_serialize_statement(raptor_serializer* serializer,
       }
 
       raptor_xml_writer_end_element(xml_writer, predicate_element);
-      raptor_free_xml_element(predicate_element);
+      raptor_xml_writer_recycle_element(xml_writer, predicate_element);
       predicate_element = NULL;
       raptor_xml_writer_cdata_counted(xml_writer, (const unsigned char*)"\n", 1);
 
@@ -571,17 +577,20 @@ raptor_rdfxml_serialize_statement(raptor_serializer* serializer,
 
     case RAPTOR_TERM_TYPE_URI:
       /* must be URI */
+      allocated = 1;
       if(RAPTOR_OPTIONS_GET_NUMERIC(serializer, RAPTOR_OPTION_RELATIVE_URIS)) {
         object_uri_string = raptor_uri_to_relative_uri_string(serializer->base_uri,
                                                               statement->object->value.uri);
       } else {
-        object_uri_string = raptor_uri_to_string(statement->object->value.uri);
+        object_uri_string = raptor_uri_as_string(statement->object->value.uri);
+        allocated = 0;
       }
       if(!object_uri_string)
         goto oom;
 
       attrs[attrs_count] = raptor_new_qname_from_namespace_local_name(serializer->world, context->rdf_nspace, (const unsigned char*)"resource", object_uri_string);
-      RAPTOR_FREE(char*, object_uri_string);
+      if(allocated)
+        RAPTOR_FREE(char*, object_uri_string);
 
       if(!attrs[attrs_count])
         goto oom;
@@ -619,12 +628,12 @@ raptor_rdfxml_serialize_statement(raptor_serializer* serializer,
     RAPTOR_FREE(qnamearray, attrs);
 
   if(predicate_element)
-    raptor_free_xml_element(predicate_element);
+    raptor_xml_writer_recycle_element(xml_writer, predicate_element);
 
   if(rdf_Description_element) {
     raptor_xml_writer_end_element(xml_writer, rdf_Description_element);
     raptor_xml_writer_cdata_counted(xml_writer, (const unsigned char*)"\n", 1);
-    raptor_free_xml_element(rdf_Description_element);
+    raptor_xml_writer_recycle_element(xml_writer, rdf_Description_element);
   }
 
   if(base_uri)
@@ -634,7 +643,7 @@ raptor_rdfxml_serialize_statement(raptor_serializer* serializer,
     raptor_free_namespace(predicate_ns);
 
   if(uri_string)
-    RAPTOR_FREE(char*, uri_string);
+    raptor_world_return_scratch(serializer->world, uri_string);
 
   return rc;
 }
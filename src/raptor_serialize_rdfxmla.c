@@ -86,6 +86,23 @@ typedef struct {
 
   /* If non-0, emit typed nodes */
   int write_typed_nodes;
+
+  /* subject node of the last statement stored; detects runs of
+   * identical subjects (subject-sorted dump input) so they skip the
+   * tree search.  Borrowed pointer into subjects/blanks, cleared
+   * whenever those trees lose nodes */
+  raptor_abbrev_subject* last_subject;
+
+  /* statements stored since the last flush; compared against
+   * RAPTOR_OPTION_SERIALIZE_FLUSH_INTERVAL to bound the abbreviation
+   * window */
+  int statements_since_flush;
+
+  /* non-0 once a flush has happened.  Blank node inlining relies on
+   * reference counts that only cover the current window, so windowed
+   * output must always label blanks with rdf:nodeID - a blank seen in
+   * two windows would otherwise become two anonymous nodes */
+  int windowed;
 } raptor_rdfxmla_context;
 
 
@@ -341,7 +358,8 @@ raptor_rdfxmla_emit_blank(raptor_serializer *serializer,
   if(node->term->type != RAPTOR_TERM_TYPE_BLANK)
     return 1;
   
-  if((node->count_as_subject == 1 && node->count_as_object == 1)) {
+  if(!context->windowed &&
+     (node->count_as_subject == 1 && node->count_as_object == 1)) {
     /* If this is only used as a 1 subject and object or never
      * used as a subject or never used as an object, it never need
      * be referenced with an explicit name */
@@ -633,6 +651,7 @@ raptor_rdfxmla_emit_subject(raptor_serializer *serializer,
   raptor_qname **attrs;
   unsigned char *attr_name;
   unsigned char *attr_value;
+  int attr_value_owned;
   raptor_uri *base_uri = NULL;
   int subject_is_single_node;
   raptor_term *subject_term = subject->node->term;
@@ -640,6 +659,9 @@ raptor_rdfxmla_emit_subject(raptor_serializer *serializer,
   if(!raptor_abbrev_subject_valid(subject))
     return 0;
 
+  if(raptor_abbrev_subject_commit_properties(subject))
+    return 1;
+
   subject_is_single_node = (context->single_node &&
                             subject_term->type == RAPTOR_TERM_TYPE_URI &&
                             raptor_uri_equals(subject_term->value.uri,
@@ -648,7 +670,7 @@ raptor_rdfxmla_emit_subject(raptor_serializer *serializer,
 
   RAPTOR_DEBUG_ABBREV_NODE("Emitting subject node", subject->node);
   
-  if(!depth &&
+  if(!depth && !context->windowed &&
      subject_term->type == RAPTOR_TERM_TYPE_BLANK &&
      subject->node->count_as_subject == 1 &&
      subject->node->count_as_object == 1) {
@@ -697,25 +719,29 @@ raptor_rdfxmla_emit_subject(raptor_serializer *serializer,
     
   attr_name = NULL;
   attr_value = NULL;
-    
+  attr_value_owned = 0;
+
   /* emit the subject node */
   if(subject_term->type == RAPTOR_TERM_TYPE_URI) {
     attr_name = (unsigned char*)"about";
     if(context->is_xmp) {
       /* XML rdf:about value is always "" */
       attr_value = RAPTOR_CALLOC(unsigned char*, 1, sizeof(unsigned char));
+      attr_value_owned = 1;
     } else if(RAPTOR_OPTIONS_GET_NUMERIC(serializer,
-                                         RAPTOR_OPTION_RELATIVE_URIS))
+                                         RAPTOR_OPTION_RELATIVE_URIS)) {
       attr_value = raptor_uri_to_relative_uri_string(serializer->base_uri,
                                                      subject_term->value.uri);
-    else
-      attr_value = raptor_uri_to_string(subject_term->value.uri);
-    
+      attr_value_owned = 1;
+    } else
+      attr_value = (unsigned char*)raptor_uri_as_string(subject_term->value.uri);
+
   } else if(subject_term->type == RAPTOR_TERM_TYPE_BLANK) {
-    if(subject->node->count_as_subject &&
-       subject->node->count_as_object &&
-       !(subject->node->count_as_subject == 1 && 
-         subject->node->count_as_object == 1)) {
+    if(context->windowed ||
+       (subject->node->count_as_subject &&
+        subject->node->count_as_object &&
+        !(subject->node->count_as_subject == 1 &&
+          subject->node->count_as_object == 1))) {
       /* No need for nodeID if this node is never used as a subject
        * or object OR if it is used exactly once as subject and object.
        */
@@ -730,9 +756,9 @@ raptor_rdfxmla_emit_subject(raptor_serializer *serializer,
                                                           attr_name,
                                                           attr_value);
     
-    if(subject_term->type != RAPTOR_TERM_TYPE_BLANK)
+    if(attr_value_owned)
       RAPTOR_FREE(char*, attr_value);
-    
+
     if(!attrs[0]) {
       RAPTOR_FREE(qnamearray, attrs);
       goto oom;  
@@ -937,11 +963,13 @@ raptor_rdfxmla_serialize_terminate(raptor_serializer* serializer)
     context->namespaces = NULL;
   }
 
+  context->last_subject = NULL;
+
   if(context->subjects) {
     raptor_free_avltree(context->subjects);
     context->subjects = NULL;
   }
-  
+
   if(context->blanks) {
     raptor_free_avltree(context->blanks);
     context->blanks = NULL;
@@ -1283,7 +1311,61 @@ raptor_rdfxmla_ensure_writen_header(raptor_serializer* serializer,
                    "Out of memory");
   return 1;
 }
-  
+
+
+/*
+ * raptor_rdfxmla_serialize_flush_subjects:
+ * @serializer: serializer object
+ *
+ * INTERNAL - Emit and discard all subjects stored so far.
+ *
+ * Streaming mode support: writes out the accumulated
+ * subjects/blanks/nodes trees inside the already-open rdf:RDF element
+ * and resets them, so memory is bounded by the window rather than the
+ * graph.  Subjects whose statements span a flush get several
+ * rdf:Description blocks and blank nodes stop being nested - in
+ * windowed output every blank carries an rdf:nodeID label since the
+ * reference counts driving inlining only see one window.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_rdfxmla_serialize_flush_subjects(raptor_serializer* serializer)
+{
+  raptor_rdfxmla_context* context = (raptor_rdfxmla_context*)serializer->context;
+
+  if(raptor_rdfxmla_ensure_writen_header(serializer, context))
+    return 1;
+
+  context->windowed = 1;
+
+  raptor_rdfxmla_emit(serializer);
+
+  raptor_free_avltree(context->subjects);
+  raptor_free_avltree(context->blanks);
+  raptor_free_avltree(context->nodes);
+  context->last_subject = NULL;
+
+  context->subjects =
+    raptor_new_avltree((raptor_data_compare_handler)raptor_abbrev_subject_compare,
+                       (raptor_data_free_handler)raptor_free_abbrev_subject, 0);
+
+  context->blanks =
+    raptor_new_avltree((raptor_data_compare_handler)raptor_abbrev_subject_compare,
+                       (raptor_data_free_handler)raptor_free_abbrev_subject, 0);
+
+  context->nodes =
+    raptor_new_avltree((raptor_data_compare_handler)raptor_abbrev_node_compare,
+                       (raptor_data_free_handler)raptor_free_abbrev_node, 0);
+
+  context->statements_since_flush = 0;
+
+  if(!context->subjects || !context->blanks || !context->nodes)
+    return 1;
+
+  return 0;
+}
+
 
 /* serialize a statement */
 static int
@@ -1296,7 +1378,8 @@ raptor_rdfxmla_serialize_statement(raptor_serializer* serializer,
   raptor_abbrev_node* object = NULL;
   int rv = 0;
   raptor_term_type object_type;
-  
+  int flush_interval;
+
   if(!(statement->subject->type == RAPTOR_TERM_TYPE_URI ||
        statement->subject->type == RAPTOR_TERM_TYPE_BLANK)) {
     raptor_log_error_formatted(serializer->world, RAPTOR_LOG_LEVEL_ERROR, NULL,
@@ -1305,12 +1388,22 @@ raptor_rdfxmla_serialize_statement(raptor_serializer* serializer,
     return 1;
   }  
 
-  subject = raptor_abbrev_subject_lookup(context->nodes, context->subjects,
-                                         context->blanks,
-                                         statement->subject);
-  if(!subject)
-    return 1;
-  
+  /* a run of statements with the same subject reuses the node found
+   * for the previous one - on subject-sorted input this replaces
+   * nearly every tree search */
+  if(context->last_subject &&
+     raptor_term_equals(context->last_subject->node->term,
+                        statement->subject))
+    subject = context->last_subject;
+  else {
+    subject = raptor_abbrev_subject_lookup(context->nodes, context->subjects,
+                                           context->blanks,
+                                           statement->subject);
+    if(!subject)
+      return 1;
+    context->last_subject = subject;
+  }
+
   object_type = statement->object->type;
 
   if(!(object_type == RAPTOR_TERM_TYPE_URI ||
@@ -1354,6 +1447,10 @@ raptor_rdfxmla_serialize_statement(raptor_serializer* serializer,
       if(context->is_xmp && predicate->ref_count > 1) {
         raptor_avltree_iterator* iter = NULL;
         int i;
+
+        /* the scan below needs the pending properties in the tree */
+        if(raptor_abbrev_subject_commit_properties(subject))
+          return 1;
         for(i = 0, (iter = raptor_new_avltree_iterator(subject->properties, NULL, NULL, 1));
             iter && !rv;
             i++, (rv = raptor_avltree_iterator_next(iter))) {
@@ -1371,9 +1468,11 @@ raptor_rdfxmla_serialize_statement(raptor_serializer* serializer,
               /* look for any generated blank node associated with this
                * statement and free it
                */
-              raptor_abbrev_subject *blank = 
+              raptor_abbrev_subject *blank =
                 raptor_abbrev_subject_find(context->blanks,
                                            statement->object);
+              if(blank == context->last_subject)
+                context->last_subject = NULL;
               if(subject) raptor_avltree_delete(context->blanks, blank);
             }
             break;
@@ -1404,7 +1503,19 @@ raptor_rdfxmla_serialize_statement(raptor_serializer* serializer,
   if(object_type == RAPTOR_TERM_TYPE_URI ||
      object_type == RAPTOR_TERM_TYPE_BLANK)
     object->count_as_object++;
-    
+
+  /* xmp and single-node modes need the whole graph in the trees (the
+   * duplicate-predicate scan and node selection look across all of
+   * it), so windowing applies to the plain abbreviated form only */
+  if(!context->is_xmp && !context->single_node) {
+    flush_interval = RAPTOR_OPTIONS_GET_NUMERIC(serializer,
+                                                RAPTOR_OPTION_SERIALIZE_FLUSH_INTERVAL);
+    if(flush_interval > 0 &&
+       ++context->statements_since_flush >= flush_interval) {
+      if(raptor_rdfxmla_serialize_flush_subjects(serializer))
+        return 1;
+    }
+  }
 
   return 0;
 
@@ -1449,7 +1560,9 @@ raptor_rdfxmla_serialize_end(raptor_serializer* serializer)
     raptor_free_uri(context->single_node);
 
   context->written_header = 0;
-  
+  context->statements_since_flush = 0;
+  context->windowed = 0;
+
   return 0;
 }
 
@@ -48,9 +48,24 @@ typedef struct {
   raptor_term* term;
   /* shared pointer */
   raptor_rss_item* item;
+  /* type the item was registered as, or RAPTOR_RSS_NONE for blank
+   * node closure entries */
+  raptor_rss_type type;
 } raptor_rss_group_map;
 
 
+/* Map of subject URI (key, owned) : indexes into the pending triples
+ * sequence of statements with that subject, so that
+ * raptor_rss10_move_statements() visits only its own subject's
+ * triples instead of rescanning the whole sequence for every item */
+typedef struct {
+  raptor_uri* uri;
+  int* indexes;
+  int count;
+  int size;
+} raptor_rss_triple_map;
+
+
 
 /*
  * Raptor 'RSS 1.0' serializer object
@@ -110,6 +125,9 @@ typedef struct {
   /* Map of group URI (key, owned) : rss item object (value, shared) */
   raptor_avltree *group_map;
 
+  /* Map of raptor_rss_triple_map indexing @triples by subject URI */
+  raptor_avltree *triples_index;
+
   /* User declared namespaces */
   raptor_sequence *user_namespaces;
 
@@ -154,25 +172,106 @@ raptor_rss10_get_group_item(raptor_rss10_serializer_context *rss_serializer,
 }
 
 
+/* As raptor_rss10_get_group_item() but only return an item that was
+ * registered as @type - used for triple-to-item routing where a hit
+ * for a different kind of item must not match */
+static raptor_rss_item*
+raptor_rss10_get_group_item_typed(raptor_rss10_serializer_context *rss_serializer,
+                                  raptor_term* term, raptor_rss_type type)
+{
+  raptor_rss_group_map search_gm;
+  raptor_rss_group_map* gm;
+
+  search_gm.world = rss_serializer->world;
+  search_gm.term = term;
+  gm = (raptor_rss_group_map*)raptor_avltree_search(rss_serializer->group_map,
+                                                    (void*)&search_gm);
+
+  return (gm && gm->type == type) ? gm->item : NULL;
+}
+
+
 static int
 raptor_rss10_set_item_group(raptor_rss10_serializer_context *rss_serializer,
-                            raptor_term* term, raptor_rss_item *item)
+                            raptor_term* term, raptor_rss_item *item,
+                            raptor_rss_type type)
 {
   raptor_rss_group_map* gm;
 
   if(raptor_rss10_get_group_item(rss_serializer, term))
     return 0;
- 
+
   gm = RAPTOR_CALLOC(raptor_rss_group_map*, 1, sizeof(*gm));
   gm->world = rss_serializer->world;
   gm->term = raptor_term_copy(term);
   gm->item = item;
-  
+  gm->type = type;
+
   raptor_avltree_add(rss_serializer->group_map, gm);
   return 0;
 }
 
 
+static void
+raptor_free_triple_map(raptor_rss_triple_map* tm)
+{
+  if(tm->uri)
+    raptor_free_uri(tm->uri);
+  if(tm->indexes)
+    RAPTOR_FREE(int*, tm->indexes);
+
+  RAPTOR_FREE(raptor_rss_triple_map, tm);
+}
+
+
+static int
+raptor_rss_triple_map_compare(raptor_rss_triple_map* tm1,
+                              raptor_rss_triple_map* tm2)
+{
+  return raptor_uri_compare(tm1->uri, tm2->uri);
+}
+
+
+/* Record that the pending triple at index @t has subject @subject_uri */
+static int
+raptor_rss10_index_triple(raptor_rss10_serializer_context *rss_serializer,
+                          raptor_uri* subject_uri, int t)
+{
+  raptor_rss_triple_map search_tm;
+  raptor_rss_triple_map* tm;
+
+  search_tm.uri = subject_uri;
+  tm = (raptor_rss_triple_map*)raptor_avltree_search(rss_serializer->triples_index,
+                                                     (void*)&search_tm);
+  if(!tm) {
+    tm = RAPTOR_CALLOC(raptor_rss_triple_map*, 1, sizeof(*tm));
+    if(!tm)
+      return 1;
+
+    tm->uri = raptor_uri_copy(subject_uri);
+    if(raptor_avltree_add(rss_serializer->triples_index, tm)) {
+      raptor_free_triple_map(tm);
+      return 1;
+    }
+  }
+
+  if(tm->count == tm->size) {
+    int* new_indexes;
+    int new_size = tm->size ? (tm->size << 1) : 4;
+
+    new_indexes = RAPTOR_REALLOC(int*, tm->indexes,
+                                 sizeof(int) * new_size);
+    if(!new_indexes)
+      return 1;
+    tm->indexes = new_indexes;
+    tm->size = new_size;
+  }
+
+  tm->indexes[tm->count++] = t;
+  return 0;
+}
+
+
 /**
  * raptor_rss10_serialize_init:
  * @serializer: serializer object
@@ -202,6 +301,9 @@ raptor_rss10_serialize_init(raptor_serializer* serializer, const char *name)
   rss_serializer->group_map = raptor_new_avltree((raptor_data_compare_handler)raptor_rss_group_map_compare,
                                                  (raptor_data_free_handler)raptor_free_group_map, 0);
 
+  rss_serializer->triples_index = raptor_new_avltree((raptor_data_compare_handler)raptor_rss_triple_map_compare,
+                                                     (raptor_data_free_handler)raptor_free_triple_map, 0);
+
   rss_serializer->user_namespaces = raptor_new_sequence((raptor_data_free_handler)raptor_free_namespace, NULL);
 
   rss_serializer->is_atom = !(strcmp(name,"atom"));
@@ -269,7 +371,10 @@ raptor_rss10_serialize_terminate(raptor_serializer* serializer)
 
   if(rss_serializer->group_map)
     raptor_free_avltree(rss_serializer->group_map);
-  
+
+  if(rss_serializer->triples_index)
+    raptor_free_avltree(rss_serializer->triples_index);
+
   if(world->rss_fields_info_qnames) {
     for(i = 0; i < RAPTOR_RSS_FIELDS_SIZE; i++) {
       if(world->rss_fields_info_qnames[i])
@@ -309,32 +414,43 @@ raptor_rss10_move_statements(raptor_rss10_serializer_context *rss_serializer,
                              raptor_rss_type type,
                              raptor_rss_item *item)
 {
-  int t;
+  raptor_rss_triple_map search_tm;
+  raptor_rss_triple_map* tm;
+  int ti;
   int count = 0;
   int is_atom = rss_serializer->is_atom;
-  int size = raptor_sequence_size(rss_serializer->triples);
-  
-  for(t = 0; t < size; t++) {
+
+  if(!item->uri)
+    return 0;
+
+  /* every pending triple with this subject is listed in the index, so
+   * only those need to be visited rather than the whole sequence */
+  search_tm.uri = item->uri;
+  tm = (raptor_rss_triple_map*)raptor_avltree_search(rss_serializer->triples_index,
+                                                     (void*)&search_tm);
+  if(!tm)
+    return 0;
+
+  for(ti = 0; ti < tm->count; ti++) {
+    int t = tm->indexes[ti];
     raptor_statement* s;
     int f;
 
     s = (raptor_statement*)raptor_sequence_get_at(rss_serializer->triples, t);
     if(!s)
+      /* already moved out of the sequence */
       continue;
 
-    if(s->subject->type != RAPTOR_TERM_TYPE_URI ||
-       !raptor_uri_equals(s->subject->value.uri, item->uri))
-       continue;
-    
     /* now we know this triple is associated with the item URI
      * and can count the relevant triples */
     count++;
-    
+
     /* add triples with anonymous object to the general triples sequence
      * for this item, and to the group map (blank node closure)
      */
     if(s->object->type == RAPTOR_TERM_TYPE_BLANK) {
-      raptor_rss10_set_item_group(rss_serializer, s->object, item);
+      raptor_rss10_set_item_group(rss_serializer, s->object, item,
+                                  RAPTOR_RSS_NONE);
 
       RAPTOR_DEBUG4("Moved anonymous value property URI <%s> for typed node %u - %s\n",
                     raptor_uri_as_string(s->predicate->value.uri),
@@ -364,7 +480,7 @@ raptor_rss10_move_statements(raptor_rss10_serializer_context *rss_serializer,
           field->uri = s->object->value.uri;
           s->object->value.uri = NULL;
         } else {
-          field->value = s->object->value.literal.string;
+          field->value = raptor_term_detach_literal_string(s->object);
           if(s->object->value.literal.datatype &&
              raptor_uri_equals(s->object->value.literal.datatype,
                                rss_serializer->xml_literal_dt))
@@ -375,8 +491,6 @@ raptor_rss10_move_statements(raptor_rss10_serializer_context *rss_serializer,
 
           if(f == RAPTOR_RSS_FIELD_ATOM_SUMMARY && *field->value == '<')
             field->is_xml = 1;
-
-          s->object->value.literal.string = NULL;
         }
 
         if(is_atom) { 
@@ -429,7 +543,11 @@ raptor_rss10_move_statements(raptor_rss10_serializer_context *rss_serializer,
                                                      t);
     raptor_sequence_push(item->triples, s);
 
-  } /* end for all triples */
+  } /* end for all indexed triples */
+
+  /* every visited triple was moved out of the sequence, only indexes
+   * recorded after this point are live */
+  tm->count = 0;
 
 #ifdef RAPTOR_DEBUG
   if(count > 0)
@@ -486,7 +604,8 @@ raptor_rss10_move_anonymous_statements(raptor_rss10_serializer_context *rss_seri
 #endif
 
         if(s->object->type == RAPTOR_TERM_TYPE_BLANK)
-          raptor_rss10_set_item_group(rss_serializer, s->object, item);
+          raptor_rss10_set_item_group(rss_serializer, s->object, item,
+                                      RAPTOR_RSS_NONE);
         
 
         handled = 1;
@@ -684,7 +803,7 @@ raptor_rss10_store_statement(raptor_rss10_serializer_context *rss_serializer,
           s->object->value.uri = NULL;
         } else {
           /* must be literal - checked above */
-          field->value = s->object->value.literal.string;
+          field->value = raptor_term_detach_literal_string(s->object);
 
           if(s->object->value.literal.datatype &&
              raptor_uri_equals(s->object->value.literal.datatype,
@@ -696,7 +815,6 @@ raptor_rss10_store_statement(raptor_rss10_serializer_context *rss_serializer,
 
           if(f == RAPTOR_RSS_FIELD_ATOM_SUMMARY && *field->value == '<')
             field->is_xml = 1;
-          s->object->value.literal.string = NULL;
         }
 
         if(is_atom) { 
@@ -749,6 +867,10 @@ raptor_rss10_store_statement(raptor_rss10_serializer_context *rss_serializer,
     if(t) {
       raptor_sequence_push(rss_serializer->triples, t);
 
+      if(t->subject->type == RAPTOR_TERM_TYPE_URI)
+        raptor_rss10_index_triple(rss_serializer, t->subject->value.uri,
+                                  raptor_sequence_size(rss_serializer->triples) - 1);
+
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
       fprintf(stderr,"Stored statement: ");
       raptor_statement_print_as_ntriples(s, stderr);
@@ -880,38 +1002,29 @@ raptor_rss10_serialize_statement(raptor_serializer* serializer,
 
 
   if(type == RAPTOR_RSS_ITEM) {
-    int size = raptor_sequence_size(rss_serializer->items);
-    for(i = 0; i < size; i++) {
-      item = (raptor_rss_item*)raptor_sequence_get_at(rss_serializer->items, i);
-
-      if(raptor_rss_item_equals_statement_subject(item, statement))
-        break;
-      
-    }
-    if(i < size) {
-      RAPTOR_DEBUG2("Found RSS item at entry %d in sequence of items\n", i);
+    /* every item in the sequence of items with a subject term is
+     * registered in the group map, so one lookup replaces scanning
+     * the whole sequence per typed-node triple */
+    item = raptor_rss10_get_group_item_typed(rss_serializer,
+                                             statement->subject, type);
+    if(item) {
+      RAPTOR_DEBUG1("Found RSS item in group map\n");
     } else {
 #ifdef RAPTOR_DEBUG
       if(1) {
         unsigned char* ts;
         ts = raptor_term_to_string(statement->subject);
-          
+
         RAPTOR_DEBUG2("RSS item term %s is not in sequence of items\n", ts);
         RAPTOR_FREE(char*, ts);
       }
 #endif
-      item = NULL;
     }
   } else if(type == RAPTOR_RSS_ENCLOSURE) {
-    int size = raptor_sequence_size(rss_serializer->enclosures);
-    for(i = 0; i < size; i++) {
-      item = (raptor_rss_item*)raptor_sequence_get_at(rss_serializer->enclosures, i);
-
-      if(raptor_rss_item_equals_statement_subject(item, statement))
-        break;
-    }
-    if(i < size) {
-      RAPTOR_DEBUG2("Found enclosure at entry %d in sequence of enclosures\n", i);
+    item = raptor_rss10_get_group_item_typed(rss_serializer,
+                                             statement->subject, type);
+    if(item) {
+      RAPTOR_DEBUG1("Found enclosure in group map\n");
     } else {
 #ifdef RAPTOR_DEBUG
       if(1) {
@@ -936,8 +1049,8 @@ raptor_rss10_serialize_statement(raptor_serializer* serializer,
     /* Move any existing statements to the newly discovered item */
     raptor_rss10_move_statements(rss_serializer, type, item);
     
-    raptor_rss10_set_item_group(rss_serializer, item->term, item);
-    
+    raptor_rss10_set_item_group(rss_serializer, item->term, item, type);
+
     handled = 1;
   }
 
@@ -1021,7 +1134,8 @@ raptor_rss10_build_items(raptor_rss10_serializer_context *rss_serializer)
         /* Move any existing statements to the newly discovered item */
         raptor_rss10_move_statements(rss_serializer, RAPTOR_RSS_ITEM, item);
 
-        raptor_rss10_set_item_group(rss_serializer, item->term, item);
+        raptor_rss10_set_item_group(rss_serializer, item->term, item,
+                                    RAPTOR_RSS_ITEM);
       }
     }
   }
@@ -96,6 +96,29 @@ typedef struct {
   /* for labeling namespaces */
   int namespace_count;
 
+  /* statements stored since the last streaming flush - see
+   * RAPTOR_OPTION_SERIALIZE_FLUSH_INTERVAL
+   */
+  int statements_since_flush;
+
+  /* non-0 once a streaming flush has happened.  Reference counts
+   * then only describe the current window, so no blank node can be
+   * proved inlinable - a later window may still reference it.  Every
+   * blank node is written with its _:label instead so that blocks in
+   * different windows merge on re-parse */
+  int windowed;
+
+  /* subject node of the last statement stored; detects runs of
+   * identical subjects (subject-sorted dump input) so they skip the
+   * tree search.  Borrowed pointer into subjects/blanks, cleared
+   * whenever those trees are reset */
+  raptor_abbrev_subject* last_subject;
+
+  /* disk-backed statement store, created lazily when
+   * RAPTOR_OPTION_SERIALIZE_SPILL_SIZE is set - statements are
+   * buffered here and replayed subject-sorted at end of serialize */
+  raptor_abbrev_spill* spill;
+
   /* state for raptor_mkr_emit_subject_resultset() */
   int mkr_rs_size;
   int mkr_rs_arity;
@@ -266,10 +289,11 @@ raptor_turtle_emit_literal(raptor_serializer *serializer,
   if(node->term->type != RAPTOR_TERM_TYPE_LITERAL)
     return 1;
 
-  rc = raptor_turtle_writer_literal(turtle_writer, context->nstack,
-                                    node->term->value.literal.string,
-                                    node->term->value.literal.language,
-                                    node->term->value.literal.datatype);
+  rc = raptor_turtle_writer_counted_literal(turtle_writer, context->nstack,
+                                            node->term->value.literal.string,
+                                            node->term->value.literal.string_len,
+                                            node->term->value.literal.language,
+                                            node->term->value.literal.datatype);
 
   RAPTOR_DEBUG_ABBREV_NODE("Emitted literal node", node);
 
@@ -302,7 +326,8 @@ raptor_turtle_emit_blank(raptor_serializer *serializer,
   if(node->term->type != RAPTOR_TERM_TYPE_BLANK)
     return 1;
 
-  if((node->count_as_subject == 1 && node->count_as_object == 1)) {
+  if(!context->windowed &&
+     (node->count_as_subject == 1 && node->count_as_object == 1)) {
     /* If this is only used as a 1 subject and object or never
      * used as a subject or never used as an object, it never need
      * be referenced with an explicit name */
@@ -850,9 +875,12 @@ raptor_turtle_emit_subject(raptor_serializer *serializer,
 
   if(!raptor_abbrev_subject_valid(subject)) return 0;
 
+  if(raptor_abbrev_subject_commit_properties(subject))
+    return 1;
+
   RAPTOR_DEBUG_ABBREV_NODE("Emitting subject node", subject->node);
 
-  if(!depth &&
+  if(!depth && !context->windowed &&
      subject->node->term->type == RAPTOR_TERM_TYPE_BLANK &&
      subject->node->count_as_subject == 1 &&
      subject->node->count_as_object == 1) {
@@ -882,7 +910,8 @@ raptor_turtle_emit_subject(raptor_serializer *serializer,
     pred2 = ((raptor_abbrev_node**)raptor_avltree_iterator_get(iter))[0];
     raptor_free_avltree_iterator(iter);
 
-    if(pred1->term->type == RAPTOR_TERM_TYPE_URI &&
+    if(!context->windowed &&
+       pred1->term->type == RAPTOR_TERM_TYPE_URI &&
        pred2->term->type == RAPTOR_TERM_TYPE_URI &&
        (
         (raptor_uri_equals(pred1->term->value.uri, context->rdf_first_uri) &&
@@ -922,7 +951,18 @@ raptor_turtle_emit_subject(raptor_serializer *serializer,
     collection = 0;
 
   } else if(subject->node->term->type == RAPTOR_TERM_TYPE_BLANK) {
-    if((subject->node->count_as_subject == 1 &&
+    if(context->windowed) {
+      /* the per-window counts cannot rule out references from other
+       * windows, so neither [] nor an anonymous block is safe here */
+      if(!emit_mkr || !context->resultset) {
+        raptor_turtle_writer_bnodeid(turtle_writer,
+                                     subject->node->term->value.blank.string,
+                                     subject->node->term->value.blank.string_len);
+        if(emit_mkr)
+          raptor_turtle_writer_raw_counted(turtle_writer, (const unsigned char*)" has", 4);
+      }
+      blank = 0;
+    } else if((subject->node->count_as_subject == 1 &&
         subject->node->count_as_object == 0) && depth > 1) {
       blank = 1;
     } else if(subject->node->count_as_object == 0) {
@@ -1064,17 +1104,39 @@ raptor_turtle_emit(raptor_serializer *serializer)
   int rc;
   raptor_avltree_iterator* iter = NULL;
 
+  /* Emit and delete the subjects one at a time so that each
+   * subject's storage (mainly its properties tree) is released as
+   * soon as it has been written, rather than held until the whole
+   * tree is emitted.  Deleting rebalances the tree under the cursor,
+   * so the cursor is re-positioned at the already-peeked successor
+   * with one O(log N) seek rather than restarted from the front.
+   */
   iter = raptor_new_avltree_iterator(context->subjects, NULL, NULL, 1);
   while(iter) {
+    raptor_abbrev_subject* next_subject = NULL;
+
     subject = (raptor_abbrev_subject *)raptor_avltree_iterator_get(iter);
-    if(subject) {
-      rc = raptor_turtle_emit_subject(serializer, subject, 0);
-      if(rc) {
-        raptor_free_avltree_iterator(iter);
-        return rc;
-      }
+    if(!subject)
+      break;
+
+    /* peek at the successor before the delete below frees @subject */
+    if(!raptor_avltree_iterator_next(iter))
+      next_subject = (raptor_abbrev_subject *)raptor_avltree_iterator_get(iter);
+
+    rc = raptor_turtle_emit_subject(serializer, subject, 0);
+
+    if(context->last_subject == subject)
+      context->last_subject = NULL;
+    raptor_avltree_delete(context->subjects, subject);
+
+    if(rc) {
+      raptor_free_avltree_iterator(iter);
+      return rc;
     }
-    if(raptor_avltree_iterator_next(iter)) break;
+
+    if(!next_subject)
+      break;
+    raptor_avltree_iterator_seek(iter, next_subject);
   }
   if(iter) raptor_free_avltree_iterator(iter);
 
@@ -1210,6 +1272,13 @@ raptor_turtle_serialize_terminate(raptor_serializer* serializer)
     context->namespaces = NULL;
   }
 
+  context->last_subject = NULL;
+
+  if(context->spill) {
+    raptor_free_abbrev_spill(context->spill);
+    context->spill = NULL;
+  }
+
   if(context->subjects) {
     raptor_free_avltree(context->subjects);
     context->subjects = NULL;
@@ -1385,9 +1454,72 @@ raptor_turtle_ensure_writen_header(raptor_serializer* serializer,
 }
 
 /* serialize a statement */
+/*
+ * raptor_turtle_serialize_flush_subjects:
+ * @serializer: serializer object
+ *
+ * INTERNAL - Emit and discard all subjects stored so far.
+ *
+ * Streaming mode support: writes out everything that has accumulated
+ * in the subjects/blanks/nodes trees and resets them, bounding memory
+ * at the cost of abbreviation quality - a subject whose statements
+ * span a flush is written as several blocks, and all blank nodes are
+ * written with explicit _:labels (never inlined) since a node that
+ * looks inlinable within one window may be referenced from another.
+ *
+ * Return value: non-0 on failure
+ */
 static int
-raptor_turtle_serialize_statement(raptor_serializer* serializer,
-                                  raptor_statement *statement)
+raptor_turtle_serialize_flush_subjects(raptor_serializer* serializer)
+{
+  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
+
+  raptor_turtle_ensure_writen_header(serializer, context);
+
+  /* must be set before the emit below: blank nodes in the very first
+   * window can be referenced from later windows too */
+  context->windowed = 1;
+
+  raptor_turtle_emit(serializer);
+
+  raptor_free_avltree(context->subjects);
+  raptor_free_avltree(context->blanks);
+  raptor_free_avltree(context->nodes);
+  context->last_subject = NULL;
+
+  context->subjects =
+    raptor_new_avltree((raptor_data_compare_handler)raptor_abbrev_subject_compare,
+                       (raptor_data_free_handler)raptor_free_abbrev_subject, 0);
+
+  context->blanks =
+    raptor_new_avltree((raptor_data_compare_handler)raptor_abbrev_subject_compare,
+                       (raptor_data_free_handler)raptor_free_abbrev_subject, 0);
+
+  context->nodes =
+    raptor_new_avltree((raptor_data_compare_handler)raptor_abbrev_node_compare,
+                       (raptor_data_free_handler)raptor_free_abbrev_node, 0);
+
+  context->statements_since_flush = 0;
+
+  if(!context->subjects || !context->blanks || !context->nodes)
+    return 1;
+
+  return 0;
+}
+
+
+/*
+ * raptor_turtle_serialize_statement_store:
+ * @serializer: serializer object
+ * @statement: statement to store
+ *
+ * INTERNAL - Store a statement in the abbrev trees for later emission.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_turtle_serialize_statement_store(raptor_serializer* serializer,
+                                        raptor_statement *statement)
 {
   raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
   raptor_abbrev_subject* subject = NULL;
@@ -1404,11 +1536,21 @@ raptor_turtle_serialize_statement(raptor_serializer* serializer,
     return 1;
   }
 
-  subject = raptor_abbrev_subject_lookup(context->nodes, context->subjects,
-                                         context->blanks,
-                                         statement->subject);
-  if(!subject) {
-    return 1;
+  /* a run of statements with the same subject reuses the node found
+   * for the previous one - on subject-sorted input this replaces
+   * nearly every tree search */
+  if(context->last_subject &&
+     raptor_term_equals(context->last_subject->node->term,
+                        statement->subject))
+    subject = context->last_subject;
+  else {
+    subject = raptor_abbrev_subject_lookup(context->nodes, context->subjects,
+                                           context->blanks,
+                                           statement->subject);
+    if(!subject) {
+      return 1;
+    }
+    context->last_subject = subject;
   }
 
   object_type = statement->object->type;
@@ -1451,16 +1593,274 @@ raptor_turtle_serialize_statement(raptor_serializer* serializer,
      object_type == RAPTOR_TERM_TYPE_BLANK)
     object->count_as_object++;
 
+  if(1) {
+    int flush_interval;
+
+    flush_interval = RAPTOR_OPTIONS_GET_NUMERIC(serializer,
+                                                RAPTOR_OPTION_SERIALIZE_FLUSH_INTERVAL);
+    if(flush_interval > 0 &&
+       ++context->statements_since_flush >= flush_interval) {
+      if(raptor_turtle_serialize_flush_subjects(serializer))
+        return 1;
+    }
+  }
+
+  return 0;
+}
+
+
+static int
+raptor_turtle_serialize_statement(raptor_serializer* serializer,
+                                  raptor_statement *statement)
+{
+  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
+  int spill_size;
+
+  spill_size = RAPTOR_OPTIONS_GET_NUMERIC(serializer,
+                                          RAPTOR_OPTION_SERIALIZE_SPILL_SIZE);
+  if(spill_size > 0) {
+    /* check the term types now so bad statements fail here and not
+     * with a syntax error when the spilled lines are parsed back */
+    if(!(statement->subject->type == RAPTOR_TERM_TYPE_URI ||
+         statement->subject->type == RAPTOR_TERM_TYPE_BLANK) ||
+       statement->predicate->type != RAPTOR_TERM_TYPE_URI ||
+       statement->object->type == RAPTOR_TERM_TYPE_UNKNOWN) {
+      raptor_log_error_formatted(serializer->world, RAPTOR_LOG_LEVEL_ERROR,
+                                 NULL,
+                                 "Do not know how to serialize node type %u",
+                                 statement->subject->type);
+      return 1;
+    }
+
+    if(!context->spill) {
+      context->spill = raptor_new_abbrev_spill(serializer->world, spill_size);
+      if(!context->spill)
+        return 1;
+    }
+    return raptor_abbrev_spill_add(context->spill, statement);
+  }
+
+  return raptor_turtle_serialize_statement_store(serializer, statement);
+}
+
+
+/* blank node usage accumulated over flushed replay windows - the
+ * in-tree counts are lost when raptor_turtle_serialize_flush_subjects()
+ * resets the nodes tree, but inlining decisions for blank nodes
+ * emitted at the end need the totals over the whole graph */
+typedef struct {
+  char* label;
+  int count_as_subject;
+  int count_as_object;
+} raptor_turtle_spill_blank_count;
+
+
+/* state threaded through raptor_turtle_spill_statement_handler() */
+typedef struct {
+  raptor_serializer* serializer;
+  raptor_avltree* blank_counts; /* raptor_turtle_spill_blank_count keyed by label */
+  int rv;
+} raptor_turtle_spill_replay_state;
+
+
+static int
+raptor_turtle_spill_blank_count_compare(raptor_turtle_spill_blank_count* count1,
+                                        raptor_turtle_spill_blank_count* count2)
+{
+  return strcmp(count1->label, count2->label);
+}
+
+
+static void
+raptor_turtle_spill_free_blank_count(raptor_turtle_spill_blank_count* count)
+{
+  if(count->label)
+    RAPTOR_FREE(char*, count->label);
+  RAPTOR_FREE(raptor_turtle_spill_blank_count, count);
+}
+
+
+/* Record the blank node usage counts of the nodes tree before a flush
+ * discards them */
+static int
+raptor_turtle_spill_note_blank_counts(raptor_turtle_spill_replay_state* state,
+                                      raptor_avltree* nodes)
+{
+  raptor_avltree_iterator* iter;
+
+  iter = raptor_new_avltree_iterator(nodes, NULL, NULL, 1);
+  while(iter) {
+    raptor_abbrev_node* node;
+    raptor_turtle_spill_blank_count key;
+    raptor_turtle_spill_blank_count* count;
+
+    node = (raptor_abbrev_node*)raptor_avltree_iterator_get(iter);
+    if(!node)
+      break;
+
+    if(node->term->type == RAPTOR_TERM_TYPE_BLANK &&
+       (node->count_as_subject || node->count_as_object)) {
+      key.label = (char*)node->term->value.blank.string;
+      count = (raptor_turtle_spill_blank_count*)
+        raptor_avltree_search(state->blank_counts, &key);
+
+      if(!count) {
+        count = RAPTOR_CALLOC(raptor_turtle_spill_blank_count*, 1,
+                              sizeof(*count));
+        if(count) {
+          count->label = RAPTOR_MALLOC(char*,
+                                       node->term->value.blank.string_len + 1);
+          if(count->label)
+            memcpy(count->label, node->term->value.blank.string,
+                   node->term->value.blank.string_len + 1);
+          else {
+            RAPTOR_FREE(raptor_turtle_spill_blank_count, count);
+            count = NULL;
+          }
+        }
+        if(!count || raptor_avltree_add(state->blank_counts, count)) {
+          raptor_free_avltree_iterator(iter);
+          return 1;
+        }
+      }
+
+      count->count_as_subject += node->count_as_subject;
+      count->count_as_object += node->count_as_object;
+    }
+
+    if(raptor_avltree_iterator_next(iter))
+      break;
+  }
+  if(iter)
+    raptor_free_avltree_iterator(iter);
+
   return 0;
 }
 
 
+/* Fold the usage counts saved from flushed windows back into the
+ * blank nodes still in the tree, so the final emit sees whole-graph
+ * totals when deciding whether a blank node can be inlined */
+static void
+raptor_turtle_spill_apply_blank_counts(raptor_turtle_spill_replay_state* state,
+                                       raptor_avltree* nodes)
+{
+  raptor_avltree_iterator* iter;
+
+  iter = raptor_new_avltree_iterator(nodes, NULL, NULL, 1);
+  while(iter) {
+    raptor_abbrev_node* node;
+    raptor_turtle_spill_blank_count key;
+    raptor_turtle_spill_blank_count* count;
+
+    node = (raptor_abbrev_node*)raptor_avltree_iterator_get(iter);
+    if(!node)
+      break;
+
+    if(node->term->type == RAPTOR_TERM_TYPE_BLANK) {
+      key.label = (char*)node->term->value.blank.string;
+      count = (raptor_turtle_spill_blank_count*)
+        raptor_avltree_search(state->blank_counts, &key);
+      if(count) {
+        node->count_as_subject += count->count_as_subject;
+        node->count_as_object += count->count_as_object;
+        /* a reference from a flushed window was already written as an
+         * explicit label, so this node can no longer be inlined at its
+         * reference site - make it look multiply referenced so the
+         * final emit names its block instead of skipping it as inlined */
+        if(count->count_as_object)
+          node->count_as_object++;
+      }
+    }
+
+    if(raptor_avltree_iterator_next(iter))
+      break;
+  }
+  if(iter)
+    raptor_free_avltree_iterator(iter);
+}
+
+
+/*
+ * raptor_turtle_spill_statement_handler:
+ * @user_data: #raptor_turtle_spill_replay_state
+ * @statement: statement replayed from the spill store
+ *
+ * INTERNAL - Statement handler for spill replay at end of serialize.
+ *
+ * The replayed stream is subject-sorted, so whenever the subject
+ * changes the finished one can be emitted and discarded immediately -
+ * only one URI subject is ever held in memory.  Blank node subject
+ * lines sort after all URI subject lines; they are accumulated in the
+ * trees instead so that blank node inlining between them still works
+ * when the remaining subjects are emitted at the end.
+ */
+static void
+raptor_turtle_spill_statement_handler(void* user_data,
+                                      raptor_statement* statement)
+{
+  raptor_turtle_spill_replay_state* state;
+  raptor_serializer* serializer;
+  raptor_turtle_context* context;
+
+  state = (raptor_turtle_spill_replay_state*)user_data;
+  if(state->rv)
+    return;
+
+  serializer = state->serializer;
+  context = (raptor_turtle_context*)serializer->context;
+
+  if(context->last_subject &&
+     context->last_subject->node->term->type == RAPTOR_TERM_TYPE_URI &&
+     !raptor_term_equals(context->last_subject->node->term,
+                         statement->subject)) {
+    if(raptor_turtle_spill_note_blank_counts(state, context->nodes) ||
+       raptor_turtle_serialize_flush_subjects(serializer)) {
+      state->rv = 1;
+      return;
+    }
+  }
+
+  state->rv = raptor_turtle_serialize_statement_store(serializer, statement);
+}
+
+
 /* end a serialize */
 static int
 raptor_turtle_serialize_end(raptor_serializer* serializer)
 {
   raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
 
+  if(context->spill) {
+    raptor_abbrev_spill* spill = context->spill;
+    raptor_turtle_spill_replay_state state;
+
+    state.serializer = serializer;
+    state.rv = 0;
+    state.blank_counts =
+      raptor_new_avltree((raptor_data_compare_handler)raptor_turtle_spill_blank_count_compare,
+                         (raptor_data_free_handler)raptor_turtle_spill_free_blank_count,
+                         0);
+    if(!state.blank_counts)
+      return 1;
+
+    /* detach the spill first so the replayed statements take the
+     * normal storage path */
+    context->spill = NULL;
+    if(raptor_abbrev_spill_replay(spill,
+                                  raptor_turtle_spill_statement_handler,
+                                  &state))
+      state.rv = 1;
+    raptor_free_abbrev_spill(spill);
+
+    if(!state.rv)
+      raptor_turtle_spill_apply_blank_counts(&state, context->nodes);
+
+    raptor_free_avltree(state.blank_counts);
+    if(state.rv)
+      return 1;
+  }
+
   raptor_turtle_ensure_writen_header(serializer, context);
 
   raptor_turtle_emit(serializer);
@@ -52,6 +52,24 @@
  *
  */
 
+/* IDs of up to this many bytes are stored inline in the hash slot so
+ * probing touches no other memory */
+#define RAPTOR_ID_SET_INLINE_LEN 23
+
+/* initial number of slots in a base ID hash set; must be a power of two */
+#define RAPTOR_ID_SET_INITIAL_CAPACITY 64
+
+/* open addressing slot; hash 0 marks an empty slot */
+typedef struct {
+  unsigned long hash;
+  size_t len;
+  union {
+    char string[RAPTOR_ID_SET_INLINE_LEN + 1];
+    char* heap_string;
+  } u;
+} raptor_base_id_item;
+
+
 struct raptor_base_id_set_s
 {
   raptor_world* world;
@@ -63,12 +81,48 @@ struct raptor_base_id_set_s
   struct raptor_base_id_set_s* prev;
   struct raptor_base_id_set_s* next;
 
-  /* binary tree */
-  raptor_avltree* tree;
+  /* open-addressing hash set of IDs */
+  raptor_base_id_item* items;
+  size_t capacity;
+  size_t count;
 };
 typedef struct raptor_base_id_set_s raptor_base_id_set;
 
 
+/*
+ * raptor_id_set_hash:
+ * @id: identifier name
+ * @id_len: length of identifier
+ *
+ * INTERNAL - Hash an ID string (djb2); never returns 0, which marks
+ * an empty slot.
+ */
+static unsigned long
+raptor_id_set_hash(const unsigned char *id, size_t id_len)
+{
+  unsigned long hash = 5381;
+
+  while(id_len--)
+    hash = ((hash << 5) + hash) + *id++;
+
+  return hash ? hash : 1;
+}
+
+
+/*
+ * raptor_base_id_item_string:
+ * @item: hash slot
+ *
+ * INTERNAL - Get the ID string stored in an occupied slot.
+ */
+static const char*
+raptor_base_id_item_string(const raptor_base_id_item *item)
+{
+  return (item->len <= RAPTOR_ID_SET_INLINE_LEN) ? item->u.string
+                                                 : item->u.heap_string;
+}
+
+
 struct raptor_id_set_s
 {
   raptor_world* world;
@@ -116,14 +170,64 @@ raptor_new_id_set(raptor_world* world)
 static void
 raptor_free_base_id_set(raptor_base_id_set *base) 
 {
-  if(base->tree)
-    raptor_free_avltree(base->tree);
+  if(base->items) {
+    size_t i;
+
+    for(i = 0; i < base->capacity; i++) {
+      if(base->items[i].hash && base->items[i].len > RAPTOR_ID_SET_INLINE_LEN)
+        RAPTOR_FREE(char*, base->items[i].u.heap_string);
+    }
+    RAPTOR_FREE(raptor_base_id_item*, base->items);
+  }
   if(base->uri)
     raptor_free_uri(base->uri);
   RAPTOR_FREE(raptor_base_id_set, base);
 }
 
 
+/*
+ * raptor_base_id_set_rehash:
+ * @base: base ID set
+ * @new_capacity: new number of slots (power of two)
+ *
+ * INTERNAL - Resize the hash set, re-inserting all occupied slots.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_base_id_set_rehash(raptor_base_id_set *base, size_t new_capacity)
+{
+  raptor_base_id_item* new_items;
+  size_t mask = new_capacity - 1;
+  size_t i;
+
+  new_items = RAPTOR_CALLOC(raptor_base_id_item*, new_capacity,
+                            sizeof(*new_items));
+  if(!new_items)
+    return 1;
+
+  for(i = 0; i < base->capacity; i++) {
+    raptor_base_id_item* item = &base->items[i];
+    size_t j;
+
+    if(!item->hash)
+      continue;
+
+    j = item->hash & mask;
+    while(new_items[j].hash)
+      j = (j + 1) & mask;
+    new_items[j] = *item;
+  }
+
+  if(base->items)
+    RAPTOR_FREE(raptor_base_id_item*, base->items);
+  base->items = new_items;
+  base->capacity = new_capacity;
+
+  return 0;
+}
+
+
 /**
  * raptor_free_id_set:
  * @set: #raptor_id_set
@@ -165,7 +269,9 @@ raptor_id_set_add(raptor_id_set* set, raptor_uri *base_uri,
                   const unsigned char *id, size_t id_len)
 {
   raptor_base_id_set *base;
-  char* item;
+  unsigned long hash;
+  size_t mask;
+  size_t i;
   
   if(!base_uri || !id || !id_len)
     return -1;
@@ -187,8 +293,10 @@ raptor_id_set_add(raptor_id_set* set, raptor_uri *base_uri,
 
     base->uri = raptor_uri_copy(base_uri);
 
-    base->tree = raptor_new_avltree((raptor_data_compare_handler)strcmp,
-                                    free, 0);
+    if(raptor_base_id_set_rehash(base, RAPTOR_ID_SET_INITIAL_CAPACITY)) {
+      raptor_free_base_id_set(base);
+      return -1;
+    }
   
     /* Add to the start of the list */
     if(set->first)
@@ -211,27 +319,49 @@ raptor_id_set_add(raptor_id_set* set, raptor_uri *base_uri,
     }
   }
   
-  item = (char*)raptor_avltree_search(base->tree, id);
+  hash = raptor_id_set_hash(id, id_len);
+  mask = base->capacity - 1;
 
-  /* if already there, error */
-  if(item) {
+  i = hash & mask;
+  while(base->items[i].hash) {
+    if(base->items[i].hash == hash && base->items[i].len == id_len &&
+       !memcmp(raptor_base_id_item_string(&base->items[i]), id, id_len)) {
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
-    set->misses++;
+      set->misses++;
 #endif
-    return 1;
+      return 1;
+    }
+    i = (i + 1) & mask;
   }
   
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
   set->hits++;
 #endif
-  
-  item = RAPTOR_MALLOC(char*, id_len + 1);
-  if(!item)
-    return 1;
 
-  memcpy(item, id, id_len + 1);
+  base->items[i].hash = hash;
+  base->items[i].len = id_len;
+  if(id_len <= RAPTOR_ID_SET_INLINE_LEN) {
+    memcpy(base->items[i].u.string, id, id_len);
+    base->items[i].u.string[id_len] = '\0';
+  } else {
+    char* item = RAPTOR_MALLOC(char*, id_len + 1);
+
+    if(!item) {
+      base->items[i].hash = 0;
+      return -1;
+    }
+    memcpy(item, id, id_len);
+    item[id_len] = '\0';
+    base->items[i].u.heap_string = item;
+  }
+  base->count++;
+
+  /* keep the load factor at most 1/2 */
+  if((base->count << 1) >= base->capacity &&
+     raptor_base_id_set_rehash(base, base->capacity << 1))
+    return -1;
 
-  return raptor_avltree_add(base->tree, item);
+  return 0;
 }
 
 
@@ -43,6 +43,82 @@
 
 /* prototypes for helper functions */
 
+/* most freed statements kept for reuse */
+#define RAPTOR_STATEMENT_POOL_MAX 64
+
+
+/*
+ * raptor_world_get_pooled_statement:
+ * @world: raptor world
+ *
+ * INTERNAL - Allocate a zeroed #raptor_statement, reusing a pooled one if any.
+ *
+ * Return value: new statement or NULL on failure
+ */
+static raptor_statement*
+raptor_world_get_pooled_statement(raptor_world* world)
+{
+  raptor_statement* s = NULL;
+
+  RAPTOR_WORLD_LOCK(world);
+  if(world->statement_pool) {
+    s = (raptor_statement*)world->statement_pool;
+    world->statement_pool = *(void**)s;
+    world->statement_pool_size--;
+  }
+  RAPTOR_WORLD_UNLOCK(world);
+
+  if(s) {
+    memset(s, '\0', sizeof(*s));
+    return s;
+  }
+
+  return RAPTOR_CALLOC(raptor_statement*, 1, sizeof(*s));
+}
+
+
+/*
+ * raptor_world_return_pooled_statement:
+ * @world: raptor world
+ * @statement: statement with all content already freed
+ *
+ * INTERNAL - Return a statement allocation to the pool (or free it).
+ */
+static void
+raptor_world_return_pooled_statement(raptor_world* world,
+                                     raptor_statement* statement)
+{
+  RAPTOR_WORLD_LOCK(world);
+  if(world->statement_pool_size < RAPTOR_STATEMENT_POOL_MAX) {
+    *(void**)statement = world->statement_pool;
+    world->statement_pool = statement;
+    world->statement_pool_size++;
+    statement = NULL;
+  }
+  RAPTOR_WORLD_UNLOCK(world);
+
+  if(statement)
+    RAPTOR_FREE(raptor_statement, statement);
+}
+
+
+/*
+ * raptor_statement_finish:
+ * @world: raptor world
+ *
+ * INTERNAL - Free the pooled statement allocations
+ */
+void
+raptor_statement_finish(raptor_world* world)
+{
+  while(world->statement_pool) {
+    void* next = *(void**)world->statement_pool;
+    RAPTOR_FREE(raptor_statement, world->statement_pool);
+    world->statement_pool = next;
+  }
+  world->statement_pool_size = 0;
+}
+
 
 /**
  * raptor_new_statement:
@@ -61,7 +137,7 @@ raptor_new_statement(raptor_world *world)
 
   raptor_world_open(world);
 
-  statement = RAPTOR_CALLOC(raptor_statement*, 1, sizeof(*statement));
+  statement = raptor_world_get_pooled_statement(world);
   if(!statement)
     return NULL;
   
@@ -142,6 +218,54 @@ raptor_statement_init(raptor_statement *statement, raptor_world *world)
 }
 
 
+/**
+ * raptor_statement_init_from_views:
+ * @statement: caller-allocated statement to initialize
+ * @world: raptor world
+ * @subject: statement subject term
+ * @predicate: statement predicate term
+ * @object: statement object term
+ * @graph: statement graph term (or NULL)
+ *
+ * Initialize a static #raptor_statement from caller-owned terms.
+ *
+ * Together with raptor_term_init_from_uri(),
+ * raptor_term_init_from_counted_blank() and
+ * raptor_term_init_from_counted_literal() this builds a statement for
+ * raptor_serializer_serialize_statement() with no raptor-side
+ * allocation: the terms are typically static views of caller data and
+ * need only stay valid for the duration of that call.  Serializers
+ * that retain terms beyond the call take deep copies via
+ * raptor_term_copy().
+ *
+ * Neither the statement nor the terms are usage counted;
+ * raptor_free_statement() on the statement is a no-op apart from
+ * clearing the term pointers.
+ *
+ * Return value: non-0 on failure
+ */
+int
+raptor_statement_init_from_views(raptor_statement *statement,
+                                 raptor_world *world,
+                                 raptor_term *subject,
+                                 raptor_term *predicate,
+                                 raptor_term *object,
+                                 raptor_term *graph)
+{
+  if(!statement || !world || !subject || !predicate || !object)
+    return 1;
+
+  raptor_statement_init(statement, world);
+
+  statement->subject = subject;
+  statement->predicate = predicate;
+  statement->object = object;
+  statement->graph = graph;
+
+  return 0;
+}
+
+
 /**
  * raptor_statement_copy:
  * @statement: statement to copy
@@ -236,7 +360,7 @@ raptor_free_statement(raptor_statement *statement)
   raptor_statement_clear(statement);
   
   if(is_dynamic)
-    RAPTOR_FREE(raptor_statement, statement);
+    raptor_world_return_pooled_statement(statement->world, statement);
 }
 
 
@@ -422,3 +546,43 @@ raptor_statement_equals(const raptor_statement* s1, const raptor_statement* s2)
 
   return 1;
 }
+
+
+/**
+ * raptor_statement_hash:
+ * @statement: statement
+ *
+ * Get a hash of a statement's content.
+ *
+ * Combines raptor_term_hash() of the subject, predicate, object and,
+ * when present, graph terms; the per-term hashes are cached in the
+ * terms so hashing a statement whose terms have been hashed before
+ * does no string scanning.  Equal statements always have equal
+ * hashes; distinct statements usually, but not always, have distinct
+ * hashes.
+ *
+ * Return value: non-0 hash value, or 0 if @statement is NULL
+ **/
+unsigned long
+raptor_statement_hash(const raptor_statement* statement)
+{
+  unsigned long hash;
+
+  if(!statement)
+    return 0;
+
+  hash = raptor_term_hash(statement->subject);
+  hash = ((hash << 5) + hash) ^ raptor_term_hash(statement->predicate);
+  hash = ((hash << 5) + hash) ^ raptor_term_hash(statement->object);
+  if(statement->graph)
+    hash = ((hash << 5) + hash) ^ raptor_term_hash(statement->graph);
+
+  /* re-mix the combination: the shift-and-xor combiner preserves
+   * enough structure for related statements to collide */
+  hash = raptor_hash_finalize(hash);
+
+  if(!hash)
+    hash = 1;
+
+  return hash;
+}
@@ -44,31 +44,30 @@
 
 #ifndef STANDALONE
 
-struct raptor_stringbuffer_node_s
-{
-  struct raptor_stringbuffer_node_s* next;
-  unsigned char *string;
-  size_t length;
-};
-typedef struct raptor_stringbuffer_node_s raptor_stringbuffer_node;
-
+/* bytes of content (plus '\0') stored inside the stringbuffer itself
+ * before any heap buffer is needed - covers most qnames and short
+ * literals */
+#define RAPTOR_STRINGBUFFER_INLINE_SIZE 64
 
 struct raptor_stringbuffer_s
 {
-  /* Pointing to the first item in the list of nodes */
-  raptor_stringbuffer_node* head;
-  /* and the last */
-  raptor_stringbuffer_node* tail;
-  
+  /* the string content; points at @inline_buffer until it outgrows it.
+   * Always '\0' terminated at @length */
+  unsigned char *buffer;
+
   /* total length of the string */
   size_t length;
 
-  /* frozen string if already calculated, or NULL if not present */
-  unsigned char *string;
+  /* bytes allocated at @buffer including the '\0' terminator */
+  size_t capacity;
+
+  /* small-string storage used while the content fits */
+  unsigned char inline_buffer[RAPTOR_STRINGBUFFER_INLINE_SIZE];
 };
 
 
 /* prototypes for local functions */
+static int raptor_stringbuffer_ensure_capacity(raptor_stringbuffer* stringbuffer, size_t additional);
 static int raptor_stringbuffer_append_string_common(raptor_stringbuffer* stringbuffer, const unsigned char *string, size_t length, int do_copy);
 
 
@@ -87,6 +86,11 @@ raptor_new_stringbuffer(void)
   raptor_stringbuffer* sb;
   
   sb = RAPTOR_CALLOC(raptor_stringbuffer*, 1, sizeof(*sb));
+  if(!sb)
+    return NULL;
+
+  sb->buffer = sb->inline_buffer;
+  sb->capacity = RAPTOR_STRINGBUFFER_INLINE_SIZE;
   return sb;
 }
 
@@ -104,26 +108,74 @@ raptor_free_stringbuffer(raptor_stringbuffer *stringbuffer)
   if(!stringbuffer)
     return;
 
-  if(stringbuffer->head) {
-    raptor_stringbuffer_node *node = stringbuffer->head;
-  
-    while(node) {
-      raptor_stringbuffer_node *next = node->next;
-      
-      if(node->string)
-        RAPTOR_FREE(char*, node->string);
-      RAPTOR_FREE(raptor_stringbuffer_node, node);
-      node = next;
-    }
-  }
-
-  if(stringbuffer->string)
-    RAPTOR_FREE(char*, stringbuffer->string);
+  if(stringbuffer->buffer != stringbuffer->inline_buffer)
+    RAPTOR_FREE(char*, stringbuffer->buffer);
 
   RAPTOR_FREE(raptor_stringbuffer, stringbuffer);
 }
 
 
+/*
+ * raptor_stringbuffer_reset:
+ * @stringbuffer: raptor stringbuffer
+ *
+ * INTERNAL - Empty a stringbuffer, keeping any allocated capacity so
+ * the buffer can be refilled without growing again.
+ */
+void
+raptor_stringbuffer_reset(raptor_stringbuffer* stringbuffer)
+{
+  stringbuffer->length = 0;
+  stringbuffer->buffer[0] = '\0';
+}
+
+
+
+/*
+ * raptor_stringbuffer_ensure_capacity:
+ * @stringbuffer: raptor stringbuffer
+ * @additional: number of content bytes about to be added
+ *
+ * INTERNAL - Reserve room for @additional more bytes plus a '\0'.
+ *
+ * Grows the heap buffer exponentially so a sequence of appends costs
+ * amortised O(1) per byte; the first growth copies the content out of
+ * the inline storage.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_stringbuffer_ensure_capacity(raptor_stringbuffer* stringbuffer,
+                                    size_t additional)
+{
+  size_t needed = stringbuffer->length + additional + 1;
+  size_t new_capacity;
+  unsigned char *new_buffer;
+
+  if(needed <= stringbuffer->capacity)
+    return 0;
+
+  new_capacity = stringbuffer->capacity;
+  while(new_capacity < needed)
+    new_capacity <<= 1;
+
+  if(stringbuffer->buffer == stringbuffer->inline_buffer) {
+    new_buffer = RAPTOR_MALLOC(unsigned char*, new_capacity);
+    if(!new_buffer)
+      return 1;
+    memcpy(new_buffer, stringbuffer->buffer, stringbuffer->length);
+  } else {
+    new_buffer = RAPTOR_REALLOC(unsigned char*, stringbuffer->buffer,
+                                new_capacity);
+    if(!new_buffer)
+      return 1;
+  }
+
+  stringbuffer->buffer = new_buffer;
+  stringbuffer->capacity = new_capacity;
+  return 0;
+}
+
 
 /**
  * raptor_stringbuffer_append_string_common:
@@ -150,43 +202,22 @@ raptor_stringbuffer_append_string_common(raptor_stringbuffer* stringbuffer,
                                          size_t length,
                                          int do_copy)
 {
-  raptor_stringbuffer_node *node;
-
   if(!string || !length)
     return 0;
   
-  node = RAPTOR_MALLOC(raptor_stringbuffer_node*, sizeof(*node));
-  if(!node) {
+  if(raptor_stringbuffer_ensure_capacity(stringbuffer, length)) {
     if(!do_copy)
       RAPTOR_FREE(char*, string);
     return 1;
   }
 
-  if(do_copy) {
-    /* Note this copy does not include the \0 character - not needed  */
-    node->string = RAPTOR_MALLOC(unsigned char*, length);
-    if(!node->string) {
-      RAPTOR_FREE(raptor_stringbuffer_node, node);
-      return 1;
-    }
-    memcpy(node->string, string, length);
-  } else
-    node->string = (unsigned char*)string;
-  node->length = length;
-
-
-  if(stringbuffer->tail) {
-    stringbuffer->tail->next = node;
-    stringbuffer->tail = node;
-  } else
-    stringbuffer->head = stringbuffer->tail = node;
-  node->next = NULL;
-
-  if(stringbuffer->string) {
-    RAPTOR_FREE(char*, stringbuffer->string);
-    stringbuffer->string = NULL;
-  }
+  memcpy(stringbuffer->buffer + stringbuffer->length, string, length);
   stringbuffer->length += length;
+  stringbuffer->buffer[stringbuffer->length] = '\0';
+
+  /* the buffer is contiguous so an owned string is consumed here */
+  if(!do_copy)
+    RAPTOR_FREE(char*, string);
 
   return 0;
 }
@@ -308,33 +339,17 @@ int
 raptor_stringbuffer_append_stringbuffer(raptor_stringbuffer* stringbuffer, 
                                         raptor_stringbuffer* append)
 {
-  raptor_stringbuffer_node *node = append->head;
-
-  if(!node)
+  if(!append->length)
     return 0;
 
-  /* move all append nodes to stringbuffer */
-  if(stringbuffer->tail) {
-    stringbuffer->tail->next = node;
-  } else
-    stringbuffer->head = node;
-
-  stringbuffer->tail = append->tail;
-
-  /* adjust our length */
-  stringbuffer->length += append->length;
-  if(stringbuffer->string) {
-    RAPTOR_FREE(char*, stringbuffer->string);
-    stringbuffer->string = NULL;
-  }
+  if(raptor_stringbuffer_append_counted_string(stringbuffer,
+                                               append->buffer, append->length,
+                                               1))
+    return 1;
 
   /* zap append content */
-  append->head = append->tail = NULL;
   append->length = 0;
-  if(append->string) {
-    RAPTOR_FREE(char*, append->string);
-    append->string = NULL;
-  }
+  append->buffer[0] = '\0';
   
   return 0;
 }
@@ -364,36 +379,20 @@ raptor_stringbuffer_prepend_string_common(raptor_stringbuffer* stringbuffer,
                                           const unsigned char *string, size_t length,
                                           int do_copy)
 {
-  raptor_stringbuffer_node *node;
-
-  node = RAPTOR_MALLOC(raptor_stringbuffer_node*, sizeof(*node));
-  if(!node)
+  if(raptor_stringbuffer_ensure_capacity(stringbuffer, length)) {
+    if(!do_copy)
+      RAPTOR_FREE(char*, string);
     return 1;
-
-  if(do_copy) {
-    /* Note this copy does not include the \0 character - not needed  */
-    node->string = RAPTOR_MALLOC(unsigned char*, length);
-    if(!node->string) {
-      RAPTOR_FREE(raptor_stringbuffer_node, node);
-      return 1;
-    }
-    memcpy(node->string, string, length);
-  } else
-    node->string = (unsigned char*)string;
-  node->length = length;
-
-
-  node->next = stringbuffer->head;
-  if(stringbuffer->head)
-    stringbuffer->head = node;
-  else
-    stringbuffer->head = stringbuffer->tail = node;
-
-  if(stringbuffer->string) {
-    RAPTOR_FREE(char*, stringbuffer->string);
-    stringbuffer->string = NULL;
   }
+
+  memmove(stringbuffer->buffer + length, stringbuffer->buffer,
+          stringbuffer->length);
+  memcpy(stringbuffer->buffer, string, length);
   stringbuffer->length += length;
+  stringbuffer->buffer[stringbuffer->length] = '\0';
+
+  if(!do_copy)
+    RAPTOR_FREE(char*, string);
 
   return 0;
 }
@@ -478,27 +477,10 @@ raptor_stringbuffer_length(raptor_stringbuffer* stringbuffer)
 unsigned char *
 raptor_stringbuffer_as_string(raptor_stringbuffer* stringbuffer)
 {
-  raptor_stringbuffer_node *node;
-  unsigned char *p;
-  
   if(!stringbuffer->length)
     return NULL;
-  if(stringbuffer->string)
-    return stringbuffer->string;
-
-  stringbuffer->string = RAPTOR_MALLOC(unsigned char*, stringbuffer->length + 1);
-  if(!stringbuffer->string)
-    return NULL;
 
-  node = stringbuffer->head;
-  p = stringbuffer->string;
-  while(node) {
-    memcpy(p, node->string, node->length);
-    p+= node->length;
-    node = node->next;
-  }
-  *p='\0';
-  return stringbuffer->string;
+  return stringbuffer->buffer;
 }
 
 
@@ -519,26 +501,17 @@ int
 raptor_stringbuffer_copy_to_string(raptor_stringbuffer* stringbuffer,
                                    unsigned char *string, size_t length)
 {
-  raptor_stringbuffer_node *node;
-  unsigned char *p;
-  
   if(!string || length < 1)
     return 1;
 
   if(!stringbuffer->length)
     return 0;
 
-  p = string;
-  for(node = stringbuffer->head; node; node = node->next) {
-    if(node->length > length) {
-      p[-1]='\0';
-      return 1;
-    }
-    memcpy(p, node->string, node->length);
-    p+= node->length;
-    length-= node->length;
-  }
-  *p='\0';
+  if(stringbuffer->length >= length)
+    return 1;
+
+  memcpy(string, stringbuffer->buffer, stringbuffer->length);
+  string[stringbuffer->length] = '\0';
   return 0;
 }
 
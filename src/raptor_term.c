@@ -39,6 +39,460 @@
 
 #ifndef STANDALONE
 
+/*
+ * Interned term pool - open addressing (linear probing) hash table.
+ *
+ * Optional (see RAPTOR_WORLD_FLAG_TERM_INTERNING): when enabled, URI
+ * and literal terms with identical content are shared, so constructing
+ * a repeated term is a usage bump and raptor_term_equals() hits its
+ * pointer-compare fast path.  Like the interned-URI store, the table
+ * does not own references to the terms it indexes; a term leaves the
+ * table when its usage count reaches zero.  Blank node terms are not
+ * interned as their identifiers are frequently rewritten.
+ */
+struct raptor_term_intern_table_s {
+  /* array of @capacity slots; NULL = empty */
+  raptor_term **slots;
+  /* size of slots array - always a power of two */
+  size_t capacity;
+  /* number of live entries */
+  size_t size;
+  /* number of tombstone entries left by deletes */
+  size_t deleted;
+};
+typedef struct raptor_term_intern_table_s raptor_term_intern_table;
+
+/* marker for a deleted slot; never dereferenced */
+static raptor_term raptor_term_intern_tombstone_object;
+#define RAPTOR_TERM_INTERN_TOMBSTONE (&raptor_term_intern_tombstone_object)
+
+/* initial number of slots; must be a power of two */
+#define RAPTOR_TERM_INTERN_INITIAL_CAPACITY 64
+
+/* most freed terms kept for reuse */
+#define RAPTOR_TERM_POOL_MAX 1024
+
+/* true if string @s lives in term @t's inline small-string storage
+ * and so must not be freed separately */
+#define RAPTOR_TERM_STRING_IS_INLINE(t, s) \
+  ((s) >= (t)->inline_storage && \
+   (s) < (t)->inline_storage + RAPTOR_TERM_INLINE_STORAGE_SIZE)
+
+
+/*
+ * raptor_world_get_pooled_term:
+ * @world: raptor world
+ *
+ * INTERNAL - Allocate a zeroed #raptor_term, reusing a pooled one if any.
+ *
+ * Terms are constructed and destroyed once per parsed or serialized
+ * node, so recycling the fixed-size struct removes a malloc/free pair
+ * per term on the hot path.
+ *
+ * Return value: new term or NULL on failure
+ */
+static raptor_term*
+raptor_world_get_pooled_term(raptor_world* world)
+{
+  raptor_term* t = NULL;
+
+  RAPTOR_WORLD_LOCK(world);
+  if(world->term_pool) {
+    t = (raptor_term*)world->term_pool;
+    world->term_pool = *(void**)t;
+    world->term_pool_size--;
+  }
+  RAPTOR_WORLD_UNLOCK(world);
+
+  if(t) {
+    memset(t, '\0', sizeof(*t));
+    return t;
+  }
+
+  return RAPTOR_CALLOC(raptor_term*, 1, sizeof(*t));
+}
+
+
+/*
+ * raptor_world_return_pooled_term:
+ * @world: raptor world
+ * @term: term with all content already freed
+ *
+ * INTERNAL - Return a term allocation to the pool (or free it).
+ */
+static void
+raptor_world_return_pooled_term(raptor_world* world, raptor_term* term)
+{
+  RAPTOR_WORLD_LOCK(world);
+  if(world->term_pool_size < RAPTOR_TERM_POOL_MAX) {
+    *(void**)term = world->term_pool;
+    world->term_pool = term;
+    world->term_pool_size++;
+    term = NULL;
+  }
+  RAPTOR_WORLD_UNLOCK(world);
+
+  if(term)
+    RAPTOR_FREE(term, term);
+}
+
+
+/*
+ * raptor_term_intern_hash:
+ * @type: term type
+ * @uri: term URI for URI terms (or NULL)
+ * @literal: literal string for literal terms (or NULL)
+ * @literal_len: length of @literal
+ * @datatype: literal datatype URI (or NULL)
+ * @language: literal language (or NULL)
+ *
+ * INTERNAL - Hash the identifying content of a (prospective) term (djb2)
+ *
+ * Return value: hash value
+ */
+static unsigned int
+raptor_term_intern_hash(raptor_term_type type,
+                        raptor_uri* uri,
+                        const unsigned char* literal, size_t literal_len,
+                        raptor_uri* datatype,
+                        const unsigned char* language)
+{
+  unsigned int hash = 5381 + (unsigned int)type;
+  const unsigned char *s;
+  size_t len;
+
+  if(type == RAPTOR_TERM_TYPE_URI) {
+    s = raptor_uri_as_counted_string(uri, &len);
+  } else {
+    s = literal;
+    len = literal_len;
+  }
+
+  while(len--)
+    hash = ((hash << 5) + hash) + *s++;
+
+  if(type == RAPTOR_TERM_TYPE_LITERAL) {
+    if(language) {
+      for(s = language; *s; s++)
+        hash = ((hash << 5) + hash) + *s;
+    }
+    if(datatype) {
+      s = raptor_uri_as_counted_string(datatype, &len);
+      while(len--)
+        hash = ((hash << 5) + hash) + *s++;
+    }
+  }
+
+  return hash;
+}
+
+
+/*
+ * raptor_term_intern_matches:
+ * @term: existing interned term
+ * @type: candidate term type
+ * @uri: candidate URI for URI terms (or NULL)
+ * @literal: candidate literal string (or NULL)
+ * @literal_len: length of @literal
+ * @datatype: candidate literal datatype URI (or NULL)
+ * @language: candidate literal language (or NULL)
+ *
+ * INTERNAL - Check an interned term against candidate term content
+ *
+ * Return value: non-0 if the term has exactly the candidate content
+ */
+static int
+raptor_term_intern_matches(raptor_term* term,
+                           raptor_term_type type,
+                           raptor_uri* uri,
+                           const unsigned char* literal, size_t literal_len,
+                           raptor_uri* datatype,
+                           const unsigned char* language)
+{
+  if(term->type != type)
+    return 0;
+
+  if(type == RAPTOR_TERM_TYPE_URI)
+    return raptor_uri_equals(term->value.uri, uri);
+
+  if(term->value.literal.string_len != (unsigned int)literal_len ||
+     memcmp(term->value.literal.string, literal, literal_len))
+    return 0;
+
+  if(term->value.literal.language) {
+    if(!language ||
+       strcmp((const char*)term->value.literal.language,
+              (const char*)language))
+      return 0;
+  } else if(language)
+    return 0;
+
+  if(term->value.literal.datatype) {
+    if(!datatype ||
+       !raptor_uri_equals(term->value.literal.datatype, datatype))
+      return 0;
+  } else if(datatype)
+    return 0;
+
+  return 1;
+}
+
+
+/*
+ * raptor_term_hash_for_intern:
+ * @term: term
+ *
+ * INTERNAL - Hash an existing term with raptor_term_intern_hash()
+ *
+ * Return value: hash value
+ */
+static unsigned int
+raptor_term_hash_for_intern(raptor_term* term)
+{
+  if(term->type == RAPTOR_TERM_TYPE_URI)
+    return raptor_term_intern_hash(term->type, term->value.uri,
+                                   NULL, 0, NULL, NULL);
+
+  return raptor_term_intern_hash(term->type, NULL,
+                                 term->value.literal.string,
+                                 term->value.literal.string_len,
+                                 term->value.literal.datatype,
+                                 term->value.literal.language);
+}
+
+
+/*
+ * raptor_new_term_intern_table:
+ * @capacity: initial capacity (power of two)
+ *
+ * INTERNAL - Constructor - create an interned-term hash table
+ *
+ * Return value: new table or NULL on failure
+ */
+static raptor_term_intern_table*
+raptor_new_term_intern_table(size_t capacity)
+{
+  raptor_term_intern_table* table;
+
+  table = RAPTOR_CALLOC(raptor_term_intern_table*, 1, sizeof(*table));
+  if(!table)
+    return NULL;
+
+  table->slots = RAPTOR_CALLOC(raptor_term**, capacity, sizeof(raptor_term*));
+  if(!table->slots) {
+    RAPTOR_FREE(raptor_term_intern_table, table);
+    return NULL;
+  }
+  table->capacity = capacity;
+
+  return table;
+}
+
+
+/*
+ * raptor_free_term_intern_table:
+ * @table: interned-term hash table
+ *
+ * INTERNAL - Destructor - destroy an interned-term hash table
+ *
+ * Does not free the terms; the table does not own references to them.
+ */
+static void
+raptor_free_term_intern_table(raptor_term_intern_table* table)
+{
+  if(!table)
+    return;
+
+  if(table->slots)
+    RAPTOR_FREE(raptor_term**, table->slots);
+  RAPTOR_FREE(raptor_term_intern_table, table);
+}
+
+
+static int raptor_term_intern_table_add(raptor_term_intern_table* table,
+                                        raptor_term* term,
+                                        unsigned int hash);
+
+/*
+ * raptor_term_intern_table_rehash:
+ * @table: interned-term hash table
+ * @new_capacity: new capacity (power of two)
+ *
+ * INTERNAL - Resize the slots array, dropping tombstones
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_term_intern_table_rehash(raptor_term_intern_table* table,
+                                size_t new_capacity)
+{
+  raptor_term **old_slots = table->slots;
+  size_t old_capacity = table->capacity;
+  size_t i;
+
+  table->slots = RAPTOR_CALLOC(raptor_term**, new_capacity,
+                               sizeof(raptor_term*));
+  if(!table->slots) {
+    table->slots = old_slots;
+    return 1;
+  }
+  table->capacity = new_capacity;
+  table->size = 0;
+  table->deleted = 0;
+
+  for(i = 0; i < old_capacity; i++) {
+    raptor_term* term = old_slots[i];
+    if(term && term != RAPTOR_TERM_INTERN_TOMBSTONE)
+      raptor_term_intern_table_add(table, term,
+                                   raptor_term_hash_for_intern(term));
+  }
+
+  RAPTOR_FREE(raptor_term**, old_slots);
+  return 0;
+}
+
+
+/*
+ * raptor_term_intern_table_add:
+ * @table: interned-term hash table
+ * @term: term to add
+ * @hash: hash of @term from raptor_term_hash_for_intern()
+ *
+ * INTERNAL - Add a term to the table, growing it as needed
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_term_intern_table_add(raptor_term_intern_table* table,
+                             raptor_term* term, unsigned int hash)
+{
+  size_t mask;
+  size_t i;
+
+  /* grow at 2/3 load counting tombstones, so probes stay short */
+  if(3 * (table->size + table->deleted + 1) > 2 * table->capacity) {
+    size_t new_capacity = table->capacity;
+    /* only grow if live entries need it; otherwise just drop tombstones */
+    if(3 * (table->size + 1) > table->capacity)
+      new_capacity <<= 1;
+    if(raptor_term_intern_table_rehash(table, new_capacity))
+      return 1;
+  }
+
+  mask = table->capacity - 1;
+  for(i = hash & mask; ; i = (i + 1) & mask) {
+    if(!table->slots[i] || table->slots[i] == RAPTOR_TERM_INTERN_TOMBSTONE) {
+      if(table->slots[i] == RAPTOR_TERM_INTERN_TOMBSTONE)
+        table->deleted--;
+      table->slots[i] = term;
+      table->size++;
+      return 0;
+    }
+  }
+}
+
+
+/*
+ * raptor_term_intern_table_find:
+ * @table: interned-term hash table
+ * @hash: hash of candidate content from raptor_term_intern_hash()
+ * @type: candidate term type
+ * @uri: candidate URI for URI terms (or NULL)
+ * @literal: candidate literal string (or NULL)
+ * @literal_len: length of @literal
+ * @datatype: candidate literal datatype URI (or NULL)
+ * @language: candidate literal language (or NULL)
+ *
+ * INTERNAL - Look up an interned term by content
+ *
+ * Return value: shared #raptor_term or NULL if not present
+ */
+static raptor_term*
+raptor_term_intern_table_find(raptor_term_intern_table* table,
+                              unsigned int hash,
+                              raptor_term_type type,
+                              raptor_uri* uri,
+                              const unsigned char* literal,
+                              size_t literal_len,
+                              raptor_uri* datatype,
+                              const unsigned char* language)
+{
+  size_t mask = table->capacity - 1;
+  size_t i;
+
+  for(i = hash & mask; table->slots[i]; i = (i + 1) & mask) {
+    raptor_term* term = table->slots[i];
+
+    if(term == RAPTOR_TERM_INTERN_TOMBSTONE)
+      continue;
+
+    if(raptor_term_intern_matches(term, type, uri, literal, literal_len,
+                                  datatype, language))
+      return term;
+  }
+
+  return NULL;
+}
+
+
+/*
+ * raptor_term_intern_table_delete:
+ * @table: interned-term hash table
+ * @term: term to remove
+ *
+ * INTERNAL - Remove a term from the table, leaving a tombstone
+ */
+static void
+raptor_term_intern_table_delete(raptor_term_intern_table* table,
+                                raptor_term* term)
+{
+  size_t mask = table->capacity - 1;
+  size_t i;
+
+  for(i = raptor_term_hash_for_intern(term) & mask; table->slots[i];
+      i = (i + 1) & mask) {
+    if(table->slots[i] == term) {
+      table->slots[i] = RAPTOR_TERM_INTERN_TOMBSTONE;
+      table->size--;
+      table->deleted++;
+      return;
+    }
+  }
+}
+
+
+int
+raptor_term_init(raptor_world* world)
+{
+  if(world->term_interning && !world->terms_table) {
+    world->terms_table = raptor_new_term_intern_table(RAPTOR_TERM_INTERN_INITIAL_CAPACITY);
+    if(!world->terms_table) {
+      raptor_log_error(world, RAPTOR_LOG_LEVEL_ERROR, NULL,
+                       "Failed to create raptor term hash table");
+    }
+  }
+
+  return 0;
+}
+
+
+void
+raptor_term_finish(raptor_world* world)
+{
+  if(world->terms_table) {
+    raptor_free_term_intern_table(world->terms_table);
+    world->terms_table = NULL;
+  }
+
+  while(world->term_pool) {
+    void* next = *(void**)world->term_pool;
+    RAPTOR_FREE(raptor_term, world->term_pool);
+    world->term_pool = next;
+  }
+  world->term_pool_size = 0;
+}
+
+
 /**
  * raptor_new_term_from_uri:
  * @world: raptor world
@@ -62,7 +516,39 @@ raptor_new_term_from_uri(raptor_world* world, raptor_uri* uri)
   
   raptor_world_open(world);
 
-  t = RAPTOR_CALLOC(raptor_term*, 1, sizeof(*t));
+  if(world->terms_table) {
+    unsigned int hash;
+
+    RAPTOR_WORLD_LOCK(world);
+
+    hash = raptor_term_intern_hash(RAPTOR_TERM_TYPE_URI, uri,
+                                   NULL, 0, NULL, NULL);
+    t = raptor_term_intern_table_find(world->terms_table, hash,
+                                      RAPTOR_TERM_TYPE_URI, uri,
+                                      NULL, 0, NULL, NULL);
+    if(t) {
+      t->usage++;
+      RAPTOR_WORLD_UNLOCK(world);
+      return t;
+    }
+
+    t = raptor_world_get_pooled_term(world);
+    if(!t) {
+      RAPTOR_WORLD_UNLOCK(world);
+      return NULL;
+    }
+
+    t->usage = 1;
+    t->world = world;
+    t->type = RAPTOR_TERM_TYPE_URI;
+    t->value.uri = raptor_uri_copy(uri);
+
+    raptor_term_intern_table_add(world->terms_table, t, hash);
+    RAPTOR_WORLD_UNLOCK(world);
+    return t;
+  }
+
+  t = raptor_world_get_pooled_term(world);
   if(!t)
     return NULL;
 
@@ -140,6 +626,67 @@ raptor_new_term_from_uri_string(raptor_world* world,
 }
 
 
+/*
+ * raptor_term_set_literal_strings:
+ * @t: cleared literal term with no string content yet
+ * @literal: literal string (not necessarily NUL terminated)
+ * @literal_len: length of @literal
+ * @language: normalized NUL terminated language string (or NULL)
+ * @language_len: length of @language
+ *
+ * INTERNAL - Store a literal string and language into a term
+ *
+ * Short values go into the term's inline storage so a typical literal
+ * term is a single allocation on one cache line; longer values fall
+ * back to separate heap copies.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_term_set_literal_strings(raptor_term* t,
+                                const unsigned char* literal,
+                                size_t literal_len,
+                                const unsigned char* language,
+                                size_t language_len)
+{
+  size_t used = 0;
+  unsigned char* dst;
+
+  if(literal_len + 1 <= RAPTOR_TERM_INLINE_STORAGE_SIZE) {
+    dst = t->inline_storage;
+    used = literal_len + 1;
+  } else {
+    dst = RAPTOR_MALLOC(unsigned char*, literal_len + 1);
+    if(!dst)
+      return 1;
+  }
+  if(literal_len)
+    memcpy(dst, literal, literal_len);
+  dst[literal_len] = '\0';
+  t->value.literal.string = dst;
+  t->value.literal.string_len = RAPTOR_LANG_LEN_FROM_INT(literal_len);
+
+  if(language) {
+    if(used + language_len + 1 <= RAPTOR_TERM_INLINE_STORAGE_SIZE)
+      dst = t->inline_storage + used;
+    else {
+      dst = RAPTOR_MALLOC(unsigned char*, language_len + 1);
+      if(!dst) {
+        if(!RAPTOR_TERM_STRING_IS_INLINE(t, t->value.literal.string))
+          RAPTOR_FREE(char*, t->value.literal.string);
+        t->value.literal.string = NULL;
+        return 1;
+      }
+    }
+    memcpy(dst, language, language_len + 1);
+    t->value.literal.language = dst;
+    t->value.literal.language_len = (unsigned char)language_len;
+  }
+
+  return 0;
+}
+
+
 /**
  * raptor_new_term_from_counted_literal:
  * @world: raptor world
@@ -171,7 +718,7 @@ raptor_new_term_from_counted_literal(raptor_world* world,
                                      unsigned char language_len)
 {
   raptor_term *t;
-  unsigned char* new_literal = NULL;
+  unsigned char language_buffer[RAPTOR_TERM_INLINE_STORAGE_SIZE];
   unsigned char* new_language = NULL;
 
   RAPTOR_CHECK_CONSTRUCTOR_WORLD(world);
@@ -183,29 +730,22 @@ raptor_new_term_from_counted_literal(raptor_world* world,
 
   if(language && datatype)
     return NULL;
-  
-
-  new_literal = RAPTOR_MALLOC(unsigned char*, literal_len + 1);
-  if(!new_literal)
-    return NULL;
 
   if(!literal || !*literal)
     literal_len = 0;
-
-  if(literal_len) {
-    memcpy(new_literal, literal, literal_len);
-    new_literal[literal_len] = '\0';
-  } else
-    *new_literal = '\0';
+  if(!literal)
+    literal = (const unsigned char*)"";
 
   if(language) {
     unsigned char c;
     unsigned char* l;
-    
-    new_language = RAPTOR_MALLOC(unsigned char*, language_len + 1);
-    if(!new_language) {
-      RAPTOR_FREE(char*, new_literal);
-      return NULL;
+
+    if(language_len + 1 <= sizeof(language_buffer))
+      new_language = language_buffer;
+    else {
+      new_language = RAPTOR_MALLOC(unsigned char*, language_len + 1);
+      if(!new_language)
+        return NULL;
     }
 
     l = new_language;
@@ -218,28 +758,72 @@ raptor_new_term_from_counted_literal(raptor_world* world,
   } else
     language_len = 0;
 
-  if(datatype)
-    datatype = raptor_uri_copy(datatype);
-  
 
-  t = RAPTOR_CALLOC(raptor_term*, 1, sizeof(*t));
-  if(!t) {
-    if(new_literal)
-      RAPTOR_FREE(char*, new_literal);
-    if(new_language)
-      RAPTOR_FREE(char*, new_language);
-    if(datatype)
-      raptor_free_uri(datatype);
-    return NULL;
+  if(world->terms_table) {
+    unsigned int hash;
+
+    RAPTOR_WORLD_LOCK(world);
+
+    hash = raptor_term_intern_hash(RAPTOR_TERM_TYPE_LITERAL, NULL,
+                                   literal, literal_len,
+                                   datatype, new_language);
+    t = raptor_term_intern_table_find(world->terms_table, hash,
+                                      RAPTOR_TERM_TYPE_LITERAL, NULL,
+                                      literal, literal_len,
+                                      datatype, new_language);
+    if(t) {
+      t->usage++;
+      RAPTOR_WORLD_UNLOCK(world);
+
+      if(new_language && new_language != language_buffer)
+        RAPTOR_FREE(char*, new_language);
+
+      return t;
+    }
+
+    t = raptor_world_get_pooled_term(world);
+    if(t && raptor_term_set_literal_strings(t, literal, literal_len,
+                                            new_language, language_len)) {
+      raptor_world_return_pooled_term(world, t);
+      t = NULL;
+    }
+    if(t) {
+      t->usage = 1;
+      t->world = world;
+      t->type = RAPTOR_TERM_TYPE_LITERAL;
+      if(datatype)
+        t->value.literal.datatype = raptor_uri_copy(datatype);
+
+      raptor_term_intern_table_add(world->terms_table, t, hash);
+      RAPTOR_WORLD_UNLOCK(world);
+
+      if(new_language && new_language != language_buffer)
+        RAPTOR_FREE(char*, new_language);
+
+      return t;
+    }
+    RAPTOR_WORLD_UNLOCK(world);
+    /* fall through to shared cleanup below */
   }
+
+  t = raptor_world_get_pooled_term(world);
+  if(t && raptor_term_set_literal_strings(t, literal, literal_len,
+                                          new_language, language_len)) {
+    raptor_world_return_pooled_term(world, t);
+    t = NULL;
+  }
+
+  if(new_language && new_language != language_buffer)
+    RAPTOR_FREE(char*, new_language);
+
+  if(!t)
+    return NULL;
+
   t->usage = 1;
   t->world = world;
   t->type = RAPTOR_TERM_TYPE_LITERAL;
-  t->value.literal.string = new_literal;
-  t->value.literal.string_len = RAPTOR_LANG_LEN_FROM_INT(literal_len);
-  t->value.literal.language = new_language;
-  t->value.literal.language_len = language_len;
-  t->value.literal.datatype = datatype;
+  if(datatype)
+    t->value.literal.datatype = raptor_uri_copy(datatype);
 
   return t;
 }
@@ -328,7 +912,7 @@ raptor_new_term_from_counted_blank(raptor_world* world,
     length = strlen((const char*)new_id);
   }
 
-  t = RAPTOR_CALLOC(raptor_term*, 1, sizeof(*t));
+  t = raptor_world_get_pooled_term(world);
   if(!t) {
     RAPTOR_FREE(char*, new_id);
     return NULL;
@@ -412,7 +996,7 @@ raptor_new_term_from_counted_string(raptor_world* world,
   memset(&locator, '\0', sizeof(locator));
   locator.line = -1;
 
-  bytes_read = raptor_ntriples_parse_term(world, &locator,
+  bytes_read = raptor_ntriples_parse_term(world, NULL, &locator,
                                           string, &length, &term, 1);
 
   if(!bytes_read || length != 0) {
@@ -425,6 +1009,125 @@ raptor_new_term_from_counted_string(raptor_world* world,
 }
 
 
+/**
+ * raptor_term_init_from_uri:
+ * @term: caller-allocated term to initialise
+ * @world: raptor world
+ * @uri: URI for the term
+ *
+ * Initialise a static URI term viewing caller-owned data.
+ *
+ * No copy and no reference is taken: @uri must remain valid for as
+ * long as @term is in use.  Static terms are not usage counted;
+ * raptor_free_term() on them is a no-op and raptor_term_copy()
+ * returns a new dynamic deep copy.
+ *
+ * Return value: non-0 on failure
+ */
+int
+raptor_term_init_from_uri(raptor_term* term, raptor_world* world,
+                          raptor_uri* uri)
+{
+  if(!term || !world || !uri)
+    return 1;
+
+  memset(term, 0, sizeof(*term));
+  term->world = world;
+  term->usage = -1;
+  term->type = RAPTOR_TERM_TYPE_URI;
+  term->value.uri = uri;
+
+  return 0;
+}
+
+
+/**
+ * raptor_term_init_from_counted_blank:
+ * @term: caller-allocated term to initialise
+ * @world: raptor world
+ * @blank: UTF-8 encoded blank node identifier
+ * @length: length of identifier
+ *
+ * Initialise a static blank node term viewing caller-owned data.
+ *
+ * No copy is taken: @blank must remain valid and NUL terminated for
+ * as long as @term is in use.  Static terms are not usage counted;
+ * raptor_free_term() on them is a no-op and raptor_term_copy()
+ * returns a new dynamic deep copy.
+ *
+ * Return value: non-0 on failure
+ */
+int
+raptor_term_init_from_counted_blank(raptor_term* term, raptor_world* world,
+                                    const unsigned char* blank, size_t length)
+{
+  if(!term || !world || !blank)
+    return 1;
+
+  memset(term, 0, sizeof(*term));
+  term->world = world;
+  term->usage = -1;
+  term->type = RAPTOR_TERM_TYPE_BLANK;
+  term->value.blank.string = (unsigned char*)blank;
+  term->value.blank.string_len = RAPTOR_BAD_CAST(unsigned int, length);
+
+  return 0;
+}
+
+
+/**
+ * raptor_term_init_from_counted_literal:
+ * @term: caller-allocated term to initialise
+ * @world: raptor world
+ * @literal: UTF-8 encoded literal string
+ * @literal_len: length of literal
+ * @datatype: literal datatype URI (or NULL)
+ * @language: literal language (or NULL for no language)
+ * @language_len: literal language length
+ *
+ * Initialise a static literal term viewing caller-owned data.
+ *
+ * No copies are taken: @literal, @datatype and @language must remain
+ * valid and NUL terminated for as long as @term is in use, and
+ * @language must already use '-' separators.  Only one of @language
+ * or @datatype may be given, as with
+ * raptor_new_term_from_counted_literal().  Static terms are not usage
+ * counted; raptor_free_term() on them is a no-op and
+ * raptor_term_copy() returns a new dynamic deep copy.
+ *
+ * Return value: non-0 on failure
+ */
+int
+raptor_term_init_from_counted_literal(raptor_term* term, raptor_world* world,
+                                      const unsigned char* literal,
+                                      size_t literal_len,
+                                      raptor_uri* datatype,
+                                      const unsigned char* language,
+                                      unsigned char language_len)
+{
+  if(!term || !world || !literal)
+    return 1;
+
+  if(language && !*language)
+    language = NULL;
+
+  if(language && datatype)
+    return 1;
+
+  memset(term, 0, sizeof(*term));
+  term->world = world;
+  term->usage = -1;
+  term->type = RAPTOR_TERM_TYPE_LITERAL;
+  term->value.literal.string = (unsigned char*)literal;
+  term->value.literal.string_len = RAPTOR_BAD_CAST(unsigned int, literal_len);
+  term->value.literal.datatype = datatype;
+  term->value.literal.language = (unsigned char*)language;
+  term->value.literal.language_len = language ? language_len : 0;
+
+  return 0;
+}
+
+
 /**
  * raptor_term_copy:
  * @term: raptor term
@@ -439,7 +1142,35 @@ raptor_term_copy(raptor_term* term)
   if(!term)
     return NULL;
 
+  /* static view terms are caller-owned: hand back a dynamic deep
+   * copy that can outlive the view */
+  if(term->usage < 0) {
+    switch(term->type) {
+      case RAPTOR_TERM_TYPE_URI:
+        return raptor_new_term_from_uri(term->world, term->value.uri);
+
+      case RAPTOR_TERM_TYPE_BLANK:
+        return raptor_new_term_from_counted_blank(term->world,
+                                                  term->value.blank.string,
+                                                  term->value.blank.string_len);
+
+      case RAPTOR_TERM_TYPE_LITERAL:
+        return raptor_new_term_from_counted_literal(term->world,
+                                                    term->value.literal.string,
+                                                    term->value.literal.string_len,
+                                                    term->value.literal.datatype,
+                                                    term->value.literal.language,
+                                                    term->value.literal.language_len);
+
+      case RAPTOR_TERM_TYPE_UNKNOWN:
+      default:
+        return NULL;
+    }
+  }
+
+  RAPTOR_WORLD_LOCK(term->world);
   term->usage++;
+  RAPTOR_WORLD_UNLOCK(term->world);
   return term;
 }
 
@@ -456,10 +1187,28 @@ raptor_free_term(raptor_term *term)
 {
   if(!term)
     return;
-  
-  if(--term->usage)
+
+  /* static view terms are caller-owned and never freed here */
+  if(term->usage < 0)
     return;
-  
+
+  RAPTOR_WORLD_LOCK(term->world);
+
+  if(--term->usage) {
+    RAPTOR_WORLD_UNLOCK(term->world);
+    return;
+  }
+
+  /* interned URI and literal terms leave the pool when unused; once
+   * deleted from the table no other thread can reach this term so it
+   * is safe to destroy after unlocking */
+  if(term->world->terms_table &&
+     (term->type == RAPTOR_TERM_TYPE_URI ||
+      term->type == RAPTOR_TERM_TYPE_LITERAL))
+    raptor_term_intern_table_delete(term->world->terms_table, term);
+
+  RAPTOR_WORLD_UNLOCK(term->world);
+
   switch(term->type) {
     case RAPTOR_TERM_TYPE_URI:
       if(term->value.uri) {
@@ -477,7 +1226,8 @@ raptor_free_term(raptor_term *term)
       
     case RAPTOR_TERM_TYPE_LITERAL:
       if(term->value.literal.string) {
-        RAPTOR_FREE(char*, term->value.literal.string);
+        if(!RAPTOR_TERM_STRING_IS_INLINE(term, term->value.literal.string))
+          RAPTOR_FREE(char*, term->value.literal.string);
         term->value.literal.string = NULL;
       }
 
@@ -485,9 +1235,10 @@ raptor_free_term(raptor_term *term)
         raptor_free_uri(term->value.literal.datatype);
         term->value.literal.datatype = NULL;
       }
-      
+
       if(term->value.literal.language) {
-        RAPTOR_FREE(char*, term->value.literal.language);
+        if(!RAPTOR_TERM_STRING_IS_INLINE(term, term->value.literal.language))
+          RAPTOR_FREE(char*, term->value.literal.language);
         term->value.literal.language = NULL;
       }
       break;
@@ -497,7 +1248,50 @@ raptor_free_term(raptor_term *term)
       break;
   }
 
-  RAPTOR_FREE(term, term);
+  if(term->escaped_image) {
+    RAPTOR_FREE(char*, term->escaped_image);
+    term->escaped_image = NULL;
+  }
+
+  raptor_world_return_pooled_term(term->world, term);
+}
+
+
+/*
+ * raptor_term_detach_literal_string:
+ * @term: literal term
+ *
+ * INTERNAL - Take ownership of a literal term's string
+ *
+ * The term's literal string field is set to NULL and the returned
+ * string is owned by the caller.  A string held in the term's inline
+ * storage is copied to the heap first, so the result is always
+ * freeable and outlives the term.
+ *
+ * Return value: the literal string or NULL on failure or if the term had none
+ */
+unsigned char*
+raptor_term_detach_literal_string(raptor_term* term)
+{
+  unsigned char* s = term->value.literal.string;
+
+  if(!s)
+    return NULL;
+
+  if(RAPTOR_TERM_STRING_IS_INLINE(term, s)) {
+    unsigned char* copy;
+
+    copy = RAPTOR_MALLOC(unsigned char*,
+                         (size_t)term->value.literal.string_len + 1);
+    if(!copy)
+      return NULL;
+    memcpy(copy, s, (size_t)term->value.literal.string_len + 1);
+    s = copy;
+  }
+
+  term->value.literal.string = NULL;
+
+  return s;
 }
 
 
@@ -604,6 +1398,139 @@ raptor_term_print_as_ntriples(const raptor_term *term, FILE* stream)
 }
 
 
+/*
+ * raptor_hash_finalize:
+ * @hash: raw accumulated hash value
+ *
+ * INTERNAL - Mix a hash so every input bit affects every output bit
+ *
+ * The djb2-style accumulators used for terms have almost no
+ * avalanche: values that differ only in a few trailing characters
+ * produce hashes differing by small linear combinations of powers of
+ * 33, and such differences can cancel when per-term hashes are
+ * combined into a statement hash.  This multiply/xor-shift mix (the
+ * murmur3 finalizer) removes that structure.
+ *
+ * Return value: mixed hash value
+ */
+unsigned long
+raptor_hash_finalize(unsigned long hash)
+{
+#if SIZEOF_UNSIGNED_LONG == 8
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdUL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53UL;
+  hash ^= hash >> 33;
+#else
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6bUL;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35UL;
+  hash ^= hash >> 16;
+#endif
+
+  return hash;
+}
+
+
+/**
+ * raptor_term_hash:
+ * @term: term
+ *
+ * Get a hash of the identifying content of a term.
+ *
+ * The hash covers the term type and its lexical value including any
+ * literal language and datatype.  It is computed on first use and
+ * cached in the term's @saved_hash field, so repeated calls are
+ * cheap.  Equal terms always have equal hashes; distinct terms
+ * usually, but not always, have distinct hashes.
+ *
+ * Return value: non-0 hash value, or 0 if @term is NULL
+ */
+unsigned long
+raptor_term_hash(raptor_term* term)
+{
+  unsigned long hash;
+  const unsigned char* s = NULL;
+  size_t len = 0;
+
+  if(!term)
+    return 0;
+
+  if(term->saved_hash)
+    return term->saved_hash;
+
+  hash = 5381 + (unsigned long)term->type;
+
+  switch(term->type) {
+    case RAPTOR_TERM_TYPE_URI:
+      s = raptor_uri_as_counted_string(term->value.uri, &len);
+      break;
+
+    case RAPTOR_TERM_TYPE_LITERAL:
+      s = term->value.literal.string;
+      len = term->value.literal.string_len;
+      break;
+
+    case RAPTOR_TERM_TYPE_BLANK:
+      s = term->value.blank.string;
+      len = term->value.blank.string_len;
+      break;
+
+    case RAPTOR_TERM_TYPE_UNKNOWN:
+    default:
+      break;
+  }
+
+  while(len--)
+    hash = ((hash << 5) + hash) + *s++;
+
+  if(term->type == RAPTOR_TERM_TYPE_LITERAL) {
+    if(term->value.literal.language) {
+      for(s = term->value.literal.language; *s; s++)
+        hash = ((hash << 5) + hash) + *s;
+    }
+    if(term->value.literal.datatype) {
+      s = raptor_uri_as_counted_string(term->value.literal.datatype, &len);
+      while(len--)
+        hash = ((hash << 5) + hash) + *s++;
+    }
+  }
+
+  hash = raptor_hash_finalize(hash);
+
+  /* 0 is reserved to mean "not yet computed" */
+  if(!hash)
+    hash = 1;
+
+  term->saved_hash = hash;
+
+  return hash;
+}
+
+
+/**
+ * raptor_term_get_xsd_datatype:
+ * @term: #raptor_term object (or NULL)
+ *
+ * Identify which common XSD datatype a literal term has.
+ *
+ * See raptor_uri_get_xsd_datatype() for the datatype URI form.
+ *
+ * Return value: the datatype of the literal or RAPTOR_XSD_DATATYPE_NONE for non-literals and other datatypes
+ */
+raptor_xsd_datatype
+raptor_term_get_xsd_datatype(raptor_term* term)
+{
+  if(!term || term->type != RAPTOR_TERM_TYPE_LITERAL ||
+     !term->value.literal.datatype)
+    return RAPTOR_XSD_DATATYPE_NONE;
+
+  return raptor_uri_get_xsd_datatype(term->value.literal.datatype);
+}
+
+
 /**
  * raptor_term_equals:
  * @t1: first term
@@ -620,13 +1547,18 @@ raptor_term_equals(raptor_term* t1, raptor_term* t2)
 
   if(!t1 || !t2)
     return 0;
-  
+
   if(t1->type != t2->type)
     return 0;
-  
+
   if(t1 == t2)
     return 1;
-  
+
+  /* cached hashes that differ prove inequality without comparing
+   * content; hashes are only computed here if both are already known */
+  if(t1->saved_hash && t2->saved_hash && t1->saved_hash != t2->saved_hash)
+    return 0;
+
   switch(t1->type) {
     case RAPTOR_TERM_TYPE_URI:
       d = raptor_uri_equals(t1->value.uri, t2->value.uri);
@@ -712,6 +1644,9 @@ raptor_term_compare(const raptor_term *t1,  const raptor_term *t2)
     return t1 ? 1 : -1;
   }
 
+  if(t1 == t2)
+    return 0;
+
   if(t1->type != t2->type)
     return (t1->type - t2->type);
   
@@ -71,6 +71,13 @@ struct raptor_turtle_writer_s {
 
   /* indentation per level if formatting */
   int indent;
+
+  /* cached newline plus indentation image for the current depth,
+   * written as one counted write; newline_len 0 means it must be
+   * rebuilt (after a depth or indent change) */
+  unsigned char* newline_buffer;
+  size_t newline_len;
+  size_t newline_size;
 };
 
 
@@ -83,11 +90,18 @@ static const unsigned char spaces_buffer[] = {
   ' ', ' ', ' ', ' '
 };
 
+/* size of the on-stack buffer a syntactic unit (qname, quoted string,
+ * datatype or language suffix) is assembled in before being flushed
+ * as one counted write; larger units fall back to split writes or the
+ * world scratch pool */
+#define TURTLE_WRITER_UNIT_BUFFER_SIZE 256
+
 
 void
 raptor_turtle_writer_increase_indent(raptor_turtle_writer *turtle_writer)
 {
   turtle_writer->depth += turtle_writer->indent;
+  turtle_writer->newline_len = 0;
 }
 
 
@@ -95,31 +109,63 @@ void
 raptor_turtle_writer_decrease_indent(raptor_turtle_writer *turtle_writer)
 {
   turtle_writer->depth -= turtle_writer->indent;
+  turtle_writer->newline_len = 0;
 }
 
-  
+
 void
 raptor_turtle_writer_newline(raptor_turtle_writer *turtle_writer)
 {
   int num_spaces;
-  
-  raptor_iostream_write_byte('\n', turtle_writer->iostr);
- 
-  if(!TURTLE_WRITER_AUTO_INDENT(turtle_writer))
+
+  if(!TURTLE_WRITER_AUTO_INDENT(turtle_writer)) {
+    raptor_iostream_write_byte('\n', turtle_writer->iostr);
     return;
+  }
+
+  if(!turtle_writer->newline_len) {
+    size_t needed;
+
+    num_spaces = turtle_writer->depth * turtle_writer->indent;
+    if(num_spaces < 0)
+      num_spaces = 0;
 
-  num_spaces = turtle_writer->depth * turtle_writer->indent;
+    needed = 1 + RAPTOR_GOOD_CAST(size_t, num_spaces);
+    if(needed > turtle_writer->newline_size) {
+      unsigned char* buffer = RAPTOR_MALLOC(unsigned char*, needed);
 
-  while(num_spaces > 0) {
-    int count;
-    count = (num_spaces > RAPTOR_GOOD_CAST(int, SPACES_BUFFER_SIZE)) ? 
-            RAPTOR_GOOD_CAST(int, SPACES_BUFFER_SIZE) : num_spaces;
+      if(!buffer) {
+        /* no image; emit the newline and indentation piecewise */
+        raptor_iostream_write_byte('\n', turtle_writer->iostr);
+        while(num_spaces > 0) {
+          int count;
+          count = (num_spaces > RAPTOR_GOOD_CAST(int, SPACES_BUFFER_SIZE)) ?
+                  RAPTOR_GOOD_CAST(int, SPACES_BUFFER_SIZE) : num_spaces;
 
-    raptor_iostream_counted_string_write(spaces_buffer, count, turtle_writer->iostr);
+          raptor_iostream_counted_string_write(spaces_buffer, count,
+                                               turtle_writer->iostr);
 
-    num_spaces -= count;
+          num_spaces -= count;
+        }
+        return;
+      }
+
+      if(turtle_writer->newline_buffer)
+        RAPTOR_FREE(unsigned char*, turtle_writer->newline_buffer);
+      turtle_writer->newline_buffer = buffer;
+      turtle_writer->newline_size = needed;
+    }
+
+    turtle_writer->newline_buffer[0] = '\n';
+    if(needed > 1)
+      memset(turtle_writer->newline_buffer + 1, ' ', needed - 1);
+    turtle_writer->newline_len = needed;
   }
 
+  raptor_iostream_counted_string_write(turtle_writer->newline_buffer,
+                                       turtle_writer->newline_len,
+                                       turtle_writer->iostr);
+
   return;
 }
 
@@ -235,6 +281,9 @@ raptor_free_turtle_writer(raptor_turtle_writer* turtle_writer)
   if(turtle_writer->nstack && turtle_writer->my_nstack)
     raptor_free_namespaces(turtle_writer->nstack);
 
+  if(turtle_writer->newline_buffer)
+    RAPTOR_FREE(unsigned char*, turtle_writer->newline_buffer);
+
   RAPTOR_FREE(raptor_turtle_writer, turtle_writer);
 }
 
@@ -369,13 +418,35 @@ raptor_turtle_writer_qname(raptor_turtle_writer* turtle_writer,
                            raptor_qname* qname)
 {
   raptor_iostream* iostr = turtle_writer->iostr;
-  
+  unsigned char buffer[TURTLE_WRITER_UNIT_BUFFER_SIZE];
+  size_t prefix_len = 0;
+  size_t needed;
+
   if(qname->nspace && qname->nspace->prefix_length > 0)
+    prefix_len = qname->nspace->prefix_length;
+
+  /* assemble prefix:local as one counted write when it fits */
+  needed = prefix_len + 1 + qname->local_name_length;
+  if(needed <= sizeof(buffer)) {
+    unsigned char* p = buffer;
+
+    if(prefix_len) {
+      memcpy(p, qname->nspace->prefix, prefix_len);
+      p += prefix_len;
+    }
+    *p++ = ':';
+    memcpy(p, qname->local_name, qname->local_name_length);
+
+    raptor_iostream_counted_string_write(buffer, needed, iostr);
+    return;
+  }
+
+  if(prefix_len)
     raptor_iostream_counted_string_write(qname->nspace->prefix,
-                                         qname->nspace->prefix_length,
+                                         prefix_len,
                                          iostr);
   raptor_iostream_write_byte(':', iostr);
-  
+
   raptor_iostream_counted_string_write(qname->local_name,
                                        qname->local_name_length,
                                        iostr);
@@ -412,6 +483,41 @@ raptor_turtle_writer_quoted_counted_string(raptor_turtle_writer* turtle_writer,
     flags = RAPTOR_ESCAPED_WRITE_TURTLE_LONG_LITERAL;
     q = quotes;
     q_len = 3;
+  } else {
+    /* assemble a short string needing no escapes, with its quotes, as
+     * one counted write */
+    unsigned char clean[256];
+    size_t i;
+
+    raptor_escaped_write_fill_clean_table(clean, '"',
+                                          RAPTOR_GOOD_CAST(unsigned int,
+                                                           flags));
+    for(i = 0; i < len; i++) {
+      if(!clean[s[i]])
+        break;
+    }
+
+    if(i == len) {
+      unsigned char buffer[TURTLE_WRITER_UNIT_BUFFER_SIZE];
+      unsigned char* unit = buffer;
+
+      if(len + 2 > sizeof(buffer))
+        unit = raptor_world_borrow_scratch(turtle_writer->world, len + 2);
+
+      if(unit) {
+        unit[0] = '"';
+        memcpy(unit + 1, s, len);
+        unit[len + 1] = '"';
+
+        raptor_iostream_counted_string_write(unit, len + 2,
+                                             turtle_writer->iostr);
+
+        if(unit != buffer)
+          raptor_world_return_scratch(turtle_writer->world, unit);
+
+        return 0;
+      }
+    }
   }
 
   raptor_iostream_counted_string_write(q, q_len, turtle_writer->iostr);
@@ -424,22 +530,24 @@ raptor_turtle_writer_quoted_counted_string(raptor_turtle_writer* turtle_writer,
 
 
 /*
- * raptor_turtle_writer_literal:
+ * raptor_turtle_writer_counted_literal:
  * @turtle_writer: Turtle writer object
  * @nstack: Namespace stack for making a QName for datatype URI
  * @s: literal string to write (SHARED)
+ * @s_len: length of @s
  * @lang: language tag (may be NULL)
  * @datatype: datatype URI (may be NULL)
  *
- * INTERNAL - Write a literal (possibly with lang and datatype) to the Turtle writer.
+ * INTERNAL - Write a counted literal (possibly with lang and datatype) to the Turtle writer.
  *
  * Return value: non-0 on failure
  **/
 int
-raptor_turtle_writer_literal(raptor_turtle_writer* turtle_writer,
-                             raptor_namespace_stack *nstack,
-                             const unsigned char* s, const unsigned char* lang,
-                             raptor_uri* datatype)
+raptor_turtle_writer_counted_literal(raptor_turtle_writer* turtle_writer,
+                                     raptor_namespace_stack *nstack,
+                                     const unsigned char* s, size_t s_len,
+                                     const unsigned char* lang,
+                                     raptor_uri* datatype)
 {
   /* DBL_MAX = 309 decimal digits */
   #define INT_MAX_LEN 309 
@@ -449,11 +557,14 @@ raptor_turtle_writer_literal(raptor_turtle_writer* turtle_writer,
 
   char* endptr = (char *)s;
   int written = 0;
+  raptor_xsd_datatype xsd_datatype;
 
   /* typed literal special cases */
   if(datatype) {
+    xsd_datatype = raptor_uri_get_xsd_datatype(datatype);
+
     /* integer */
-    if(raptor_uri_equals(datatype, turtle_writer->world->xsd_integer_uri)) {
+    if(xsd_datatype == RAPTOR_XSD_DATATYPE_INTEGER) {
       /* FIXME. Work around that gcc < 4.5 cannot disable warn_unused_result */
       long gcc_is_stupid = strtol((const char*)s, &endptr, 10);
       if(endptr != (char*)s && !*endptr) {
@@ -466,8 +577,8 @@ raptor_turtle_writer_literal(raptor_turtle_writer* turtle_writer,
       }
 
     /* double, decimal */
-    } else if(raptor_uri_equals(datatype, turtle_writer->world->xsd_double_uri) ||
-      raptor_uri_equals(datatype, turtle_writer->world->xsd_decimal_uri)) {
+    } else if(xsd_datatype == RAPTOR_XSD_DATATYPE_DOUBLE ||
+              xsd_datatype == RAPTOR_XSD_DATATYPE_DECIMAL) {
       /* FIXME. Work around that gcc < 4.5 cannot disable warn_unused_result */
       double gcc_is_doubly_stupid = strtod((const char*)s, &endptr);
       if(endptr != (char*)s && !*endptr) {
@@ -480,7 +591,7 @@ raptor_turtle_writer_literal(raptor_turtle_writer* turtle_writer,
       }
 
     /* boolean */
-    } else if(raptor_uri_equals(datatype, turtle_writer->world->xsd_boolean_uri)) {
+    } else if(xsd_datatype == RAPTOR_XSD_DATATYPE_BOOLEAN) {
       if(!strcmp((const char*)s, "0") || !strcmp((const char*)s, "false")) {
         raptor_iostream_string_write("false", turtle_writer->iostr);
         written = 1;
@@ -497,31 +608,94 @@ raptor_turtle_writer_literal(raptor_turtle_writer* turtle_writer,
   if(written)
     return 0;
     
-  if(raptor_turtle_writer_quoted_counted_string(turtle_writer, s,
-                                                strlen((const char*)s)))
+  if(raptor_turtle_writer_quoted_counted_string(turtle_writer, s, s_len))
     return 1;
 
   /* typed literal, not a special case */
   if(datatype) {
     raptor_qname* qname;
 
-    raptor_iostream_string_write("^^", turtle_writer->iostr);
     qname = raptor_new_qname_from_namespace_uri(nstack, datatype, 10);
     if(qname) {
-      raptor_turtle_writer_qname(turtle_writer, qname);
+      /* assemble ^^prefix:local as one counted write when it fits */
+      unsigned char buffer[TURTLE_WRITER_UNIT_BUFFER_SIZE];
+      size_t prefix_len = 0;
+      size_t needed;
+
+      if(qname->nspace && qname->nspace->prefix_length > 0)
+        prefix_len = qname->nspace->prefix_length;
+
+      needed = 2 + prefix_len + 1 + qname->local_name_length;
+      if(needed <= sizeof(buffer)) {
+        unsigned char* p = buffer;
+
+        *p++ = '^';
+        *p++ = '^';
+        if(prefix_len) {
+          memcpy(p, qname->nspace->prefix, prefix_len);
+          p += prefix_len;
+        }
+        *p++ = ':';
+        memcpy(p, qname->local_name, qname->local_name_length);
+
+        raptor_iostream_counted_string_write(buffer, needed,
+                                             turtle_writer->iostr);
+      } else {
+        raptor_iostream_counted_string_write("^^", 2, turtle_writer->iostr);
+        raptor_turtle_writer_qname(turtle_writer, qname);
+      }
       raptor_free_qname(qname);
-    } else
+    } else {
+      raptor_iostream_counted_string_write("^^", 2, turtle_writer->iostr);
       raptor_turtle_writer_reference(turtle_writer, datatype);
+    }
   } else if(lang) {
-    /* literal with language tag */
-    raptor_iostream_write_byte('@', turtle_writer->iostr);
-    raptor_iostream_string_write(lang, turtle_writer->iostr);
+    /* literal with language tag; @lang as one counted write */
+    unsigned char buffer[TURTLE_WRITER_UNIT_BUFFER_SIZE];
+    size_t lang_len = strlen((const char*)lang);
+
+    if(lang_len + 1 <= sizeof(buffer)) {
+      buffer[0] = '@';
+      memcpy(buffer + 1, lang, lang_len);
+      raptor_iostream_counted_string_write(buffer, lang_len + 1,
+                                           turtle_writer->iostr);
+    } else {
+      raptor_iostream_write_byte('@', turtle_writer->iostr);
+      raptor_iostream_string_write(lang, turtle_writer->iostr);
+    }
   }
 
   return 0;
 }
 
 
+/*
+ * raptor_turtle_writer_literal:
+ * @turtle_writer: Turtle writer object
+ * @nstack: Namespace stack for making a QName for datatype URI
+ * @s: literal string to write (SHARED)
+ * @lang: language tag (may be NULL)
+ * @datatype: datatype URI (may be NULL)
+ *
+ * INTERNAL - Write a literal (possibly with lang and datatype) to the Turtle writer.
+ *
+ * See also raptor_turtle_writer_counted_literal() which saves a
+ * strlen() when the caller already knows the length.
+ *
+ * Return value: non-0 on failure
+ **/
+int
+raptor_turtle_writer_literal(raptor_turtle_writer* turtle_writer,
+                             raptor_namespace_stack *nstack,
+                             const unsigned char* s, const unsigned char* lang,
+                             raptor_uri* datatype)
+{
+  return raptor_turtle_writer_counted_literal(turtle_writer, nstack, s,
+                                              strlen((const char*)s),
+                                              lang, datatype);
+}
+
+
 /**
  * raptor_turtle_writer_comment:
  * @turtle_writer: Turtle writer object
@@ -586,8 +760,9 @@ raptor_turtle_writer_set_option(raptor_turtle_writer *turtle_writer,
 
     case RAPTOR_OPTION_WRITER_INDENT_WIDTH:
       turtle_writer->indent = value;
+      turtle_writer->newline_len = 0;
       break;
-    
+
     case RAPTOR_OPTION_WRITER_AUTO_EMPTY:
     case RAPTOR_OPTION_WRITER_XML_VERSION:
     case RAPTOR_OPTION_WRITER_XML_DECLARATION:
@@ -872,11 +1047,12 @@ raptor_turtle_writer_term(raptor_turtle_writer* turtle_writer,
   if(term->type == RAPTOR_TERM_TYPE_URI) {
     rc = raptor_turtle_writer_uri(turtle_writer, term->value.uri);
   } else if(term->type == RAPTOR_TERM_TYPE_LITERAL) {
-    rc = raptor_turtle_writer_literal(turtle_writer,
-                                      turtle_writer->nstack,
-                                      term->value.literal.string,
-                                      term->value.literal.language, 
-                                      term->value.literal.datatype);
+    rc = raptor_turtle_writer_counted_literal(turtle_writer,
+                                              turtle_writer->nstack,
+                                              term->value.literal.string,
+                                              term->value.literal.string_len,
+                                              term->value.literal.language, 
+                                              term->value.literal.datatype);
   } else if(term->type == RAPTOR_TERM_TYPE_BLANK) {
     rc = raptor_bnodeid_ntriples_write(term->value.blank.string,
                                        term->value.blank.string_len,
@@ -980,7 +1156,7 @@ main(int argc, char *argv[])
 
   raptor_turtle_writer_literal(turtle_writer, nstack,
                                (const unsigned char*)"10.0", NULL,
-                               world->xsd_decimal_uri);
+                               world->xsd_datatype_uris[RAPTOR_XSD_DATATYPE_DECIMAL]);
 
   raptor_turtle_writer_newline(turtle_writer);
 
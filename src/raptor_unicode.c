@@ -39,10 +39,74 @@
 #include "raptor_internal.h"
 
 
+/* Vectorized ASCII scanning - pick the widest unit the compiler
+ * targets.  SSE2 is baseline on x86-64; NEON is baseline on AArch64;
+ * everything else falls back to the scalar loop.
+ */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAPTOR_UNICODE_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define RAPTOR_UNICODE_NEON 1
+#include <arm_neon.h>
+#endif
+
+
 /* Unicode defines only the range U+0000 to U+10FFFF */
 const raptor_unichar raptor_unicode_max_codepoint = 0x10FFFF;
 
 
+/*
+ * raptor_unicode_utf8_ascii_span:
+ * @string: UTF-8 string
+ * @length: length of string
+ *
+ * INTERNAL - Count the leading bytes of @string below U+0080.
+ *
+ * ASCII bytes are trivially valid UTF-8 and are each one character, so
+ * the validation and measuring loops below can skip a whole span in
+ * bulk and only run the scalar decoder from the first non-ASCII byte.
+ *
+ * Return value: number of leading ASCII bytes
+ */
+static size_t
+raptor_unicode_utf8_ascii_span(const unsigned char *string, size_t length)
+{
+  const unsigned char *p = string;
+  const unsigned char *end = string + length;
+
+#ifdef RAPTOR_UNICODE_SSE2
+  while(p + 16 <= end) {
+    __m128i chunk = _mm_loadu_si128((const __m128i*)p);
+    int mask = _mm_movemask_epi8(chunk);
+
+    if(mask) {
+      /* lowest set bit = first non-ASCII byte */
+      unsigned int offset = 0;
+      while(!(mask & (1 << offset)))
+        offset++;
+      return RAPTOR_GOOD_CAST(size_t, p - string) + offset;
+    }
+    p += 16;
+  }
+#endif
+#ifdef RAPTOR_UNICODE_NEON
+  while(p + 16 <= end) {
+    uint8x16_t chunk = vld1q_u8(p);
+
+    if(vmaxvq_u8(chunk) > 0x7F)
+      break;
+    p += 16;
+  }
+#endif
+
+  while(p < end && *p < 0x80)
+    p++;
+
+  return RAPTOR_GOOD_CAST(size_t, p - string);
+}
+
+
 /**
  * raptor_unicode_utf8_string_put_char:
  * @c: Unicode character
@@ -792,20 +856,20 @@ int
 raptor_unicode_check_utf8_nfc_string(const unsigned char *input, size_t length,
                                      int *error)
 {
-  unsigned int i;
-  int plain = 1;
-  
-  for(i = 0; i < length; i++)
-    if(input[i] > 0x7f) {
-      plain = 0;
-      break;
-    }
-    
-  if(plain)
+  size_t span;
+
+  span = raptor_unicode_utf8_ascii_span(input, length);
+  if(span == length)
+    /* ASCII is NFC by definition */
     return 1;
 
 #ifdef RAPTOR_NFC_ICU
-  return raptor_nfc_icu_check(input, length, error);
+  /* The ASCII prefix cannot affect the result: a combining character
+   * that could compose with a preceding base character never
+   * quick-checks as definitely NFC on its own, so only the non-ASCII
+   * tail needs to be handed over.
+   */
+  return raptor_nfc_icu_check(input + span, length - span, error);
 #else
   if(error)
     *error = 1;
@@ -814,6 +878,84 @@ raptor_unicode_check_utf8_nfc_string(const unsigned char *input, size_t length,
 }
 
 
+/*
+ * raptor_world_check_utf8_nfc_string:
+ * @world: raptor_world object (or NULL for no caching)
+ * @input: UTF-8 string
+ * @length: length of string
+ * @error: pointer to error flag (or NULL)
+ *
+ * INTERNAL - NFC check with a per-world cache of validated strings.
+ *
+ * Like raptor_unicode_check_utf8_nfc_string() but remembers recently
+ * validated non-ASCII spans in a small direct-mapped cache on @world,
+ * so documents repeating the same non-ASCII names and literals pay
+ * for the full check only once.  Hits are confirmed by byte
+ * comparison; spans longer than RAPTOR_NFC_CACHE_MAX_LEN bytes are
+ * not cached.
+ *
+ * Return value: Non 0 if the string is in NFC (or an error)
+ **/
+int
+raptor_world_check_utf8_nfc_string(raptor_world* world,
+                                   const unsigned char *input, size_t length,
+                                   int *error)
+{
+  size_t span;
+  const unsigned char* tail;
+  size_t tail_length;
+  raptor_nfc_cache_slot* slot = NULL;
+  int rc;
+
+  span = raptor_unicode_utf8_ascii_span(input, length);
+  if(span == length)
+    return 1;
+
+  tail = input + span;
+  tail_length = length - span;
+
+  if(world && tail_length <= RAPTOR_NFC_CACHE_MAX_LEN) {
+    int hit = 0;
+
+    RAPTOR_WORLD_LOCK(world);
+
+    if(!world->nfc_cache)
+      world->nfc_cache = RAPTOR_CALLOC(raptor_nfc_cache_slot*,
+                                       RAPTOR_NFC_CACHE_SLOTS,
+                                       sizeof(raptor_nfc_cache_slot));
+
+    if(world->nfc_cache) {
+      unsigned long hash = 5381;
+      size_t i;
+
+      for(i = 0; i < tail_length; i++)
+        hash = ((hash << 5) + hash) + tail[i];
+
+      slot = &world->nfc_cache[hash & (RAPTOR_NFC_CACHE_SLOTS - 1)];
+      if(slot->length == tail_length &&
+         !memcmp(slot->string, tail, tail_length))
+        hit = 1;
+    }
+
+    RAPTOR_WORLD_UNLOCK(world);
+
+    if(hit)
+      return 1;
+  }
+
+  rc = raptor_unicode_check_utf8_nfc_string(tail, tail_length, error);
+
+  if(rc && slot) {
+    RAPTOR_WORLD_LOCK(world);
+    memcpy(slot->string, tail, tail_length);
+    slot->length = tail_length;
+    RAPTOR_WORLD_UNLOCK(world);
+  }
+
+  return rc;
+}
+
+
 /**
  * raptor_unicode_check_utf8_string:
  * @string: UTF-8 string
@@ -830,6 +972,13 @@ raptor_unicode_check_utf8_string(const unsigned char *string, size_t length)
     raptor_unichar unichar = 0;
 
     int unichar_len;
+
+    size_t span = raptor_unicode_utf8_ascii_span(string, length);
+    string += span;
+    length -= span;
+    if(!length)
+      break;
+
     unichar_len = raptor_unicode_utf8_string_get_char(string, length, &unichar);
     if(unichar_len < 0 || RAPTOR_GOOD_CAST(size_t, unichar_len) > length)
       return 0;
@@ -860,6 +1009,14 @@ raptor_unicode_utf8_strlen(const unsigned char *string, size_t length)
   
   while(length > 0) {
     int unichar_len;
+
+    size_t span = raptor_unicode_utf8_ascii_span(string, length);
+    string += span;
+    length -= span;
+    unicode_length += RAPTOR_BAD_CAST(int, span);
+    if(!length)
+      break;
+
     unichar_len = raptor_unicode_utf8_string_get_char(string, length, NULL);
     if(unichar_len < 0 || RAPTOR_GOOD_CAST(size_t, unichar_len) > length) {
       unicode_length = -1;
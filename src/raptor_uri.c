@@ -82,11 +82,257 @@ struct raptor_uri_s {
   unsigned int length;
   /* usage count */
   int usage;
+  /* hash of string - computed once at construction, used by interning */
+  unsigned int hash;
+  /* cached "<...>" rendering from raptor_uri_escaped_write() or NULL;
+   * built once for the first escape flags seen and kept until the URI
+   * is destroyed */
+  unsigned char *escaped_string;
+  /* length of escaped_string */
+  size_t escaped_string_len;
+  /* escape flags escaped_string was built with */
+  unsigned int escaped_string_flags;
 };
 
 
 #ifndef STANDALONE
 
+/*
+ * Interned URI store - open addressing (linear probing) hash table.
+ *
+ * Replaces the former AVL tree store: lookups compare the cached hash
+ * and length before ever touching the URI bytes, so the common case of
+ * a miss or a hit costs O(1) amortized rather than a strcmp() per tree
+ * level.
+ */
+struct raptor_uri_intern_table_s {
+  /* array of @capacity slots; NULL = empty */
+  raptor_uri **slots;
+  /* size of slots array - always a power of two */
+  size_t capacity;
+  /* number of live entries */
+  size_t size;
+  /* number of tombstone entries left by deletes */
+  size_t deleted;
+};
+typedef struct raptor_uri_intern_table_s raptor_uri_intern_table;
+
+/* marker for a deleted slot; never dereferenced */
+static raptor_uri raptor_uri_intern_tombstone_object;
+#define RAPTOR_URI_INTERN_TOMBSTONE (&raptor_uri_intern_tombstone_object)
+
+/* initial number of slots; must be a power of two */
+#define RAPTOR_URI_INTERN_INITIAL_CAPACITY 64
+
+
+/*
+ * raptor_uri_string_hash:
+ * @string: string (need not be NUL terminated)
+ * @length: length of @string
+ *
+ * INTERNAL - Hash a URI string (djb2)
+ *
+ * Return value: hash value
+ */
+static unsigned int
+raptor_uri_string_hash(const unsigned char *string, size_t length)
+{
+  unsigned int hash = 5381;
+
+  while(length--)
+    hash = ((hash << 5) + hash) + *string++;
+
+  return hash;
+}
+
+
+/*
+ * raptor_new_uri_intern_table:
+ * @capacity: initial capacity (power of two)
+ *
+ * INTERNAL - Constructor - create an interned-URI hash table
+ *
+ * Return value: new table or NULL on failure
+ */
+static raptor_uri_intern_table*
+raptor_new_uri_intern_table(size_t capacity)
+{
+  raptor_uri_intern_table* table;
+
+  table = RAPTOR_CALLOC(raptor_uri_intern_table*, 1, sizeof(*table));
+  if(!table)
+    return NULL;
+
+  table->slots = RAPTOR_CALLOC(raptor_uri**, capacity, sizeof(raptor_uri*));
+  if(!table->slots) {
+    RAPTOR_FREE(raptor_uri_intern_table, table);
+    return NULL;
+  }
+  table->capacity = capacity;
+
+  return table;
+}
+
+
+/*
+ * raptor_free_uri_intern_table:
+ * @table: interned-URI hash table
+ *
+ * INTERNAL - Destructor - destroy an interned-URI hash table
+ *
+ * Does not free the URIs; like the former AVL tree store, the table
+ * does not own references to them.
+ */
+static void
+raptor_free_uri_intern_table(raptor_uri_intern_table* table)
+{
+  if(!table)
+    return;
+
+  if(table->slots)
+    RAPTOR_FREE(raptor_uri**, table->slots);
+  RAPTOR_FREE(raptor_uri_intern_table, table);
+}
+
+
+/*
+ * raptor_uri_intern_table_find:
+ * @table: interned-URI hash table
+ * @string: URI string (need not be NUL terminated)
+ * @length: length of @string
+ * @hash: hash of @string from raptor_uri_string_hash()
+ *
+ * INTERNAL - Look up an interned URI by string
+ *
+ * Return value: shared #raptor_uri or NULL if not present
+ */
+static raptor_uri*
+raptor_uri_intern_table_find(raptor_uri_intern_table* table,
+                             const unsigned char *string, size_t length,
+                             unsigned int hash)
+{
+  size_t mask = table->capacity - 1;
+  size_t i;
+
+  for(i = hash & mask; table->slots[i]; i = (i + 1) & mask) {
+    raptor_uri* uri = table->slots[i];
+
+    if(uri == RAPTOR_URI_INTERN_TOMBSTONE)
+      continue;
+
+    if(uri->hash == hash && uri->length == (unsigned int)length &&
+       !memcmp(uri->string, string, length))
+      return uri;
+  }
+
+  return NULL;
+}
+
+
+static int raptor_uri_intern_table_add(raptor_uri_intern_table* table,
+                                       raptor_uri* uri);
+
+/*
+ * raptor_uri_intern_table_rehash:
+ * @table: interned-URI hash table
+ * @new_capacity: new capacity (power of two)
+ *
+ * INTERNAL - Resize the slots array, dropping tombstones
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_uri_intern_table_rehash(raptor_uri_intern_table* table,
+                               size_t new_capacity)
+{
+  raptor_uri **old_slots = table->slots;
+  size_t old_capacity = table->capacity;
+  size_t i;
+
+  table->slots = RAPTOR_CALLOC(raptor_uri**, new_capacity,
+                               sizeof(raptor_uri*));
+  if(!table->slots) {
+    table->slots = old_slots;
+    return 1;
+  }
+  table->capacity = new_capacity;
+  table->size = 0;
+  table->deleted = 0;
+
+  for(i = 0; i < old_capacity; i++) {
+    raptor_uri* uri = old_slots[i];
+    if(uri && uri != RAPTOR_URI_INTERN_TOMBSTONE)
+      raptor_uri_intern_table_add(table, uri);
+  }
+
+  RAPTOR_FREE(raptor_uri**, old_slots);
+  return 0;
+}
+
+
+/*
+ * raptor_uri_intern_table_add:
+ * @table: interned-URI hash table
+ * @uri: URI to add (uri->hash must be set)
+ *
+ * INTERNAL - Add a URI to the table, growing it as needed
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_uri_intern_table_add(raptor_uri_intern_table* table, raptor_uri* uri)
+{
+  size_t mask;
+  size_t i;
+
+  /* grow at 2/3 load counting tombstones, so probes stay short */
+  if(3 * (table->size + table->deleted + 1) > 2 * table->capacity) {
+    size_t new_capacity = table->capacity;
+    /* only grow if live entries need it; otherwise just drop tombstones */
+    if(3 * (table->size + 1) > table->capacity)
+      new_capacity <<= 1;
+    if(raptor_uri_intern_table_rehash(table, new_capacity))
+      return 1;
+  }
+
+  mask = table->capacity - 1;
+  for(i = uri->hash & mask; ; i = (i + 1) & mask) {
+    if(!table->slots[i] || table->slots[i] == RAPTOR_URI_INTERN_TOMBSTONE) {
+      if(table->slots[i] == RAPTOR_URI_INTERN_TOMBSTONE)
+        table->deleted--;
+      table->slots[i] = uri;
+      table->size++;
+      return 0;
+    }
+  }
+}
+
+
+/*
+ * raptor_uri_intern_table_delete:
+ * @table: interned-URI hash table
+ * @uri: URI to remove
+ *
+ * INTERNAL - Remove a URI from the table, leaving a tombstone
+ */
+static void
+raptor_uri_intern_table_delete(raptor_uri_intern_table* table,
+                               raptor_uri* uri)
+{
+  size_t mask = table->capacity - 1;
+  size_t i;
+
+  for(i = uri->hash & mask; table->slots[i]; i = (i + 1) & mask) {
+    if(table->slots[i] == uri) {
+      table->slots[i] = RAPTOR_URI_INTERN_TOMBSTONE;
+      table->size--;
+      table->deleted++;
+      return;
+    }
+  }
+}
+
+
 /**
  * raptor_new_uri_from_counted_string:
  * @world: raptor_world object
@@ -107,7 +353,8 @@ raptor_new_uri_from_counted_string(raptor_world* world,
 {
   raptor_uri* new_uri;
   unsigned char *new_string;
-  
+  unsigned int hash = 0;
+
   RAPTOR_CHECK_CONSTRUCTOR_WORLD(world);
 
   if(!uri_string || !*uri_string)
@@ -115,29 +362,29 @@ raptor_new_uri_from_counted_string(raptor_world* world,
 
   raptor_world_open(world);
 
-  if(world->uris_tree) {
-    raptor_uri key; /* on stack - not allocated */
+  RAPTOR_WORLD_LOCK(world);
 
-    /* just to be safe */
-    memset(&key, 0, sizeof(key));
+  if(world->uris_table) {
+    hash = raptor_uri_string_hash(uri_string, length);
 
-    key.string = (unsigned char*)uri_string;
-    key.length = (unsigned int)length;
-
-    /* if existing URI found in tree, return it */
-    new_uri = (raptor_uri*)raptor_avltree_search(world->uris_tree, &key);
+    /* if existing URI found in table, return it */
+    new_uri = raptor_uri_intern_table_find(world->uris_table,
+                                           uri_string, length, hash);
     if(new_uri) {
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
       RAPTOR_DEBUG3("Found existing URI %s with current usage %d\n",
                     uri_string, new_uri->usage);
 #endif
-      
+
+      RAPTOR_STATS_INC(uri_intern_hits);
       new_uri->usage++;
-      
+
       goto unlock;
     }
+
+    RAPTOR_STATS_INC(uri_intern_misses);
   }
-  
+
 
   /* otherwise create a new one */
 
@@ -153,6 +400,7 @@ raptor_new_uri_from_counted_string(raptor_world* world,
 
   new_uri->world = world;
   new_uri->length = (unsigned int)length;
+  new_uri->hash = hash;
 
   new_string = RAPTOR_MALLOC(unsigned char*, length + 1);
   if(!new_string) {
@@ -167,9 +415,9 @@ raptor_new_uri_from_counted_string(raptor_world* world,
 
   new_uri->usage = 1; /* for user */
 
-  /* store in tree */
-  if(world->uris_tree) {
-    if(raptor_avltree_add(world->uris_tree, new_uri)) {
+  /* store in table */
+  if(world->uris_table) {
+    if(raptor_uri_intern_table_add(world->uris_table, new_uri)) {
       RAPTOR_FREE(char*, new_string);
       RAPTOR_FREE(raptor_uri, new_uri);
       new_uri = NULL;
@@ -177,6 +425,7 @@ raptor_new_uri_from_counted_string(raptor_world* world,
   }
 
  unlock:
+  RAPTOR_WORLD_UNLOCK(world);
 
   return new_uri;
 }
@@ -207,37 +456,39 @@ raptor_new_uri(raptor_world* world, const unsigned char *uri_string)
 
 
 /**
- * raptor_new_uri_from_uri_local_name:
+ * raptor_new_uri_from_uri_counted_local_name:
  * @world: raptor_world object
  * @uri: existing #raptor_uri
  * @local_name: local name
- * 
- * Constructor - create a raptor URI from an existing URI and a local name.
+ * @local_name_length: length of @local_name
+ *
+ * Constructor - create a raptor URI from an existing URI and a counted local name.
  *
  * Creates a new URI from the concatenation of the @local_name to the
  * @uri.  This is NOT relative URI resolution, which is done by the
  * raptor_new_uri_relative_to_base() constructor.
- * 
+ *
+ * Note: The @local_name need not be NUL terminated.
+ *
  * Return value: a new #raptor_uri object or NULL on failure.
  **/
 raptor_uri*
-raptor_new_uri_from_uri_local_name(raptor_world* world, raptor_uri *uri,
-                                   const unsigned char *local_name)
+raptor_new_uri_from_uri_counted_local_name(raptor_world* world,
+                                           raptor_uri *uri,
+                                           const unsigned char *local_name,
+                                           size_t local_name_length)
 {
   size_t len;
   unsigned char *new_string;
   raptor_uri* new_uri;
-  size_t local_name_length;
 
   RAPTOR_CHECK_CONSTRUCTOR_WORLD(world);
 
-  if(!uri)
+  if(!uri || !local_name)
     return NULL;
-  
+
   raptor_world_open(world);
 
-  local_name_length = strlen((const char*)local_name);
-  
   len = uri->length + local_name_length;
   new_string = RAPTOR_MALLOC(unsigned char*, len + 1);
   if(!new_string)
@@ -245,7 +496,8 @@ raptor_new_uri_from_uri_local_name(raptor_world* world, raptor_uri *uri,
 
   memcpy((char*)new_string, (const char*)uri->string, uri->length);
   memcpy((char*)(new_string + uri->length), (const char*)local_name,
-         local_name_length + 1);
+         local_name_length);
+  new_string[len] = '\0';
 
   new_uri = raptor_new_uri_from_counted_string(world, new_string, len);
   RAPTOR_FREE(char*, new_string);
@@ -254,6 +506,189 @@ raptor_new_uri_from_uri_local_name(raptor_world* world, raptor_uri *uri,
 }
 
 
+/**
+ * raptor_new_uri_from_uri_local_name:
+ * @world: raptor_world object
+ * @uri: existing #raptor_uri
+ * @local_name: local name
+ *
+ * Constructor - create a raptor URI from an existing URI and a local name.
+ *
+ * Creates a new URI from the concatenation of the @local_name to the
+ * @uri.  This is NOT relative URI resolution, which is done by the
+ * raptor_new_uri_relative_to_base() constructor.
+ *
+ * Use raptor_new_uri_from_uri_counted_local_name() if the local name
+ * length is known.
+ *
+ * Return value: a new #raptor_uri object or NULL on failure.
+ **/
+raptor_uri*
+raptor_new_uri_from_uri_local_name(raptor_world* world, raptor_uri *uri,
+                                   const unsigned char *local_name)
+{
+  RAPTOR_CHECK_CONSTRUCTOR_WORLD(world);
+
+  if(!local_name)
+    return NULL;
+
+  return raptor_new_uri_from_uri_counted_local_name(world, uri, local_name,
+                                                    strlen((const char*)local_name));
+}
+
+
+/*
+ * Relative URI resolution cache.
+ *
+ * RDF/XML and Turtle documents resolve thousands of relative
+ * references against the same handful of base URIs; each resolution
+ * re-parses the base into RFC 2396 components.  This direct-mapped
+ * cache memoizes recent (base, reference) pairs per world so repeated
+ * resolutions skip raptor_uri_resolve_uri_reference() entirely.
+ */
+
+/* number of (base, reference) slots; must be a power of two */
+#define RAPTOR_URI_RESOLVE_CACHE_SIZE 64
+
+typedef struct {
+  /* base URI of this entry (owned reference) or NULL if empty */
+  raptor_uri* base_uri;
+  /* owned copy of the relative reference string */
+  unsigned char* reference;
+  size_t reference_len;
+  /* result of the resolution (owned reference) */
+  raptor_uri* resolved_uri;
+} raptor_uri_resolve_cache_entry;
+
+struct raptor_uri_resolve_cache_s {
+  raptor_uri_resolve_cache_entry entries[RAPTOR_URI_RESOLVE_CACHE_SIZE];
+};
+typedef struct raptor_uri_resolve_cache_s raptor_uri_resolve_cache;
+
+
+/*
+ * raptor_uri_resolve_cache_entry_clear:
+ * @entry: cache entry
+ *
+ * INTERNAL - Release the content of a resolution cache entry.
+ */
+static void
+raptor_uri_resolve_cache_entry_clear(raptor_uri_resolve_cache_entry* entry)
+{
+  if(!entry->base_uri)
+    return;
+
+  raptor_free_uri(entry->base_uri);
+  RAPTOR_FREE(char*, entry->reference);
+  raptor_free_uri(entry->resolved_uri);
+  entry->base_uri = NULL;
+}
+
+
+/*
+ * raptor_uri_resolve_cache_slot:
+ * @cache: resolution cache
+ * @base_uri: base URI
+ * @uri_string: relative reference
+ * @uri_len: length of @uri_string
+ *
+ * INTERNAL - Map a (base, reference) pair to its cache slot.
+ *
+ * Return value: cache entry for the pair (which may hold other content)
+ */
+static raptor_uri_resolve_cache_entry*
+raptor_uri_resolve_cache_slot(raptor_uri_resolve_cache* cache,
+                              raptor_uri* base_uri,
+                              const unsigned char *uri_string, size_t uri_len)
+{
+  unsigned int hash = base_uri->hash;
+
+  while(uri_len--)
+    hash = ((hash << 5) + hash) + *uri_string++;
+
+  return &cache->entries[hash & (RAPTOR_URI_RESOLVE_CACHE_SIZE - 1)];
+}
+
+
+/*
+ * Relative URI generation cache - the reverse of the resolution cache
+ * above.
+ *
+ * Serializers with RAPTOR_OPTION_RELATIVE_URIS on call
+ * raptor_uri_to_relative_counted_uri_string() for every URI emitted,
+ * re-splitting the (rarely changing) base URI and re-walking the
+ * common path prefix each time.  This direct-mapped cache memoizes
+ * recent (base, reference) to relative-string results per world and
+ * keeps the decomposed form of the last base URI.
+ */
+
+/* number of (base, reference) slots; must be a power of two */
+#define RAPTOR_URI_RELATIVE_CACHE_SIZE 64
+
+typedef struct {
+  /* base URI of this entry (owned reference) or NULL if empty */
+  raptor_uri* base_uri;
+  /* reference URI of this entry (owned reference) */
+  raptor_uri* reference_uri;
+  /* owned copy of the relative URI string result */
+  unsigned char* relative;
+  size_t relative_len;
+} raptor_uri_relative_cache_entry;
+
+struct raptor_uri_relative_cache_s {
+  raptor_uri_relative_cache_entry entries[RAPTOR_URI_RELATIVE_CACHE_SIZE];
+
+  /* decomposed form of the last base URI seen (owned; consulted only
+   * by single threaded worlds - the borrowed detail cannot be
+   * protected across a computation) */
+  raptor_uri* detail_base_uri;
+  raptor_uri_detail* detail;
+};
+typedef struct raptor_uri_relative_cache_s raptor_uri_relative_cache;
+
+
+/*
+ * raptor_uri_relative_cache_entry_clear:
+ * @entry: cache entry
+ *
+ * INTERNAL - Release the content of a relative generation cache entry.
+ */
+static void
+raptor_uri_relative_cache_entry_clear(raptor_uri_relative_cache_entry* entry)
+{
+  if(!entry->base_uri)
+    return;
+
+  raptor_free_uri(entry->base_uri);
+  raptor_free_uri(entry->reference_uri);
+  RAPTOR_FREE(char*, entry->relative);
+  entry->base_uri = NULL;
+}
+
+
+/*
+ * raptor_uri_relative_cache_slot:
+ * @cache: relative generation cache
+ * @base_uri: base URI
+ * @reference_uri: reference URI
+ *
+ * INTERNAL - Map a (base, reference) pair to its cache slot.
+ *
+ * Return value: cache entry for the pair (which may hold other content)
+ */
+static raptor_uri_relative_cache_entry*
+raptor_uri_relative_cache_slot(raptor_uri_relative_cache* cache,
+                               raptor_uri* base_uri,
+                               raptor_uri* reference_uri)
+{
+  unsigned int hash;
+
+  hash = ((base_uri->hash << 5) + base_uri->hash) ^ reference_uri->hash;
+
+  return &cache->entries[hash & (RAPTOR_URI_RELATIVE_CACHE_SIZE - 1)];
+}
+
+
 /**
  * raptor_new_uri_relative_to_base_counted:
  * @world: raptor_world object
@@ -275,6 +710,7 @@ raptor_new_uri_relative_to_base_counted(raptor_world* world,
   size_t buffer_length;
   raptor_uri* new_uri;
   size_t actual_length;
+  raptor_uri_resolve_cache_entry* entry;
   
   RAPTOR_CHECK_CONSTRUCTOR_WORLD(world);
 
@@ -289,7 +725,25 @@ raptor_new_uri_relative_to_base_counted(raptor_world* world,
   /* If URI string is empty, just copy base URI */
   if(!*uri_string)
     return raptor_uri_copy(base_uri);
-  
+
+  if(world->uri_resolve_cache) {
+    raptor_uri* cached_uri = NULL;
+
+    RAPTOR_WORLD_LOCK(world);
+    entry = raptor_uri_resolve_cache_slot(world->uri_resolve_cache,
+                                          base_uri, uri_string, uri_len);
+    if(entry->base_uri &&
+       raptor_uri_equals(entry->base_uri, base_uri) &&
+       entry->reference_len == uri_len &&
+       !memcmp(entry->reference, uri_string, uri_len))
+      cached_uri = raptor_uri_copy(entry->resolved_uri);
+    RAPTOR_WORLD_UNLOCK(world);
+
+    if(cached_uri)
+      return cached_uri;
+  } else
+    entry = NULL;
+
   /* +1 for adding any missing URI path '/' */
   buffer_length = base_uri->length + uri_len + 1;
   buffer = RAPTOR_MALLOC(unsigned char*, buffer_length + 1);
@@ -301,6 +755,25 @@ raptor_new_uri_relative_to_base_counted(raptor_world* world,
 
   new_uri = raptor_new_uri_from_counted_string(world, buffer, actual_length);
   RAPTOR_FREE(char*, buffer);
+
+  if(entry && new_uri) {
+    unsigned char* reference_copy;
+
+    reference_copy = RAPTOR_MALLOC(unsigned char*, uri_len + 1);
+    if(reference_copy) {
+      memcpy(reference_copy, uri_string, uri_len);
+      reference_copy[uri_len] = '\0';
+
+      RAPTOR_WORLD_LOCK(world);
+      raptor_uri_resolve_cache_entry_clear(entry);
+      entry->base_uri = raptor_uri_copy(base_uri);
+      entry->reference = reference_copy;
+      entry->reference_len = uri_len;
+      entry->resolved_uri = raptor_uri_copy(new_uri);
+      RAPTOR_WORLD_UNLOCK(world);
+    }
+  }
+
   return new_uri;
 }
 
@@ -484,23 +957,31 @@ raptor_free_uri(raptor_uri *uri)
   if(!uri)
     return;
 
+  RAPTOR_WORLD_LOCK(uri->world);
+
   uri->usage--;
-  
+
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
   RAPTOR_DEBUG3("URI %s usage count now %d\n", uri->string, uri->usage);
 #endif
 
   /* decrement usage, don't free if not 0 yet*/
   if(uri->usage > 0) {
+    RAPTOR_WORLD_UNLOCK(uri->world);
     return;
   }
 
-  /* this does not free the uri */
-  if(uri->world->uris_tree)
-    raptor_avltree_delete(uri->world->uris_tree, uri);
+  /* this does not free the uri; once deleted from the table no other
+   * thread can reach it so it is safe to free after unlocking */
+  if(uri->world->uris_table)
+    raptor_uri_intern_table_delete(uri->world->uris_table, uri);
+
+  RAPTOR_WORLD_UNLOCK(uri->world);
 
   if(uri->string)
     RAPTOR_FREE(char*, uri->string);
+  if(uri->escaped_string)
+    RAPTOR_FREE(char*, uri->escaped_string);
   RAPTOR_FREE(raptor_uri, uri);
 }
 
@@ -539,6 +1020,37 @@ raptor_uri_equals(raptor_uri* uri1, raptor_uri* uri2)
 }
 
 
+/**
+ * raptor_uri_get_xsd_datatype:
+ * @uri: #raptor_uri object (or NULL)
+ *
+ * Identify which common XSD datatype a URI names.
+ *
+ * Compares against the pre-built datatype URIs in the world, so with
+ * URI interning (the default) each candidate is rejected by a pointer
+ * or length comparison rather than a string compare.
+ *
+ * Return value: the datatype or RAPTOR_XSD_DATATYPE_NONE
+ */
+raptor_xsd_datatype
+raptor_uri_get_xsd_datatype(raptor_uri* uri)
+{
+  raptor_world* world;
+  int i;
+
+  if(!uri)
+    return RAPTOR_XSD_DATATYPE_NONE;
+
+  world = uri->world;
+  for(i = RAPTOR_XSD_DATATYPE_NONE + 1; i <= RAPTOR_XSD_DATATYPE_LAST; i++) {
+    if(raptor_uri_equals(uri, world->xsd_datatype_uris[i]))
+      return (raptor_xsd_datatype)i;
+  }
+
+  return RAPTOR_XSD_DATATYPE_NONE;
+}
+
+
 /**
  * raptor_uri_compare:
  * @uri1: URI 1 (may be NULL)
@@ -587,8 +1099,10 @@ raptor_uri*
 raptor_uri_copy(raptor_uri *uri) 
 {
   RAPTOR_ASSERT_OBJECT_POINTER_RETURN_VALUE(uri, raptor_uri, NULL);
-  
+
+  RAPTOR_WORLD_LOCK(uri->world);
   uri->usage++;
+  RAPTOR_WORLD_UNLOCK(uri->world);
   return uri;
 }
 
@@ -1171,20 +1685,27 @@ raptor_new_uri_for_retrieval(raptor_uri* old_uri)
 int
 raptor_uri_init(raptor_world* world)
 {
-  if(world->uri_interning && !world->uris_tree) {
-    world->uris_tree = raptor_new_avltree((raptor_data_compare_handler)raptor_uri_compare,
-                                          /* free */ NULL, 0);
-    if(!world->uris_tree) {
+  if(world->uri_interning && !world->uris_table) {
+    world->uris_table = raptor_new_uri_intern_table(RAPTOR_URI_INTERN_INITIAL_CAPACITY);
+    if(!world->uris_table) {
 #ifdef RAPTOR_DEBUG
-      RAPTOR_FATAL1("Failed to create raptor URI avltree");
+      RAPTOR_FATAL1("Failed to create raptor URI hash table");
 #else
       raptor_log_error(world, RAPTOR_LOG_LEVEL_ERROR, NULL,
-                       "Failed to create raptor URI avltree");
+                       "Failed to create raptor URI hash table");
 #endif
     }
-    
+
   }
 
+  if(!world->uri_resolve_cache)
+    world->uri_resolve_cache = RAPTOR_CALLOC(raptor_uri_resolve_cache*, 1,
+                                             sizeof(raptor_uri_resolve_cache));
+
+  if(!world->uri_relative_cache)
+    world->uri_relative_cache = RAPTOR_CALLOC(raptor_uri_relative_cache*, 1,
+                                              sizeof(raptor_uri_relative_cache));
+
   return 0;
 }
 
@@ -1192,9 +1713,34 @@ raptor_uri_init(raptor_world* world)
 void
 raptor_uri_finish(raptor_world* world)
 {
-  if(world->uris_tree) {
-    raptor_free_avltree(world->uris_tree);
-    world->uris_tree = NULL;
+  if(world->uri_resolve_cache) {
+    int i;
+
+    for(i = 0; i < RAPTOR_URI_RESOLVE_CACHE_SIZE; i++)
+      raptor_uri_resolve_cache_entry_clear(&world->uri_resolve_cache->entries[i]);
+
+    RAPTOR_FREE(raptor_uri_resolve_cache*, world->uri_resolve_cache);
+    world->uri_resolve_cache = NULL;
+  }
+
+  if(world->uri_relative_cache) {
+    int i;
+
+    for(i = 0; i < RAPTOR_URI_RELATIVE_CACHE_SIZE; i++)
+      raptor_uri_relative_cache_entry_clear(&world->uri_relative_cache->entries[i]);
+
+    if(world->uri_relative_cache->detail_base_uri) {
+      raptor_free_uri(world->uri_relative_cache->detail_base_uri);
+      raptor_free_uri_detail(world->uri_relative_cache->detail);
+    }
+
+    RAPTOR_FREE(raptor_uri_relative_cache*, world->uri_relative_cache);
+    world->uri_relative_cache = NULL;
+  }
+
+  if(world->uris_table) {
+    raptor_free_uri_intern_table(world->uris_table);
+    world->uris_table = NULL;
   }
 }
 
@@ -1364,26 +1910,85 @@ raptor_uri_to_relative_counted_uri_string(raptor_uri *base_uri,
   size_t base_len, reference_len, reference_file_len, suffix_len;
   unsigned char *result = NULL;
   int suffix_is_result = 0;
-  
+  raptor_world* world = NULL;
+  raptor_uri_relative_cache* cache = NULL;
+  raptor_uri_relative_cache_entry* entry = NULL;
+  int base_detail_is_cached = 0;
+
   if(!reference_uri)
     return NULL;
-    
+
   if(length_p)
     *length_p=0;
 
+  if(base_uri) {
+    world = base_uri->world;
+    cache = world->uri_relative_cache;
+  }
+
+  if(cache) {
+    unsigned char* cached_result = NULL;
+    size_t cached_len = 0;
+
+    RAPTOR_WORLD_LOCK(world);
+    entry = raptor_uri_relative_cache_slot(cache, base_uri, reference_uri);
+    if(entry->base_uri &&
+       raptor_uri_equals(entry->base_uri, base_uri) &&
+       raptor_uri_equals(entry->reference_uri, reference_uri)) {
+      cached_result = RAPTOR_MALLOC(unsigned char*, entry->relative_len + 1);
+      if(cached_result) {
+        memcpy(cached_result, entry->relative, entry->relative_len + 1);
+        cached_len = entry->relative_len;
+      }
+    }
+    RAPTOR_WORLD_UNLOCK(world);
+
+    if(cached_result) {
+      if(length_p)
+        *length_p = cached_len;
+      return cached_result;
+    }
+  }
+
   reference_str = raptor_uri_as_counted_string(reference_uri, &reference_len);
   reference_detail = raptor_new_uri_detail(reference_str);
   if(!reference_detail)
     goto err;
-  
+
   if(!base_uri)
     goto buildresult;
-  
+
   base = raptor_uri_as_counted_string(base_uri, &base_len);
-  base_detail = raptor_new_uri_detail(base);
-  if(!base_detail)
-    goto err;
-  
+
+  /* Reuse the decomposed form of the base URI from the last call when
+   * it is unchanged (single threaded worlds only: the borrowed detail
+   * cannot be protected across the computation below)
+   */
+  if(cache && !world->thread_safe && cache->detail_base_uri &&
+     raptor_uri_equals(cache->detail_base_uri, base_uri)) {
+    base_detail = cache->detail;
+    base_detail_is_cached = 1;
+  }
+
+  if(!base_detail) {
+    base_detail = raptor_new_uri_detail(base);
+    if(!base_detail)
+      goto err;
+
+    if(cache && !world->thread_safe) {
+      if(cache->detail_base_uri) {
+        raptor_free_uri(cache->detail_base_uri);
+        raptor_free_uri_detail(cache->detail);
+      }
+      cache->detail_base_uri = raptor_uri_copy(base_uri);
+      if(cache->detail_base_uri) {
+        cache->detail = base_detail;
+        base_detail_is_cached = 1;
+      } else
+        cache->detail = NULL;
+    }
+  }
+
   /* Check if the whole URIs are equal */
   if(raptor_uri_equals(base_uri, reference_uri)) {
     reference_len = 0;
@@ -1510,10 +2115,43 @@ raptor_uri_to_relative_counted_uri_string(raptor_uri *base_uri,
   }
   
   err:
-  if(base_detail)
+  if(base_detail && !base_detail_is_cached)
     raptor_free_uri_detail(base_detail);
   raptor_free_uri_detail(reference_detail);
-  
+
+  if(entry && result) {
+    size_t result_len = length_p ? *length_p :
+                        strlen(RAPTOR_GOOD_CAST(const char*, result));
+    unsigned char* relative_copy;
+
+    relative_copy = RAPTOR_MALLOC(unsigned char*, result_len + 1);
+    if(relative_copy) {
+      raptor_uri* base_copy;
+      raptor_uri* reference_copy;
+
+      memcpy(relative_copy, result, result_len + 1);
+
+      base_copy = raptor_uri_copy(base_uri);
+      reference_copy = raptor_uri_copy(reference_uri);
+
+      if(base_copy && reference_copy) {
+        RAPTOR_WORLD_LOCK(world);
+        raptor_uri_relative_cache_entry_clear(entry);
+        entry->base_uri = base_copy;
+        entry->reference_uri = reference_copy;
+        entry->relative = relative_copy;
+        entry->relative_len = result_len;
+        RAPTOR_WORLD_UNLOCK(world);
+      } else {
+        if(base_copy)
+          raptor_free_uri(base_copy);
+        if(reference_copy)
+          raptor_free_uri(reference_copy);
+        RAPTOR_FREE(char*, relative_copy);
+      }
+    }
+  }
+
   return result;
 }
 
@@ -1745,7 +2383,74 @@ raptor_uri_escaped_write(raptor_uri* uri,
 
   if(!uri)
     return 1;
-  
+
+  if(!base_uri) {
+    /* Serializers stringify the same interned URIs over and over;
+     * keep the complete "<...>" rendering from the first escape flags
+     * seen and replay it with a single write.  A URI written with
+     * different flags later just takes the uncached path below */
+    if(!uri->escaped_string) {
+      unsigned char clean[256];
+      size_t i;
+      void* escaped = NULL;
+      size_t escaped_len = 0;
+
+      uri_str = raptor_uri_as_counted_string(uri, &len);
+
+      raptor_escaped_write_fill_clean_table(clean, '>', flags);
+      for(i = 0; i < len; i++) {
+        if(!clean[uri_str[i]])
+          break;
+      }
+
+      if(i == len) {
+        /* nothing needs escaping - the common case */
+        escaped = RAPTOR_MALLOC(unsigned char*, len + 3);
+        if(escaped) {
+          unsigned char* p = (unsigned char*)escaped;
+          p[0] = '<';
+          if(len)
+            memcpy(p + 1, uri_str, len);
+          p[len + 1] = '>';
+          p[len + 2] = '\0';
+          escaped_len = len + 2;
+        }
+      } else {
+        raptor_iostream* escaped_iostr;
+
+        escaped_iostr = raptor_new_iostream_to_string(uri->world, &escaped,
+                                                      &escaped_len, NULL);
+        if(escaped_iostr) {
+          raptor_iostream_write_byte('<', escaped_iostr);
+          raptor_string_escaped_write(uri_str, len, '>', flags,
+                                      escaped_iostr);
+          raptor_iostream_write_byte('>', escaped_iostr);
+          raptor_free_iostream(escaped_iostr);
+        }
+      }
+
+      if(escaped) {
+        RAPTOR_WORLD_LOCK(uri->world);
+        if(!uri->escaped_string) {
+          uri->escaped_string = (unsigned char*)escaped;
+          uri->escaped_string_len = escaped_len;
+          uri->escaped_string_flags = flags;
+          escaped = NULL;
+        }
+        RAPTOR_WORLD_UNLOCK(uri->world);
+
+        if(escaped)
+          RAPTOR_FREE(char*, escaped);
+      }
+    }
+
+    if(uri->escaped_string && uri->escaped_string_flags == flags) {
+      raptor_iostream_write_bytes(uri->escaped_string, 1,
+                                  uri->escaped_string_len, iostr);
+      return 0;
+    }
+  }
+
   raptor_iostream_write_byte('<', iostr);
   if(base_uri) {
     uri_str = raptor_uri_to_relative_counted_uri_string(base_uri, uri, &len);
@@ -70,6 +70,11 @@ raptor_www_init(raptor_world* world)
 #endif
   }
 
+#ifdef RAPTOR_WWW_LIBCURL
+  if(!rc)
+    rc = raptor_www_curl_world_init(world);
+#endif
+
   world->www_initialized = 1;
   return rc;
 }
@@ -87,6 +92,10 @@ raptor_www_init(raptor_world* world)
 void
 raptor_www_finish(raptor_world* world)
 {
+#ifdef RAPTOR_WWW_LIBCURL
+  raptor_www_curl_world_finish(world);
+#endif
+
   if(!world->www_skip_www_init_finish) {
 #ifdef RAPTOR_WWW_LIBCURL
     curl_global_cleanup();
@@ -126,6 +135,7 @@ raptor_new_www_with_connection(raptor_world* world, void *connection)
   www->type = NULL;
   www->free_type = 1; /* default is to free content type */
   www->total_bytes = 0;
+  www->content_length = 0;
   www->failed = 0;
   www->status_code = 0;
   www->write_bytes = NULL;
@@ -233,6 +243,11 @@ raptor_free_www(raptor_www* www)
  * 
  * Set the handler to receive bytes written by the #raptor_www implementation.
  *
+ * The bytes passed to the handler are handed over directly from the
+ * underlying retrieval library with no intermediate copy; the pointer
+ * is only valid for the duration of the handler call and the handler
+ * must copy anything it needs to keep.
+ *
  **/
 void
 raptor_www_set_write_bytes_handler(raptor_www* www, 
@@ -578,19 +593,32 @@ raptor_www_error(raptor_www* www, const char *message, ...)
 static int 
 raptor_www_file_handle_fetch(raptor_www* www, FILE* fh) 
 {
+  char* buffer;
+  size_t buffer_size = RAPTOR_WWW_READ_BUFFER_SIZE;
+
+  /* read in large chunks; fall back to the small inline buffer */
+  buffer = RAPTOR_MALLOC(char*, buffer_size + 1);
+  if(!buffer) {
+    buffer = www->buffer;
+    buffer_size = RAPTOR_WWW_BUFFER_SIZE;
+  }
+
   while(!feof(fh)) {
-    size_t len = fread(www->buffer, 1, RAPTOR_WWW_BUFFER_SIZE, fh);
+    size_t len = fread(buffer, 1, buffer_size, fh);
     if(len > 0) {
       www->total_bytes += len;
-      www->buffer[len]='\0';
+      buffer[len]='\0';
       
       if(www->write_bytes)
-        www->write_bytes(www, www->write_bytes_userdata, www->buffer, len, 1);
+        www->write_bytes(www, www->write_bytes_userdata, buffer, len, 1);
     }
 
     if(feof(fh) || www->failed)
       break;
   }
+
+  if(buffer != www->buffer)
+    RAPTOR_FREE(char*, buffer);
   
   if(!www->failed)
     www->status_code = 200;
@@ -618,11 +646,15 @@ raptor_www_file_fetch(raptor_www* www)
   }
 
 #if defined(HAVE_UNISTD_H) && defined(HAVE_SYS_STAT_H)
-  if(!stat(filename, &buf) && S_ISDIR(buf.st_mode)) {
-    raptor_www_error(www, "Cannot read from a directory '%s'", filename);
-    RAPTOR_FREE(char*, filename);
-    www->status_code = 404;
-    return 1;
+  if(!stat(filename, &buf)) {
+    if(S_ISDIR(buf.st_mode)) {
+      raptor_www_error(www, "Cannot read from a directory '%s'", filename);
+      RAPTOR_FREE(char*, filename);
+      www->status_code = 404;
+      return 1;
+    }
+    if(S_ISREG(buf.st_mode))
+      www->content_length = (size_t)buf.st_size;
   }
 #endif
 
@@ -662,6 +694,8 @@ raptor_www_fetch(raptor_www *www, raptor_uri *uri)
   
   www->uri = raptor_new_uri_for_retrieval(uri);
   
+  www->content_length = 0;
+
   www->locator.uri = uri;
   www->locator.line= -1;
   www->locator.column= -1;
@@ -705,15 +739,53 @@ raptor_www_fetch(raptor_www *www, raptor_uri *uri)
 }
 
 
+typedef struct
+{
+  char* buffer;
+  size_t length;
+  size_t capacity;
+  int failed;
+} raptor_www_fetch_to_string_context;
+
+
 static void
 raptor_www_fetch_to_string_write_bytes(raptor_www* www, void *userdata,
                                        const void *ptr, size_t size,
                                        size_t nmemb)
 {
-  raptor_stringbuffer* sb = (raptor_stringbuffer*)userdata;
+  raptor_www_fetch_to_string_context* fc;
   size_t len = size * nmemb;
 
-  raptor_stringbuffer_append_counted_string(sb, (unsigned char*)ptr, len, 1);
+  fc = (raptor_www_fetch_to_string_context*)userdata;
+
+  if(fc->failed || !len)
+    return;
+
+  if(fc->length + len > fc->capacity) {
+    size_t new_capacity = fc->capacity;
+    char* new_buffer;
+
+    if(!new_capacity) {
+      /* size the buffer in one shot from the Content-Length header
+       * (or file size) when the retrieval reported one */
+      new_capacity = www->content_length;
+      if(new_capacity < RAPTOR_WWW_BUFFER_SIZE)
+        new_capacity = RAPTOR_WWW_BUFFER_SIZE;
+    }
+    while(new_capacity < fc->length + len)
+      new_capacity += new_capacity;
+
+    new_buffer = RAPTOR_REALLOC(char*, fc->buffer, new_capacity);
+    if(!new_buffer) {
+      fc->failed = 1;
+      return;
+    }
+    fc->buffer = new_buffer;
+    fc->capacity = new_capacity;
+  }
+
+  memcpy(fc->buffer + fc->length, ptr, len);
+  fc->length += len;
 }
 
 
@@ -739,30 +811,32 @@ raptor_www_fetch_to_string(raptor_www *www, raptor_uri *uri,
                            void **string_p, size_t *length_p,
                            raptor_data_malloc_handler const malloc_handler)
 {
-  raptor_stringbuffer *sb = NULL;
+  raptor_www_fetch_to_string_context fc;
   void *str = NULL;
   raptor_www_write_bytes_handler saved_write_bytes;
   void *saved_write_bytes_userdata;
-  
-  sb = raptor_new_stringbuffer();
-  if(!sb)
-    return 1;
+
+  fc.buffer = NULL;
+  fc.length = 0;
+  fc.capacity = 0;
+  fc.failed = 0;
 
   if(length_p)
     *length_p=0;
 
   saved_write_bytes = www->write_bytes;
   saved_write_bytes_userdata = www->write_bytes_userdata;
-  raptor_www_set_write_bytes_handler(www, raptor_www_fetch_to_string_write_bytes, sb);
+  raptor_www_set_write_bytes_handler(www, raptor_www_fetch_to_string_write_bytes, &fc);
 
-  if(raptor_www_fetch(www, uri))
+  if(raptor_www_fetch(www, uri) || fc.failed)
     str = NULL;
   else {
-    size_t len = raptor_stringbuffer_length(sb);
+    size_t len = fc.length;
     if(len) {
       str = (void*)malloc_handler(len+1);
       if(str) {
-        raptor_stringbuffer_copy_to_string(sb, (unsigned char*)str, len+1);
+        memcpy(str, fc.buffer, len);
+        ((char*)str)[len] = '\0';
         *string_p=str;
         if(length_p)
           *length_p=len;
@@ -770,8 +844,8 @@ raptor_www_fetch_to_string(raptor_www *www, raptor_uri *uri,
     }
   }
 
-  if(sb)
-    raptor_free_stringbuffer(sb);
+  if(fc.buffer)
+    RAPTOR_FREE(char*, fc.buffer);
 
   raptor_www_set_write_bytes_handler(www, saved_write_bytes, saved_write_bytes_userdata);
 
@@ -816,3 +890,230 @@ raptor_www_set_final_uri_handler(raptor_www* www,
   www->final_uri_handler = handler;
   www->final_uri_userdata = user_data;
 }
+
+
+/*
+ * WWW fetch groups.
+ *
+ * A group runs several WWW retrievals in one call, concurrently via
+ * curl_multi when raptor is built with libcurl and sequentially
+ * otherwise.  Each member #raptor_www keeps its own handlers which
+ * are invoked on the calling thread as data arrives.
+ */
+
+/* one pending retrieval in a group */
+typedef struct {
+  raptor_www* www;
+  raptor_uri* uri;
+} raptor_www_group_entry;
+
+struct raptor_www_group_s {
+  raptor_world* world;
+  /* sequence of #raptor_www_group_entry */
+  raptor_sequence* entries;
+};
+
+
+static void
+raptor_free_www_group_entry(void* data)
+{
+  raptor_www_group_entry* entry = (raptor_www_group_entry*)data;
+
+  raptor_free_uri(entry->uri);
+  RAPTOR_FREE(raptor_www_group_entry*, entry);
+}
+
+
+/**
+ * raptor_new_www_group:
+ * @world: raptor_world object
+ *
+ * Constructor - create a new #raptor_www_group object.
+ *
+ * A group performs multiple WWW retrievals in one call to
+ * raptor_www_group_fetch(), concurrently when the WWW implementation
+ * supports it (libcurl).
+ *
+ * Return value: a new #raptor_www_group or NULL on failure.
+ **/
+raptor_www_group*
+raptor_new_www_group(raptor_world* world)
+{
+  raptor_www_group* group;
+
+  RAPTOR_CHECK_CONSTRUCTOR_WORLD(world);
+
+  raptor_world_open(world);
+
+  group = RAPTOR_CALLOC(raptor_www_group*, 1, sizeof(*group));
+  if(!group)
+    return NULL;
+
+  group->world = world;
+  group->entries = raptor_new_sequence(raptor_free_www_group_entry, NULL);
+  if(!group->entries) {
+    RAPTOR_FREE(raptor_www_group*, group);
+    return NULL;
+  }
+
+  return group;
+}
+
+
+/**
+ * raptor_free_www_group:
+ * @group: WWW group object
+ *
+ * Destructor - destroy a #raptor_www_group object.
+ *
+ * The member #raptor_www objects are owned by the caller and are not
+ * destroyed.
+ **/
+void
+raptor_free_www_group(raptor_www_group* group)
+{
+  if(!group)
+    return;
+
+  if(group->entries)
+    raptor_free_sequence(group->entries);
+  RAPTOR_FREE(raptor_www_group*, group);
+}
+
+
+/**
+ * raptor_www_group_add:
+ * @group: WWW group object
+ * @www: WWW object to retrieve with
+ * @uri: URI to read from
+ *
+ * Add a retrieval to a WWW group.
+ *
+ * The @www object must remain valid until raptor_www_group_fetch()
+ * returns and must not be used for other retrievals while queued.
+ *
+ * Return value: non-0 on failure
+ **/
+int
+raptor_www_group_add(raptor_www_group* group, raptor_www* www,
+                     raptor_uri* uri)
+{
+  raptor_www_group_entry* entry;
+
+  if(!group || !www || !uri)
+    return 1;
+
+  entry = RAPTOR_MALLOC(raptor_www_group_entry*, sizeof(*entry));
+  if(!entry)
+    return 1;
+
+  entry->www = www;
+  entry->uri = raptor_uri_copy(uri);
+
+  if(raptor_sequence_push(group->entries, entry))
+    return 1;
+
+  return 0;
+}
+
+
+/**
+ * raptor_www_group_fetch:
+ * @group: WWW group object
+ *
+ * Perform all queued retrievals in a WWW group.
+ *
+ * With libcurl the transfers run concurrently on the calling thread
+ * and each member's write bytes and other handlers are invoked as
+ * data arrives on any of the transfers; the order in which handlers
+ * of different members fire is therefore unspecified.  Without
+ * libcurl the retrievals happen sequentially.
+ *
+ * The queued retrievals remain in the group afterwards; the per
+ * member outcome is available via the usual #raptor_www status.
+ *
+ * Return value: non-0 if any retrieval failed
+ **/
+int
+raptor_www_group_fetch(raptor_www_group* group)
+{
+  int count;
+  int status = 0;
+  int i;
+#ifdef RAPTOR_WWW_LIBCURL
+  raptor_www** concurrent = NULL;
+  int concurrent_count = 0;
+#endif
+
+  if(!group)
+    return 1;
+
+  count = raptor_sequence_size(group->entries);
+  if(!count)
+    return 0;
+
+#ifdef RAPTOR_WWW_LIBCURL
+  concurrent = RAPTOR_CALLOC(raptor_www**, count, sizeof(raptor_www*));
+  if(!concurrent)
+    return 1;
+
+  for(i = 0; i < count; i++) {
+    raptor_www_group_entry* entry;
+    raptor_www* www;
+
+    entry = (raptor_www_group_entry*)raptor_sequence_get_at(group->entries, i);
+    www = entry->www;
+
+    www->uri = raptor_new_uri_for_retrieval(entry->uri);
+
+    www->content_length = 0;
+
+    www->locator.uri = entry->uri;
+    www->locator.line = -1;
+    www->locator.column = -1;
+
+    if(www->uri_filter) {
+      int rc = www->uri_filter(www->uri_filter_user_data, entry->uri);
+      if(rc) {
+        www->failed = 1;
+        status = 1;
+        continue;
+      }
+    }
+
+    /* local files gain nothing from the multi handle */
+    if(raptor_uri_uri_string_is_file_uri(raptor_uri_as_string(www->uri))) {
+      if(raptor_www_file_fetch(www))
+        status = 1;
+    } else
+      concurrent[concurrent_count++] = www;
+  }
+
+  if(concurrent_count &&
+     raptor_www_curl_multi_fetch(concurrent, concurrent_count))
+    status = 1;
+
+  for(i = 0; i < concurrent_count; i++) {
+    raptor_www* www = concurrent[i];
+
+    if(!www->failed && www->status_code && www->status_code != 200) {
+      raptor_www_error(www, "Resolving URI failed with HTTP status %d",
+                       www->status_code);
+      www->failed = 1;
+      status = 1;
+    }
+  }
+
+  RAPTOR_FREE(raptor_www**, concurrent);
+#else
+  for(i = 0; i < count; i++) {
+    raptor_www_group_entry* entry;
+
+    entry = (raptor_www_group_entry*)raptor_sequence_get_at(group->entries, i);
+    if(raptor_www_fetch(entry->www, entry->uri))
+      status = 1;
+  }
+#endif
+
+  return status;
+}
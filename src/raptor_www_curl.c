@@ -87,6 +87,9 @@ raptor_www_curl_write_callback(void *ptr, size_t size, size_t nmemb, void *userd
   RAPTOR_DEBUG2("Got %d bytes\n", bytes);
 #endif
 
+  /* hand curl's buffer straight to the handler with no copy; it is
+   * only valid until this callback returns
+   */
   if(www->write_bytes)
     www->write_bytes(www, www->write_bytes_userdata, ptr, size, nmemb);
   www->total_bytes += bytes;
@@ -127,6 +130,22 @@ raptor_www_curl_header_callback(void* ptr,  size_t  size, size_t nmemb,
   }
   
 
+#define CONTENT_LENGTH_LEN 16
+  if(!raptor_strncasecmp((char*)ptr, "Content-Length: ", CONTENT_LENGTH_LEN)) {
+    size_t content_length = 0;
+    char* p = (char*)ptr + CONTENT_LENGTH_LEN;
+    char* end = (char*)ptr + bytes;
+
+    while(p < end && *p >= '0' && *p <= '9')
+      content_length = content_length * 10 + (size_t)(*p++ - '0');
+    www->content_length = content_length;
+
+#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 2
+    RAPTOR_DEBUG2("Got content length header %d\n", (int)content_length);
+#endif
+  }
+
+
 #define CONTENT_LOCATION_LEN 18
   if(!raptor_strncasecmp((char*)ptr, "Content-Location: ", 
                          CONTENT_LOCATION_LEN)) {
@@ -157,11 +176,171 @@ raptor_www_curl_header_callback(void* ptr,  size_t  size, size_t nmemb,
 }
 
 
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+
+static void
+raptor_www_curl_share_lock(CURL* handle, curl_lock_data data,
+                           curl_lock_access access, void* userptr)
+{
+  pthread_mutex_t* locks = (pthread_mutex_t*)userptr;
+
+  pthread_mutex_lock(&locks[data]);
+}
+
+
+static void
+raptor_www_curl_share_unlock(CURL* handle, curl_lock_data data,
+                             void* userptr)
+{
+  pthread_mutex_t* locks = (pthread_mutex_t*)userptr;
+
+  pthread_mutex_unlock(&locks[data]);
+}
+#endif /* HAVE_PTHREAD_H */
+
+
+/*
+ * raptor_www_curl_world_init:
+ * @world: raptor_world object
+ *
+ * INTERNAL - Initialise world-level curl connection sharing.
+ *
+ * Creates the share handle that passes DNS results and TLS session
+ * data between fetches of the same world.  The handle pool itself
+ * starts empty and is filled as fetches complete.
+ *
+ * Return value: non-0 on failure
+ */
+int
+raptor_www_curl_world_init(raptor_world* world)
+{
+  world->curl_share = curl_share_init();
+  if(!world->curl_share)
+    return 1;
+
+#ifdef HAVE_PTHREAD_H
+  {
+    pthread_mutex_t* locks;
+    int i;
+
+    locks = RAPTOR_CALLOC(pthread_mutex_t*, CURL_LOCK_DATA_LAST,
+                          sizeof(*locks));
+    if(!locks) {
+      curl_share_cleanup(world->curl_share);
+      world->curl_share = NULL;
+      return 1;
+    }
+    for(i = 0; i < CURL_LOCK_DATA_LAST; i++)
+      pthread_mutex_init(&locks[i], NULL);
+
+    world->curl_share_locks = locks;
+    curl_share_setopt(world->curl_share, CURLSHOPT_LOCKFUNC,
+                      raptor_www_curl_share_lock);
+    curl_share_setopt(world->curl_share, CURLSHOPT_UNLOCKFUNC,
+                      raptor_www_curl_share_unlock);
+    curl_share_setopt(world->curl_share, CURLSHOPT_USERDATA, locks);
+  }
+#endif
+
+  curl_share_setopt(world->curl_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+#ifdef CURL_LOCK_DATA_SSL_SESSION
+  curl_share_setopt(world->curl_share, CURLSHOPT_SHARE,
+                    CURL_LOCK_DATA_SSL_SESSION);
+#endif
+
+  return 0;
+}
+
+
+/*
+ * raptor_www_curl_world_finish:
+ * @world: raptor_world object
+ *
+ * INTERNAL - Destroy the world handle pool and share handle.
+ */
+void
+raptor_www_curl_world_finish(raptor_world* world)
+{
+  while(world->curl_handle_pool_size > 0)
+    curl_easy_cleanup(world->curl_handle_pool[--world->curl_handle_pool_size]);
+
+  if(world->curl_share) {
+    curl_share_cleanup(world->curl_share);
+    world->curl_share = NULL;
+  }
+
+#ifdef HAVE_PTHREAD_H
+  if(world->curl_share_locks) {
+    pthread_mutex_t* locks = (pthread_mutex_t*)world->curl_share_locks;
+    int i;
+
+    for(i = 0; i < CURL_LOCK_DATA_LAST; i++)
+      pthread_mutex_destroy(&locks[i]);
+    RAPTOR_FREE(pthread_mutex_t*, locks);
+    world->curl_share_locks = NULL;
+  }
+#endif
+}
+
+
+/*
+ * raptor_www_curl_acquire_handle:
+ * @world: raptor_world object
+ *
+ * INTERNAL - Get a curl easy handle, reusing a pooled one if possible.
+ *
+ * Pooled handles keep their connection caches, so repeated fetches
+ * from the same host skip the TCP and TLS handshakes.
+ *
+ * Return value: curl handle or NULL on failure
+ */
+static CURL*
+raptor_www_curl_acquire_handle(raptor_world* world)
+{
+  CURL* handle = NULL;
+
+  if(world && world->curl_handle_pool_size > 0)
+    handle = world->curl_handle_pool[--world->curl_handle_pool_size];
+
+  if(!handle)
+    handle = curl_easy_init();
+
+  if(handle && world && world->curl_share)
+    curl_easy_setopt(handle, CURLOPT_SHARE, world->curl_share);
+
+  return handle;
+}
+
+
+/*
+ * raptor_www_curl_release_handle:
+ * @world: raptor_world object
+ * @handle: curl easy handle
+ *
+ * INTERNAL - Return a curl easy handle to the world pool.
+ */
+static void
+raptor_www_curl_release_handle(raptor_world* world, CURL* handle)
+{
+  if(world && world->curl_handle_pool_size < RAPTOR_WWW_CURL_POOL_SIZE) {
+    /* reset clears options and callbacks but keeps the handle's live
+     * connections and session cache for the next fetch
+     */
+    curl_easy_reset(handle);
+    world->curl_handle_pool[world->curl_handle_pool_size++] = handle;
+    return;
+  }
+
+  curl_easy_cleanup(handle);
+}
+
+
 void
 raptor_www_curl_init(raptor_www *www)
 {
   if(!www->curl_handle) {
-    www->curl_handle = curl_easy_init();
+    www->curl_handle = raptor_www_curl_acquire_handle(www->world);
     www->curl_init_here = 1;
   }
 
@@ -196,6 +375,13 @@ raptor_www_curl_init(raptor_www *www)
   curl_easy_setopt(www->curl_handle, CURLOPT_CONNECTTIMEOUT,
                    www->connection_timeout);
   curl_easy_setopt(www->curl_handle, CURLOPT_NOSIGNAL, 1);
+
+#ifdef CURL_MAX_READ_SIZE
+  /* ask for data in large chunks rather than the default 16K */
+  curl_easy_setopt(www->curl_handle, CURLOPT_BUFFERSIZE,
+                   (long)(RAPTOR_WWW_READ_BUFFER_SIZE < CURL_MAX_READ_SIZE ?
+                          RAPTOR_WWW_READ_BUFFER_SIZE : CURL_MAX_READ_SIZE));
+#endif
 }
 
 
@@ -204,17 +390,26 @@ raptor_www_curl_free(raptor_www *www)
 {
     /* only tidy up if we did all the work */
   if(www->curl_init_here && www->curl_handle) {
-    curl_easy_cleanup(www->curl_handle);
+    raptor_www_curl_release_handle(www->world, www->curl_handle);
     www->curl_handle = NULL;
   }
 }
 
 
-int
-raptor_www_curl_fetch(raptor_www *www) 
+/*
+ * raptor_www_curl_prepare:
+ * @www: WWW object
+ *
+ * INTERNAL - Set the per-transfer curl options before a perform.
+ *
+ * Return value: header list to free with curl_slist_free_all() after
+ * the transfer, or NULL
+ */
+static struct curl_slist*
+raptor_www_curl_prepare(raptor_www *www)
 {
   struct curl_slist *slist = NULL;
-    
+
   if(www->proxy)
     curl_easy_setopt(www->curl_handle, CURLOPT_PROXY, www->proxy);
 
@@ -236,7 +431,21 @@ raptor_www_curl_fetch(raptor_www *www)
   curl_easy_setopt(www->curl_handle, CURLOPT_URL, 
                    raptor_uri_as_string(www->uri));
 
-  if(curl_easy_perform(www->curl_handle)) {
+  return slist;
+}
+
+
+/*
+ * raptor_www_curl_transfer_done:
+ * @www: WWW object
+ * @curl_failed: non-0 if the transfer failed at the curl level
+ *
+ * INTERNAL - Record the outcome of a completed curl transfer.
+ */
+static void
+raptor_www_curl_transfer_done(raptor_www *www, int curl_failed)
+{
+  if(curl_failed) {
     /* failed */
     www->failed = 1;
     raptor_www_error(www, "Resolving URI failed: %s", www->error_buffer);
@@ -253,6 +462,17 @@ raptor_www_curl_fetch(raptor_www *www)
       www->status_code = RAPTOR_GOOD_CAST(int, lstatus);
 
   }
+}
+
+
+int
+raptor_www_curl_fetch(raptor_www *www) 
+{
+  struct curl_slist *slist;
+
+  slist = raptor_www_curl_prepare(www);
+
+  raptor_www_curl_transfer_done(www, curl_easy_perform(www->curl_handle) != 0);
 
   if(slist)
     curl_slist_free_all(slist);
@@ -261,6 +481,117 @@ raptor_www_curl_fetch(raptor_www *www)
 }
 
 
+/*
+ * raptor_www_curl_multi_fetch:
+ * @wwws: array of WWW objects, each with its target in www->uri
+ * @www_count: number of WWW objects
+ *
+ * INTERNAL - Run several curl transfers concurrently via curl_multi.
+ *
+ * Each WWW object keeps its own easy handle, write bytes and header
+ * callbacks; curl_multi interleaves the transfers so the callbacks
+ * fire as data arrives on any of them.  All calls happen on the
+ * calling thread.
+ *
+ * Return value: non 0 on failure of any transfer
+ */
+int
+raptor_www_curl_multi_fetch(raptor_www **wwws, int www_count)
+{
+  CURLM* multi_handle;
+  struct curl_slist **slists;
+  int still_running = 0;
+  int status = 0;
+  int i;
+
+  multi_handle = curl_multi_init();
+  if(!multi_handle)
+    return 1;
+
+  slists = RAPTOR_CALLOC(struct curl_slist**, www_count, sizeof(*slists));
+  if(!slists) {
+    curl_multi_cleanup(multi_handle);
+    return 1;
+  }
+
+  for(i = 0; i < www_count; i++) {
+    slists[i] = raptor_www_curl_prepare(wwws[i]);
+    curl_easy_setopt(wwws[i]->curl_handle, CURLOPT_PRIVATE, wwws[i]);
+    curl_multi_add_handle(multi_handle, wwws[i]->curl_handle);
+  }
+
+  do {
+    CURLMsg* msg;
+    int msgs_in_queue;
+
+    if(curl_multi_perform(multi_handle, &still_running) != CURLM_OK) {
+      status = 1;
+      break;
+    }
+
+    /* record each transfer as it completes */
+    while((msg = curl_multi_info_read(multi_handle, &msgs_in_queue))) {
+      if(msg->msg == CURLMSG_DONE) {
+        char *www_ptr = NULL;
+
+        if(curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE,
+                             &www_ptr) == CURLE_OK && www_ptr)
+          raptor_www_curl_transfer_done((raptor_www*)www_ptr,
+                                        msg->data.result != CURLE_OK);
+      }
+    }
+
+    if(still_running) {
+#if LIBCURL_VERSION_NUM >= 0x071c00
+      if(curl_multi_wait(multi_handle, NULL, 0, 1000, NULL) != CURLM_OK) {
+        status = 1;
+        break;
+      }
+#else
+      fd_set fdread;
+      fd_set fdwrite;
+      fd_set fdexcep;
+      int maxfd = -1;
+      long timeout_ms = -1;
+      struct timeval timeout;
+
+      FD_ZERO(&fdread);
+      FD_ZERO(&fdwrite);
+      FD_ZERO(&fdexcep);
+
+      curl_multi_timeout(multi_handle, &timeout_ms);
+      if(timeout_ms < 0 || timeout_ms > 1000)
+        timeout_ms = 1000;
+      timeout.tv_sec = timeout_ms / 1000;
+      timeout.tv_usec = (timeout_ms % 1000) * 1000;
+
+      if(curl_multi_fdset(multi_handle, &fdread, &fdwrite, &fdexcep,
+                          &maxfd) != CURLM_OK) {
+        status = 1;
+        break;
+      }
+      /* maxfd of -1 means curl is between actions; just retry */
+      if(maxfd >= 0)
+        select(maxfd + 1, &fdread, &fdwrite, &fdexcep, &timeout);
+#endif
+    }
+  } while(still_running);
+
+  for(i = 0; i < www_count; i++) {
+    curl_multi_remove_handle(multi_handle, wwws[i]->curl_handle);
+    if(slists[i])
+      curl_slist_free_all(slists[i]);
+    if(wwws[i]->failed)
+      status = 1;
+  }
+
+  curl_multi_cleanup(multi_handle);
+  RAPTOR_FREE(struct curl_slist**, slists);
+
+  return status;
+}
+
+
 int
 raptor_www_curl_set_ssl_cert_options(raptor_www* www,
                                      const char* cert_filename,
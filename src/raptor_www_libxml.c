@@ -136,21 +136,42 @@ raptor_www_libxml_fetch(raptor_www *www)
   }
 
   www->status_code = xmlNanoHTTPReturnCode(www->ctxt);
-  
-  while(1) {
-    int len = xmlNanoHTTPRead(www->ctxt, www->buffer, RAPTOR_WWW_BUFFER_SIZE);
-    if(len < 0)
-      break;
-    
-    www->total_bytes += len;
 
-    if(www->write_bytes)
-      www->write_bytes(www, www->write_bytes_userdata, www->buffer, len, 1);
-    
-    if(len < RAPTOR_WWW_BUFFER_SIZE || www->failed)
-      break;
+  {
+    long content_length = xmlNanoHTTPContentLength(www->ctxt);
+    if(content_length > 0)
+      www->content_length = (size_t)content_length;
   }
-  
+
+  {
+    char* buffer;
+    int buffer_size = RAPTOR_WWW_READ_BUFFER_SIZE;
+
+    /* read in large chunks; fall back to the small inline buffer */
+    buffer = RAPTOR_MALLOC(char*, buffer_size);
+    if(!buffer) {
+      buffer = www->buffer;
+      buffer_size = RAPTOR_WWW_BUFFER_SIZE;
+    }
+
+    while(1) {
+      int len = xmlNanoHTTPRead(www->ctxt, buffer, buffer_size);
+      if(len < 0)
+        break;
+
+      www->total_bytes += len;
+
+      if(www->write_bytes)
+        www->write_bytes(www, www->write_bytes_userdata, buffer, len, 1);
+
+      if(len < buffer_size || www->failed)
+        break;
+    }
+
+    if(buffer != www->buffer)
+      RAPTOR_FREE(char*, buffer);
+  }
+
   xmlNanoHTTPClose(www->ctxt);
 
   return www->failed;
@@ -160,6 +160,53 @@ raptor_free_xml_element(raptor_xml_element *element)
 }
 
 
+/*
+ * raptor_xml_element_clear:
+ * @element: XML element
+ *
+ * INTERNAL - Free an element's contents, keeping the structure and
+ * the cdata stringbuffer allocation so the element can be reused.
+ */
+void
+raptor_xml_element_clear(raptor_xml_element* element)
+{
+  unsigned int i;
+
+  for(i = 0; i < element->attribute_count; i++)
+    if(element->attributes[i])
+      raptor_free_qname(element->attributes[i]);
+
+  if(element->attributes)
+    RAPTOR_FREE(raptor_qname_array, element->attributes);
+  element->attributes = NULL;
+  element->attribute_count = 0;
+
+  if(element->content_cdata_sb)
+    raptor_stringbuffer_reset(element->content_cdata_sb);
+  element->content_cdata_length = 0;
+  element->content_cdata_seen = 0;
+  element->content_element_seen = 0;
+
+  if(element->base_uri)
+    raptor_free_uri(element->base_uri);
+  element->base_uri = NULL;
+
+  if(element->xml_language)
+    RAPTOR_FREE(char*, element->xml_language);
+  element->xml_language = NULL;
+
+  raptor_free_qname(element->name);
+  element->name = NULL;
+
+  if(element->declared_nspaces)
+    raptor_free_sequence(element->declared_nspaces);
+  element->declared_nspaces = NULL;
+
+  element->parent = NULL;
+  element->user_data = NULL;
+}
+
+
 /**
  * raptor_xml_element_get_name:
  * @xml_element: XML Element
@@ -799,6 +846,7 @@ raptor_xml_escape_string_any_write(const unsigned char *string,
 {
   size_t l;
   const unsigned char *p;
+  const unsigned char *span;
 
   if(xml_version != 10)
     xml_version = 11;
@@ -806,20 +854,51 @@ raptor_xml_escape_string_any_write(const unsigned char *string,
   if(quote != '\"' && quote != '\'')
     quote='\0';
 
-  for(l = len, p = string; l; p++, l--) {
-    int unichar_len = 1;
-    raptor_unichar unichar=*p;
-
-    if(*p > 0x7f) {
-      unichar_len = raptor_unicode_utf8_string_get_char(p, l, &unichar);
-      if(unichar_len < 0 || RAPTOR_GOOD_CAST(size_t, unichar_len) > l) {
-        raptor_log_error(raptor_iostream_get_world(iostr),
-                         RAPTOR_LOG_LEVEL_ERROR, NULL,
-                         "Bad UTF-8 encoding.");
-        return 1;
+  l = len;
+  p = string;
+  span = string;
+  while(l) {
+    raptor_unichar unichar;
+
+    /* scan forward over a span of characters needing no escaping so
+     * it can be written wholesale; multi-byte UTF-8 sequences are
+     * never escaped but are still validated */
+    while(l) {
+      unsigned char c = *p;
+
+      if(c > 0x7f) {
+        int unichar_len = raptor_unicode_utf8_string_get_char(p, l, &unichar);
+        if(unichar_len < 0 || RAPTOR_GOOD_CAST(size_t, unichar_len) > l) {
+          raptor_log_error(raptor_iostream_get_world(iostr),
+                           RAPTOR_LOG_LEVEL_ERROR, NULL,
+                           "Bad UTF-8 encoding.");
+          return 1;
+        }
+        p += unichar_len;
+        l -= unichar_len;
+        continue;
       }
+
+      if(c == '&' || c == '<' || c == 0x7f ||
+         (c < 0x20 && c != 0x09 && c != 0x0a) ||
+         (quote ? (c == (unsigned char)quote || c == 0x09 || c == 0x0a) :
+                  (c == '>')))
+        break;
+
+      p++;
+      l--;
     }
 
+    if(p > span)
+      raptor_iostream_counted_string_write((const char*)span,
+                                           RAPTOR_GOOD_CAST(size_t, p - span),
+                                           iostr);
+    if(!l)
+      break;
+
+    /* *p is a single-byte character that needs escaping (or is illegal) */
+    unichar = *p;
+
     if(unichar == '&')
       raptor_iostream_counted_string_write("&amp;", 5, iostr);
     else if(unichar == '<')
@@ -827,7 +906,7 @@ raptor_xml_escape_string_any_write(const unsigned char *string,
     else if(!quote && unichar == '>')
       raptor_iostream_counted_string_write("&gt;", 4, iostr);
     else if(quote && unichar == (unsigned long)quote) {
-      if(quote == '\'')  
+      if(quote == '\'')
         raptor_iostream_counted_string_write("&apos;", 6, iostr);
       else
         raptor_iostream_counted_string_write("&quot;", 6, iostr);
@@ -840,8 +919,8 @@ raptor_xml_escape_string_any_write(const unsigned char *string,
       else
         raptor_iostream_write_byte('A'+ ((char)unichar-0x0a), iostr);
       raptor_iostream_write_byte(';', iostr);
-    } else if(unichar == 0x7f ||
-               (unichar < 0x20 && unichar != 0x09 && unichar != 0x0a)) {
+    } else {
+      /* unichar == 0x7f or an illegal control character */
       if(!unichar || xml_version < 11) {
         raptor_log_error_formatted(raptor_iostream_get_world(iostr),
                                    RAPTOR_LOG_LEVEL_ERROR, NULL,
@@ -855,11 +934,11 @@ raptor_xml_escape_string_any_write(const unsigned char *string,
         raptor_iostream_hexadecimal_write(RAPTOR_GOOD_CAST(unsigned int, unichar), width, iostr);
         raptor_iostream_write_byte(';', iostr);
       }
-    } else
-      raptor_iostream_counted_string_write((const char*)p, unichar_len, iostr);
+    }
 
-    unichar_len--; /* since loop does len-- */
-    p += unichar_len; l -= unichar_len;
+    p++;
+    l--;
+    span = p;
   }
 
   return 0;
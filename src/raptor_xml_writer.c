@@ -64,9 +64,14 @@
 #undef RAPTOR_DEBUG_CDATA
 
 
+/* Number of finished XML elements kept for reuse - XML writing nests
+ * only a few elements deep, so a small pool keeps steady-state
+ * serialization free of element-lifecycle allocation */
+#define RAPTOR_XML_WRITER_ELEMENT_POOL_SIZE 8
+
 struct raptor_xml_writer_s {
   raptor_world *world;
-  
+
   int canonicalize;
 
   int depth;
@@ -88,6 +93,11 @@ struct raptor_xml_writer_s {
 
   /* Options (per-object) */
   raptor_object_options options;
+
+  /* free list of cleared elements for reuse by
+   * raptor_xml_writer_new_element() */
+  raptor_xml_element* element_pool[RAPTOR_XML_WRITER_ELEMENT_POOL_SIZE];
+  int element_pool_size;
 };
 
 
@@ -184,8 +194,9 @@ raptor_xml_writer_start_element_common(raptor_xml_writer* xml_writer,
   int depth = xml_writer->depth;
   int auto_indent = XML_WRITER_AUTO_INDENT(xml_writer);
   struct nsd *nspace_declarations = NULL;
-  size_t nspace_declarations_count = 0;  
+  size_t nspace_declarations_count = 0;
   unsigned int i;
+  int corked = 0;
 
   if(nstack) {
     int nspace_max_count = element->attribute_count * 2; /* attr and value */
@@ -307,6 +318,11 @@ raptor_xml_writer_start_element_common(raptor_xml_writer* xml_writer,
   }
   
 
+  /* assemble the whole start tag in the iostream cork buffer so it
+   * reaches the underlying sink as one contiguous write */
+  if(!raptor_iostream_cork(iostr))
+    corked = 1;
+
   raptor_iostream_write_byte('<', iostr);
 
   if(element->name->nspace && element->name->nspace->prefix_length > 0) {
@@ -380,6 +396,9 @@ raptor_xml_writer_start_element_common(raptor_xml_writer* xml_writer,
   if(!auto_empty)
     raptor_iostream_write_byte('>', iostr);
 
+  if(corked)
+    raptor_iostream_uncork(iostr);
+
   if(nstack)
     RAPTOR_FREE(stringarray, nspace_declarations);
 
@@ -388,6 +407,9 @@ raptor_xml_writer_start_element_common(raptor_xml_writer* xml_writer,
   /* Clean up nspace_declarations on error */
   error:
 
+  if(corked)
+    raptor_iostream_uncork(iostr);
+
   for(i = 0; i < nspace_declarations_count; i++) {
     if(nspace_declarations[i].declaration)
       RAPTOR_FREE(char*, nspace_declarations[i].declaration);
@@ -492,6 +514,9 @@ raptor_free_xml_writer(raptor_xml_writer* xml_writer)
   if(!xml_writer)
     return;
 
+  while(xml_writer->element_pool_size > 0)
+    raptor_free_xml_element(xml_writer->element_pool[--xml_writer->element_pool_size]);
+
   if(xml_writer->nstack && xml_writer->my_nstack)
     raptor_free_namespaces(xml_writer->nstack);
 
@@ -501,6 +526,107 @@ raptor_free_xml_writer(raptor_xml_writer* xml_writer)
 }
 
 
+/*
+ * raptor_xml_writer_new_element:
+ * @xml_writer: XML writer object
+ * @name: The XML element name
+ * @xml_language: the in-scope XML language (or NULL)
+ * @xml_base: the in-scope XML base URI (or NULL)
+ *
+ * INTERNAL - Constructor - create an XML element, reusing one from the
+ * writer's element pool when available.
+ *
+ * Elements returned here must be released with
+ * raptor_xml_writer_recycle_element() rather than
+ * raptor_free_xml_element() so they return to the pool.
+ *
+ * Return value: a new #raptor_xml_element or NULL on failure
+ */
+raptor_xml_element*
+raptor_xml_writer_new_element(raptor_xml_writer* xml_writer,
+                              raptor_qname* name,
+                              const unsigned char* xml_language,
+                              raptor_uri* xml_base)
+{
+  raptor_xml_element* element;
+
+  if(xml_writer->element_pool_size > 0) {
+    /* reuse a cleared element recycled after an earlier end tag */
+    element = xml_writer->element_pool[--xml_writer->element_pool_size];
+    element->name = name;
+    element->xml_language = xml_language;
+    element->base_uri = xml_base;
+    return element;
+  }
+
+  return raptor_new_xml_element(name, xml_language, xml_base);
+}
+
+
+/*
+ * raptor_xml_writer_new_element_from_namespace_local_name:
+ * @xml_writer: XML writer object
+ * @ns: namespace
+ * @name: the XML element local name
+ * @xml_language: the in-scope XML language (or NULL)
+ * @xml_base: base uri (or NULL)
+ *
+ * INTERNAL - Constructor - create an XML element from an XML namespace
+ * and a local name, reusing one from the writer's element pool when
+ * available.
+ *
+ * Return value: a new #raptor_xml_element or NULL on failure
+ */
+raptor_xml_element*
+raptor_xml_writer_new_element_from_namespace_local_name(raptor_xml_writer* xml_writer,
+                                                        raptor_namespace* ns,
+                                                        const unsigned char* name,
+                                                        const unsigned char* xml_language,
+                                                        raptor_uri* xml_base)
+{
+  raptor_uri *base_uri_copy;
+  raptor_qname *qname;
+  raptor_xml_element *element = NULL;
+
+  qname = raptor_new_qname_from_namespace_local_name(ns->nstack->world, ns,
+                                                     name, NULL);
+  if(qname) {
+    base_uri_copy = xml_base ? raptor_uri_copy(xml_base) : NULL;
+    element = raptor_xml_writer_new_element(xml_writer, qname, xml_language,
+                                            base_uri_copy);
+    if(!element) {
+      raptor_free_qname(qname);
+      if(base_uri_copy)
+        raptor_free_uri(base_uri_copy);
+    }
+  }
+  return element;
+}
+
+
+/*
+ * raptor_xml_writer_recycle_element:
+ * @xml_writer: XML writer object
+ * @element: finished XML element
+ *
+ * INTERNAL - Return an element to the writer's pool for reuse, or free
+ * it when the pool is full.
+ */
+void
+raptor_xml_writer_recycle_element(raptor_xml_writer* xml_writer,
+                                  raptor_xml_element* element)
+{
+  if(!element)
+    return;
+
+  if(xml_writer->element_pool_size < RAPTOR_XML_WRITER_ELEMENT_POOL_SIZE) {
+    raptor_xml_element_clear(element);
+    xml_writer->element_pool[xml_writer->element_pool_size++] = element;
+  } else
+    raptor_free_xml_element(element);
+}
+
+
 static void
 raptor_xml_writer_write_xml_declaration(raptor_xml_writer* xml_writer)
 {
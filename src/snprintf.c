@@ -26,6 +26,9 @@
 #ifdef HAVE_STDLIB_H
 #include <stdlib.h>
 #endif
+#include <limits.h>
+#include <float.h>
+#include <math.h>
 
 #include "raptor2.h"
 #include "raptor_internal.h"
@@ -355,6 +358,497 @@ raptor_format_integer(char* buffer, size_t bufsize, int integer,
 }
 
 
+
+/* Shortest round-trip double formatting.
+ *
+ * Implements the Grisu2 algorithm from Florian Loitsch, "Printing
+ * Floating-Point Numbers Quickly and Accurately with Integers" (PLDI
+ * 2010): digits are generated with 64-bit integer arithmetic against
+ * the rounding boundaries of the value, so the output is the shortest
+ * (or very close to shortest) decimal string that parses back to
+ * exactly the same double.  No snprintf() and no locale is involved.
+ *
+ * When 64-bit unsigned arithmetic is not available the formatting
+ * falls back to a precision loop over raptor_snprintf() verified by
+ * strtod() round-tripping, with any locale decimal point fixed up.
+ */
+
+#ifdef ULLONG_MAX
+#define RAPTOR_GRISU 1
+typedef unsigned long long raptor_grisu_uint64;
+#define RAPTOR_UINT64_C(v) (v##ULL)
+#endif
+
+#ifdef RAPTOR_GRISU
+
+typedef struct {
+  raptor_grisu_uint64 f;
+  int e;
+} raptor_grisu_fp;
+
+#define RAPTOR_GRISU_SIGNIFICAND_MASK RAPTOR_UINT64_C(0x000FFFFFFFFFFFFF)
+#define RAPTOR_GRISU_EXPONENT_MASK    RAPTOR_UINT64_C(0x7FF0000000000000)
+#define RAPTOR_GRISU_SIGN_MASK        RAPTOR_UINT64_C(0x8000000000000000)
+#define RAPTOR_GRISU_HIDDEN_BIT       RAPTOR_UINT64_C(0x0010000000000000)
+#define RAPTOR_GRISU_EXPONENT_BIAS    (0x3FF + 52)
+
+/* Normalized 64-bit significands of 10^k for k = -348 .. 340 step 8,
+ * computed with exact integer arithmetic.
+ */
+static const raptor_grisu_fp raptor_grisu_cached_powers[87] = {
+  { RAPTOR_UINT64_C(0xFA8FD5A0081C0288), -1220 }, /* 10^-348 */
+  { RAPTOR_UINT64_C(0xBAAEE17FA23EBF76), -1193 }, /* 10^-340 */
+  { RAPTOR_UINT64_C(0x8B16FB203055AC76), -1166 }, /* 10^-332 */
+  { RAPTOR_UINT64_C(0xCF42894A5DCE35EA), -1140 }, /* 10^-324 */
+  { RAPTOR_UINT64_C(0x9A6BB0AA55653B2D), -1113 }, /* 10^-316 */
+  { RAPTOR_UINT64_C(0xE61ACF033D1A45DF), -1087 }, /* 10^-308 */
+  { RAPTOR_UINT64_C(0xAB70FE17C79AC6CA), -1060 }, /* 10^-300 */
+  { RAPTOR_UINT64_C(0xFF77B1FCBEBCDC4F), -1034 }, /* 10^-292 */
+  { RAPTOR_UINT64_C(0xBE5691EF416BD60C), -1007 }, /* 10^-284 */
+  { RAPTOR_UINT64_C(0x8DD01FAD907FFC3C), -980 }, /* 10^-276 */
+  { RAPTOR_UINT64_C(0xD3515C2831559A83), -954 }, /* 10^-268 */
+  { RAPTOR_UINT64_C(0x9D71AC8FADA6C9B5), -927 }, /* 10^-260 */
+  { RAPTOR_UINT64_C(0xEA9C227723EE8BCB), -901 }, /* 10^-252 */
+  { RAPTOR_UINT64_C(0xAECC49914078536D), -874 }, /* 10^-244 */
+  { RAPTOR_UINT64_C(0x823C12795DB6CE57), -847 }, /* 10^-236 */
+  { RAPTOR_UINT64_C(0xC21094364DFB5637), -821 }, /* 10^-228 */
+  { RAPTOR_UINT64_C(0x9096EA6F3848984F), -794 }, /* 10^-220 */
+  { RAPTOR_UINT64_C(0xD77485CB25823AC7), -768 }, /* 10^-212 */
+  { RAPTOR_UINT64_C(0xA086CFCD97BF97F4), -741 }, /* 10^-204 */
+  { RAPTOR_UINT64_C(0xEF340A98172AACE5), -715 }, /* 10^-196 */
+  { RAPTOR_UINT64_C(0xB23867FB2A35B28E), -688 }, /* 10^-188 */
+  { RAPTOR_UINT64_C(0x84C8D4DFD2C63F3B), -661 }, /* 10^-180 */
+  { RAPTOR_UINT64_C(0xC5DD44271AD3CDBA), -635 }, /* 10^-172 */
+  { RAPTOR_UINT64_C(0x936B9FCEBB25C996), -608 }, /* 10^-164 */
+  { RAPTOR_UINT64_C(0xDBAC6C247D62A584), -582 }, /* 10^-156 */
+  { RAPTOR_UINT64_C(0xA3AB66580D5FDAF6), -555 }, /* 10^-148 */
+  { RAPTOR_UINT64_C(0xF3E2F893DEC3F126), -529 }, /* 10^-140 */
+  { RAPTOR_UINT64_C(0xB5B5ADA8AAFF80B8), -502 }, /* 10^-132 */
+  { RAPTOR_UINT64_C(0x87625F056C7C4A8B), -475 }, /* 10^-124 */
+  { RAPTOR_UINT64_C(0xC9BCFF6034C13053), -449 }, /* 10^-116 */
+  { RAPTOR_UINT64_C(0x964E858C91BA2655), -422 }, /* 10^-108 */
+  { RAPTOR_UINT64_C(0xDFF9772470297EBD), -396 }, /* 10^-100 */
+  { RAPTOR_UINT64_C(0xA6DFBD9FB8E5B88F), -369 }, /* 10^-92 */
+  { RAPTOR_UINT64_C(0xF8A95FCF88747D94), -343 }, /* 10^-84 */
+  { RAPTOR_UINT64_C(0xB94470938FA89BCF), -316 }, /* 10^-76 */
+  { RAPTOR_UINT64_C(0x8A08F0F8BF0F156B), -289 }, /* 10^-68 */
+  { RAPTOR_UINT64_C(0xCDB02555653131B6), -263 }, /* 10^-60 */
+  { RAPTOR_UINT64_C(0x993FE2C6D07B7FAC), -236 }, /* 10^-52 */
+  { RAPTOR_UINT64_C(0xE45C10C42A2B3B06), -210 }, /* 10^-44 */
+  { RAPTOR_UINT64_C(0xAA242499697392D3), -183 }, /* 10^-36 */
+  { RAPTOR_UINT64_C(0xFD87B5F28300CA0E), -157 }, /* 10^-28 */
+  { RAPTOR_UINT64_C(0xBCE5086492111AEB), -130 }, /* 10^-20 */
+  { RAPTOR_UINT64_C(0x8CBCCC096F5088CC), -103 }, /* 10^-12 */
+  { RAPTOR_UINT64_C(0xD1B71758E219652C), -77 }, /* 10^-4 */
+  { RAPTOR_UINT64_C(0x9C40000000000000), -50 }, /* 10^4 */
+  { RAPTOR_UINT64_C(0xE8D4A51000000000), -24 }, /* 10^12 */
+  { RAPTOR_UINT64_C(0xAD78EBC5AC620000), 3 }, /* 10^20 */
+  { RAPTOR_UINT64_C(0x813F3978F8940984), 30 }, /* 10^28 */
+  { RAPTOR_UINT64_C(0xC097CE7BC90715B3), 56 }, /* 10^36 */
+  { RAPTOR_UINT64_C(0x8F7E32CE7BEA5C70), 83 }, /* 10^44 */
+  { RAPTOR_UINT64_C(0xD5D238A4ABE98068), 109 }, /* 10^52 */
+  { RAPTOR_UINT64_C(0x9F4F2726179A2245), 136 }, /* 10^60 */
+  { RAPTOR_UINT64_C(0xED63A231D4C4FB27), 162 }, /* 10^68 */
+  { RAPTOR_UINT64_C(0xB0DE65388CC8ADA8), 189 }, /* 10^76 */
+  { RAPTOR_UINT64_C(0x83C7088E1AAB65DB), 216 }, /* 10^84 */
+  { RAPTOR_UINT64_C(0xC45D1DF942711D9A), 242 }, /* 10^92 */
+  { RAPTOR_UINT64_C(0x924D692CA61BE758), 269 }, /* 10^100 */
+  { RAPTOR_UINT64_C(0xDA01EE641A708DEA), 295 }, /* 10^108 */
+  { RAPTOR_UINT64_C(0xA26DA3999AEF774A), 322 }, /* 10^116 */
+  { RAPTOR_UINT64_C(0xF209787BB47D6B85), 348 }, /* 10^124 */
+  { RAPTOR_UINT64_C(0xB454E4A179DD1877), 375 }, /* 10^132 */
+  { RAPTOR_UINT64_C(0x865B86925B9BC5C2), 402 }, /* 10^140 */
+  { RAPTOR_UINT64_C(0xC83553C5C8965D3D), 428 }, /* 10^148 */
+  { RAPTOR_UINT64_C(0x952AB45CFA97A0B3), 455 }, /* 10^156 */
+  { RAPTOR_UINT64_C(0xDE469FBD99A05FE3), 481 }, /* 10^164 */
+  { RAPTOR_UINT64_C(0xA59BC234DB398C25), 508 }, /* 10^172 */
+  { RAPTOR_UINT64_C(0xF6C69A72A3989F5C), 534 }, /* 10^180 */
+  { RAPTOR_UINT64_C(0xB7DCBF5354E9BECE), 561 }, /* 10^188 */
+  { RAPTOR_UINT64_C(0x88FCF317F22241E2), 588 }, /* 10^196 */
+  { RAPTOR_UINT64_C(0xCC20CE9BD35C78A5), 614 }, /* 10^204 */
+  { RAPTOR_UINT64_C(0x98165AF37B2153DF), 641 }, /* 10^212 */
+  { RAPTOR_UINT64_C(0xE2A0B5DC971F303A), 667 }, /* 10^220 */
+  { RAPTOR_UINT64_C(0xA8D9D1535CE3B396), 694 }, /* 10^228 */
+  { RAPTOR_UINT64_C(0xFB9B7CD9A4A7443C), 720 }, /* 10^236 */
+  { RAPTOR_UINT64_C(0xBB764C4CA7A44410), 747 }, /* 10^244 */
+  { RAPTOR_UINT64_C(0x8BAB8EEFB6409C1A), 774 }, /* 10^252 */
+  { RAPTOR_UINT64_C(0xD01FEF10A657842C), 800 }, /* 10^260 */
+  { RAPTOR_UINT64_C(0x9B10A4E5E9913129), 827 }, /* 10^268 */
+  { RAPTOR_UINT64_C(0xE7109BFBA19C0C9D), 853 }, /* 10^276 */
+  { RAPTOR_UINT64_C(0xAC2820D9623BF429), 880 }, /* 10^284 */
+  { RAPTOR_UINT64_C(0x80444B5E7AA7CF85), 907 }, /* 10^292 */
+  { RAPTOR_UINT64_C(0xBF21E44003ACDD2D), 933 }, /* 10^300 */
+  { RAPTOR_UINT64_C(0x8E679C2F5E44FF8F), 960 }, /* 10^308 */
+  { RAPTOR_UINT64_C(0xD433179D9C8CB841), 986 }, /* 10^316 */
+  { RAPTOR_UINT64_C(0x9E19DB92B4E31BA9), 1013 }, /* 10^324 */
+  { RAPTOR_UINT64_C(0xEB96BF6EBADF77D9), 1039 }, /* 10^332 */
+  { RAPTOR_UINT64_C(0xAF87023B9BF0EE6B), 1066 } /* 10^340 */
+};
+
+static const unsigned int raptor_grisu_pow10_32[10] = {
+  1, 10, 100, 1000, 10000, 100000,
+  1000000, 10000000, 100000000, 1000000000
+};
+
+
+/* decompose an IEEE 754 double into significand and binary exponent */
+static raptor_grisu_fp
+raptor_grisu_from_double(double value)
+{
+  raptor_grisu_fp v;
+  raptor_grisu_uint64 bits;
+  int biased;
+
+  memcpy(&bits, &value, sizeof(bits));
+
+  biased = (int)((bits & RAPTOR_GRISU_EXPONENT_MASK) >> 52);
+  if(biased) {
+    v.f = (bits & RAPTOR_GRISU_SIGNIFICAND_MASK) + RAPTOR_GRISU_HIDDEN_BIT;
+    v.e = biased - RAPTOR_GRISU_EXPONENT_BIAS;
+  } else {
+    /* denormal */
+    v.f = bits & RAPTOR_GRISU_SIGNIFICAND_MASK;
+    v.e = 1 - RAPTOR_GRISU_EXPONENT_BIAS;
+  }
+
+  return v;
+}
+
+
+static raptor_grisu_fp
+raptor_grisu_normalize(raptor_grisu_fp v)
+{
+  while(!(v.f & RAPTOR_GRISU_SIGN_MASK)) {
+    v.f <<= 1;
+    v.e--;
+  }
+  return v;
+}
+
+
+/* rounded 64x64 -> top 64 bits multiply via 32-bit halves */
+static raptor_grisu_fp
+raptor_grisu_multiply(raptor_grisu_fp x, raptor_grisu_fp y)
+{
+  const raptor_grisu_uint64 mask32 = RAPTOR_UINT64_C(0xFFFFFFFF);
+  raptor_grisu_uint64 a = x.f >> 32;
+  raptor_grisu_uint64 b = x.f & mask32;
+  raptor_grisu_uint64 c = y.f >> 32;
+  raptor_grisu_uint64 d = y.f & mask32;
+  raptor_grisu_uint64 ac = a * c;
+  raptor_grisu_uint64 bc = b * c;
+  raptor_grisu_uint64 ad = a * d;
+  raptor_grisu_uint64 bd = b * d;
+  raptor_grisu_uint64 tmp;
+  raptor_grisu_fp r;
+
+  tmp = (bd >> 32) + (ad & mask32) + (bc & mask32);
+  tmp += RAPTOR_UINT64_C(1) << 31; /* round */
+
+  r.f = ac + (ad >> 32) + (bc >> 32) + (tmp >> 32);
+  r.e = x.e + y.e + 64;
+
+  return r;
+}
+
+
+/* the boundaries are the midpoints to the neighbouring doubles; any
+ * decimal inside them parses back to the original value */
+static void
+raptor_grisu_boundaries(raptor_grisu_fp v,
+                        raptor_grisu_fp* minus, raptor_grisu_fp* plus)
+{
+  raptor_grisu_fp pl, mi;
+
+  pl.f = (v.f << 1) + 1;
+  pl.e = v.e - 1;
+  while(!(pl.f & (RAPTOR_GRISU_HIDDEN_BIT << 1))) {
+    pl.f <<= 1;
+    pl.e--;
+  }
+  pl.f <<= 10; /* 64 - 52 - 2 */
+  pl.e -= 10;
+
+  if(v.f == RAPTOR_GRISU_HIDDEN_BIT) {
+    /* lower boundary is closer for powers of two */
+    mi.f = (v.f << 2) - 1;
+    mi.e = v.e - 2;
+  } else {
+    mi.f = (v.f << 1) - 1;
+    mi.e = v.e - 1;
+  }
+  mi.f <<= mi.e - pl.e;
+  mi.e = pl.e;
+
+  *minus = mi;
+  *plus = pl;
+}
+
+
+/* power of ten scaling the binary exponent into the digit generation
+ * range; sets @K to the decimal exponent of the scale */
+static raptor_grisu_fp
+raptor_grisu_cached_power(int e, int* K)
+{
+  double dk = (-61 - e) * 0.30102999566398114 + 347;
+  int k = (int)dk;
+  unsigned int index;
+
+  if(dk - k > 0.0)
+    k++;
+
+  index = (unsigned int)((k >> 3) + 1);
+  *K = -(-348 + (int)(index << 3));
+
+  return raptor_grisu_cached_powers[index];
+}
+
+
+/* nudge the last digit towards the scaled value w while staying
+ * inside the rounding boundaries */
+static void
+raptor_grisu_round(char* buffer, int len, raptor_grisu_uint64 delta,
+                   raptor_grisu_uint64 rest, raptor_grisu_uint64 ten_kappa,
+                   raptor_grisu_uint64 wp_w)
+{
+  while(rest < wp_w && delta - rest >= ten_kappa &&
+        (rest + ten_kappa < wp_w ||
+         wp_w - rest > rest + ten_kappa - wp_w)) {
+    buffer[len - 1]--;
+    rest += ten_kappa;
+  }
+}
+
+
+/* generate the shortest digits of W within delta of the upper
+ * boundary Mp; K becomes the decimal exponent of the last digit */
+static void
+raptor_grisu_digit_gen(raptor_grisu_fp W, raptor_grisu_fp Mp,
+                       raptor_grisu_uint64 delta,
+                       char* buffer, int* len, int* K)
+{
+  raptor_grisu_fp one;
+  raptor_grisu_uint64 wp_w = Mp.f - W.f;
+  raptor_grisu_uint64 p2;
+  unsigned int p1;
+  int kappa;
+
+  one.f = RAPTOR_UINT64_C(1) << -Mp.e;
+  one.e = Mp.e;
+
+  p1 = (unsigned int)(Mp.f >> -one.e);
+  p2 = Mp.f & (one.f - 1);
+
+  kappa = 1;
+  while(kappa < 10 && p1 >= raptor_grisu_pow10_32[kappa])
+    kappa++;
+
+  *len = 0;
+
+  while(kappa > 0) {
+    unsigned int d = p1 / raptor_grisu_pow10_32[kappa - 1];
+    raptor_grisu_uint64 tmp;
+
+    p1 %= raptor_grisu_pow10_32[kappa - 1];
+    if(d || *len)
+      buffer[(*len)++] = (char)('0' + d);
+    kappa--;
+
+    tmp = ((raptor_grisu_uint64)p1 << -one.e) + p2;
+    if(tmp <= delta) {
+      *K += kappa;
+      raptor_grisu_round(buffer, *len, delta, tmp,
+                         (raptor_grisu_uint64)raptor_grisu_pow10_32[kappa] << -one.e,
+                         wp_w);
+      return;
+    }
+  }
+
+  for(;;) {
+    unsigned int d;
+
+    p2 *= 10;
+    delta *= 10;
+    d = (unsigned int)(p2 >> -one.e);
+    if(d || *len)
+      buffer[(*len)++] = (char)('0' + d);
+    p2 &= one.f - 1;
+    kappa--;
+
+    if(p2 < delta) {
+      *K += kappa;
+      raptor_grisu_round(buffer, *len, delta, p2, one.f,
+                         wp_w * raptor_grisu_pow10_32[-kappa]);
+      return;
+    }
+  }
+}
+
+
+/* shortest digits of a finite non-zero positive double; K is the
+ * decimal exponent of the last generated digit */
+static void
+raptor_grisu2(double value, char* buffer, int* len, int* K)
+{
+  raptor_grisu_fp v = raptor_grisu_from_double(value);
+  raptor_grisu_fp w_m, w_p, c_mk, W, Wp, Wm;
+
+  raptor_grisu_boundaries(v, &w_m, &w_p);
+
+  c_mk = raptor_grisu_cached_power(w_p.e, K);
+  W = raptor_grisu_multiply(raptor_grisu_normalize(v), c_mk);
+  Wp = raptor_grisu_multiply(w_p, c_mk);
+  Wm = raptor_grisu_multiply(w_m, c_mk);
+
+  /* shrink by one unit in the last place on each side so any digits
+   * emitted inside [Wm, Wp] are guaranteed to round-trip */
+  Wm.f++;
+  Wp.f--;
+
+  raptor_grisu_digit_gen(W, Wp, Wp.f - Wm.f, buffer, len, K);
+}
+
+#else /* !RAPTOR_GRISU */
+
+/* shortest digits via a precision loop over snprintf, verified by
+ * strtod round-tripping; digits are returned without the decimal
+ * point so the caller formats them exactly as the grisu path does */
+static void
+raptor_format_double_fallback(double value, char* buffer, int* len, int* K)
+{
+  char tmp[64];
+  int precision;
+
+  for(precision = 0; precision < 17; precision++) {
+    char* p;
+    char* digits;
+    int exponent;
+
+    raptor_snprintf(tmp, sizeof(tmp), "%.*E", precision, value);
+    if(strtod(tmp, NULL) == value) {
+      /* mantissa digits, skipping sign and any (locale) decimal point */
+      digits = tmp;
+      if(*digits == '-')
+        digits++;
+
+      *len = 0;
+      for(p = digits; *p && *p != 'E' && *p != 'e'; p++) {
+        if(*p >= '0' && *p <= '9')
+          buffer[(*len)++] = *p;
+      }
+      if(*p)
+        p++;
+      exponent = (int)strtol(p, NULL, 10);
+
+      /* drop trailing zero digits */
+      while(*len > 1 && buffer[*len - 1] == '0')
+        (*len)--;
+
+      /* exponent of the last digit, as grisu reports it */
+      *K = exponent - (*len - 1);
+      return;
+    }
+  }
+
+  /* unreachable - 17 significant digits always round-trip */
+  buffer[0] = '0';
+  *len = 1;
+  *K = 0;
+}
+
+#endif /* RAPTOR_GRISU */
+
+
+/**
+ * raptor_format_double:
+ * @buffer: buffer (or NULL)
+ * @bufsize: size of above (or 0)
+ * @value: double value to format
+ *
+ * INTERNAL - Format a double as the shortest decimal string that
+ * parses back to exactly the same value, in xsd:double style
+ * scientific notation such as "4.2E1", "5.0E-1" or "-1.25E10".
+ * Infinities and NaN are formatted as "INF", "-INF" and "NaN".
+ *
+ * The output is locale-independent: the decimal point is always '.'.
+ *
+ * If @buffer is NULL or the @bufsize is too small, the number of
+ * bytes needed (excluding NUL) is returned and no formatting is done.
+ *
+ * Return value: number of bytes needed or written (excluding NUL) or 0 on failure
+ */
+size_t
+raptor_format_double(char* buffer, size_t bufsize, double value)
+{
+  /* sign + 17 digits + '.' + 'E' + '-' + 3 exponent digits + NUL */
+  char work[32];
+  char digits[20];
+  char* p = work;
+  int len, K, exponent, i;
+  size_t needed;
+
+  if(value != value) {
+    len = 3;
+    memcpy(work, "NaN", 4);
+    goto copy;
+  }
+
+  if(value < 0) {
+    *p++ = '-';
+    value = -value;
+  }
+
+  if(value > DBL_MAX) {
+    memcpy(p, "INF", 4);
+    len = RAPTOR_GOOD_CAST(int, (p - work)) + 3;
+    goto copy;
+  }
+
+  if(value == 0) {
+    memcpy(p, "0.0E0", 6);
+    len = RAPTOR_GOOD_CAST(int, (p - work)) + 5;
+    goto copy;
+  }
+
+  K = 0;
+#ifdef RAPTOR_GRISU
+  raptor_grisu2(value, digits, &len, &K);
+#else
+  raptor_format_double_fallback(value, digits, &len, &K);
+#endif
+
+  /* exponent of the first digit */
+  exponent = K + len - 1;
+
+  *p++ = digits[0];
+  *p++ = '.';
+  if(len > 1) {
+    for(i = 1; i < len; i++)
+      *p++ = digits[i];
+  } else
+    *p++ = '0';
+
+  *p++ = 'E';
+  if(exponent < 0) {
+    *p++ = '-';
+    exponent = -exponent;
+  }
+  p += raptor_format_integer(p, 4, exponent, /* base */ 10, -1, '\0');
+  *p = '\0';
+
+  len = RAPTOR_GOOD_CAST(int, (p - work));
+
+  copy:
+  needed = RAPTOR_GOOD_CAST(size_t, len);
+  if(!buffer || bufsize < needed + 1) /* +1 for NUL */
+    return needed;
+
+  memcpy(buffer, work, needed + 1);
+  return needed;
+}
+
+
+
 #else /* STANDALONE */
 
 
@@ -398,6 +892,65 @@ test_snprintf(size_t len_ref, const char *format, ...)
 }
 
 
+/* format a double and check the result parses back to the same value */
+static int
+test_format_double(double value)
+{
+  char buffer[32];
+  size_t len;
+  double parsed;
+
+  len = raptor_format_double(buffer, sizeof(buffer), value);
+  if(!len || len != strlen(buffer)) {
+    fprintf(stderr, "%s: raptor_format_double(%.17E) returned length %d\n",
+            program, value, (int)len);
+    return 1;
+  }
+
+  parsed = strtod(buffer, NULL);
+  if(parsed != value) {
+    fprintf(stderr,
+            "%s: raptor_format_double(%.17E) gave \"%s\" which parses to %.17E\n",
+            program, value, buffer, parsed);
+    return 1;
+  }
+
+  return 0;
+}
+
+
+static int
+test_format_doubles(void)
+{
+  /* from C float.h; tiniest denormal written out long hand */
+  static const char* const tricky[] = {
+    "5E-324", "2.2250738585072014E-308", "1.7976931348623157E308",
+    "0.1", "0.3", "1", "1.5", "2.2", "100", "1E22", "123456.789",
+    "3.141592653589793", "2.2204460492503131E-16", NULL
+  };
+  int errors = 0;
+  int i;
+
+  for(i = 0; tricky[i]; i++) {
+    double value = strtod(tricky[i], NULL);
+    errors += test_format_double(value);
+    errors += test_format_double(-value);
+  }
+
+  errors += test_format_double(0.0);
+  errors += test_format_double(-0.0);
+
+  /* values spread across the exponent range */
+  for(i = 0; i < 100000; i++) {
+    double value = ((double)rand() / RAND_MAX + (double)rand()) *
+                   ldexp(1.0, rand() % 600 - 300);
+    errors += test_format_double(value);
+  }
+
+  return errors;
+}
+
+
 #define FMT_LEN_MAX 128
 #define ARG_LEN_MAX 128
 
@@ -411,6 +964,8 @@ main(int argc, char *argv[])
 
   program = raptor_basename(argv[0]);
 
+  errors += test_format_doubles();
+
   for(x = 2; x < FMT_LEN_MAX; x++) {
     for(y = 0; y < ARG_LEN_MAX; y++) {
       size_t len_ref = x + y - 2;
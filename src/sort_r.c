@@ -72,6 +72,174 @@ raptor_sort_r(void *base, size_t nel, size_t width,
 }
 
 
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+/* below this many elements per thread the thread start-up cost
+ * outweighs any parallel speed-up */
+#define RAPTOR_PARALLEL_SORT_MIN_NEL 4096
+
+#define RAPTOR_PARALLEL_SORT_MAX_THREADS 8
+
+/* a contiguous sub-array sorted by one worker thread */
+typedef struct {
+  char* base;
+  size_t nel;
+  size_t width;
+  raptor_data_compare_arg_handler compar;
+  void* user_data;
+  pthread_t thread;
+  int threaded;
+} raptor_parallel_sort_run;
+
+
+static void*
+raptor_parallel_sort_worker(void* arg)
+{
+  raptor_parallel_sort_run* run = (raptor_parallel_sort_run*)arg;
+
+  raptor_sort_r(run->base, run->nel, run->width, run->compar, run->user_data);
+  return NULL;
+}
+
+
+/*
+ * raptor_parallel_sort_merge:
+ * @a: first sorted run; grows to cover both runs
+ * @b: second sorted run, adjacent in memory after @a
+ * @scratch: scratch space of at least (@a->nel + @b->nel) elements
+ *
+ * INTERNAL - Merge two adjacent sorted runs in place via @scratch.
+ */
+static void
+raptor_parallel_sort_merge(raptor_parallel_sort_run* a,
+                           raptor_parallel_sort_run* b,
+                           char* scratch)
+{
+  const size_t width = a->width;
+  char* pa = a->base;
+  char* pb = b->base;
+  char* const ea = pa + a->nel * width;
+  char* const eb = pb + b->nel * width;
+  char* out = scratch;
+
+  while(pa < ea && pb < eb) {
+    if(a->compar(pa, pb, a->user_data) <= 0) {
+      memcpy(out, pa, width);
+      pa += width;
+    } else {
+      memcpy(out, pb, width);
+      pb += width;
+    }
+    out += width;
+  }
+  if(pa < ea) {
+    memcpy(out, pa, RAPTOR_GOOD_CAST(size_t, ea - pa));
+    out += ea - pa;
+  }
+  if(pb < eb) {
+    memcpy(out, pb, RAPTOR_GOOD_CAST(size_t, eb - pb));
+    out += eb - pb;
+  }
+
+  memcpy(a->base, scratch, RAPTOR_GOOD_CAST(size_t, out - scratch));
+  a->nel += b->nel;
+}
+#endif /* HAVE_PTHREAD_H */
+
+
+/**
+ * raptor_sort_r_parallel:
+ * @base: the array to be sorted
+ * @nel: the number of elements in the array
+ * @width: the size in bytes of each element of the array
+ * @compar: comparison function
+ * @user_data: a pointer to be passed to the comparison function
+ *
+ * Sort a large array on multiple threads.
+ *
+ * Splits the array into runs sorted concurrently with raptor_sort_r()
+ * and then merges the runs.  @compar may be called from several
+ * threads at once and must be thread-safe.
+ *
+ * Falls back to raptor_sort_r() for small arrays, when scratch space
+ * cannot be allocated or when the platform has no thread support.
+ * Like raptor_sort_r() the sort is not stable; elements that compare
+ * equal may appear in any order.
+ */
+void
+raptor_sort_r_parallel(void *base, size_t nel, size_t width,
+                       raptor_data_compare_arg_handler compar,
+                       void *user_data)
+{
+#ifdef HAVE_PTHREAD_H
+  raptor_parallel_sort_run runs[RAPTOR_PARALLEL_SORT_MAX_THREADS];
+  char* scratch;
+  size_t run_count;
+  size_t chunk;
+  size_t i;
+
+  run_count = nel / RAPTOR_PARALLEL_SORT_MIN_NEL;
+  if(run_count > RAPTOR_PARALLEL_SORT_MAX_THREADS)
+    run_count = RAPTOR_PARALLEL_SORT_MAX_THREADS;
+  if(run_count < 2) {
+    raptor_sort_r(base, nel, width, compar, user_data);
+    return;
+  }
+
+  scratch = RAPTOR_MALLOC(char*, nel * width);
+  if(!scratch) {
+    raptor_sort_r(base, nel, width, compar, user_data);
+    return;
+  }
+
+  chunk = nel / run_count;
+  for(i = 0; i < run_count; i++) {
+    runs[i].base = (char*)base + i * chunk * width;
+    runs[i].nel = (i == run_count - 1) ? (nel - i * chunk) : chunk;
+    runs[i].width = width;
+    runs[i].compar = compar;
+    runs[i].user_data = user_data;
+  }
+
+  for(i = 1; i < run_count; i++) {
+    /* on thread creation failure, sort the run inline */
+    runs[i].threaded = !pthread_create(&runs[i].thread, NULL,
+                                       raptor_parallel_sort_worker, &runs[i]);
+    if(!runs[i].threaded)
+      raptor_parallel_sort_worker(&runs[i]);
+  }
+  /* sort the first run on the calling thread */
+  raptor_parallel_sort_worker(&runs[0]);
+
+  for(i = 1; i < run_count; i++) {
+    if(runs[i].threaded)
+      pthread_join(runs[i].thread, NULL);
+  }
+
+  /* pairwise merge passes until a single run covers the array */
+  while(run_count > 1) {
+    size_t out = 0;
+    for(i = 0; i + 1 < run_count; i += 2) {
+      raptor_parallel_sort_merge(&runs[i], &runs[i + 1], scratch);
+      runs[out++] = runs[i];
+    }
+    if(i < run_count)
+      runs[out++] = runs[i];
+    run_count = out;
+  }
+
+  RAPTOR_FREE(char*, scratch);
+#else
+  raptor_sort_r(base, nel, width, compar, user_data);
+#endif
+}
+
+
 #endif
 
 
@@ -46,6 +46,39 @@
 #include <turtle_lexer.h>
 #include <turtle_common.h>
 
+/*
+ * Character class table for Turtle escape handling, indexed by byte.
+ * Bits are the RAPTOR_TURTLE_CLASS_* flags from turtle_common.h:
+ *   ECHAR (1)         - t b n r f
+ *   PN_LOCAL_ESC (2)  - the Turtle 2013 set -_~.!$&'()*+,;=/?#@%
+ *   IRI_FORBIDDEN (4) - space (may not appear raw in an IRIREF)
+ *   UHEX (8)          - [0-9A-Fa-f]
+ * Table generated from that classification; regenerate rather than
+ * editing entries by hand.
+ */
+const unsigned char raptor_turtle_char_classes[256] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 0x00 */
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 0x10 */
+  4, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, /* 0x20 */
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 2, 0, 2, 0, 2, /* 0x30 */
+  2, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 0x40 */
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, /* 0x50 */
+  0, 8, 9, 8, 8, 8, 9, 0, 0, 0, 0, 0, 0, 0, 1, 0, /* 0x60 */
+  0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, /* 0x70 */
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 0x80 */
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 0x90 */
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 0xA0 */
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 0xB0 */
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 0xC0 */
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 0xD0 */
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* 0xE0 */
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0  /* 0xF0 */
+};
+
+#define RAPTOR_TURTLE_CLASS(c) \
+  (raptor_turtle_char_classes[(unsigned char)(c)])
+
+
 /**
  * raptor_stringbuffer_append_turtle_string:
  * @stringbuffer: String buffer to add to
@@ -86,113 +119,151 @@ raptor_stringbuffer_append_turtle_string(raptor_stringbuffer* stringbuffer,
   if(!string)
     return -1;
 
-  for(s = text, d = string, i = 0; i < len; s++, i++) {
-    unsigned char c=*s;
+  s = text;
+  d = string;
+  i = 0;
+  while(i < len) {
+    unsigned char c;
+    const unsigned char *bs;
+    size_t span;
 
-    if(c == ' ' &&  is_uri) {
-      error_handler(error_data,
-                    "Turtle %s error - character '%c'", label, c);
-      RAPTOR_FREE(char*, string);
-      return 1;
+    if(is_uri) {
+      /* single pass over the span with the shared N-Triples span
+       * primitive: stops at the next backslash OR forbidden raw space
+       * instead of scanning the span once per character class */
+      span = raptor_ntriples_scan_clean_span(s, len - i, '\\', ' ');
+      if(span) {
+        memcpy(d, s, span);
+        d += span;
+        s += span;
+        i += span;
+      }
+      if(i >= len)
+        break;
+      if(*s == ' ') {
+        error_handler(error_data,
+                      "Turtle %s error - character '%c'", label, ' ');
+        RAPTOR_FREE(char*, string);
+        return 1;
+      }
+      if(*s != '\\') {
+        /* raw control or non-ASCII byte - legal, copy it through */
+        *d++ = *s++;
+        i++;
+        continue;
+      }
+    } else {
+      /* strings carry raw UTF-8 freely, so just bulk-append up to
+       * the next backslash */
+      bs = (const unsigned char*)memchr(s, '\\', len - i);
+      span = bs ? RAPTOR_GOOD_CAST(size_t, bs - s) : (len - i);
+
+      if(span) {
+        memcpy(d, s, span);
+        d += span;
+        s += span;
+        i += span;
+      }
+
+      if(!bs)
+        break;
     }
 
-    if(c == '\\' ) {
-      s++; i++;
-      c = *s;
-      if(c == 'n' || c == 'r' || c == 't' || c == 'b' || c == 'f') {
-        if(is_uri) {
-          error_handler(error_data,
-                        "Turtle %s error - illegal URI escape '\\%c'", label, c);
-          RAPTOR_FREE(char*, string);
-          return 1;
-        }
-        if(c == 'n')
-          *d++ = '\n';
-        else if(c == 'r')
-          *d++ = '\r';
-        else if(c == 't')
-          *d++ = '\t';
-        else if(c == 'b')
-          *d++ = '\b';
-        else /* 'f' */
-          *d++ = '\f';
-      } else if(c == '\\' || c == delim ||
-              c == '-' || c == '_' || c == '~' || c == '.' || c == '!' ||
-              c == '$' || c == '&' || c == '\'' || c == '(' || c == ')' ||
-              c == '*' || c == '+' || c == ',' || c == ';' ||c == '=' ||
-              c == '/' || c == '?' || c == '#' || c == '@' ||c == '%')
-        *d++ = c;
-      else if(c == 'u' || c == 'U') {
-        size_t ulen = (c == 'u') ? 4 : 8;
-        unsigned long unichar = 0;
-        int n;
-        int unichar_width;
-        size_t ii;
-
-        s++; i++;
-        if(i+ulen > len) {
-          error_handler(error_data,
-                        "Turtle %s error - \\%c over end of line", label, c);
-          RAPTOR_FREE(char*, string);
-          return 1;
-        }
+    /* process the escape at *s */
+    s++; i++;
+    c = *s;
 
-        for(ii = 0; ii < ulen; ii++) {
-          char cc = s[ii];
-          if(!isxdigit(RAPTOR_GOOD_CAST(char, cc))) {
-            error_handler(error_data,
-                          "Turtle %s error - illegal hex digit %c in Unicode escape '%c%s...'",
-                          label, cc, c, s);
-            RAPTOR_FREE(char*, string);
-            return 1;
-          }
-        }
+    if(RAPTOR_TURTLE_CLASS(c) & RAPTOR_TURTLE_CLASS_ECHAR) {
+      if(is_uri) {
+        error_handler(error_data,
+                      "Turtle %s error - illegal URI escape '\\%c'", label, c);
+        RAPTOR_FREE(char*, string);
+        return 1;
+      }
+      if(c == 'n')
+        *d++ = '\n';
+      else if(c == 'r')
+        *d++ = '\r';
+      else if(c == 't')
+        *d++ = '\t';
+      else if(c == 'b')
+        *d++ = '\b';
+      else /* 'f' */
+        *d++ = '\f';
+    } else if(c == '\\' || c == delim ||
+              (RAPTOR_TURTLE_CLASS(c) & RAPTOR_TURTLE_CLASS_PN_LOCAL_ESC))
+      *d++ = c;
+    else if(c == 'u' || c == 'U') {
+      size_t ulen = (c == 'u') ? 4 : 8;
+      unsigned long unichar = 0;
+      int n;
+      int unichar_width;
+      size_t ii;
+
+      s++; i++;
+      if(i+ulen > len) {
+        error_handler(error_data,
+                      "Turtle %s error - \\%c over end of line", label, c);
+        RAPTOR_FREE(char*, string);
+        return 1;
+      }
 
-        n = sscanf((const char*)s, ((ulen == 4) ? "%04lx" : "%08lx"), &unichar);
-        if(n != 1) {
+      for(ii = 0; ii < ulen; ii++) {
+        char cc = s[ii];
+        if(!(RAPTOR_TURTLE_CLASS(cc) & RAPTOR_TURTLE_CLASS_UHEX)) {
           error_handler(error_data,
-                        "Turtle %s error - illegal Unicode escape '%c%s...'",
-                        label, c, s);
+                        "Turtle %s error - illegal hex digit %c in Unicode escape '%c%s...'",
+                        label, cc, c, s);
           RAPTOR_FREE(char*, string);
           return 1;
         }
+      }
 
-        s+= ulen-1;
-        i+= ulen-1;
-        
-        if(is_uri && (unichar == 0x0020 || unichar == 0x003C || unichar == 0x003E)) {
-          error_handler(error_data,
-                        "Turtle %s error - illegal Unicode escape \\u%04lX in URI.", label, unichar);
-          break;
-        }
+      n = sscanf((const char*)s, ((ulen == 4) ? "%04lx" : "%08lx"), &unichar);
+      if(n != 1) {
+        error_handler(error_data,
+                      "Turtle %s error - illegal Unicode escape '%c%s...'",
+                      label, c, s);
+        RAPTOR_FREE(char*, string);
+        return 1;
+      }
 
-        if(unichar > raptor_unicode_max_codepoint) {
-          error_handler(error_data,
-                        "Turtle %s error - illegal Unicode character with code point #x%lX (max #x%lX).", 
-                        label, unichar, raptor_unicode_max_codepoint);
-          RAPTOR_FREE(char*, string);
-          return 1;
-        }
-          
-        unichar_width = raptor_unicode_utf8_string_put_char(unichar, d, 
-                                                            len-(d-string));
-        if(unichar_width < 0) {
-          error_handler(error_data,
-                        "Turtle %s error - illegal Unicode character with code point #x%lX.", 
-                        label, unichar);
-          RAPTOR_FREE(char*, string);
-          return 1;
-        }
-        d += (size_t)unichar_width;
+      s+= ulen-1;
+      i+= ulen-1;
+      
+      if(is_uri && (unichar == 0x0020 || unichar == 0x003C || unichar == 0x003E)) {
+        error_handler(error_data,
+                      "Turtle %s error - illegal Unicode escape \\u%04lX in URI.", label, unichar);
+        break;
+      }
 
-      } else {
-        /* don't handle \x where x isn't one of: \t \n \r \\ (delim) */
+      if(unichar > raptor_unicode_max_codepoint) {
         error_handler(error_data,
-                      "Turtle %s error - illegal escape \\%c (#x%02X) in \"%s\"", 
-                      label, c, c, text);
+                      "Turtle %s error - illegal Unicode character with code point #x%lX (max #x%lX).", 
+                      label, unichar, raptor_unicode_max_codepoint);
+        RAPTOR_FREE(char*, string);
+        return 1;
       }
-    } else
-      *d++=c;
+        
+      unichar_width = raptor_unicode_utf8_string_put_char(unichar, d, 
+                                                          len-(d-string));
+      if(unichar_width < 0) {
+        error_handler(error_data,
+                      "Turtle %s error - illegal Unicode character with code point #x%lX.", 
+                      label, unichar);
+        RAPTOR_FREE(char*, string);
+        return 1;
+      }
+      d += (size_t)unichar_width;
+
+    } else {
+      /* don't handle \x where x isn't one of: \t \n \r \\ (delim) */
+      error_handler(error_data,
+                    "Turtle %s error - illegal escape \\%c (#x%02X) in \"%s\"",
+                    label, c, c, text);
+    }
+
+    s++; i++;
   }
   *d='\0';
 
@@ -238,88 +309,102 @@ raptor_turtle_expand_qname_escapes(unsigned char *name,
   if(!name)
     return -1;
 
-  for(s = name, d = name, i = 0; i < len; s++, i++) {
-    unsigned char c=*s;
+  s = name;
+  d = name;
+  i = 0;
+  while(i < len) {
+    unsigned char c;
+    const unsigned char *bs = (const unsigned char*)memchr(s, '\\', len - i);
+    size_t span = bs ? RAPTOR_GOOD_CAST(size_t, bs - s) : (len - i);
+
+    /* bulk-move the escape-free span up to the next backslash */
+    if(span) {
+      memmove(d, s, span);
+      d += span;
+      s += span;
+      i += span;
+    }
+
+    if(!bs)
+      break;
+
+    /* process the escape at *s */
+    s++; i++;
+    c = *s;
+
+    if(c == 'n')
+      *d++ = '\n';
+    else if(c == 'r')
+      *d++ = '\r';
+    else if(c == 't')
+      *d++ = '\t';
+    else if(c == 'b')
+      *d++ = '\b';
+    else if(c == 'f')
+      *d++ = '\f';
+    else if(c == '\\' ||
+            (RAPTOR_TURTLE_CLASS(c) & RAPTOR_TURTLE_CLASS_PN_LOCAL_ESC))
+      *d++ = c;
+    else if(c == 'u' || c == 'U') {
+      size_t ulen = (c == 'u') ? 4 : 8;
+      unsigned long unichar = 0;
+      int n;
+      int unichar_width;
+      size_t ii;
 
-    if(c == '\\' ) {
       s++; i++;
-      c = *s;
-      if(c == 'n')
-        *d++ = '\n';
-      else if(c == 'r')
-        *d++ = '\r';
-      else if(c == 't')
-        *d++ = '\t';
-      else if(c == 'b')
-        *d++ = '\b';
-      else if(c == 'f')
-        *d++ = '\f';
-      else if(c == '\\' ||
-              c == '-' || c == '_' || c == '~' || c == '.' || c == '!' ||
-              c == '$' || c == '&' || c == '\'' || c == '(' || c == ')' ||
-              c == '*' || c == '+' || c == ',' || c == ';' ||c == '=' ||
-              c == '/' || c == '?' || c == '#' || c == '@' ||c == '%')
-        *d++ = c;
-      else if(c == 'u' || c == 'U') {
-        size_t ulen = (c == 'u') ? 4 : 8;
-        unsigned long unichar = 0;
-        int n;
-        int unichar_width;
-        size_t ii;
-
-        s++; i++;
-        if(i+ulen > len) {
+      if(i+ulen > len) {
+        error_handler(error_data,
+                      "Turtle name error - \\%c over end of line", c);
+        return 1;
+      }
+      
+      for(ii = 0; ii < ulen; ii++) {
+        char cc = s[ii];
+        if(!(RAPTOR_TURTLE_CLASS(cc) & RAPTOR_TURTLE_CLASS_UHEX)) {
           error_handler(error_data,
-                        "Turtle name error - \\%c over end of line", c);
+                        "Turtle name error - illegal hex digit %c in Unicode escape '%c%s...'",
+                        cc, c, s);
           return 1;
         }
-        
-        for(ii = 0; ii < ulen; ii++) {
-          char cc = s[ii];
-          if(!isxdigit(RAPTOR_GOOD_CAST(char, cc))) {
-            error_handler(error_data,
-                          "Turtle name error - illegal hex digit %c in Unicode escape '%c%s...'",
-                          cc, c, s);
-            return 1;
-          }
-        }
+      }
 
-        n = sscanf((const char*)s, ((ulen == 4) ? "%04lx" : "%08lx"), &unichar);
-        if(n != 1) {
-          error_handler(error_data,
-                        "Turtle name error - illegal Uncode escape '%c%s...'",
-                        c, s);
-          return 1;
-        }
+      n = sscanf((const char*)s, ((ulen == 4) ? "%04lx" : "%08lx"), &unichar);
+      if(n != 1) {
+        error_handler(error_data,
+                      "Turtle name error - illegal Uncode escape '%c%s...'",
+                      c, s);
+        return 1;
+      }
 
-        s+= ulen-1;
-        i+= ulen-1;
+      s+= ulen-1;
+      i+= ulen-1;
+      
+      if(unichar > raptor_unicode_max_codepoint) {
+        error_handler(error_data,
+                      "Turtle name error - illegal Unicode character with code point #x%lX (max #x%lX).", 
+                      unichar, raptor_unicode_max_codepoint);
+        return 1;
+      }
         
-        if(unichar > raptor_unicode_max_codepoint) {
-          error_handler(error_data,
-                        "Turtle name error - illegal Unicode character with code point #x%lX (max #x%lX).", 
-                        unichar, raptor_unicode_max_codepoint);
-          return 1;
-        }
-          
-        unichar_width = raptor_unicode_utf8_string_put_char(unichar, d, 
-                                                            len - (d-name));
-        if(unichar_width < 0) {
-          error_handler(error_data,
-                        "Turtle name error - illegal Unicode character with code point #x%lX.", 
-                        unichar);
-          return 1;
-        }
-        d += (size_t)unichar_width;
-
-      } else {
-        /* don't handle \x where x isn't one of: \t \n \r \\ (delim) */
+      unichar_width = raptor_unicode_utf8_string_put_char(unichar, d, 
+                                                          len - (d-name));
+      if(unichar_width < 0) {
         error_handler(error_data,
-                      "Turtle name error - illegal escape \\%c (#x%02X) in \"%s\"", 
-                      c, c, name);
+                      "Turtle name error - illegal Unicode character with code point #x%lX.", 
+                      unichar);
+        return 1;
       }
-    } else
-      *d++ = c;
+      d += (size_t)unichar_width;
+
+    } else {
+      /* don't handle \x where x isn't one of: \t \n \r \\ (delim) */
+      error_handler(error_data,
+                    "Turtle name error - illegal escape \\%c (#x%02X) in \"%s\"",
+                    c, c, name);
+    }
+
+    s++; i++;
   }
   *d='\0';
 
@@ -329,3 +414,73 @@ raptor_turtle_expand_qname_escapes(unsigned char *name,
   /* string gets owned by the stringbuffer after this */
   return len;
 }
+
+
+/*
+ * raptor_turtle_arena_alloc:
+ * @turtle_parser: Turtle parser object
+ * @len: bytes wanted
+ *
+ * INTERNAL - Allocate token memory from the parser's bump arena.
+ *
+ * Grammar-action token strings are all freed within the statement
+ * that consumed them, so they are carved out of a single block with a
+ * pointer bump.  Requests that do not fit the block fall back to the
+ * heap; raptor_turtle_arena_free() tells the two apart.
+ *
+ * Return value: new memory or NULL on failure
+ */
+unsigned char*
+raptor_turtle_arena_alloc(raptor_turtle_parser* turtle_parser, size_t len)
+{
+  unsigned char* p;
+
+  if(!turtle_parser->arena_block) {
+    turtle_parser->arena_block = RAPTOR_MALLOC(unsigned char*,
+                                               RAPTOR_TURTLE_ARENA_SIZE);
+    if(!turtle_parser->arena_block)
+      return RAPTOR_MALLOC(unsigned char*, len);
+  }
+
+  if(turtle_parser->arena_offset + len > RAPTOR_TURTLE_ARENA_SIZE)
+    return RAPTOR_MALLOC(unsigned char*, len);
+
+  p = turtle_parser->arena_block + turtle_parser->arena_offset;
+  turtle_parser->arena_offset += len;
+  turtle_parser->arena_live++;
+
+  return p;
+}
+
+
+/*
+ * raptor_turtle_arena_free:
+ * @turtle_parser: Turtle parser object
+ * @ptr: memory to release (may be NULL)
+ *
+ * INTERNAL - Release token memory from raptor_turtle_arena_alloc().
+ *
+ * Arena pointers just decrement the live count; when it reaches zero
+ * the whole arena rewinds, which is what makes the allocations cheap.
+ * Heap fallback pointers are freed normally.
+ */
+void
+raptor_turtle_arena_free(raptor_turtle_parser* turtle_parser, void* ptr)
+{
+  unsigned char* p = (unsigned char*)ptr;
+
+  if(!p)
+    return;
+
+  if(turtle_parser->arena_block &&
+     p >= turtle_parser->arena_block &&
+     p < turtle_parser->arena_block + RAPTOR_TURTLE_ARENA_SIZE) {
+    if(--turtle_parser->arena_live <= 0) {
+      turtle_parser->arena_live = 0;
+      turtle_parser->arena_offset = 0;
+    }
+    return;
+  }
+
+  RAPTOR_FREE(char*, p);
+}
@@ -35,8 +35,24 @@ RAPTOR_INTERNAL_API int turtle_syntax_error(raptor_parser *rdf_parser, const cha
 RAPTOR_INTERNAL_API raptor_uri* turtle_qname_to_uri(raptor_parser *rdf_parser, unsigned char *name, size_t name_len);
 RAPTOR_INTERNAL_API size_t raptor_turtle_expand_qname_escapes(unsigned char *name, size_t len, raptor_simple_message_handler error_handler, void *error_data);
 
+/* turtle_common.c */
+RAPTOR_INTERNAL_API unsigned char* raptor_turtle_arena_alloc(struct raptor_turtle_parser_s* turtle_parser, size_t len);
+RAPTOR_INTERNAL_API void raptor_turtle_arena_free(struct raptor_turtle_parser_s* turtle_parser, void* ptr);
+
+/* Character class bits for raptor_turtle_char_classes[] */
+/* simple string escape char: one of t b n r f after a backslash */
+#define RAPTOR_TURTLE_CLASS_ECHAR          1
+/* reserved char escapable in local names and strings (Turtle 2013) */
+#define RAPTOR_TURTLE_CLASS_PN_LOCAL_ESC   2
+/* char forbidden raw inside an IRIREF */
+#define RAPTOR_TURTLE_CLASS_IRI_FORBIDDEN  4
+/* hex digit for \uXXXX / \UXXXXXXXX escapes */
+#define RAPTOR_TURTLE_CLASS_UHEX           8
+
+extern const unsigned char raptor_turtle_char_classes[256];
+
 /* turtle_lexer.l */
-extern void turtle_token_free(raptor_world* world, int token, YYSTYPE *lval);
+extern void turtle_token_free(raptor_parser* rdf_parser, int token, YYSTYPE *lval);
 
 
 /*
@@ -88,8 +104,18 @@ struct raptor_turtle_parser_s {
 
   /* Last run of many */
   int is_end;
+
+  /* bump arena for grammar-action token strings; freeing an arena
+   * pointer is a no-op and the arena rewinds once no token is live */
+  unsigned char* arena_block;
+  size_t arena_offset;
+  int arena_live;
 };
 
+/* size of the token arena block; tokens that do not fit fall back to
+ * the heap */
+#define RAPTOR_TURTLE_ARENA_SIZE 16384
+
 
 #ifdef __cplusplus
 }
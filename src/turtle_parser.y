@@ -94,6 +94,10 @@ const char * turtle_token_print(raptor_world* world, int token, YYSTYPE *lval);
 /* Prototypes */ 
 int turtle_parser_error(raptor_parser* rdf_parser, void* scanner, const char *msg);
 
+/* Free a token string; most come from the parser's bump arena where
+ * this is a pointer-bump accounting no-op - see turtle_common.c */
+#define TURTLE_FREE_TOKEN(s) raptor_turtle_arena_free((raptor_turtle_parser*)rdf_parser->context, (void*)(s))
+
 /* Make lex/yacc interface as small as possible */
 #undef yylex
 #define yylex turtle_lexer_lex
@@ -188,7 +192,7 @@ static void raptor_turtle_handle_statement(raptor_parser *parser, raptor_stateme
 
 %destructor {
   if($$)
-    RAPTOR_FREE(char*, $$);
+    TURTLE_FREE_TOKEN($$);
 } STRING_LITERAL BLANK_LITERAL INTEGER_LITERAL FLOATING_LITERAL DECIMAL_LITERAL IDENTIFIER LANGTAG
 
 %destructor {
@@ -758,7 +762,7 @@ prefix: PREFIX IDENTIFIER URI_LITERAL DOT
   }
 
   if($2)
-    RAPTOR_FREE(char*, $2);
+    TURTLE_FREE_TOKEN($2);
   raptor_free_uri($3);
 
   if(!ns)
@@ -792,7 +796,7 @@ prefix: PREFIX IDENTIFIER URI_LITERAL DOT
   }
 
   if($2)
-    RAPTOR_FREE(char*, $2);
+    TURTLE_FREE_TOKEN($2);
   raptor_free_uri($3);
 
   if(!ns)
@@ -877,8 +881,8 @@ literal: STRING_LITERAL LANGTAG
 #endif
 
   $$ = raptor_new_term_from_literal(rdf_parser->world, $1, NULL, $2);
-  RAPTOR_FREE(char*, $1);
-  RAPTOR_FREE(char*, $2);
+  TURTLE_FREE_TOKEN($1);
+  TURTLE_FREE_TOKEN($2);
   if(!$$)
     YYERROR;
 }
@@ -892,12 +896,12 @@ literal: STRING_LITERAL LANGTAG
     if($2) {
       raptor_parser_error(rdf_parser,
                           "Language not allowed with datatyped literal");
-      RAPTOR_FREE(char*, $2);
+      TURTLE_FREE_TOKEN($2);
       $2 = NULL;
     }
   
     $$ = raptor_new_term_from_literal(rdf_parser->world, $1, $4, NULL);
-    RAPTOR_FREE(char*, $1);
+    TURTLE_FREE_TOKEN($1);
     raptor_free_uri($4);
     if(!$$)
       YYERROR;
@@ -915,12 +919,12 @@ literal: STRING_LITERAL LANGTAG
     if($2) {
       raptor_parser_error(rdf_parser,
                           "Language not allowed with datatyped literal");
-      RAPTOR_FREE(char*, $2);
+      TURTLE_FREE_TOKEN($2);
       $2 = NULL;
     }
   
     $$ = raptor_new_term_from_literal(rdf_parser->world, $1, $4, NULL);
-    RAPTOR_FREE(char*, $1);
+    TURTLE_FREE_TOKEN($1);
     raptor_free_uri($4);
     if(!$$)
       YYERROR;
@@ -936,7 +940,7 @@ literal: STRING_LITERAL LANGTAG
 
   if($3) {
     $$ = raptor_new_term_from_literal(rdf_parser->world, $1, $3, NULL);
-    RAPTOR_FREE(char*, $1);
+    TURTLE_FREE_TOKEN($1);
     raptor_free_uri($3);
     if(!$$)
       YYERROR;
@@ -952,7 +956,7 @@ literal: STRING_LITERAL LANGTAG
 
   if($3) {
     $$ = raptor_new_term_from_literal(rdf_parser->world, $1, $3, NULL);
-    RAPTOR_FREE(char*, $1);
+    TURTLE_FREE_TOKEN($1);
     raptor_free_uri($3);
     if(!$$)
       YYERROR;
@@ -966,7 +970,7 @@ literal: STRING_LITERAL LANGTAG
 #endif
 
   $$ = raptor_new_term_from_literal(rdf_parser->world, $1, NULL, NULL);
-  RAPTOR_FREE(char*, $1);
+  TURTLE_FREE_TOKEN($1);
   if(!$$)
     YYERROR;
 }
@@ -976,9 +980,9 @@ literal: STRING_LITERAL LANGTAG
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
   printf("resource integer=%s\n", $1);
 #endif
-  uri = raptor_uri_copy(rdf_parser->world->xsd_integer_uri);
+  uri = raptor_uri_copy(rdf_parser->world->xsd_datatype_uris[RAPTOR_XSD_DATATYPE_INTEGER]);
   $$ = raptor_new_term_from_literal(rdf_parser->world, $1, uri, NULL);
-  RAPTOR_FREE(char*, $1);
+  TURTLE_FREE_TOKEN($1);
   raptor_free_uri(uri);
   if(!$$)
     YYERROR;
@@ -989,9 +993,9 @@ literal: STRING_LITERAL LANGTAG
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
   printf("resource double=%s\n", $1);
 #endif
-  uri = raptor_uri_copy(rdf_parser->world->xsd_double_uri);
+  uri = raptor_uri_copy(rdf_parser->world->xsd_datatype_uris[RAPTOR_XSD_DATATYPE_DOUBLE]);
   $$ = raptor_new_term_from_literal(rdf_parser->world, $1, uri, NULL);
-  RAPTOR_FREE(char*, $1);
+  TURTLE_FREE_TOKEN($1);
   raptor_free_uri(uri);
   if(!$$)
     YYERROR;
@@ -1002,13 +1006,13 @@ literal: STRING_LITERAL LANGTAG
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
   printf("resource decimal=%s\n", $1);
 #endif
-  uri = raptor_uri_copy(rdf_parser->world->xsd_decimal_uri);
+  uri = raptor_uri_copy(rdf_parser->world->xsd_datatype_uris[RAPTOR_XSD_DATATYPE_DECIMAL]);
   if(!uri) {
-    RAPTOR_FREE(char*, $1);
+    TURTLE_FREE_TOKEN($1);
     YYERROR;
   }
   $$ = raptor_new_term_from_literal(rdf_parser->world, $1, uri, NULL);
-  RAPTOR_FREE(char*, $1);
+  TURTLE_FREE_TOKEN($1);
   raptor_free_uri(uri);
   if(!$$)
     YYERROR;
@@ -1019,7 +1023,7 @@ literal: STRING_LITERAL LANGTAG
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
   fputs("resource boolean true\n", stderr);
 #endif
-  uri = raptor_uri_copy(rdf_parser->world->xsd_boolean_uri);
+  uri = raptor_uri_copy(rdf_parser->world->xsd_datatype_uris[RAPTOR_XSD_DATATYPE_BOOLEAN]);
   $$ = raptor_new_term_from_literal(rdf_parser->world,
                                     (const unsigned char*)"true", uri, NULL);
   raptor_free_uri(uri);
@@ -1032,7 +1036,7 @@ literal: STRING_LITERAL LANGTAG
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
   fputs("resource boolean false\n", stderr);
 #endif
-  uri = raptor_uri_copy(rdf_parser->world->xsd_boolean_uri);
+  uri = raptor_uri_copy(rdf_parser->world->xsd_datatype_uris[RAPTOR_XSD_DATATYPE_BOOLEAN]);
   $$ = raptor_new_term_from_literal(rdf_parser->world,
                                     (const unsigned char*)"false", uri, NULL);
   raptor_free_uri(uri);
@@ -1086,16 +1090,12 @@ predicateObjectListOpt: predicateObjectList
 
 blankNode: BLANK_LITERAL
 {
-  const unsigned char *id;
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
+#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
   printf("subject blank=\"%s\"\n", $1);
 #endif
-  id = raptor_world_internal_generate_id(rdf_parser->world, $1);
-  if(!id)
-    YYERROR;
-
-  $$ = raptor_new_term_from_blank(rdf_parser->world, id);
-  RAPTOR_FREE(char*, id);
+  $$ = raptor_parser_get_blank_term(rdf_parser, $1,
+                                    strlen((const char*)$1));
+  RAPTOR_FREE(char*, $1);
 
   if(!$$)
     YYERROR;
@@ -1107,7 +1107,7 @@ blankNodePropertyList: LEFT_SQUARE predicateObjectListOpt RIGHT_SQUARE
   int i;
   const unsigned char *id;
 
-  id = raptor_world_generate_bnodeid(rdf_parser->world);
+  id = raptor_parser_internal_generate_id(rdf_parser, NULL);
   if(!id) {
     if($2)
       raptor_free_sequence($2);
@@ -1195,7 +1195,7 @@ collection: LEFT_ROUND itemList RIGHT_ROUND
     raptor_statement* t2 = (raptor_statement*)raptor_sequence_get_at($2, i);
     const unsigned char *blank_id;
 
-    blank_id = raptor_world_generate_bnodeid(rdf_parser->world);
+    blank_id = raptor_parser_internal_generate_id(rdf_parser, NULL);
     if(!blank_id)
       YYERR_MSG_GOTO(err_collection, "Cannot create bnodeid");
 
@@ -1292,7 +1292,10 @@ turtle_parser_error(raptor_parser* rdf_parser, void* scanner, const char *msg)
      * sorting it in the next run aye? */
     return 0;
   }
-  
+
+  if(rdf_parser->option_snapshot.fail_fast)
+    rdf_parser->failed = 1;
+
   if(turtle_parser->error_count++)
     return 0;
 
@@ -1317,6 +1320,9 @@ turtle_syntax_error(raptor_parser *rdf_parser, const char *message, ...)
   if(!turtle_parser)
     return 1;
 
+  if(rdf_parser->option_snapshot.fail_fast)
+    rdf_parser->failed = 1;
+
   if(turtle_parser->error_count++)
     return 0;
 
@@ -1361,9 +1367,10 @@ turtle_qname_to_uri(raptor_parser *rdf_parser, unsigned char *name, size_t name_
 
 #ifndef TURTLE_PUSH_PARSE
 static int
-turtle_parse(raptor_parser *rdf_parser, const char *string, size_t length)
+turtle_parse(raptor_parser *rdf_parser, char *string, size_t length)
 {
   raptor_turtle_parser* turtle_parser = (raptor_turtle_parser*)rdf_parser->context;
+  char hold[2];
   int rc;
   
   if(!string || !*string)
@@ -1379,13 +1386,28 @@ turtle_parse(raptor_parser *rdf_parser, const char *string, size_t length)
 #endif
 
   turtle_lexer_set_extra(rdf_parser, turtle_parser->scanner);
-  (void)turtle_lexer__scan_bytes((char *)string, (int)length, turtle_parser->scanner);
+
+  /* Zero-copy token handoff: scan the line buffer in place rather
+   * than letting flex duplicate the whole region.
+   * turtle_lexer__scan_buffer() requires two NUL bytes after the
+   * scanned region; when this is not the final chunk they overwrite
+   * bytes of the unconsumed tail, so save and restore them around the
+   * parse.  The buffer always has two spare bytes - see
+   * raptor_turtle_parse_chunk().
+   */
+  hold[0] = string[length];
+  hold[1] = string[length + 1];
+  string[length] = string[length + 1] = '\0';
+  (void)turtle_lexer__scan_buffer(string, length + 2, turtle_parser->scanner);
 
   rc = turtle_parser_parse(rdf_parser, turtle_parser->scanner);
 
   turtle_lexer_lex_destroy(turtle_parser->scanner);
   turtle_parser->scanner_set = 0;
 
+  string[length] = hold[0];
+  string[length + 1] = hold[1];
+
   return rc;
 }
 #endif
@@ -1496,6 +1518,11 @@ raptor_turtle_parse_terminate(raptor_parser *rdf_parser) {
   if(turtle_parser->buffer)
     RAPTOR_FREE(cdata, turtle_parser->buffer);
 
+  if(turtle_parser->arena_block) {
+    RAPTOR_FREE(char*, turtle_parser->arena_block);
+    turtle_parser->arena_block = NULL;
+  }
+
   if(turtle_parser->graph_name) {
     raptor_free_term(turtle_parser->graph_name);
     turtle_parser->graph_name = NULL;
@@ -1574,7 +1601,7 @@ raptor_turtle_handle_statement(raptor_parser *parser, raptor_statement *t)
     return;
 
   /* Generate the statement */
-  (*parser->statement_handler)(parser->user_data, t);
+  raptor_parser_emit_statement_inline(parser, t);
 }
 
 static void
@@ -1647,8 +1674,10 @@ raptor_turtle_parse_chunk(raptor_parser* rdf_parser,
     /* resize */
     size_t new_buffer_length = turtle_parser->end_of_buffer;
 
+    /* +2 gives the lexer room for the two NUL bytes an in-place
+     * turtle_lexer__scan_buffer() scan needs beyond the region */
     turtle_parser->buffer = RAPTOR_REALLOC(char*, turtle_parser->buffer,
-                                           new_buffer_length + 1);
+                                           new_buffer_length + 2);
 
     /* adjust stored length */
     turtle_parser->buffer_length = new_buffer_length;
@@ -50,6 +50,9 @@
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
 #endif
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
 
 
 
@@ -184,7 +187,7 @@ relay_namespaces(void* user_data, raptor_namespace *nspace)
 #endif
 
 
-#define GETOPT_STRING "cef:ghi:I:o:O:qrtvw"
+#define GETOPT_STRING "cef:ghi:I:j:o:O:qrtvw"
 
 #ifdef HAVE_GETOPT_LONG
 #define SHOW_NAMESPACES_FLAG 0x100
@@ -200,6 +203,7 @@ static const struct option long_options[] =
   {"help", 0, 0, 'h'},
   {"input", 1, 0, 'i'},
   {"input-uri", 1, 0, 'I'},
+  {"jobs", 1, 0, 'j'},
   {"output", 1, 0, 'o'},
   {"output-uri", 1, 0, 'O'},
   {"quiet", 0, 0, 'q'},
@@ -302,6 +306,283 @@ typedef struct
 } option_value;
 
 
+/*
+ * Multi-file conversion mode (-j N file1 file2 ...)
+ *
+ * A pool of workers converts many input files in one process, writing
+ * each output next to its input.  Every worker owns a private
+ * raptor_world with a parser/serializer pair created once and reused,
+ * since a raptor_world must not be shared between threads; the win is
+ * paying world setup N times instead of once per file.
+ */
+
+typedef struct
+{
+  raptor_serializer* serializer;
+  long triples;
+} rapper_batch_file_state;
+
+typedef struct
+{
+  /* shared, read only */
+  const char* syntax_name;
+  const char* serializer_syntax_name;
+  char** filenames;
+  int file_count;
+  raptor_sequence* parser_options;
+  raptor_sequence* serializer_options;
+
+  /* shared cursor over filenames */
+  int* next_index;
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_t* lock;
+  pthread_t thread;
+#endif
+
+  /* per worker results */
+  long triple_count;
+  int failed;
+} rapper_batch_worker;
+
+
+static void
+rapper_batch_triples(void *user_data, raptor_statement *triple)
+{
+  rapper_batch_file_state* state = (rapper_batch_file_state*)user_data;
+
+  state->triples++;
+  if(state->serializer)
+    raptor_serializer_serialize_statement(state->serializer, triple);
+}
+
+
+/* convert one file with the worker's world; returns non-0 on failure */
+static int
+rapper_batch_convert_file(rapper_batch_worker* worker, raptor_world* world,
+                          const char* filename)
+{
+  raptor_parser* parser = NULL;
+  raptor_iostream* iostr = NULL;
+  rapper_batch_file_state state;
+  unsigned char* file_uri_string = NULL;
+  raptor_uri* file_uri = NULL;
+  char* output_filename = NULL;
+  int i;
+  int failed = 1;
+
+  state.serializer = NULL;
+  state.triples = 0;
+
+  parser = raptor_new_parser(world, worker->syntax_name);
+  if(!parser) {
+    fprintf(stderr, "%s: Failed to create raptor parser type %s\n",
+            program, worker->syntax_name);
+    return 1;
+  }
+
+  if(worker->parser_options) {
+    for(i = 0; i < raptor_sequence_size(worker->parser_options); i++) {
+      option_value *fv;
+      fv = (option_value*)raptor_sequence_get_at(worker->parser_options, i);
+      raptor_parser_set_option(parser, fv->option, fv->s_value, fv->i_value);
+    }
+  }
+
+  raptor_parser_set_statement_handler(parser, &state, rapper_batch_triples);
+
+  if(worker->serializer_syntax_name) {
+    size_t len = strlen(filename);
+    size_t name_len = strlen(worker->serializer_syntax_name);
+
+    state.serializer = raptor_new_serializer(world,
+                                             worker->serializer_syntax_name);
+    if(!state.serializer) {
+      fprintf(stderr, "%s: Failed to create raptor serializer type %s\n",
+              program, worker->serializer_syntax_name);
+      goto tidy;
+    }
+
+    if(worker->serializer_options) {
+      for(i = 0; i < raptor_sequence_size(worker->serializer_options); i++) {
+        option_value *fv;
+        fv = (option_value*)raptor_sequence_get_at(worker->serializer_options,
+                                                   i);
+        raptor_serializer_set_option(state.serializer, fv->option,
+                                     fv->s_value, fv->i_value);
+      }
+    }
+
+    /* output goes next to the input as FILENAME.SERIALIZER-NAME */
+    output_filename = (char*)raptor_alloc_memory(len + 1 + name_len + 1);
+    if(!output_filename)
+      goto tidy;
+    memcpy(output_filename, filename, len);
+    output_filename[len] = '.';
+    memcpy(output_filename + len + 1, worker->serializer_syntax_name,
+           name_len + 1);
+
+    iostr = raptor_new_iostream_to_filename(world, output_filename);
+    if(!iostr) {
+      fprintf(stderr, "%s: Failed to create output file %s\n",
+              program, output_filename);
+      goto tidy;
+    }
+
+    if(raptor_serializer_start_to_iostream(state.serializer, NULL, iostr))
+      goto tidy;
+  }
+
+  file_uri_string = raptor_uri_filename_to_uri_string(filename);
+  if(!file_uri_string)
+    goto tidy;
+  file_uri = raptor_new_uri(world, file_uri_string);
+  if(!file_uri)
+    goto tidy;
+
+  if(raptor_parser_parse_file(parser, file_uri, NULL)) {
+    fprintf(stderr, "%s: Failed to parse file %s %s content\n",
+            program, filename, worker->syntax_name);
+    goto tidy;
+  }
+
+  failed = 0;
+  worker->triple_count += state.triples;
+
+  tidy:
+  raptor_free_parser(parser);
+  if(state.serializer) {
+    raptor_serializer_serialize_end(state.serializer);
+    raptor_free_serializer(state.serializer);
+  }
+  if(iostr)
+    raptor_free_iostream(iostr);
+  if(file_uri)
+    raptor_free_uri(file_uri);
+  if(file_uri_string)
+    raptor_free_memory(file_uri_string);
+  if(output_filename)
+    raptor_free_memory(output_filename);
+
+  return failed;
+}
+
+
+static void*
+rapper_batch_worker_run(void* arg)
+{
+  rapper_batch_worker* worker = (rapper_batch_worker*)arg;
+  raptor_world* world;
+
+  world = raptor_new_world();
+  if(!world || raptor_world_open(world)) {
+    worker->failed = 1;
+    return NULL;
+  }
+
+  for(;;) {
+    int i;
+
+#ifdef HAVE_PTHREAD_H
+    pthread_mutex_lock(worker->lock);
+    i = (*worker->next_index)++;
+    pthread_mutex_unlock(worker->lock);
+#else
+    i = (*worker->next_index)++;
+#endif
+    if(i >= worker->file_count)
+      break;
+
+    if(rapper_batch_convert_file(worker, world, worker->filenames[i]))
+      worker->failed = 1;
+  }
+
+  raptor_free_world(world);
+  return NULL;
+}
+
+
+/* convert many files with a pool of N workers; returns non-0 on failure */
+static int
+rapper_batch_convert(char** filenames, int file_count, int jobs,
+                     const char* syntax_name,
+                     const char* serializer_syntax_name,
+                     raptor_sequence* parser_options,
+                     raptor_sequence* serializer_options)
+{
+  rapper_batch_worker* workers;
+  int next_index = 0;
+  long total_triples = 0;
+  int failed = 0;
+  int i;
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_t lock;
+  int started = 0;
+#endif
+
+  if(jobs > file_count)
+    jobs = file_count;
+#ifndef HAVE_PTHREAD_H
+  jobs = 1;
+#endif
+
+  workers = (rapper_batch_worker*)raptor_calloc_memory(jobs,
+                                                       sizeof(*workers));
+  if(!workers)
+    return 1;
+
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_init(&lock, NULL);
+#endif
+
+  for(i = 0; i < jobs; i++) {
+    workers[i].syntax_name = syntax_name;
+    workers[i].serializer_syntax_name = serializer_syntax_name;
+    workers[i].filenames = filenames;
+    workers[i].file_count = file_count;
+    workers[i].parser_options = parser_options;
+    workers[i].serializer_options = serializer_options;
+    workers[i].next_index = &next_index;
+#ifdef HAVE_PTHREAD_H
+    workers[i].lock = &lock;
+#endif
+  }
+
+#ifdef HAVE_PTHREAD_H
+  for(i = 0; i < jobs; i++) {
+    if(pthread_create(&workers[i].thread, NULL,
+                      rapper_batch_worker_run, &workers[i])) {
+      /* on thread creation failure, convert this worker's share inline */
+      rapper_batch_worker_run(&workers[i]);
+    }
+    started++;
+  }
+
+  for(i = 0; i < started; i++)
+    pthread_join(workers[i].thread, NULL);
+#else
+  rapper_batch_worker_run(&workers[0]);
+#endif
+
+  for(i = 0; i < jobs; i++) {
+    total_triples += workers[i].triple_count;
+    if(workers[i].failed)
+      failed = 1;
+  }
+
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_destroy(&lock);
+#endif
+  raptor_free_memory(workers);
+
+  if(!quiet)
+    fprintf(stderr, "%s: Converted %d files returning %ld triples\n",
+            program, file_count, total_triples);
+
+  return failed;
+}
+
+
+
 
 int
 main(int argc, char *argv[]) 
@@ -333,6 +614,7 @@ main(int argc, char *argv[])
 
   /* other variables */
   int rc;
+  int jobs = 0;
   int usage = 0;
   int help = 0;
   char *p;
@@ -597,6 +879,18 @@ main(int argc, char *argv[])
         if(optarg)
           base_uri_string = (unsigned char*)optarg;
         break;
+
+      case 'j':
+        if(optarg) {
+          jobs = atoi(optarg);
+          if(jobs < 1) {
+            fprintf(stderr,
+                    "%s: invalid argument `%s' for `" HELP_ARG(j, jobs) "'\n",
+                    program, optarg);
+            usage = 1;
+          }
+        }
+        break;
         
       case 'w':
         ignore_warnings = 1;
@@ -629,7 +923,10 @@ main(int argc, char *argv[])
 
   }
 
-  if(optind != argc-1 && optind != argc-2 && !help && !usage) {
+  if(jobs) {
+    if(optind >= argc && !help && !usage)
+      usage = 2; /* Title and usage */
+  } else if(optind != argc-1 && optind != argc-2 && !help && !usage) {
     usage = 2; /* Title and usage */
   }
 
@@ -685,6 +982,7 @@ main(int argc, char *argv[])
         putchar('\n');
     }
     puts(HELP_TEXT("I URI", "input-uri URI   ", "Set the input/parser base URI. '-' for none.") HELP_PAD "    Default is INPUT-BASE-URI argument value.");
+    puts(HELP_TEXT("j N", "jobs N          ", "Convert multiple input files with N parallel jobs;") HELP_PAD "    all arguments are input filenames and each output is" HELP_PAD "    written to FILENAME.SERIALIZER-NAME next to its input.");
     putchar('\n');
 
     puts(HELP_TEXT("o FORMAT", "output FORMAT", "Set the output format/serializer to one of:"));
@@ -726,6 +1024,25 @@ main(int argc, char *argv[])
   }
 
 
+  if(jobs) {
+    if(guess)
+      syntax_name = "guess";
+
+    rc = rapper_batch_convert(argv + optind, argc - optind, jobs,
+                              syntax_name,
+                              count ? NULL : serializer_syntax_name,
+                              parser_options, serializer_options);
+
+    if(parser_options)
+      raptor_free_sequence(parser_options);
+    if(serializer_options)
+      raptor_free_sequence(serializer_options);
+    if(namespace_declarations)
+      raptor_free_sequence(namespace_declarations);
+    raptor_free_world(world);
+    return rc;
+  }
+
   if(optind == argc-1)
     uri_string = (unsigned char*)argv[optind];
   else {
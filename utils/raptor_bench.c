@@ -0,0 +1,441 @@
+/* -*- Mode: c; c-basic-offset: 2 -*-
+ *
+ * raptor_bench.c - Raptor parser and serializer throughput benchmark
+ *
+ * Copyright (C) 2010, David Beckett http://www.dajobe.org/
+ *
+ * This package is Free Software and part of Redland http://librdf.org/
+ *
+ * It is licensed under the following three licenses as alternatives:
+ *   1. GNU Lesser General Public License (LGPL) V2.1 or any newer version
+ *   2. GNU General Public License (GPL) V2 or any newer version
+ *   3. Apache License, V2.0 or any newer version
+ *
+ * You may not use this file except in compliance with at least one of
+ * the above three licenses.
+ *
+ * See LICENSE.html or LICENSE.txt at the top of this package for the
+ * complete terms and further detail along with the license texts for
+ * the licenses in COPYING.LIB, COPYING and LICENSE-2.0.txt respectively.
+ *
+ *
+ * Generates a synthetic corpus, serializes it with each serializer
+ * and parses the result back with the matching parser, reporting
+ * throughput one benchmark per line as key=value pairs:
+ *
+ *   op=serialize syntax=ntriples triples=... bytes=... seconds=... \
+ *     triples_per_sec=... mb_per_sec=... peak_rss_kb=...
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <raptor_config.h>
+#endif
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
+/* many places for getopt */
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#else
+#include <raptor_getopt.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+#ifndef WIN32
+#include <sys/resource.h>
+#endif
+
+/* Raptor includes */
+#include <raptor2.h>
+
+static char *program = NULL;
+
+static const char * const title_string =
+  "Raptor RDF parse/serialize throughput benchmark";
+
+/* default number of synthetic triples per corpus */
+#define BENCH_DEFAULT_TRIPLE_COUNT 100000
+
+/* distinct subjects/predicates the generator cycles through */
+#define BENCH_SUBJECT_WIDTH 1000
+#define BENCH_PREDICATE_WIDTH 50
+
+static const char* const bench_syntax_names[] = {
+  "ntriples", "turtle", "rdfxml", NULL
+};
+
+
+#define GETOPT_STRING "hs:t:"
+
+#ifdef HAVE_GETOPT_LONG
+static const struct option long_options[] =
+{
+  /* name, has_arg, flag, val */
+  {"help", 0, 0, 'h'},
+  {"syntax", 1, 0, 's'},
+  {"triples", 1, 0, 't'},
+  {NULL, 0, 0, 0}
+};
+#endif
+
+
+static double
+bench_get_seconds(void)
+{
+#ifdef HAVE_GETTIMEOFDAY
+  struct timeval tv;
+
+  gettimeofday(&tv, NULL);
+  return (double)tv.tv_sec + ((double)tv.tv_usec / 1000000.0);
+#else
+  return (double)time(NULL);
+#endif
+}
+
+
+static long
+bench_get_peak_rss_kb(void)
+{
+#ifndef WIN32
+  struct rusage usage;
+
+  if(!getrusage(RUSAGE_SELF, &usage))
+    return usage.ru_maxrss;
+#endif
+  return -1;
+}
+
+
+static void
+bench_report(const char* op, const char* syntax_name,
+             long triples, size_t bytes, double seconds)
+{
+  if(seconds <= 0.0)
+    seconds = 0.000001;
+
+  fprintf(stdout,
+          "op=%s syntax=%s triples=%ld bytes=%lu seconds=%.3f "
+          "triples_per_sec=%.0f mb_per_sec=%.2f peak_rss_kb=%ld\n",
+          op, syntax_name, triples, (unsigned long)bytes, seconds,
+          (double)triples / seconds,
+          ((double)bytes / (1024.0 * 1024.0)) / seconds,
+          bench_get_peak_rss_kb());
+}
+
+
+/* make the Ith synthetic statement; mixes URI, plain, language-tagged
+ * and datatyped literal objects so escaping and term construction
+ * paths are all exercised
+ */
+static raptor_statement*
+bench_make_statement(raptor_world* world, raptor_uri* datatype_uri, long i)
+{
+  raptor_statement* statement;
+  raptor_term* subject;
+  raptor_term* predicate;
+  raptor_term* object;
+  unsigned char buffer[128];
+
+  sprintf((char*)buffer, "http://example.org/subject/s%ld",
+          i % BENCH_SUBJECT_WIDTH);
+  subject = raptor_new_term_from_uri_string(world, buffer);
+  if(!subject)
+    return NULL;
+
+  sprintf((char*)buffer, "http://example.org/vocab/p%ld",
+          i % BENCH_PREDICATE_WIDTH);
+  predicate = raptor_new_term_from_uri_string(world, buffer);
+  if(!predicate) {
+    raptor_free_term(subject);
+    return NULL;
+  }
+
+  switch(i % 4) {
+    case 0:
+      sprintf((char*)buffer, "http://example.org/object/o%ld", i);
+      object = raptor_new_term_from_uri_string(world, buffer);
+      break;
+    case 1:
+      sprintf((char*)buffer, "literal value %ld with \"quotes\"\nand newline",
+              i);
+      object = raptor_new_term_from_literal(world, buffer, NULL, NULL);
+      break;
+    case 2:
+      sprintf((char*)buffer, "literal value %ld", i);
+      object = raptor_new_term_from_literal(world, buffer, NULL,
+                                            (const unsigned char*)"en");
+      break;
+    default:
+      sprintf((char*)buffer, "%ld", i);
+      object = raptor_new_term_from_literal(world, buffer, datatype_uri,
+                                            NULL);
+      break;
+  }
+  if(!object) {
+    raptor_free_term(subject);
+    raptor_free_term(predicate);
+    return NULL;
+  }
+
+  statement = raptor_new_statement_from_nodes(world, subject, predicate,
+                                              object, NULL);
+  return statement;
+}
+
+
+static void
+bench_count_statement(void *user_data, raptor_statement *statement)
+{
+  long* count_p = (long*)user_data;
+
+  (*count_p)++;
+}
+
+
+/* serialize a fresh synthetic corpus to a malloced string;
+ * returns non-0 on failure
+ */
+static int
+bench_serialize(raptor_world* world, const char* syntax_name,
+                long triple_count, void** string_p, size_t* length_p)
+{
+  raptor_serializer* serializer;
+  raptor_iostream* iostr;
+  raptor_uri* base_uri;
+  raptor_uri* datatype_uri;
+  double start;
+  long i;
+  int rc = 1;
+
+  base_uri = raptor_new_uri(world,
+                            (const unsigned char*)"http://example.org/base");
+  datatype_uri = raptor_new_uri(world,
+    (const unsigned char*)"http://www.w3.org/2001/XMLSchema#integer");
+  if(!base_uri || !datatype_uri)
+    goto tidy;
+
+  serializer = raptor_new_serializer(world, syntax_name);
+  if(!serializer)
+    goto tidy;
+
+  iostr = raptor_new_iostream_to_string(world, string_p, length_p, NULL);
+  if(!iostr) {
+    raptor_free_serializer(serializer);
+    goto tidy;
+  }
+
+  start = bench_get_seconds();
+
+  if(raptor_serializer_start_to_iostream(serializer, base_uri, iostr)) {
+    raptor_free_serializer(serializer);
+    raptor_free_iostream(iostr);
+    goto tidy;
+  }
+
+  for(i = 0; i < triple_count; i++) {
+    raptor_statement* statement;
+
+    statement = bench_make_statement(world, datatype_uri, i);
+    if(!statement)
+      break;
+
+    raptor_serializer_serialize_statement(serializer, statement);
+    raptor_free_statement(statement);
+  }
+
+  raptor_serializer_serialize_end(serializer);
+  raptor_free_serializer(serializer);
+  raptor_free_iostream(iostr);
+
+  if(i == triple_count) {
+    bench_report("serialize", syntax_name, triple_count, *length_p,
+                 bench_get_seconds() - start);
+    rc = 0;
+  }
+
+  tidy:
+  if(datatype_uri)
+    raptor_free_uri(datatype_uri);
+  if(base_uri)
+    raptor_free_uri(base_uri);
+
+  return rc;
+}
+
+
+/* parse a serialized corpus back from memory; returns non-0 on failure */
+static int
+bench_parse(raptor_world* world, const char* syntax_name,
+            void* string, size_t length)
+{
+  raptor_parser* parser;
+  raptor_iostream* iostr;
+  raptor_uri* base_uri;
+  long parsed_triples = 0;
+  double start;
+  int rc = 1;
+
+  base_uri = raptor_new_uri(world,
+                            (const unsigned char*)"http://example.org/base");
+  if(!base_uri)
+    return 1;
+
+  parser = raptor_new_parser(world, syntax_name);
+  if(!parser)
+    goto tidy;
+
+  raptor_parser_set_statement_handler(parser, &parsed_triples,
+                                      bench_count_statement);
+
+  iostr = raptor_new_iostream_from_string(world, string, length);
+  if(!iostr) {
+    raptor_free_parser(parser);
+    goto tidy;
+  }
+
+  start = bench_get_seconds();
+
+  rc = raptor_parser_parse_iostream(parser, iostr, base_uri);
+
+  if(!rc)
+    bench_report("parse", syntax_name, parsed_triples, length,
+                 bench_get_seconds() - start);
+
+  raptor_free_iostream(iostr);
+  raptor_free_parser(parser);
+
+  tidy:
+  raptor_free_uri(base_uri);
+
+  return rc;
+}
+
+
+int
+main(int argc, char *argv[])
+{
+  raptor_world* world;
+  long triple_count = BENCH_DEFAULT_TRIPLE_COUNT;
+  const char* only_syntax = NULL;
+  int usage = 0;
+  int help = 0;
+  int failures = 0;
+  int i;
+  char *p;
+
+  program = argv[0];
+  if((p = strrchr(program, '/')))
+    program = p + 1;
+  else if((p = strrchr(program, '\\')))
+    program = p + 1;
+  argv[0] = program;
+
+  world = raptor_new_world();
+  if(!world || raptor_world_open(world))
+    exit(1);
+
+  while(!usage && !help)
+  {
+    int c;
+#ifdef HAVE_GETOPT_LONG
+    int option_index = 0;
+
+    c = getopt_long(argc, argv, GETOPT_STRING, long_options, &option_index);
+#else
+    c = getopt(argc, argv, GETOPT_STRING);
+#endif
+    if(c == -1)
+      break;
+
+    switch(c) {
+      case 0:
+      case '?': /* getopt() - unknown option */
+        usage = 1;
+        break;
+
+      case 'h':
+        help = 1;
+        break;
+
+      case 's':
+        if(optarg)
+          only_syntax = optarg;
+        break;
+
+      case 't':
+        if(optarg) {
+          triple_count = atol(optarg);
+          if(triple_count < 1) {
+            fprintf(stderr, "%s: invalid argument `%s' for `-t'\n",
+                    program, optarg);
+            usage = 1;
+          }
+        }
+        break;
+    }
+  }
+
+  if(usage) {
+    fprintf(stderr, "Try `%s -h' for more information.\n", program);
+    raptor_free_world(world);
+    exit(1);
+  }
+
+  if(help) {
+    puts(title_string);
+    printf("Usage: %s [OPTIONS]\n\n", program);
+    puts("  -h       Print this help, then exit");
+    puts("  -s NAME  Benchmark only syntax NAME (default: all of");
+    fputs("          ", stdout);
+    for(i = 0; bench_syntax_names[i]; i++)
+      printf(" %s", bench_syntax_names[i]);
+    puts(")");
+    printf("  -t N     Number of synthetic triples (default %d)\n",
+           BENCH_DEFAULT_TRIPLE_COUNT);
+    puts("\nOutput is one line per benchmark of key=value pairs for");
+    puts("regression tracking.");
+    raptor_free_world(world);
+    exit(0);
+  }
+
+  for(i = 0; bench_syntax_names[i]; i++) {
+    const char* syntax_name = bench_syntax_names[i];
+    void* string = NULL;
+    size_t length = 0;
+
+    if(only_syntax && strcmp(only_syntax, syntax_name))
+      continue;
+
+    if(!raptor_world_is_serializer_name(world, syntax_name) ||
+       !raptor_world_is_parser_name(world, syntax_name)) {
+      fprintf(stderr, "%s: Skipping syntax %s - not compiled in\n",
+              program, syntax_name);
+      continue;
+    }
+
+    if(bench_serialize(world, syntax_name, triple_count, &string, &length)) {
+      fprintf(stderr, "%s: Serializing %s failed\n", program, syntax_name);
+      failures++;
+    } else if(bench_parse(world, syntax_name, string, length)) {
+      fprintf(stderr, "%s: Parsing %s failed\n", program, syntax_name);
+      failures++;
+    }
+
+    if(string)
+      raptor_free_memory(string);
+  }
+
+  raptor_free_world(world);
+
+  return failures ? 1 : 0;
+}
@@ -73,15 +73,17 @@ extern char *optarg;
 #define RDF_NAMESPACE_URI_LEN 43
 #define ORDINAL_STRING_LEN (RDF_NAMESPACE_URI_LEN + MAX_ASCII_INT_SIZE + 1)
 
-#define GETOPT_STRING "bhf:t:u:"
+#define GETOPT_STRING "behf:m:t:u:"
 
 #ifdef HAVE_GETOPT_LONG
 static const struct option long_options[] =
 {
   /* name, has_arg, flag, val */
   {"brief"       , 0, 0, 'b'},
+  {"external"    , 0, 0, 'e'},
   {"help"        , 0, 0, 'h'},
   {"from-format" , 1, 0, 'f'},
+  {"run-size"    , 1, 0, 'm'},
   {"to-format"   , 1, 0, 't'},
   {"base-uri"    , 1, 0, 'u'},
   {NULL          , 0, 0, 0}
@@ -100,16 +102,26 @@ static const struct option long_options[] =
 
 typedef struct rdfdiff_link_s {
   struct rdfdiff_link_s *next;
+  /* chain within a statement hash bucket */
+  struct rdfdiff_link_s *hash_next;
   raptor_statement *statement;
+  /* found in the other file; skipped when printing leftovers */
+  int matched;
 } rdfdiff_link;
 
 typedef struct rdfdiff_blank_s {
   struct rdfdiff_blank_s *next;
+  /* chain within a signature bucket */
+  struct rdfdiff_blank_s *sig_next;
   raptor_world *world;
   char *blank_id;
   raptor_statement *owner;
   rdfdiff_link *first;
   rdfdiff_link *last;
+  /* order-independent hash of the node's ground triples; equal
+   * subtrees always get equal signatures so only nodes sharing a
+   * signature need the recursive comparison */
+  unsigned int signature;
   int matched;
 } rdfdiff_blank;
 
@@ -119,6 +131,11 @@ typedef struct {
   raptor_parser *parser;
   rdfdiff_link *first;
   rdfdiff_link *last;
+  /* hash table over the ground statements in the first/last list,
+   * chained via rdfdiff_link hash_next */
+  rdfdiff_link **stmt_buckets;
+  unsigned int stmt_bucket_count;
+  int stmt_count;
   rdfdiff_blank *first_blank;
   rdfdiff_blank *last_blank;
   int statement_count;
@@ -128,6 +145,10 @@ typedef struct {
 } rdfdiff_file;
 
 static int brief = 0;
+/* non-0 to compare via external sorted temp runs instead of in memory */
+static int external_mode = 0;
+/* in-memory run budget for external mode (-m, in megabytes) */
+static size_t external_run_bytes = 64 * 1024 * 1024;
 static char *program = NULL;
 static const char * const title_string="Raptor RDF diff utility";
 static int ignore_errors = 0;
@@ -141,6 +162,8 @@ static rdfdiff_file*to_file = NULL;
 static rdfdiff_file* rdfdiff_new_file(raptor_world* world, const unsigned char *name, const char *syntax);
 static void rdfdiff_free_file(rdfdiff_file* file);
 
+static unsigned int rdfdiff_statement_hash(const raptor_statement *statement);
+static int rdfdiff_statement_hash_grow(rdfdiff_file* file);
 static rdfdiff_blank *rdfdiff_find_blank(rdfdiff_blank *first, char *blank_id);
 static rdfdiff_blank *rdfdiff_new_blank(raptor_world *world, char *blank_id);
 static void rdfdiff_free_blank(rdfdiff_blank *blank);
@@ -230,6 +253,9 @@ rdfdiff_free_file(rdfdiff_file* file)
     rdfdiff_free_blank(cur1);
   }
   
+  if(file->stmt_buckets)
+    RAPTOR_FREE(rdfdiff_link**, file->stmt_buckets);
+
   RAPTOR_FREE(rdfdiff_file, file);  
   
 }
@@ -620,8 +646,11 @@ rdfdiff_add_statement(rdfdiff_file* file, raptor_statement *statement)
     dlink->statement = raptor_statement_copy(statement);
 
     if(dlink->statement) {
-      
+      unsigned int bucket;
+
       dlink->next = NULL;
+      dlink->hash_next = NULL;
+      dlink->matched = 0;
 
       if(!file->first) {
         file->first = dlink;
@@ -630,7 +659,21 @@ rdfdiff_add_statement(rdfdiff_file* file, raptor_statement *statement)
         file->last->next = dlink;
         file->last = dlink;
       }
-      
+
+      if(file->stmt_count >= (int)file->stmt_bucket_count) {
+        /* the rehash walks the list and so indexes dlink too */
+        if(rdfdiff_statement_hash_grow(file))
+          rv = 1;
+        else
+          file->stmt_count++;
+      } else {
+        bucket = rdfdiff_statement_hash(dlink->statement) &
+                 (file->stmt_bucket_count - 1);
+        dlink->hash_next = file->stmt_buckets[bucket];
+        file->stmt_buckets[bucket] = dlink;
+        file->stmt_count++;
+      }
+
     } else {
       RAPTOR_FREE(rdfdiff_link, dlink);
       rv = 1;
@@ -648,21 +691,114 @@ rdfdiff_add_statement(rdfdiff_file* file, raptor_statement *statement)
 }
 
 
+/* initial statement hash table size - must be a power of two */
+#define RDFDIFF_INITIAL_BUCKET_COUNT 1024
+
+
+static unsigned int
+rdfdiff_hash_string(unsigned int hash, const unsigned char *string)
+{
+  if(string)
+    while(*string)
+      hash = (hash << 5) + hash + *string++;
+
+  return hash;
+}
+
+
+/*
+ * rdfdiff_statement_hash - hash a ground statement consistently with
+ * rdfdiff_statement_equals()
+ */
+static unsigned int
+rdfdiff_statement_hash(const raptor_statement *statement)
+{
+  unsigned int hash = 5381;
+
+  if(statement->subject->type != RAPTOR_TERM_TYPE_BLANK)
+    hash = rdfdiff_hash_string(hash,
+                               raptor_uri_as_string(statement->subject->value.uri));
+
+  hash = rdfdiff_hash_string(hash,
+                             raptor_uri_as_string(statement->predicate->value.uri));
+
+  if(statement->object->type == RAPTOR_TERM_TYPE_LITERAL) {
+    hash = rdfdiff_hash_string(hash, statement->object->value.literal.string);
+    hash = rdfdiff_hash_string(hash, statement->object->value.literal.language);
+    if(statement->object->value.literal.datatype)
+      hash = rdfdiff_hash_string(hash,
+                                 raptor_uri_as_string(statement->object->value.literal.datatype));
+  } else if(statement->object->type != RAPTOR_TERM_TYPE_BLANK)
+    hash = rdfdiff_hash_string(hash,
+                               raptor_uri_as_string(statement->object->value.uri));
+
+  return hash;
+}
+
+
+/* double the statement hash table, rehashing from the statement list */
+static int
+rdfdiff_statement_hash_grow(rdfdiff_file* file)
+{
+  unsigned int new_count;
+  rdfdiff_link **new_buckets;
+  rdfdiff_link *cur;
+
+  new_count = file->stmt_bucket_count << 1;
+  if(!new_count)
+    new_count = RDFDIFF_INITIAL_BUCKET_COUNT;
+
+  new_buckets = RAPTOR_CALLOC(rdfdiff_link**, new_count,
+                              sizeof(rdfdiff_link*));
+  if(!new_buckets)
+    return 1;
+
+  for(cur = file->first; cur; cur = cur->next) {
+    unsigned int bucket;
+
+    bucket = rdfdiff_statement_hash(cur->statement) & (new_count - 1);
+    cur->hash_next = new_buckets[bucket];
+    new_buckets[bucket] = cur;
+  }
+
+  if(file->stmt_buckets)
+    RAPTOR_FREE(rdfdiff_link**, file->stmt_buckets);
+  file->stmt_buckets = new_buckets;
+  file->stmt_bucket_count = new_count;
+
+  return 0;
+}
+
+
+/*
+ * rdfdiff_statement_find - look up a ground statement in the file's
+ * statement hash; if remove is non-0 the found link is also unlinked
+ * from its bucket so it cannot match twice
+ */
 static rdfdiff_link*
 rdfdiff_statement_find(rdfdiff_file* file, const raptor_statement *statement,
-                       rdfdiff_link** prev_p)
+                       int remove)
 {
+  rdfdiff_link* cur;
   rdfdiff_link* prev = NULL;
-  rdfdiff_link* cur = file->first;
-  
-  while(cur) {
+  unsigned int bucket;
+
+  if(!file->stmt_buckets)
+    return NULL;
+
+  bucket = rdfdiff_statement_hash(statement) & (file->stmt_bucket_count - 1);
+  for(cur = file->stmt_buckets[bucket]; cur; cur = cur->hash_next) {
     if(rdfdiff_statement_equals(file->world, cur->statement, statement)) {
-      if(prev_p)
-        *prev_p=prev;
+      if(remove) {
+        if(prev)
+          prev->hash_next = cur->hash_next;
+        else
+          file->stmt_buckets[bucket] = cur->hash_next;
+        cur->hash_next = NULL;
+      }
       return cur;
     }
     prev = cur;
-    cur = cur->next;
   }
 
   return NULL;
@@ -672,10 +808,105 @@ rdfdiff_statement_find(rdfdiff_file* file, const raptor_statement *statement,
 static int
 rdfdiff_statement_exists(rdfdiff_file* file, const raptor_statement *statement)
 {
-  rdfdiff_link* node;
-  rdfdiff_link* prev = NULL;
-  node = rdfdiff_statement_find(file, statement, &prev);
-  return (node != NULL);
+  return (rdfdiff_statement_find(file, statement, 0) != NULL);
+}
+
+
+/*
+ * rdfdiff_blank_signature - hash the ground triples of a blank node
+ *
+ * Mixes only the parts that rdfdiff_blank_equals() compares exactly:
+ * the owner arc's non-blank terms and, per contained statement, the
+ * predicate and any non-blank object.  Blank terms contribute a fixed
+ * marker since the recursion matches them structurally.  Statement
+ * hashes are summed so the signature is independent of arrival order.
+ */
+static unsigned int
+rdfdiff_blank_signature(const rdfdiff_blank *blank)
+{
+  unsigned int sig = 5381;
+  rdfdiff_link *cur;
+
+  if(blank->owner) {
+    if(blank->owner->subject->type == RAPTOR_TERM_TYPE_BLANK)
+      sig = rdfdiff_hash_string(sig, (const unsigned char *)"<blank>");
+    else
+      sig = rdfdiff_hash_string(sig,
+                                raptor_uri_as_string(blank->owner->subject->value.uri));
+    sig = rdfdiff_hash_string(sig,
+                              raptor_uri_as_string(blank->owner->predicate->value.uri));
+  }
+
+  for(cur = blank->first; cur; cur = cur->next) {
+    const raptor_statement *statement = cur->statement;
+    unsigned int stmt_sig = 5381;
+
+    stmt_sig = rdfdiff_hash_string(stmt_sig,
+                                   raptor_uri_as_string(statement->predicate->value.uri));
+
+    if(statement->object->type == RAPTOR_TERM_TYPE_LITERAL) {
+      stmt_sig = rdfdiff_hash_string(stmt_sig,
+                                     statement->object->value.literal.string);
+      stmt_sig = rdfdiff_hash_string(stmt_sig,
+                                     statement->object->value.literal.language);
+      if(statement->object->value.literal.datatype)
+        stmt_sig = rdfdiff_hash_string(stmt_sig,
+                                       raptor_uri_as_string(statement->object->value.literal.datatype));
+    } else if(statement->object->type == RAPTOR_TERM_TYPE_BLANK)
+      stmt_sig = rdfdiff_hash_string(stmt_sig,
+                                     (const unsigned char *)"<blank>");
+    else
+      stmt_sig = rdfdiff_hash_string(stmt_sig,
+                                     raptor_uri_as_string(statement->object->value.uri));
+
+    sig += stmt_sig;
+  }
+
+  return sig;
+}
+
+
+/*
+ * rdfdiff_file_signature_blanks - signature every blank node of a
+ * file and bucket them by signature
+ *
+ * Returns the bucket array (power-of-two sized, chained through
+ * sig_next) for the caller to free, storing its size in
+ * *bucket_count_p, or NULL when the file has no blank nodes or on
+ * allocation failure; the caller falls back to the full scan then.
+ */
+static rdfdiff_blank **
+rdfdiff_file_signature_blanks(rdfdiff_file* file,
+                              unsigned int *bucket_count_p)
+{
+  rdfdiff_blank **buckets;
+  rdfdiff_blank *blank;
+  unsigned int bucket_count = 1;
+  int count = 0;
+
+  for(blank = file->first_blank; blank; blank = blank->next) {
+    blank->signature = rdfdiff_blank_signature(blank);
+    count++;
+  }
+
+  if(!count)
+    return NULL;
+
+  while((int)bucket_count < count)
+    bucket_count <<= 1;
+
+  buckets = RAPTOR_CALLOC(rdfdiff_blank**, bucket_count, sizeof(*buckets));
+  if(!buckets)
+    return NULL;
+
+  for(blank = file->first_blank; blank; blank = blank->next) {
+    unsigned int bucket = blank->signature & (bucket_count - 1);
+    blank->sig_next = buckets[bucket];
+    buckets[bucket] = blank;
+  }
+
+  *bucket_count_p = bucket_count;
+  return buckets;
 }
 
 
@@ -710,7 +941,416 @@ rdfdiff_collect_statements(void *user_data, raptor_statement *statement)
   if(rv != 0) {
     raptor_parser_parse_abort(file->parser);
   }
-  
+
+}
+
+
+/*
+ * External (sorted-run) comparison mode.
+ *
+ * Instead of holding both files' statements in memory, each input is
+ * streamed through canonical N-Triples rendering into in-memory runs
+ * of at most external_run_bytes, each run sorted and spilled to a
+ * temporary file, then the two merged sorted streams are walked once
+ * emitting the lines present on only one side.  Memory use is bounded
+ * by the run budget regardless of input size; the trade-off is that
+ * blank nodes are compared by label rather than by graph isomorphism.
+ */
+
+typedef struct {
+  raptor_world *world;
+  /* lines of the run being accumulated */
+  char **lines;
+  size_t line_count;
+  size_t line_capacity;
+  /* bytes held by the current run's lines */
+  size_t bytes;
+  /* one temporary file per sorted run */
+  FILE **runs;
+  int run_count;
+  int failed;
+} rdfdiff_run_set;
+
+/* merged duplicate-free sorted view over a run set's temp files */
+typedef struct {
+  FILE **runs;
+  int run_count;
+  /* current line of each run, NULL at end of run */
+  char **heads;
+  /* line most recently returned */
+  char *current;
+} rdfdiff_merge;
+
+
+static int
+rdfdiff_line_compare(const void *a, const void *b)
+{
+  return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+
+/* sort the accumulated run, spill it to a temporary file (duplicates
+ * dropped) and release the lines */
+static int
+rdfdiff_run_set_flush(rdfdiff_run_set *rs)
+{
+  FILE *f;
+  FILE **new_runs;
+  size_t i;
+  const char *prev = NULL;
+
+  if(!rs->line_count)
+    return 0;
+
+  qsort(rs->lines, rs->line_count, sizeof(char*), rdfdiff_line_compare);
+
+  f = tmpfile();
+  if(!f)
+    return 1;
+
+  for(i = 0; i < rs->line_count; i++) {
+    if(!prev || strcmp(prev, rs->lines[i])) {
+      fputs(rs->lines[i], f);
+      putc('\n', f);
+    }
+    prev = rs->lines[i];
+  }
+
+  for(i = 0; i < rs->line_count; i++)
+    raptor_free_memory(rs->lines[i]);
+  rs->line_count = 0;
+  rs->bytes = 0;
+
+  if(fflush(f) || fseek(f, 0L, SEEK_SET)) {
+    fclose(f);
+    return 1;
+  }
+
+  new_runs = (FILE**)realloc(rs->runs, (rs->run_count + 1) * sizeof(FILE*));
+  if(!new_runs) {
+    fclose(f);
+    return 1;
+  }
+  new_runs[rs->run_count] = f;
+  rs->runs = new_runs;
+  rs->run_count++;
+
+  return 0;
+}
+
+
+/*
+ * rdfdiff_external_collect_statements - Called when parsing either
+ * file in external mode to render statements into sorted runs.
+ */
+static void
+rdfdiff_external_collect_statements(void *user_data,
+                                    raptor_statement *statement)
+{
+  rdfdiff_run_set *rs = (rdfdiff_run_set*)user_data;
+  raptor_iostream *iostr;
+  void *line = NULL;
+  size_t len = 0;
+
+  if(rs->failed)
+    return;
+
+  iostr = raptor_new_iostream_to_string(rs->world, &line, &len, NULL);
+  if(!iostr) {
+    rs->failed = 1;
+    return;
+  }
+  if(raptor_statement_ntriples_write(statement, iostr, 1)) {
+    raptor_free_iostream(iostr);
+    rs->failed = 1;
+    return;
+  }
+  raptor_free_iostream(iostr);
+  if(!line) {
+    rs->failed = 1;
+    return;
+  }
+
+  /* drop the trailing newline so a line is a plain string */
+  if(len && ((char*)line)[len - 1] == '\n')
+    ((char*)line)[--len] = '\0';
+
+  if(rs->line_count == rs->line_capacity) {
+    size_t new_capacity = rs->line_capacity ? (rs->line_capacity << 1) : 4096;
+    char **new_lines;
+
+    new_lines = (char**)realloc(rs->lines, new_capacity * sizeof(char*));
+    if(!new_lines) {
+      raptor_free_memory(line);
+      rs->failed = 1;
+      return;
+    }
+    rs->lines = new_lines;
+    rs->line_capacity = new_capacity;
+  }
+  rs->lines[rs->line_count++] = (char*)line;
+  rs->bytes += len + 1 + sizeof(char*);
+
+  if(rs->bytes >= external_run_bytes && rdfdiff_run_set_flush(rs))
+    rs->failed = 1;
+}
+
+
+static void
+rdfdiff_run_set_finish(rdfdiff_run_set *rs)
+{
+  size_t i;
+  int j;
+
+  for(i = 0; i < rs->line_count; i++)
+    raptor_free_memory(rs->lines[i]);
+  if(rs->lines)
+    free(rs->lines);
+
+  for(j = 0; j < rs->run_count; j++)
+    fclose(rs->runs[j]);
+  if(rs->runs)
+    free(rs->runs);
+}
+
+
+/* read one newline-terminated line, or NULL at end of file */
+static char *
+rdfdiff_read_line(FILE *f)
+{
+  size_t capacity = 128;
+  size_t len = 0;
+  char *line;
+  int c;
+
+  c = getc(f);
+  if(c == EOF)
+    return NULL;
+
+  line = (char*)malloc(capacity);
+  if(!line)
+    return NULL;
+
+  while(c != EOF && c != '\n') {
+    if(len + 1 == capacity) {
+      char *new_line = (char*)realloc(line, capacity << 1);
+
+      if(!new_line) {
+        free(line);
+        return NULL;
+      }
+      line = new_line;
+      capacity <<= 1;
+    }
+    line[len++] = (char)c;
+    c = getc(f);
+  }
+  line[len] = '\0';
+
+  return line;
+}
+
+
+static int
+rdfdiff_merge_init(rdfdiff_merge *m, rdfdiff_run_set *rs)
+{
+  int i;
+
+  m->runs = rs->runs;
+  m->run_count = rs->run_count;
+  m->heads = NULL;
+  m->current = NULL;
+
+  if(m->run_count) {
+    m->heads = (char**)calloc(m->run_count, sizeof(char*));
+    if(!m->heads)
+      return 1;
+    for(i = 0; i < m->run_count; i++)
+      m->heads[i] = rdfdiff_read_line(m->runs[i]);
+  }
+
+  return 0;
+}
+
+
+/* next distinct line in merged sorted order, or NULL when exhausted.
+ * The returned string is valid until the next call */
+static const char *
+rdfdiff_merge_next(rdfdiff_merge *m)
+{
+  for(;;) {
+    int i;
+    int min = -1;
+
+    for(i = 0; i < m->run_count; i++) {
+      if(m->heads[i] &&
+         (min < 0 || strcmp(m->heads[i], m->heads[min]) < 0))
+        min = i;
+    }
+    if(min < 0) {
+      if(m->current)
+        free(m->current);
+      m->current = NULL;
+      return NULL;
+    }
+
+    if(m->current && !strcmp(m->heads[min], m->current)) {
+      /* duplicate straddling two runs */
+      free(m->heads[min]);
+      m->heads[min] = rdfdiff_read_line(m->runs[min]);
+      continue;
+    }
+
+    if(m->current)
+      free(m->current);
+    m->current = m->heads[min];
+    m->heads[min] = rdfdiff_read_line(m->runs[min]);
+    return m->current;
+  }
+}
+
+
+static void
+rdfdiff_merge_finish(rdfdiff_merge *m)
+{
+  int i;
+
+  for(i = 0; i < m->run_count; i++) {
+    if(m->heads[i])
+      free(m->heads[i]);
+  }
+  if(m->heads)
+    free(m->heads);
+  if(m->current)
+    free(m->current);
+  m->current = NULL;
+}
+
+
+static int
+rdfdiff_run_set_parse(rdfdiff_run_set *rs, raptor_uri *uri,
+                      const char *syntax, raptor_uri *base_uri)
+{
+  raptor_parser *parser;
+  int rv = 0;
+
+  parser = raptor_new_parser(rs->world, syntax);
+  if(!parser) {
+    fprintf(stderr, "%s: Failed to create raptor parser type %s for %s\n",
+            program, syntax, raptor_uri_as_string(uri));
+    return 1;
+  }
+
+  raptor_parser_set_statement_handler(parser, rs,
+                                      rdfdiff_external_collect_statements);
+
+  if(raptor_parser_parse_uri(parser, uri, base_uri)) {
+    fprintf(stderr, "%s: Failed to parse URI %s as %s content\n", program,
+            raptor_uri_as_string(uri), syntax);
+    rv = 1;
+  }
+
+  raptor_free_parser(parser);
+
+  if(!rv && (rs->failed || rdfdiff_run_set_flush(rs))) {
+    fprintf(stderr, "%s: Out of memory or temporary file failure\n", program);
+    rv = 1;
+  }
+
+  return rv;
+}
+
+
+/*
+ * rdfdiff_compare_external - compare two inputs via sorted temp runs
+ *
+ * Returns 0 when identical, 1 when different or on parse failure.
+ */
+static int
+rdfdiff_compare_external(raptor_world *world,
+                         raptor_uri *from_uri, const char *from_syntax,
+                         raptor_uri *to_uri, const char *to_syntax,
+                         raptor_uri *base_uri)
+{
+  rdfdiff_run_set from_rs;
+  rdfdiff_run_set to_rs;
+  rdfdiff_merge from_merge;
+  rdfdiff_merge to_merge;
+  const char *from_name = (const char*)raptor_uri_as_string(from_uri);
+  const char *to_name = (const char*)raptor_uri_as_string(to_uri);
+  const char *a;
+  const char *b;
+  int difference_count = 0;
+  int rv = 0;
+
+  memset(&from_rs, 0, sizeof(from_rs));
+  memset(&to_rs, 0, sizeof(to_rs));
+  from_rs.world = world;
+  to_rs.world = world;
+
+  if(rdfdiff_run_set_parse(&from_rs, from_uri, from_syntax, base_uri) ||
+     /* Note intentional from_uri as base_uri */
+     rdfdiff_run_set_parse(&to_rs, to_uri, to_syntax,
+                           base_uri ? base_uri : from_uri)) {
+    rv = 1;
+    goto tidy;
+  }
+
+  if(rdfdiff_merge_init(&from_merge, &from_rs) ||
+     rdfdiff_merge_init(&to_merge, &to_rs)) {
+    rdfdiff_merge_finish(&from_merge);
+    rdfdiff_merge_finish(&to_merge);
+    rv = 1;
+    goto tidy;
+  }
+
+  a = rdfdiff_merge_next(&from_merge);
+  b = rdfdiff_merge_next(&to_merge);
+  while(a || b) {
+    int cmp = (a && b) ? strcmp(a, b) : (a ? -1 : 1);
+
+    if(!cmp) {
+      a = rdfdiff_merge_next(&from_merge);
+      b = rdfdiff_merge_next(&to_merge);
+    } else if(cmp < 0) {
+      if(!brief) {
+        if(emit_to_header) {
+          fprintf(stderr, "Statements in %s but not in %s\n",
+                  from_name, to_name);
+          emit_to_header = 0;
+        }
+        fprintf(stderr, ">    %s\n", a);
+      }
+      difference_count++;
+      a = rdfdiff_merge_next(&from_merge);
+    } else {
+      if(!brief) {
+        if(emit_from_header) {
+          fprintf(stderr, "Statements in %s but not in %s\n",
+                  to_name, from_name);
+          emit_from_header = 0;
+        }
+        fprintf(stderr, "<    %s\n", b);
+      }
+      difference_count++;
+      b = rdfdiff_merge_next(&to_merge);
+    }
+  }
+
+  rdfdiff_merge_finish(&from_merge);
+  rdfdiff_merge_finish(&to_merge);
+
+  if(difference_count) {
+    if(brief)
+      fprintf(stderr, "Files differ\n");
+    rv = 1;
+  }
+
+  tidy:
+  rdfdiff_run_set_finish(&from_rs);
+  rdfdiff_run_set_finish(&to_rs);
+
+  return rv;
 }
 
 
@@ -772,10 +1412,26 @@ main(int argc, char *argv[])
         brief = 1;
         break;
 
+      case 'e':
+        external_mode = 1;
+        break;
+
       case 'h':
         help = 1;
         break;
 
+      case 'm':
+        if(optarg) {
+          long megs = atol(optarg);
+          if(megs < 1) {
+            fprintf(stderr, "%s: Bad run size %s - expected megabytes >= 1\n",
+                    program, optarg);
+            usage = 1;
+          } else
+            external_run_bytes = (size_t)megs * 1024 * 1024;
+        }
+        break;
+
       case 'f':
         if(optarg)
           from_syntax = optarg;
@@ -819,6 +1475,8 @@ main(int argc, char *argv[])
     puts("\nOPTIONS:");
     puts(HELP_TEXT("h", "help                      ", "Print this help, then exit"));
     puts(HELP_TEXT("b", "brief                     ", "Report only whether files differ"));
+    puts(HELP_TEXT("e", "external                  ", "Compare via sorted temporary files with bounded memory" HELP_PAD "(blank nodes compared by label, not isomorphism)"));
+    puts(HELP_TEXT("m MB", "run-size MB            ", "Set external mode in-memory run size in megabytes (default 64)"));
     puts(HELP_TEXT("u BASE-URI", "base-uri BASE-URI  ", "Set the base URI for the files"));
     puts(HELP_TEXT("f FORMAT",   "from-format FORMAT ", "Format of <from URI> (default is rdfxml)"));
     puts(HELP_TEXT("t FORMAT",   "to-format FORMAT   ", "Format of <to URI> (default is rdfxml)"));
@@ -865,6 +1523,12 @@ main(int argc, char *argv[])
     goto exit;
   }
 
+  if(external_mode) {
+    rv = rdfdiff_compare_external(world, from_uri, from_syntax,
+                                  to_uri, to_syntax, base_uri);
+    goto exit;
+  }
+
   /* create and init "from" data structures */
   from_file = rdfdiff_new_file(world, from_string, from_syntax);
   if(!from_file) {
@@ -906,17 +1570,10 @@ main(int argc, char *argv[])
   cur = to_file->first;
   while(cur) {
     rdfdiff_link* node;
-    rdfdiff_link* prev;
-    node = rdfdiff_statement_find(from_file, cur->statement, &prev);
+    node = rdfdiff_statement_find(from_file, cur->statement, 1);
     if(node) {
-      /* exists in from file - remove it from the list */
-      if(from_file->first == node) {
-        from_file->first = node->next;
-      } else {
-        prev->next = node->next;
-      }
-      raptor_free_statement(node->statement);
-      RAPTOR_FREE(rdfdiff_link, node);
+      /* exists in from file - mark it matched */
+      node->matched = 1;
     } else {
       if(!brief) {
         if(emit_from_header) {
@@ -936,22 +1593,40 @@ main(int argc, char *argv[])
   }
 
   
-  /* Now compare the blank nodes */
+  /* Now compare the blank nodes.  A signature pre-pass buckets the
+   * from file's blank nodes by a hash of their ground triples so each
+   * to-file node is only compared recursively against candidates with
+   * identical ground content, instead of against every blank node. */
+  {
+    unsigned int sig_bucket_count = 0;
+    rdfdiff_blank **sig_buckets;
+
+    sig_buckets = rdfdiff_file_signature_blanks(from_file,
+                                                &sig_bucket_count);
+
   b1 = to_file->first_blank;
   while(b1) {
 
-    rdfdiff_blank *b2 = from_file->first_blank;
+    rdfdiff_blank *b2;
+
+    b1->signature = rdfdiff_blank_signature(b1);
+
+    if(sig_buckets)
+      b2 = sig_buckets[b1->signature & (sig_bucket_count - 1)];
+    else
+      b2 = from_file->first_blank;
 
     while(b2) {
 
-      if(!b2->matched && rdfdiff_blank_equals(b1, b2, to_file, from_file)) {
+      if(!b2->matched && b2->signature == b1->signature &&
+         rdfdiff_blank_equals(b1, b2, to_file, from_file)) {
         b1->matched = 1;
         b2->matched = 1;
         break;
       }
-      
-      b2 = b2->next;
-      
+
+      b2 = sig_buckets ? b2->sig_next : b2->next;
+
     }
 
     if(b2 == 0) {
@@ -972,34 +1647,35 @@ main(int argc, char *argv[])
       
       to_file->difference_count++;
     }
-    
+
     b1 = b1->next;
 
   }
-  
-  if(from_file->first) {
-    /* The entrys left in from_file have not been found in to_file. */
-    if(!brief) {
-
-      if(emit_to_header) {
-        fprintf(stderr, "Statements in %s but not in %s\n",  from_file->name,
-                to_file->name);
-        emit_to_header = 0;
-      }
-      
-      cur = from_file->first;
-      while(cur) {
-        if(!brief) {
-          fprintf(stderr, ">    ");
-          raptor_statement_print_as_ntriples(cur->statement, stderr);
-          fprintf(stderr, "\n");
+
+    if(sig_buckets)
+      RAPTOR_FREE(rdfdiff_blank**, sig_buckets);
+  }
+
+  /* The unmatched entries left in from_file were not found in to_file. */
+  cur = from_file->first;
+  while(cur) {
+    if(!cur->matched) {
+      if(!brief) {
+        if(emit_to_header) {
+          fprintf(stderr, "Statements in %s but not in %s\n",  from_file->name,
+                  to_file->name);
+          emit_to_header = 0;
         }
-      
-        cur = cur->next;
-        from_file->difference_count++;
+
+        fprintf(stderr, ">    ");
+        raptor_statement_print_as_ntriples(cur->statement, stderr);
+        fprintf(stderr, "\n");
       }
+
+      from_file->difference_count++;
     }
 
+    cur = cur->next;
   }
 
   if(from_file->first_blank) {